@@ -3,6 +3,8 @@
 #include "wh/callbacks/callbacks.hpp"
 #include "wh/callbacks/interface.hpp"
 #include "wh/callbacks/manager.hpp"
+#include "wh/callbacks/span_exporter.hpp"
+#include "wh/callbacks/span_sinks.hpp"
 #include "wh/callbacks/template_helper.hpp"
 
 auto main() -> int { return 0; }
@@ -9,13 +9,16 @@
 #include "wh/core/error_domain.hpp"
 #include "wh/core/function.hpp"
 #include "wh/core/json.hpp"
+#include "wh/core/metrics.hpp"
 #include "wh/core/reflect.hpp"
 #include "wh/core/result.hpp"
 #include "wh/core/resume_state.hpp"
 #include "wh/core/run_context.hpp"
+#include "wh/core/small_string.hpp"
 #include "wh/core/small_vector.hpp"
 #include "wh/core/stdexec.hpp"
 #include "wh/core/type_traits.hpp"
 #include "wh/core/type_utils.hpp"
+#include "wh/core/versioned.hpp"
 
 auto main() -> int { return 0; }
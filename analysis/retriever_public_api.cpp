@@ -1,4 +1,5 @@
 #include "wh/retriever/callback_event.hpp"
+#include "wh/retriever/filter.hpp"
 #include "wh/retriever/options.hpp"
 #include "wh/retriever/retriever.hpp"
 
@@ -1,5 +1,7 @@
 #include "wh/output/output_parser.hpp"
 #include "wh/sync/async_mutex.hpp"
+#include "wh/sync/async_semaphore.hpp"
+#include "wh/sync/async_shared_mutex.hpp"
 #include "wh/workflow/workflow.hpp"
 
 auto main() -> int { return 0; }
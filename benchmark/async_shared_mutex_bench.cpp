@@ -0,0 +1,126 @@
+#include <cstddef>
+#include <cstdint>
+#include <latch>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <exec/start_detached.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include "wh/sync/async_semaphore.hpp"
+#include "wh/sync/async_shared_mutex.hpp"
+
+namespace {
+
+constexpr std::uint32_t pool_threads = 4U;
+constexpr std::size_t task_count = 4096U;
+constexpr std::size_t catalog_size = 256U;
+
+/// Read-mostly state standing in for a tool catalog or index snapshot.
+struct catalog {
+  std::vector<std::uint64_t> entries = std::vector<std::uint64_t>(catalog_size, 1U);
+
+  [[nodiscard]] auto read() const -> std::uint64_t {
+    return std::accumulate(entries.begin(), entries.end(), std::uint64_t{0U});
+  }
+
+  auto write(const std::size_t index) -> void { ++entries[index % entries.size()]; }
+};
+
+[[nodiscard]] auto is_write(const std::size_t index, const std::int64_t writes_per_hundred)
+    -> bool {
+  return static_cast<std::int64_t>(index % 100U) < writes_per_hundred;
+}
+
+auto BM_shared_mutex_std_blocking(benchmark::State &state) -> void {
+  exec::static_thread_pool pool{pool_threads};
+  auto scheduler = pool.get_scheduler();
+  const auto writes = state.range(0);
+  std::shared_mutex mutex{};
+  catalog data{};
+  for (auto _ : state) {
+    std::latch done{static_cast<std::ptrdiff_t>(task_count)};
+    for (std::size_t index = 0U; index < task_count; ++index) {
+      exec::start_detached(stdexec::then(stdexec::schedule(scheduler), [&, index]() noexcept {
+        if (is_write(index, writes)) {
+          std::unique_lock lock{mutex};
+          data.write(index);
+        } else {
+          std::shared_lock lock{mutex};
+          benchmark::DoNotOptimize(data.read());
+        }
+        done.count_down();
+      }));
+    }
+    done.wait();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(task_count));
+}
+
+auto BM_shared_mutex_async(benchmark::State &state) -> void {
+  using mutex_t = wh::sync::async_shared_mutex;
+  exec::static_thread_pool pool{pool_threads};
+  auto scheduler = pool.get_scheduler();
+  const auto writes = state.range(0);
+  mutex_t mutex{};
+  catalog data{};
+  for (auto _ : state) {
+    std::latch done{static_cast<std::ptrdiff_t>(task_count)};
+    for (std::size_t index = 0U; index < task_count; ++index) {
+      if (is_write(index, writes)) {
+        exec::start_detached(stdexec::starts_on(
+            scheduler, stdexec::then(mutex.lock(), [&, index](mutex_t::lock_guard guard) noexcept {
+              data.write(index);
+              guard.unlock();
+              done.count_down();
+            })));
+      } else {
+        exec::start_detached(stdexec::starts_on(
+            scheduler,
+            stdexec::then(mutex.lock_shared(), [&](mutex_t::shared_lock_guard guard) noexcept {
+              benchmark::DoNotOptimize(data.read());
+              guard.unlock();
+              done.count_down();
+            })));
+      }
+    }
+    done.wait();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(task_count));
+}
+
+auto BM_semaphore_async_acquire(benchmark::State &state) -> void {
+  using semaphore_t = wh::sync::async_semaphore;
+  exec::static_thread_pool pool{pool_threads};
+  auto scheduler = pool.get_scheduler();
+  semaphore_t semaphore{static_cast<std::size_t>(state.range(0))};
+  catalog data{};
+  for (auto _ : state) {
+    std::latch done{static_cast<std::ptrdiff_t>(task_count)};
+    for (std::size_t index = 0U; index < task_count; ++index) {
+      exec::start_detached(stdexec::starts_on(
+          scheduler, stdexec::then(semaphore.acquire(), [&](semaphore_t::permit permit) noexcept {
+            benchmark::DoNotOptimize(data.read());
+            permit.release();
+            done.count_down();
+          })));
+    }
+    done.wait();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(task_count));
+}
+
+BENCHMARK(BM_shared_mutex_std_blocking)->Arg(0)->Arg(5)->Arg(50)->UseRealTime();
+
+BENCHMARK(BM_shared_mutex_async)->Arg(0)->Arg(5)->Arg(50)->UseRealTime();
+
+BENCHMARK(BM_semaphore_async_acquire)->Arg(1)->Arg(4)->Arg(64)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,159 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/callbacks/callbacks.hpp"
+#include "wh/core/component.hpp"
+#include "wh/retriever/callback_event.hpp"
+
+namespace {
+
+constexpr char query_text[] = "how do interned metadata keys reduce retrieval latency";
+constexpr char filter_text[] = "lang == 'cpp' and score >= 0.25";
+constexpr std::size_t hit_count = 8U;
+
+struct retriever_state {
+  wh::callbacks::run_info run_info{};
+  wh::retriever::retriever_callback_event event{};
+};
+
+enum class listener_mode : std::int64_t {
+  no_runtime = 0,
+  empty_manager,
+  other_stage,
+  listening,
+};
+
+[[nodiscard]] auto mode_label(const listener_mode mode) -> const char * {
+  switch (mode) {
+  case listener_mode::no_runtime:
+    return "no_runtime";
+  case listener_mode::empty_manager:
+    return "empty_manager";
+  case listener_mode::other_stage:
+    return "other_stage";
+  case listener_mode::listening:
+    return "listening";
+  }
+  return "";
+}
+
+[[nodiscard]] auto make_context(const listener_mode mode, std::size_t &observed)
+    -> wh::core::run_context {
+  wh::core::run_context context{};
+  if (mode == listener_mode::no_runtime) {
+    return context;
+  }
+  context.callbacks.emplace();
+  context.callbacks->metadata.trace_id = "trace-bench";
+  context.callbacks->metadata.node_path = wh::core::address{"graph", "retriever"};
+  if (mode == listener_mode::empty_manager) {
+    return context;
+  }
+  const auto stage = mode == listener_mode::other_stage ? wh::callbacks::stage::stream_end
+                                                        : wh::callbacks::stage::end;
+  wh::core::stage_callbacks callbacks{};
+  const auto record = [&observed](const wh::core::callback_stage,
+                                  const wh::core::callback_event_view,
+                                  const wh::core::callback_run_info &info) {
+    observed += info.trace_id.size();
+  };
+  callbacks.on_end = record;
+  callbacks.on_stream_end = record;
+  context.callbacks->manager.register_local_callbacks(
+      wh::callbacks::make_callback_config(
+          [stage](const wh::callbacks::stage current) noexcept { return current == stage; }),
+      std::move(callbacks));
+  return context;
+}
+
+[[nodiscard]] auto make_state(const wh::core::component_options &options) -> retriever_state {
+  retriever_state state{};
+  state.run_info.name = "Retriever";
+  state.run_info.type = "Retriever";
+  state.run_info.component = wh::core::component_kind::retriever;
+  state.run_info = wh::core::apply_component_run_info(std::move(state.run_info), options);
+  state.event.top_k = hit_count;
+  state.event.filter = filter_text;
+  state.event.extra = query_text;
+  return state;
+}
+
+// Mirrors the wrapper flow before lazy callback state: the state is always
+// built, the sink copies metadata, and every emission re-applies it.
+auto eager_emit(const wh::callbacks::callback_sink &sink, const wh::callbacks::stage stage,
+                const retriever_state &state) -> void {
+  const auto *sink_manager = sink.manager_ptr();
+  if (sink_manager == nullptr) {
+    return;
+  }
+  if (const auto *metadata = sink.metadata_ptr(); metadata != nullptr) {
+    sink_manager->dispatch(stage, wh::core::make_callback_event_view(state.event),
+                           wh::core::apply_callback_run_metadata(state.run_info, *metadata));
+    return;
+  }
+  sink_manager->dispatch(stage, wh::core::make_callback_event_view(state.event), state.run_info);
+}
+
+[[nodiscard]] auto eager_sink(const wh::core::run_context &context)
+    -> wh::callbacks::callback_sink {
+  wh::callbacks::callback_sink sink{};
+  if (context.callbacks.has_value()) {
+    sink.borrowed = &context.callbacks->manager;
+    if (!context.callbacks->metadata.empty()) {
+      sink.metadata = context.callbacks->metadata;
+    }
+  }
+  return sink;
+}
+
+auto run_eager(const wh::core::run_context &context, const wh::core::component_options &options,
+               const std::vector<int> &hits) -> std::size_t {
+  const auto sink = eager_sink(context);
+  auto state = make_state(options);
+  eager_emit(sink, wh::callbacks::stage::start, state);
+  state.event.extra = std::to_string(hits.size());
+  eager_emit(sink, wh::callbacks::stage::end, state);
+  return hits.size();
+}
+
+auto run_lazy(const wh::core::run_context &context, const wh::core::component_options &options,
+              const std::vector<int> &hits) -> std::size_t {
+  const auto sink = wh::callbacks::borrow_callback_sink(context);
+  auto state = wh::callbacks::make_lazy_callback_state(sink, [&] { return make_state(options); });
+  wh::callbacks::emit(sink, wh::callbacks::stage::start, state);
+  if (state.has_value() && sink.active(wh::callbacks::stage::end)) {
+    state->event.extra = std::to_string(hits.size());
+  }
+  wh::callbacks::emit(sink, wh::callbacks::stage::end, state);
+  return hits.size();
+}
+
+template <auto run_t> auto run_wrapper(benchmark::State &state) -> void {
+  const auto mode = static_cast<listener_mode>(state.range(0));
+  state.SetLabel(mode_label(mode));
+  std::size_t observed = 0U;
+  const auto context = make_context(mode, observed);
+  wh::core::component_options options{};
+  options.set_base(wh::core::component_common_options{.span_id = "span-bench"});
+  const std::vector<int> hits(hit_count, 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(run_t(context, options, hits));
+  }
+  benchmark::DoNotOptimize(observed);
+}
+
+// One retriever-shaped call: start and end emissions around a no-op body.
+auto BM_callback_wrapper_eager(benchmark::State &state) -> void { run_wrapper<run_eager>(state); }
+
+auto BM_callback_wrapper_lazy(benchmark::State &state) -> void { run_wrapper<run_lazy>(state); }
+
+BENCHMARK(BM_callback_wrapper_eager)->DenseRange(0, 3)->Unit(benchmark::kNanosecond);
+
+BENCHMARK(BM_callback_wrapper_lazy)->DenseRange(0, 3)->Unit(benchmark::kNanosecond);
+
+} // namespace
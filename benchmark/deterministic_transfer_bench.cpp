@@ -0,0 +1,100 @@
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/adk/deterministic_transfer.hpp"
+
+namespace {
+
+constexpr std::size_t handoffs_per_session = 10U;
+constexpr std::size_t reply_bytes = 256U;
+constexpr std::array<std::string_view, 4U> swarm_agents{"triage", "research", "coder", "review"};
+constexpr wh::adk::resolved_transfer_trim_options trim{
+    .trim_assistant_transfer_message = true,
+    .trim_tool_transfer_pair = true,
+};
+
+[[nodiscard]] auto make_text_message(const wh::schema::message_role role,
+                                     const std::string_view name, const std::size_t turn)
+    -> wh::schema::message {
+  wh::schema::message message{};
+  message.role = role;
+  message.name = std::string{name};
+  message.parts.emplace_back(
+      wh::schema::text_part{std::string(reply_bytes, 'x') + std::to_string(turn)});
+  return message;
+}
+
+// Appends one swarm turn: a user message plus the active agent's reply.
+auto append_turn(std::vector<wh::schema::message> &history, const std::string_view agent,
+                 const std::size_t turn) -> void {
+  history.push_back(make_text_message(wh::schema::message_role::user, {}, turn));
+  history.push_back(make_text_message(wh::schema::message_role::assistant, agent, turn));
+}
+
+// Appends the stamped transfer pair emitted when `agent` hands off to `target`.
+auto append_handoff(std::vector<wh::schema::message> &history, const std::string_view agent,
+                    const std::string_view target, const std::size_t turn) -> void {
+  const auto call_id = "call-" + std::to_string(turn);
+  history.push_back(wh::adk::make_transfer_assistant_message(target, call_id));
+  history.back().name = std::string{agent};
+  history.push_back(wh::adk::make_transfer_tool_message(target, call_id));
+  history.back().name = std::string{agent};
+}
+
+// Arg is the turn count; each iteration runs one swarm session with a fixed number of
+// handoffs and rewrites the history for every new active agent.
+template <typename rewrite_t>
+auto run_swarm_session(benchmark::State &state, rewrite_t &&rewrite) -> void {
+  const auto turns = static_cast<std::size_t>(state.range(0));
+  const auto turns_per_handoff = turns / handoffs_per_session;
+  for (auto _ : state) {
+    std::vector<wh::schema::message> history{};
+    std::size_t active = 0U;
+    for (std::size_t turn = 1U; turn <= turns; ++turn) {
+      append_turn(history, swarm_agents[active], turn);
+      if (turn % turns_per_handoff != 0U) {
+        continue;
+      }
+      const auto next = (active + 1U) % swarm_agents.size();
+      append_handoff(history, swarm_agents[active], swarm_agents[next], turn);
+      active = next;
+      auto request = rewrite(history, swarm_agents[active]);
+      benchmark::DoNotOptimize(request);
+    }
+  }
+}
+
+auto BM_transfer_history_full_rewrite(benchmark::State &state) -> void {
+  run_swarm_session(state, [](const std::vector<wh::schema::message> &history,
+                              const std::string_view agent) {
+    return wh::adk::rewrite_transfer_history(history, agent, trim);
+  });
+}
+
+auto BM_transfer_history_view_rewrite(benchmark::State &state) -> void {
+  wh::adk::transfer_history_view view{};
+  run_swarm_session(state, [&view](const std::vector<wh::schema::message> &history,
+                                   const std::string_view agent) {
+    return view.rewrite(history, agent, trim);
+  });
+}
+
+// Overlay-only cost: what a handoff pays before the request is materialized.
+auto BM_transfer_history_view_overlay(benchmark::State &state) -> void {
+  wh::adk::transfer_history_view view{};
+  run_swarm_session(state, [&view](const std::vector<wh::schema::message> &history,
+                                   const std::string_view agent) {
+    return view.overlay(history, agent, trim).size();
+  });
+}
+
+BENCHMARK(BM_transfer_history_full_rewrite)->Arg(50)->Arg(200)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_transfer_history_view_rewrite)->Arg(50)->Arg(200)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_transfer_history_view_overlay)->Arg(50)->Arg(200)->Unit(benchmark::kMicrosecond);
+
+} // namespace
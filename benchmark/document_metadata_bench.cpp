@@ -0,0 +1,199 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/document/keys.hpp"
+#include "wh/schema/document.hpp"
+
+namespace {
+
+constexpr std::size_t route_count = 3U;
+constexpr char sub_index_text[] = "primary";
+constexpr char dsl_text[] = "lang:cpp";
+
+// Mirrors the document layout used before metadata was flattened.
+class map_document {
+public:
+  explicit map_document(std::string content) : content_(std::move(content)) {}
+
+  [[nodiscard]] auto content() const noexcept -> const std::string & { return content_; }
+
+  template <typename value_t> auto set(const std::string_view key, value_t &&value) -> void {
+    if (!metadata_) {
+      metadata_.emplace();
+    }
+    metadata_->insert_or_assign(std::string{key}, wh::schema::document_metadata_value{
+                                                      std::forward<value_t>(value)});
+  }
+
+  template <typename value_t>
+  [[nodiscard]] auto get(const std::string_view key) const -> const value_t * {
+    if (!metadata_) {
+      return nullptr;
+    }
+    const auto iter = metadata_->find(key);
+    return iter == metadata_->end() ? nullptr : std::get_if<value_t>(&iter->second);
+  }
+
+  [[nodiscard]] auto score() const -> double {
+    const auto *typed = get<double>(wh::schema::document_metadata_keys::score);
+    return typed == nullptr ? 0.0 : *typed;
+  }
+
+  [[nodiscard]] auto sub_index() const -> std::string {
+    const auto *typed = get<std::string>(wh::schema::document_metadata_keys::sub_index);
+    return typed == nullptr ? std::string{} : *typed;
+  }
+
+  [[nodiscard]] auto parent_id() const -> const std::string * {
+    return get<std::string>(wh::document::parent_id_metadata_key);
+  }
+
+private:
+  std::string content_{};
+  std::optional<wh::schema::document_metadata_map> metadata_{};
+};
+
+struct flat_document_ops {
+  using document_type = wh::schema::document;
+
+  [[nodiscard]] static auto make(std::string content, const double score,
+                                 std::string parent_id) -> document_type {
+    static const auto parent_key =
+        wh::schema::make_document_metadata_key(wh::document::parent_id_metadata_key);
+    static const auto lang_key = wh::schema::make_document_metadata_key("lang");
+    document_type document{std::move(content)};
+    document.with_score(score).with_sub_index(sub_index_text).with_dsl(dsl_text);
+    document.set_metadata(parent_key, std::move(parent_id));
+    document.set_metadata(lang_key, std::string{"en"});
+    return document;
+  }
+
+  [[nodiscard]] static auto keep(const document_type &document) -> bool {
+    return document.score() >= 0.1 && document.sub_index_view() == sub_index_text;
+  }
+
+  [[nodiscard]] static auto score(const document_type &document) -> double {
+    return document.score();
+  }
+
+  [[nodiscard]] static auto parent_id(const document_type &document) -> const std::string * {
+    static const auto parent_key =
+        wh::schema::make_document_metadata_key(wh::document::parent_id_metadata_key);
+    return document.metadata_ptr<std::string>(parent_key);
+  }
+
+  static auto set_score(document_type &document, const double score) -> void {
+    document.with_score(score);
+  }
+};
+
+struct map_document_ops {
+  using document_type = map_document;
+
+  [[nodiscard]] static auto make(std::string content, const double score,
+                                 std::string parent_id) -> document_type {
+    document_type document{std::move(content)};
+    document.set(wh::schema::document_metadata_keys::score, score);
+    document.set(wh::schema::document_metadata_keys::sub_index, std::string{sub_index_text});
+    document.set(wh::schema::document_metadata_keys::dsl, std::string{dsl_text});
+    document.set(wh::document::parent_id_metadata_key, std::move(parent_id));
+    document.set("lang", std::string{"en"});
+    return document;
+  }
+
+  [[nodiscard]] static auto keep(const document_type &document) -> bool {
+    return document.score() >= 0.1 && document.sub_index() == sub_index_text;
+  }
+
+  [[nodiscard]] static auto score(const document_type &document) -> double {
+    return document.score();
+  }
+
+  [[nodiscard]] static auto parent_id(const document_type &document) -> const std::string * {
+    return document.parent_id();
+  }
+
+  static auto set_score(document_type &document, const double score) -> void {
+    document.set(wh::schema::document_metadata_keys::score, score);
+  }
+};
+
+// Retrieves `candidates` hits per route, filters them, fuses the routes with
+// reciprocal-rank scoring and collects parent ids of the fused top hits.
+template <typename ops_t> auto run_retrieve_and_fuse(const std::size_t candidates) -> std::size_t {
+  using document_t = typename ops_t::document_type;
+  std::vector<std::vector<document_t>> routes(route_count);
+  for (std::size_t route = 0U; route < route_count; ++route) {
+    auto &hits = routes[route];
+    hits.reserve(candidates);
+    for (std::size_t index = 0U; index < candidates; ++index) {
+      const auto id = (index * (route + 1U)) % candidates;
+      hits.push_back(ops_t::make("chunk-" + std::to_string(id),
+                                 1.0 - static_cast<double>(index) / static_cast<double>(candidates),
+                                 "parent-" + std::to_string(id / 8U)));
+    }
+    std::erase_if(hits, [](const document_t &document) { return !ops_t::keep(document); });
+  }
+
+  std::unordered_map<std::string_view, std::pair<double, const document_t *>> fused{};
+  fused.reserve(candidates);
+  for (const auto &hits : routes) {
+    for (std::size_t rank = 0U; rank < hits.size(); ++rank) {
+      auto &slot = fused[hits[rank].content()];
+      slot.first += 1.0 / (static_cast<double>(rank) + 60.0);
+      slot.second = &hits[rank];
+    }
+  }
+
+  std::vector<document_t> ranked{};
+  ranked.reserve(fused.size());
+  for (const auto &[content, entry] : fused) {
+    auto document = *entry.second;
+    ops_t::set_score(document, entry.first);
+    ranked.push_back(std::move(document));
+  }
+  std::ranges::sort(ranked, [](const document_t &left, const document_t &right) {
+    return ops_t::score(left) > ops_t::score(right);
+  });
+
+  std::size_t parents = 0U;
+  for (const auto &document : ranked) {
+    if (const auto *parent = ops_t::parent_id(document); parent != nullptr) {
+      parents += parent->size();
+    }
+  }
+  return parents;
+}
+
+auto BM_document_metadata_map(benchmark::State &state) -> void {
+  const auto candidates = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(run_retrieve_and_fuse<map_document_ops>(candidates));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(candidates * route_count));
+}
+
+auto BM_document_metadata_flat(benchmark::State &state) -> void {
+  const auto candidates = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(run_retrieve_and_fuse<flat_document_ops>(candidates));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(candidates * route_count));
+}
+
+BENCHMARK(BM_document_metadata_map)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_document_metadata_flat)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,110 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <stdexec/execution.hpp>
+
+#include "wh/compose/graph.hpp"
+#include "wh/compose/runtime/checkpoint.hpp"
+#include "wh/compose/runtime/checkpoint_parking.hpp"
+#include "wh/core/run_context.hpp"
+#include "wh/schema/message/types.hpp"
+
+namespace {
+
+constexpr char checkpoint_id[] = "hitl-session";
+
+using history = std::vector<wh::schema::message>;
+
+[[nodiscard]] auto make_history(const std::size_t turns) -> history {
+  history messages{};
+  messages.reserve(turns);
+  for (std::size_t turn = 0U; turn < turns; ++turn) {
+    wh::schema::message message{};
+    message.role = turn % 2U == 0U ? wh::schema::message_role::user
+                                   : wh::schema::message_role::assistant;
+    message.parts.emplace_back(
+        wh::schema::text_part{"turn " + std::to_string(turn) + std::string(256U, 'x')});
+    messages.push_back(std::move(message));
+  }
+  return messages;
+}
+
+// One pass-through node: the checkpoint carries the whole history as entry input.
+[[nodiscard]] auto make_graph() -> wh::compose::graph {
+  wh::compose::graph graph{};
+  static_cast<void>(graph.add_lambda(
+      "approve",
+      [](wh::compose::graph_value &input, wh::core::run_context &,
+         const wh::compose::graph_call_scope &) -> wh::core::result<wh::compose::graph_value> {
+        return std::move(input);
+      }));
+  static_cast<void>(graph.add_entry_edge("approve"));
+  static_cast<void>(graph.add_exit_edge("approve"));
+  static_cast<void>(graph.compile());
+  return graph;
+}
+
+[[nodiscard]] auto invoke(wh::compose::graph &graph, wh::compose::graph_input input,
+                          wh::compose::graph_invoke_controls controls,
+                          const wh::compose::graph_runtime_services &services) -> bool {
+  wh::core::run_context context{};
+  wh::compose::graph_invoke_request request{};
+  request.input = std::move(input);
+  request.controls = std::move(controls);
+  request.services = std::addressof(services);
+  auto waited = stdexec::sync_wait(graph.invoke(context, std::move(request)));
+  return waited.has_value() && std::get<0>(*waited).has_value() &&
+         std::get<0>(*waited).value().output_status.has_value();
+}
+
+// One interrupt (persist) followed by one resume (restore) of the same run.
+auto round_trip(benchmark::State &state, const wh::compose::graph_runtime_services &services)
+    -> void {
+  auto graph = make_graph();
+  const auto messages = make_history(static_cast<std::size_t>(state.range(0)));
+  wh::compose::graph_invoke_controls interrupt_controls{};
+  interrupt_controls.checkpoint.save =
+      wh::compose::checkpoint_save_options{.checkpoint_id = std::string{checkpoint_id}};
+  wh::compose::graph_invoke_controls resume_controls{};
+  resume_controls.checkpoint.load =
+      wh::compose::checkpoint_load_options{.checkpoint_id = std::string{checkpoint_id}};
+  for (auto _ : state) {
+    auto interrupted = invoke(graph, wh::compose::graph_input::value(wh::core::any{messages}),
+                              interrupt_controls, services);
+    auto resumed = invoke(graph, wh::compose::graph_input::restore_checkpoint(),
+                          resume_controls, services);
+    if (!interrupted || !resumed) {
+      state.SkipWithError("interrupt/resume round trip failed");
+      return;
+    }
+  }
+}
+
+// Arg is the history length carried by the parked run.
+auto BM_interrupt_resume_checkpoint_store(benchmark::State &state) -> void {
+  wh::compose::checkpoint_store store{};
+  wh::compose::graph_runtime_services services{};
+  services.checkpoint.store = std::addressof(store);
+  round_trip(state, services);
+}
+
+auto BM_interrupt_resume_parked(benchmark::State &state) -> void {
+  wh::compose::checkpoint_store store{};
+  wh::compose::checkpoint_parking_lot parking{wh::compose::checkpoint_parking_options{
+      .durable_store = std::addressof(store),
+  }};
+  wh::compose::graph_runtime_services services{};
+  services.checkpoint.backend = parking.backend();
+  round_trip(state, services);
+}
+
+BENCHMARK(BM_interrupt_resume_checkpoint_store)->Arg(16)->Arg(128)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_interrupt_resume_parked)->Arg(16)->Arg(128)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,105 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/core/metrics.hpp"
+
+namespace {
+
+constexpr char baseline_label[] = "no_metrics";
+constexpr char shared_label[] = "single_atomic";
+constexpr char sharded_label[] = "sharded";
+
+/// Stand-in for the work done around one recorded event.
+[[nodiscard]] auto simulated_work(const std::uint64_t seed) -> std::uint64_t {
+  auto value = seed * 0x9E3779B97F4A7C15ULL;
+  value ^= value >> 29U;
+  return value;
+}
+
+std::atomic<std::uint64_t> shared_counter{0U};
+wh::core::metric_counter sharded_counter{};
+wh::core::metric_gauge depth_gauge{};
+wh::core::metric_histogram latency_histogram{};
+
+auto BM_metrics_baseline(benchmark::State &state) -> void {
+  std::uint64_t seed = 0U;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(simulated_work(++seed));
+  }
+  state.SetLabel(baseline_label);
+}
+
+auto BM_metrics_counter_single_atomic(benchmark::State &state) -> void {
+  std::uint64_t seed = 0U;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(simulated_work(++seed));
+    shared_counter.fetch_add(1U, std::memory_order_relaxed);
+  }
+  state.SetLabel(shared_label);
+}
+
+auto BM_metrics_counter_sharded(benchmark::State &state) -> void {
+  std::uint64_t seed = 0U;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(simulated_work(++seed));
+    sharded_counter.add();
+  }
+  state.SetLabel(sharded_label);
+}
+
+auto BM_metrics_gauge_add(benchmark::State &state) -> void {
+  std::uint64_t seed = 0U;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(simulated_work(++seed));
+    depth_gauge.add(1);
+    depth_gauge.add(-1);
+  }
+}
+
+auto BM_metrics_histogram_record(benchmark::State &state) -> void {
+  std::uint64_t seed = 0U;
+  for (auto _ : state) {
+    const auto sample = simulated_work(++seed);
+    benchmark::DoNotOptimize(sample);
+    latency_histogram.record_nanos(sample & 0xFFFFFU);
+  }
+}
+
+auto BM_metrics_histogram_record_elapsed(benchmark::State &state) -> void {
+  for (auto _ : state) {
+    const auto started = std::chrono::steady_clock::now();
+    benchmark::DoNotOptimize(simulated_work(static_cast<std::uint64_t>(state.iterations())));
+    wh::core::record_elapsed(&latency_histogram, started);
+  }
+}
+
+auto BM_metrics_prometheus_encode(benchmark::State &state) -> void {
+  wh::core::metrics_registry registry{};
+  for (std::int64_t index = 0; index < state.range(0); ++index) {
+    const auto node = std::to_string(index);
+    static_cast<void>(wh::core::make_graph_node_metrics(registry, "bench", node));
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(wh::core::encode_prometheus_text(registry));
+  }
+}
+
+BENCHMARK(BM_metrics_baseline)->Threads(1)->Threads(4)->Unit(benchmark::kNanosecond);
+
+BENCHMARK(BM_metrics_counter_single_atomic)->Threads(1)->Threads(4)->Unit(benchmark::kNanosecond);
+
+BENCHMARK(BM_metrics_counter_sharded)->Threads(1)->Threads(4)->Unit(benchmark::kNanosecond);
+
+BENCHMARK(BM_metrics_gauge_add)->Threads(1)->Threads(4)->Unit(benchmark::kNanosecond);
+
+BENCHMARK(BM_metrics_histogram_record)->Threads(1)->Threads(4)->Unit(benchmark::kNanosecond);
+
+BENCHMARK(BM_metrics_histogram_record_elapsed)->Threads(1)->Unit(benchmark::kNanosecond);
+
+BENCHMARK(BM_metrics_prometheus_encode)->Arg(16)->Arg(256)->Unit(benchmark::kMicrosecond);
+
+} // namespace
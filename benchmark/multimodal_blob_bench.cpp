@@ -0,0 +1,150 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/schema/message/types.hpp"
+
+namespace {
+
+constexpr std::size_t image_bytes = 192U * 1024U;
+constexpr std::size_t distinct_images = 4U;
+constexpr std::size_t handoff_copies = 8U;
+constexpr char data_uri_prefix[] = "data:image/png;base64,";
+
+using history = std::vector<wh::schema::message>;
+
+[[nodiscard]] auto image_data_uri(const std::size_t index) -> std::string {
+  const std::string bytes(image_bytes, static_cast<char>('a' + (index % distinct_images)));
+  return data_uri_prefix + wh::schema::encode_base64(bytes);
+}
+
+// One user turn per image, cycling through a few screenshots as agents re-attach them.
+[[nodiscard]] auto make_history(const std::size_t turns) -> history {
+  history messages{};
+  messages.reserve(turns);
+  for (std::size_t turn = 0U; turn < turns; ++turn) {
+    wh::schema::message message{};
+    message.parts.emplace_back(wh::schema::text_part{"describe this screenshot"});
+    message.parts.emplace_back(wh::schema::image_part{.uri = image_data_uri(turn)});
+    messages.push_back(std::move(message));
+  }
+  return messages;
+}
+
+[[nodiscard]] auto make_interned_history(const std::size_t turns) -> history {
+  wh::schema::media_blob_store store{};
+  auto messages = make_history(turns);
+  for (auto &message : messages) {
+    static_cast<void>(wh::schema::intern_message_media(message, store));
+  }
+  return messages;
+}
+
+// Heap bytes owned by one copy of the history's media payloads.
+[[nodiscard]] auto owned_media_bytes(const history &messages) -> std::size_t {
+  std::size_t total = 0U;
+  for (const auto &message : messages) {
+    for (const auto &part : message.parts) {
+      if (const auto *image = std::get_if<wh::schema::image_part>(&part); image != nullptr) {
+        total += image->uri.size();
+      }
+    }
+  }
+  return total;
+}
+
+// Distinct media bytes kept alive by shared blobs across any number of copies.
+[[nodiscard]] auto shared_media_bytes(const history &messages) -> std::size_t {
+  wh::schema::media_blob_table table{};
+  for (const auto &message : messages) {
+    for (const auto &part : message.parts) {
+      if (const auto *image = std::get_if<wh::schema::image_part>(&part); image != nullptr) {
+        static_cast<void>(table.reference(image->data));
+      }
+    }
+  }
+  return table.payload_bytes();
+}
+
+// Arg is the conversation turn count; each iteration hands the history through
+// `handoff_copies` agents.
+auto BM_multimodal_handoff_inline(benchmark::State &state) -> void {
+  const auto source = make_history(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    for (std::size_t copy = 0U; copy < handoff_copies; ++copy) {
+      auto handed_off = source;
+      benchmark::DoNotOptimize(handed_off);
+    }
+  }
+  state.counters["media_bytes_per_copy"] = static_cast<double>(owned_media_bytes(source));
+  state.counters["resident_media_bytes"] =
+      static_cast<double>(owned_media_bytes(source) * (handoff_copies + 1U));
+}
+
+auto BM_multimodal_handoff_blob(benchmark::State &state) -> void {
+  const auto source = make_interned_history(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    for (std::size_t copy = 0U; copy < handoff_copies; ++copy) {
+      auto handed_off = source;
+      benchmark::DoNotOptimize(handed_off);
+    }
+  }
+  state.counters["media_bytes_per_copy"] = static_cast<double>(owned_media_bytes(source));
+  state.counters["resident_media_bytes"] = static_cast<double>(shared_media_bytes(source));
+}
+
+// Bytes a checkpoint writes for media: every occurrence inline versus one
+// table entry per distinct blob.
+auto BM_multimodal_checkpoint_inline(benchmark::State &state) -> void {
+  const auto source = make_history(static_cast<std::size_t>(state.range(0)));
+  std::size_t written = 0U;
+  for (auto _ : state) {
+    written = 0U;
+    for (const auto &message : source) {
+      for (const auto &part : message.parts) {
+        if (const auto *image = std::get_if<wh::schema::image_part>(&part); image != nullptr) {
+          std::string encoded = image->uri;
+          written += encoded.size();
+          benchmark::DoNotOptimize(encoded);
+        }
+      }
+    }
+  }
+  state.counters["media_bytes_written"] = static_cast<double>(written);
+}
+
+auto BM_multimodal_checkpoint_blob(benchmark::State &state) -> void {
+  const auto source = make_interned_history(static_cast<std::size_t>(state.range(0)));
+  std::size_t written = 0U;
+  for (auto _ : state) {
+    wh::schema::media_blob_table table{};
+    written = 0U;
+    for (const auto &message : source) {
+      for (const auto &part : message.parts) {
+        if (const auto *image = std::get_if<wh::schema::image_part>(&part); image != nullptr) {
+          const auto id = table.reference(image->data);
+          written += id.size();
+        }
+      }
+    }
+    table.for_each([&written](std::string_view, const wh::schema::media_blob &blob) {
+      auto encoded = blob.to_base64();
+      written += encoded.size();
+      benchmark::DoNotOptimize(encoded);
+    });
+  }
+  state.counters["media_bytes_written"] = static_cast<double>(written);
+}
+
+BENCHMARK(BM_multimodal_handoff_inline)->Arg(8)->Arg(32)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_multimodal_handoff_blob)->Arg(8)->Arg(32)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_multimodal_checkpoint_inline)->Arg(8)->Arg(32)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_multimodal_checkpoint_blob)->Arg(8)->Arg(32)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,114 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/adk/run_path.hpp"
+
+namespace {
+
+constexpr std::size_t tokens_per_stream = 512U;
+constexpr std::size_t token_bytes = 8U;
+
+// Path fields an ADK token event carries through each nesting level.
+struct token_event {
+  std::string text{};
+  wh::adk::run_path path{};
+  wh::adk::run_path_prefix path_prefix{};
+};
+
+// One scope path per nesting level, shaped like an agent-tool call location.
+[[nodiscard]] auto make_levels(const std::size_t depth) -> std::vector<wh::adk::run_path> {
+  std::vector<wh::adk::run_path> levels{};
+  levels.reserve(depth);
+  for (std::size_t level = 0U; level < depth; ++level) {
+    levels.emplace_back("tool", "delegate-" + std::to_string(level), "call-1", "agent",
+                        "worker-" + std::to_string(level));
+  }
+  return levels;
+}
+
+[[nodiscard]] auto make_token() -> token_event {
+  return token_event{
+      .text = std::string(token_bytes, 't'),
+      .path = wh::adk::run_path{"agent", "leaf"},
+  };
+}
+
+// Rebuilds the path one appended segment at a time, copying it per segment.
+[[nodiscard]] auto append_each_segment(const wh::adk::run_path &prefix,
+                                       const wh::adk::run_path &suffix) -> wh::adk::run_path {
+  auto combined = prefix;
+  for (const auto &segment : suffix.segments()) {
+    combined = combined.append(segment);
+  }
+  return combined;
+}
+
+// Arg is the nesting depth; every level rewrites the path segment by segment.
+auto BM_nested_run_path_append_each(benchmark::State &state) -> void {
+  const auto levels = make_levels(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    for (std::size_t token = 0U; token < tokens_per_stream; ++token) {
+      auto event = make_token();
+      for (auto level = levels.rbegin(); level != levels.rend(); ++level) {
+        event.path = append_each_segment(*level, event.path);
+      }
+      benchmark::DoNotOptimize(event);
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(tokens_per_stream));
+}
+
+// Every level materializes the full path in one linear pass.
+auto BM_nested_run_path_eager(benchmark::State &state) -> void {
+  const auto levels = make_levels(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    for (std::size_t token = 0U; token < tokens_per_stream; ++token) {
+      auto event = make_token();
+      for (auto level = levels.rbegin(); level != levels.rend(); ++level) {
+        event.path = wh::adk::append_run_path_prefix(*level, event.path);
+      }
+      benchmark::DoNotOptimize(event);
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(tokens_per_stream));
+}
+
+// Every level defers its scope through a forwarder; the root consumer only
+// compares the full path in place, as transfer routing does.
+auto BM_nested_run_path_forwarded(benchmark::State &state) -> void {
+  const auto levels = make_levels(static_cast<std::size_t>(state.range(0)));
+  wh::adk::run_path expected{"agent", "leaf"};
+  for (auto level = levels.rbegin(); level != levels.rend(); ++level) {
+    expected = wh::adk::append_run_path_prefix(*level, expected);
+  }
+  std::size_t matched = 0U;
+  for (auto _ : state) {
+    std::vector<wh::adk::run_path_forwarder> forwarders(levels.begin(), levels.end());
+    for (std::size_t token = 0U; token < tokens_per_stream; ++token) {
+      auto event = make_token();
+      for (auto level = forwarders.rbegin(); level != forwarders.rend(); ++level) {
+        event.path_prefix = level->forward(event.path_prefix);
+      }
+      matched += event.path_prefix.matches(event.path, expected) ? 1U : 0U;
+      benchmark::DoNotOptimize(event);
+    }
+  }
+  const auto tokens = static_cast<std::int64_t>(state.iterations()) *
+                      static_cast<std::int64_t>(tokens_per_stream);
+  state.counters["match_rate"] =
+      tokens == 0 ? 0.0 : static_cast<double>(matched) / static_cast<double>(tokens);
+  state.SetItemsProcessed(tokens);
+}
+
+BENCHMARK(BM_nested_run_path_append_each)->DenseRange(4, 8, 2)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_nested_run_path_eager)->DenseRange(4, 8, 2)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_nested_run_path_forwarded)->DenseRange(4, 8, 2)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,135 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/flow/retrieval/parent_cache.hpp"
+
+namespace {
+
+constexpr std::size_t parent_count = 10000U;
+constexpr std::size_t parents_per_query = 8U;
+constexpr std::size_t query_count = 4096U;
+constexpr std::size_t content_bytes = 2048U;
+constexpr double zipf_exponent = 1.1;
+constexpr char parent_prefix[] = "parent-";
+constexpr auto store_round_trip = std::chrono::microseconds{20};
+
+using loaded_documents = wh::core::result<std::vector<wh::schema::document>>;
+
+// Backing store the loader copies from, standing in for a document database.
+[[nodiscard]] auto parent_store() -> const std::vector<wh::schema::document> & {
+  static const auto store = [] {
+    std::vector<wh::schema::document> documents{};
+    documents.reserve(parent_count);
+    for (std::size_t index = 0U; index < parent_count; ++index) {
+      const auto parent_id = parent_prefix + std::to_string(index);
+      wh::schema::document document{std::string(content_bytes, 'a' + (index % 26U))};
+      document.set_metadata(std::string{wh::flow::retrieval::parent_id_metadata_key}, parent_id);
+      document.set_metadata("source", std::string{"bench"});
+      documents.push_back(std::move(document));
+    }
+    return documents;
+  }();
+  return store;
+}
+
+// Fixed-seed queries whose parent ids follow a Zipf distribution over ranks.
+[[nodiscard]] auto zipf_queries() -> const std::vector<std::vector<std::string>> & {
+  static const auto queries = [] {
+    std::vector<double> cdf(parent_count);
+    double total = 0.0;
+    for (std::size_t rank = 0U; rank < parent_count; ++rank) {
+      total += 1.0 / std::pow(static_cast<double>(rank + 1U), zipf_exponent);
+      cdf[rank] = total;
+    }
+    std::mt19937_64 engine{42U};
+    std::uniform_real_distribution<double> uniform{0.0, total};
+    std::vector<std::vector<std::string>> generated(query_count);
+    for (auto &parent_ids : generated) {
+      while (parent_ids.size() < parents_per_query) {
+        const auto rank = static_cast<std::size_t>(
+            std::ranges::lower_bound(cdf, uniform(engine)) - cdf.begin());
+        auto parent_id = parent_prefix + std::to_string(std::min(rank, parent_count - 1U));
+        if (std::ranges::find(parent_ids, parent_id) == parent_ids.end()) {
+          parent_ids.push_back(std::move(parent_id));
+        }
+      }
+    }
+    return generated;
+  }();
+  return queries;
+}
+
+// Spins for one store round trip, then copies the requested parents.
+auto load_parents(const std::vector<std::string> &parent_ids) -> loaded_documents {
+  const auto deadline = std::chrono::steady_clock::now() + store_round_trip;
+  while (std::chrono::steady_clock::now() < deadline) {
+  }
+  const auto &store = parent_store();
+  std::vector<wh::schema::document> documents{};
+  documents.reserve(parent_ids.size());
+  for (const auto &parent_id : parent_ids) {
+    const auto index = std::stoul(parent_id.substr(sizeof(parent_prefix) - 1U));
+    documents.push_back(store[index]);
+  }
+  return documents;
+}
+
+auto BM_parent_load_uncached(benchmark::State &state) -> void {
+  const auto &queries = zipf_queries();
+  std::size_t next = 0U;
+  for (auto _ : state) {
+    auto loaded = load_parents(queries[next]);
+    benchmark::DoNotOptimize(loaded);
+    next = (next + 1U) % queries.size();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(parents_per_query));
+}
+
+// Arg is the cache capacity in parent documents.
+auto BM_parent_load_cached(benchmark::State &state) -> void {
+  static std::unique_ptr<wh::flow::retrieval::parent_document_cache> cache{};
+  if (state.thread_index() == 0) {
+    const auto one = wh::flow::retrieval::parent_document_bytes(parent_store().front());
+    cache = std::make_unique<wh::flow::retrieval::parent_document_cache>(
+        wh::flow::retrieval::parent_cache_options{
+            .max_bytes = one * static_cast<std::size_t>(state.range(0))});
+  }
+  const auto &queries = zipf_queries();
+  auto next = static_cast<std::size_t>(state.thread_index()) * 97U % queries.size();
+  for (auto _ : state) {
+    auto loaded = cache->get_or_load(queries[next], load_parents);
+    benchmark::DoNotOptimize(loaded);
+    next = (next + 1U) % queries.size();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(parents_per_query));
+  if (state.thread_index() == 0) {
+    const auto stats = cache->stats();
+    const auto lookups = stats.hits + stats.misses + stats.coalesced;
+    state.counters["hit_rate"] =
+        lookups == 0U ? 0.0 : static_cast<double>(stats.hits) / static_cast<double>(lookups);
+    cache.reset();
+  }
+}
+
+BENCHMARK(BM_parent_load_uncached)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_parent_load_cached)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(5000)
+    ->Threads(1)
+    ->Threads(4)
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
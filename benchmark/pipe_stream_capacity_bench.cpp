@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/schema/stream/pipe.hpp"
+
+namespace {
+
+using token_writer = wh::schema::stream::pipe_stream_writer<std::string>;
+using token_reader = wh::schema::stream::pipe_stream_reader<std::string>;
+
+constexpr std::size_t session_count = 10'000U;
+constexpr std::size_t fixed_capacity = 64U;
+constexpr wh::core::ring_capacity_policy adaptive_capacity{.initial = 8U, .max = 1024U};
+constexpr char token_text[] = "token";
+
+[[nodiscard]] auto make_session(const bool adaptive) -> std::pair<token_writer, token_reader> {
+  if (adaptive) {
+    return wh::schema::stream::make_pipe_stream<std::string>(adaptive_capacity);
+  }
+  return wh::schema::stream::make_pipe_stream<std::string>(fixed_capacity);
+}
+
+auto drain(token_reader &reader) -> std::size_t {
+  std::size_t drained = 0U;
+  for (;;) {
+    auto next = reader.try_read();
+    auto *result = std::get_if<wh::schema::stream::stream_result<
+        wh::schema::stream::stream_chunk<std::string>>>(&next);
+    if (result == nullptr || result->has_error() || result->value().eof) {
+      return drained;
+    }
+    ++drained;
+  }
+}
+
+[[nodiscard]] auto ring_bytes(const wh::core::ring_capacity_stats &stats) -> std::size_t {
+  return stats.allocated * sizeof(std::string);
+}
+
+// Ten thousand sessions that receive one event and then sit idle.
+auto BM_pipe_stream_idle_sessions(benchmark::State &state) -> void {
+  const auto adaptive = state.range(0) != 0;
+  state.SetLabel(adaptive ? "adaptive" : "fixed_64");
+  std::size_t bytes = 0U;
+  for (auto _ : state) {
+    std::vector<std::pair<token_writer, token_reader>> sessions{};
+    sessions.reserve(session_count);
+    for (std::size_t index = 0U; index < session_count; ++index) {
+      auto &session = sessions.emplace_back(make_session(adaptive));
+      if (index % 4U == 0U) {
+        static_cast<void>(session.first.try_write(std::string{token_text}));
+        static_cast<void>(drain(session.second));
+      }
+    }
+    bytes = 0U;
+    for (const auto &session : sessions) {
+      bytes += ring_bytes(session.second.capacity_stats());
+    }
+    benchmark::DoNotOptimize(bytes);
+  }
+  state.counters["ring_bytes"] = static_cast<double>(bytes);
+}
+
+// Fast producers emit token bursts; the consumer drains only every few bursts.
+auto BM_pipe_stream_hot_sessions(benchmark::State &state) -> void {
+  const auto adaptive = state.range(0) != 0;
+  const auto burst = static_cast<std::size_t>(state.range(1));
+  constexpr std::size_t hot_sessions = 256U;
+  constexpr std::size_t rounds = 8U;
+  state.SetLabel(adaptive ? "adaptive" : "fixed_64");
+
+  std::uint64_t stalls = 0U;
+  std::size_t bytes = 0U;
+  std::size_t high_water = 0U;
+  for (auto _ : state) {
+    std::vector<std::pair<token_writer, token_reader>> sessions{};
+    sessions.reserve(hot_sessions);
+    for (std::size_t index = 0U; index < hot_sessions; ++index) {
+      sessions.push_back(make_session(adaptive));
+    }
+    for (std::size_t round = 0U; round < rounds; ++round) {
+      for (auto &[writer, reader] : sessions) {
+        for (std::size_t token = 0U; token < burst; ++token) {
+          auto status = writer.try_write(std::string{token_text});
+          if (status.has_error()) {
+            // A full ring forces the producer to yield until the consumer runs.
+            ++stalls;
+            static_cast<void>(drain(reader));
+            static_cast<void>(writer.try_write(std::string{token_text}));
+          }
+        }
+        if (round % 2U == 1U) {
+          static_cast<void>(drain(reader));
+        }
+      }
+    }
+    bytes = 0U;
+    high_water = 0U;
+    for (const auto &session : sessions) {
+      const auto stats = session.second.capacity_stats();
+      bytes += ring_bytes(stats);
+      high_water = std::max(high_water, stats.high_water);
+    }
+  }
+
+  state.counters["stalls_per_iter"] =
+      benchmark::Counter(static_cast<double>(stalls), benchmark::Counter::kAvgIterations);
+  state.counters["ring_bytes"] = static_cast<double>(bytes);
+  state.counters["high_water"] = static_cast<double>(high_water);
+}
+
+BENCHMARK(BM_pipe_stream_idle_sessions)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_pipe_stream_hot_sessions)
+    ->ArgsProduct({{0, 1}, {32, 128}})
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,161 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/compose/reduce.hpp"
+#include "wh/compose/types.hpp"
+#include "wh/schema/message/types.hpp"
+
+namespace {
+
+constexpr std::size_t fan_in_width = 4U;
+constexpr std::size_t value_bytes = 512U;
+constexpr char branch_prefix[] = "branch-";
+
+using fan_in_values = std::array<wh::core::any, fan_in_width>;
+
+// Moves every entry of the later maps into the first one.
+auto merge_value_maps(const std::span<wh::compose::graph_value_map> values)
+    -> wh::core::result<wh::compose::graph_value_map> {
+  auto merged = std::move(values.front());
+  for (auto &value : values.subspan(1U)) {
+    merged.merge(value);
+  }
+  return merged;
+}
+
+// Appends every later message's parts to the first message.
+auto concat_messages(const std::span<wh::schema::message> values)
+    -> wh::core::result<wh::schema::message> {
+  auto merged = std::move(values.front());
+  for (auto &value : values.subspan(1U)) {
+    merged.parts.insert(merged.parts.end(), std::make_move_iterator(value.parts.begin()),
+                        std::make_move_iterator(value.parts.end()));
+  }
+  return merged;
+}
+
+[[nodiscard]] auto make_value_map(const std::size_t branch, const std::size_t entries)
+    -> wh::compose::graph_value_map {
+  wh::compose::graph_value_map map{};
+  map.reserve(entries);
+  for (std::size_t index = 0U; index < entries; ++index) {
+    map.insert_or_assign(branch_prefix + std::to_string(branch) + "/" + std::to_string(index),
+                         wh::compose::graph_value{std::string(value_bytes, 'v')});
+  }
+  return map;
+}
+
+[[nodiscard]] auto make_message(const std::size_t parts) -> wh::schema::message {
+  wh::schema::message message{};
+  message.role = wh::schema::message_role::assistant;
+  message.parts.reserve(parts);
+  for (std::size_t index = 0U; index < parts; ++index) {
+    message.parts.emplace_back(wh::schema::text_part{std::string(value_bytes, 't')});
+  }
+  return message;
+}
+
+template <typename make_fn_t>
+[[nodiscard]] auto make_inputs(make_fn_t &&make, const std::size_t size) -> fan_in_values {
+  fan_in_values inputs{};
+  for (std::size_t branch = 0U; branch < fan_in_width; ++branch) {
+    inputs[branch] = wh::core::any{make(branch, size)};
+  }
+  return inputs;
+}
+
+[[nodiscard]] auto map_registry() -> const wh::internal::values_merge_registry & {
+  static const auto registry = [] {
+    wh::internal::values_merge_registry built{};
+    static_cast<void>(
+        built.register_owned_merge<wh::compose::graph_value_map>(merge_value_maps));
+    built.freeze();
+    return built;
+  }();
+  return registry;
+}
+
+[[nodiscard]] auto message_registry() -> const wh::internal::stream_concat_registry & {
+  static const auto registry = [] {
+    wh::internal::stream_concat_registry built{};
+    static_cast<void>(built.register_owned_concat<wh::schema::message>(concat_messages));
+    built.freeze();
+    return built;
+  }();
+  return registry;
+}
+
+// Arg is the entry count per branch map; inputs are rebuilt outside timing.
+auto BM_fan_in_map_merge_shared(benchmark::State &state) -> void {
+  const auto entries = static_cast<std::size_t>(state.range(0));
+  const auto type = wh::core::any_type_key_v<wh::compose::graph_value_map>;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto inputs = make_inputs(make_value_map, entries);
+    state.ResumeTiming();
+    auto merged = wh::compose::values_merge(map_registry(), type, inputs);
+    benchmark::DoNotOptimize(merged);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(entries * fan_in_width));
+}
+
+auto BM_fan_in_map_merge_owned(benchmark::State &state) -> void {
+  const auto entries = static_cast<std::size_t>(state.range(0));
+  const auto type = wh::core::any_type_key_v<wh::compose::graph_value_map>;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto inputs = make_inputs(make_value_map, entries);
+    state.ResumeTiming();
+    auto merged = wh::compose::values_merge_owned(map_registry(), type, inputs);
+    benchmark::DoNotOptimize(merged);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(entries * fan_in_width));
+}
+
+// Arg is the text part count per branch message.
+auto BM_fan_in_message_concat_shared(benchmark::State &state) -> void {
+  const auto parts = static_cast<std::size_t>(state.range(0));
+  const auto type = wh::core::any_type_key_v<wh::schema::message>;
+  const auto make = [](std::size_t, const std::size_t size) { return make_message(size); };
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto inputs = make_inputs(make, parts);
+    state.ResumeTiming();
+    auto merged = wh::compose::stream_concat(message_registry(), type, inputs);
+    benchmark::DoNotOptimize(merged);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(parts * fan_in_width));
+}
+
+auto BM_fan_in_message_concat_owned(benchmark::State &state) -> void {
+  const auto parts = static_cast<std::size_t>(state.range(0));
+  const auto type = wh::core::any_type_key_v<wh::schema::message>;
+  const auto make = [](std::size_t, const std::size_t size) { return make_message(size); };
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto inputs = make_inputs(make, parts);
+    state.ResumeTiming();
+    auto merged = wh::compose::stream_concat_owned(message_registry(), type, inputs);
+    benchmark::DoNotOptimize(merged);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(parts * fan_in_width));
+}
+
+BENCHMARK(BM_fan_in_map_merge_shared)->Arg(64)->Arg(1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_fan_in_map_merge_owned)->Arg(64)->Arg(1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_fan_in_message_concat_shared)->Arg(16)->Arg(256)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_fan_in_message_concat_owned)->Arg(16)->Arg(256)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,133 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/core/small_string.hpp"
+#include "wh/schema/message/types.hpp"
+#include "wh/schema/stream/core/types.hpp"
+
+namespace {
+
+std::atomic<std::uint64_t> allocation_count{0U};
+
+} // namespace
+
+auto operator new(const std::size_t size) -> void * {
+  allocation_count.fetch_add(1U, std::memory_order_relaxed);
+  if (auto *pointer = std::malloc(size == 0U ? 1U : size); pointer != nullptr) {
+    return pointer;
+  }
+  throw std::bad_alloc{};
+}
+
+auto operator delete(void *pointer) noexcept -> void { std::free(pointer); }
+
+auto operator delete(void *pointer, std::size_t) noexcept -> void { std::free(pointer); }
+
+namespace {
+
+constexpr char message_id_text[] = "chatcmpl-8f3a9d2b7c1e4f5a6b7c8d9e0f1a";
+constexpr char call_id_text[] = "call_Qm2x8VbN4kLp7RtY9sWd3FhJ";
+constexpr char tool_name_text[] = "search_knowledge_base";
+constexpr char source_text[] = "assistant_model_node";
+
+// Mirrors the pre-small_string schema layout so both variants run the same turn shape.
+struct legacy_tool_call_part {
+  std::size_t index{0U};
+  std::string id{};
+  std::string type{"function"};
+  std::string name{};
+  std::string arguments{};
+  bool complete{true};
+};
+
+struct legacy_message {
+  std::string message_id{};
+  wh::schema::message_role role{wh::schema::message_role::assistant};
+  std::string name{};
+  std::string tool_call_id{};
+  std::string tool_name{};
+  std::vector<std::variant<wh::schema::text_part, legacy_tool_call_part>> parts{};
+};
+
+struct legacy_chunk {
+  std::optional<legacy_message> value{};
+  std::string source{};
+};
+
+template <typename message_t, typename tool_part_t, typename chunk_t>
+auto stream_turn(const std::size_t chunk_count) -> std::size_t {
+  std::vector<chunk_t> emitted{};
+  std::vector<message_t> history{};
+  emitted.reserve(chunk_count);
+  history.reserve(chunk_count);
+  for (std::size_t index = 0U; index < chunk_count; ++index) {
+    message_t delta{};
+    delta.message_id = message_id_text;
+    delta.parts.emplace_back(tool_part_t{.index = 0U,
+                                         .id = call_id_text,
+                                         .name = tool_name_text,
+                                         .arguments = "{\"q\"",
+                                         .complete = false});
+    chunk_t chunk{};
+    chunk.value.emplace(delta);
+    chunk.source = source_text;
+    history.push_back(*chunk.value);
+    emitted.push_back(std::move(chunk));
+  }
+  return history.size() + emitted.size();
+}
+
+auto BM_schema_streamed_turn_identifiers(benchmark::State &state) -> void {
+  const auto small = state.range(0) != 0;
+  const auto chunk_count = static_cast<std::size_t>(state.range(1));
+  state.SetLabel(small ? "small_string" : "std_string");
+
+  std::uint64_t allocations = 0U;
+  for (auto _ : state) {
+    const auto before = allocation_count.load(std::memory_order_relaxed);
+    const auto produced =
+        small ? stream_turn<wh::schema::message, wh::schema::tool_call_part,
+                            wh::schema::stream::stream_chunk<wh::schema::message>>(chunk_count)
+              : stream_turn<legacy_message, legacy_tool_call_part, legacy_chunk>(chunk_count);
+    allocations += allocation_count.load(std::memory_order_relaxed) - before;
+    benchmark::DoNotOptimize(produced);
+  }
+
+  state.counters["allocs_per_turn"] = benchmark::Counter(
+      static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(chunk_count));
+}
+
+auto BM_small_string_copy(benchmark::State &state) -> void {
+  const wh::core::small_string<> source{call_id_text};
+  for (auto _ : state) {
+    wh::core::small_string<> copy{source};
+    benchmark::DoNotOptimize(copy.data());
+  }
+}
+
+auto BM_interned_string_lookup(benchmark::State &state) -> void {
+  for (auto _ : state) {
+    auto handle = wh::core::intern(tool_name_text);
+    benchmark::DoNotOptimize(handle.data());
+  }
+}
+
+BENCHMARK(BM_schema_streamed_turn_identifiers)->ArgsProduct({{0, 1}, {16, 256}});
+
+BENCHMARK(BM_small_string_copy);
+
+BENCHMARK(BM_interned_string_lookup);
+
+} // namespace
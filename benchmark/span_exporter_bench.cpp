@@ -0,0 +1,130 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/callbacks/span_exporter.hpp"
+#include "wh/callbacks/span_sinks.hpp"
+
+namespace {
+
+constexpr char trace_text[] = "trace-bench";
+constexpr char parent_text[] = "graph-span";
+constexpr wh::callbacks::span_exporter_options exporter_options{
+    .thread_buffer_capacity = 8192U, .flush_interval = std::chrono::milliseconds{5}};
+
+[[nodiscard]] auto make_run_info() -> wh::callbacks::run_info {
+  wh::callbacks::run_info info{};
+  info.name = "Retriever";
+  info.type = "Retriever";
+  info.component = wh::core::component_kind::retriever;
+  info.trace_id = trace_text;
+  info.parent_span_id = parent_text;
+  info.node_path = wh::core::address{"graph", "retriever"};
+  return info;
+}
+
+// Encodes every batch as a collector would receive it, then discards it.
+[[nodiscard]] auto encoding_sink() -> wh::callbacks::span_sink {
+  return [](const std::span<const wh::callbacks::span_record> spans) -> wh::core::result<void> {
+    auto body = wh::callbacks::encode_otlp_trace_request(spans, "bench");
+    benchmark::DoNotOptimize(body);
+    return {};
+  };
+}
+
+// Mirrors a hand-written handler that builds and encodes each span inline.
+class synchronous_span_handler {
+public:
+  [[nodiscard]] auto callbacks() -> wh::callbacks::stage_callbacks {
+    wh::callbacks::stage_callbacks callbacks{};
+    callbacks.on_start = [this](const wh::callbacks::stage, const wh::callbacks::event_view,
+                                const wh::callbacks::run_info &) {
+      std::lock_guard lock{mutex_};
+      start_ = wh::callbacks::detail::span_now_unix_nano();
+    };
+    callbacks.on_end = [this](const wh::callbacks::stage, const wh::callbacks::event_view,
+                              const wh::callbacks::run_info &info) {
+      wh::callbacks::span_record span{};
+      span.trace_id = info.trace_id;
+      span.span_id =
+          wh::callbacks::detail::format_span_id(wh::callbacks::detail::next_span_id_bits());
+      span.parent_span_id = info.parent_span_id;
+      span.name = info.name;
+      span.end_time_unix_nano = wh::callbacks::detail::span_now_unix_nano();
+      span.component_type = info.type;
+      span.component_kind = info.component;
+      span.node_path = info.node_path.to_string();
+      std::lock_guard lock{mutex_};
+      span.start_time_unix_nano = start_;
+      line_.clear();
+      wh::callbacks::append_otlp_span_json(line_, span);
+      benchmark::DoNotOptimize(line_);
+    };
+    return callbacks;
+  }
+
+private:
+  std::mutex mutex_{};
+  std::uint64_t start_{0U};
+  std::string line_{};
+};
+
+auto run_calls(benchmark::State &state, const wh::callbacks::manager &manager) -> void {
+  const auto info = make_run_info();
+  int payload = 0;
+  for (auto _ : state) {
+    manager.dispatch(wh::callbacks::stage::start, wh::callbacks::make_event_view(payload), info);
+    manager.dispatch(wh::callbacks::stage::end, wh::callbacks::make_event_view(payload), info);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+// One component call (start + end) with no span handler registered.
+auto BM_span_handler_none(benchmark::State &state) -> void {
+  static const wh::callbacks::manager manager{};
+  run_calls(state, manager);
+}
+
+// One component call with spans built and encoded inside the callback.
+auto BM_span_handler_synchronous(benchmark::State &state) -> void {
+  static synchronous_span_handler handler{};
+  static const auto manager = [] {
+    wh::callbacks::manager registered{};
+    registered.register_global_callbacks(wh::callbacks::span_exporter::config(),
+                                         handler.callbacks());
+    return registered;
+  }();
+  run_calls(state, manager);
+}
+
+// One component call with spans pushed to per-thread rings and encoded by the
+// background exporter.
+auto BM_span_handler_exporter(benchmark::State &state) -> void {
+  static wh::callbacks::span_exporter exporter{encoding_sink(), exporter_options};
+  static const auto manager = [] {
+    wh::callbacks::manager registered{};
+    wh::callbacks::register_span_exporter(registered, exporter);
+    return registered;
+  }();
+  run_calls(state, manager);
+  if (state.thread_index() == 0) {
+    const auto stats = exporter.stats();
+    state.counters["dropped"] = static_cast<double>(stats.dropped);
+    state.counters["exported"] = static_cast<double>(stats.exported);
+  }
+}
+
+BENCHMARK(BM_span_handler_none)->Threads(1)->Threads(4)->Unit(benchmark::kNanosecond);
+
+BENCHMARK(BM_span_handler_synchronous)->Threads(1)->Threads(4)->Unit(benchmark::kNanosecond);
+
+BENCHMARK(BM_span_handler_exporter)->Threads(1)->Threads(4)->Unit(benchmark::kNanosecond);
+
+} // namespace
@@ -0,0 +1,98 @@
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/schema/stream/adapter.hpp"
+#include "wh/schema/stream/reader/values_stream_reader.hpp"
+
+namespace {
+
+constexpr std::size_t token_count = 10'000U;
+
+using erased_reader = wh::schema::stream::any_stream_reader<int>;
+
+[[nodiscard]] auto make_tokens() -> std::vector<int> {
+  std::vector<int> tokens(token_count);
+  for (std::size_t index = 0U; index < token_count; ++index) {
+    tokens[index] = static_cast<int>(index);
+  }
+  return tokens;
+}
+
+[[nodiscard]] auto scale(const int value) -> wh::core::result<int> { return value * 3; }
+
+[[nodiscard]] auto keep_odd(const int value)
+    -> wh::core::result<wh::schema::stream::filter_map_step<int>> {
+  if (value % 2 == 0) {
+    return wh::schema::stream::skip;
+  }
+  return value;
+}
+
+[[nodiscard]] auto offset(const int value) -> wh::core::result<int> { return value + 1; }
+
+auto drain(erased_reader &reader) -> std::int64_t {
+  std::int64_t sum = 0;
+  for (;;) {
+    auto next = reader.read();
+    if (next.has_error() || next.value().eof) {
+      return sum;
+    }
+    sum += *next.value().value;
+  }
+}
+
+// Erasures that fell back to heap storage since the last report reset.
+[[nodiscard]] auto spill_count() -> std::uint64_t {
+  std::uint64_t spills = 0U;
+  for (const auto &record : wh::schema::stream::stream_reader_spill_report()) {
+    spills += record.count;
+  }
+  return spills;
+}
+
+// Baseline: each adapter layer is erased on its own, as graph lowering does today.
+auto BM_stream_adapter_nested_erased(benchmark::State &state) -> void {
+  const auto tokens = make_tokens();
+  wh::schema::stream::reset_stream_reader_spill_report();
+  for (auto _ : state) {
+    erased_reader source{wh::schema::stream::make_values_stream_reader(tokens)};
+    erased_reader scaled{
+        wh::schema::stream::make_transform_stream_reader(std::move(source), scale)};
+    erased_reader filtered{
+        wh::schema::stream::make_filter_map_stream_reader(std::move(scaled), keep_odd)};
+    erased_reader reader{
+        wh::schema::stream::make_transform_stream_reader(std::move(filtered), offset)};
+    benchmark::DoNotOptimize(drain(reader));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * token_count));
+  state.counters["erasures_per_chain"] = 4.0;
+  state.counters["spills_per_chain"] =
+      static_cast<double>(spill_count()) / static_cast<double>(state.iterations());
+}
+
+auto BM_stream_adapter_fused(benchmark::State &state) -> void {
+  const auto tokens = make_tokens();
+  wh::schema::stream::reset_stream_reader_spill_report();
+  for (auto _ : state) {
+    auto source = wh::schema::stream::make_values_stream_reader(tokens);
+    auto reader = wh::schema::stream::make_stream_pipeline(std::move(source))
+                      .transform(scale)
+                      .filter_map(keep_odd)
+                      .transform(offset)
+                      .erase();
+    benchmark::DoNotOptimize(drain(reader));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * token_count));
+  state.counters["erasures_per_chain"] = 1.0;
+  state.counters["spills_per_chain"] =
+      static_cast<double>(spill_count()) / static_cast<double>(state.iterations());
+}
+
+BENCHMARK(BM_stream_adapter_nested_erased)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_stream_adapter_fused)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,108 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/compose/reduce.hpp"
+#include "wh/schema/message/types.hpp"
+
+namespace {
+
+constexpr std::size_t token_bytes = 24U;
+
+[[nodiscard]] auto text_registry() -> const wh::internal::stream_concat_registry & {
+  static const auto registry = [] {
+    wh::internal::stream_concat_registry built{};
+    static_cast<void>(wh::compose::register_builtin_concat_accumulators(built));
+    built.freeze();
+    return built;
+  }();
+  return registry;
+}
+
+[[nodiscard]] auto make_token_message(const std::size_t index) -> wh::schema::message {
+  wh::schema::message chunk{};
+  chunk.role = wh::schema::message_role::assistant;
+  chunk.parts.emplace_back(wh::schema::text_part{std::string(token_bytes, 'a' + (index % 26U))});
+  return chunk;
+}
+
+// Arg is the chunk count; buffers every chunk, then concatenates at EOF.
+auto BM_stream_concat_buffered_text(benchmark::State &state) -> void {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto type = wh::core::any_type_key_v<std::string>;
+  std::size_t peak_bytes = 0U;
+  for (auto _ : state) {
+    std::vector<wh::core::any> buffered{};
+    std::size_t buffered_bytes = 0U;
+    for (std::size_t index = 0U; index < count; ++index) {
+      buffered.emplace_back(std::string(token_bytes, 't'));
+      buffered_bytes += token_bytes;
+    }
+    auto joined = wh::compose::stream_concat_owned(text_registry(), type, buffered);
+    peak_bytes = buffered_bytes + wh::core::any_cast<std::string>(&joined.value())->capacity();
+    benchmark::DoNotOptimize(joined);
+  }
+  state.counters["peak_payload_bytes"] = static_cast<double>(peak_bytes);
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(count));
+}
+
+// Arg is the chunk count; folds each chunk into the running value on arrival.
+auto BM_stream_concat_folded_text(benchmark::State &state) -> void {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto type = wh::core::any_type_key_v<std::string>;
+  std::size_t peak_bytes = 0U;
+  for (auto _ : state) {
+    auto accumulator = text_registry().begin_concat(type).value();
+    for (std::size_t index = 0U; index < count; ++index) {
+      static_cast<void>(accumulator.append(wh::core::any{std::string(token_bytes, 't')}));
+    }
+    peak_bytes = accumulator.partial_as<std::string>()->capacity() + token_bytes;
+    auto joined = accumulator.finish();
+    benchmark::DoNotOptimize(joined);
+  }
+  state.counters["peak_payload_bytes"] = static_cast<double>(peak_bytes);
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(count));
+}
+
+// Arg is the token delta count of one streamed assistant message.
+auto BM_stream_concat_buffered_message(benchmark::State &state) -> void {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    std::vector<wh::schema::message> buffered{};
+    for (std::size_t index = 0U; index < count; ++index) {
+      buffered.push_back(make_token_message(index));
+    }
+    auto merged = wh::schema::merge_message_chunks(std::move(buffered));
+    benchmark::DoNotOptimize(merged);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(count));
+}
+
+auto BM_stream_concat_folded_message(benchmark::State &state) -> void {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto type = wh::core::any_type_key_v<wh::schema::message>;
+  for (auto _ : state) {
+    auto accumulator = text_registry().begin_concat(type).value();
+    for (std::size_t index = 0U; index < count; ++index) {
+      static_cast<void>(accumulator.append(wh::core::any{make_token_message(index)}));
+    }
+    auto merged = accumulator.finish();
+    benchmark::DoNotOptimize(merged);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(count));
+}
+
+BENCHMARK(BM_stream_concat_buffered_text)->Arg(256)->Arg(4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_stream_concat_folded_text)->Arg(256)->Arg(4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_stream_concat_buffered_message)->Arg(256)->Arg(4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_stream_concat_folded_message)->Arg(256)->Arg(4096)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,98 @@
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include "wh/compose/graph/detail/collect_policy.hpp"
+#include "wh/compose/graph/detail/rewrite_policy.hpp"
+#include "wh/compose/graph/stream.hpp"
+#include "wh/core/stdexec/resume_scheduler.hpp"
+
+namespace {
+
+constexpr std::size_t token_count = 10'000U;
+constexpr std::size_t rewrite_capacity = token_count + 1U;
+
+[[nodiscard]] auto make_tokens() -> std::vector<wh::compose::graph_value> {
+  std::vector<wh::compose::graph_value> tokens{};
+  tokens.reserve(token_count);
+  for (std::size_t index = 0U; index < token_count; ++index) {
+    tokens.emplace_back(static_cast<int>(index));
+  }
+  return tokens;
+}
+
+[[nodiscard]] auto make_token_reader(const std::vector<wh::compose::graph_value> &tokens)
+    -> wh::compose::graph_stream_reader {
+  return std::move(wh::compose::make_values_stream_reader(tokens)).value();
+}
+
+// Baseline: the same collect with no pump, so the pump's extra time is the
+// scheduling share (`1 - direct / pump`).
+auto BM_stream_collect_direct(benchmark::State &state) -> void {
+  const auto tokens = make_tokens();
+  for (auto _ : state) {
+    auto collected = wh::compose::collect_graph_stream_reader(make_token_reader(tokens));
+    benchmark::DoNotOptimize(collected);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * token_count));
+}
+
+// Arg is the drain budget; `1` is one scheduler resume per chunk.
+auto BM_stream_collect_pump(benchmark::State &state) -> void {
+  const auto tokens = make_tokens();
+  const auto budget = static_cast<std::size_t>(state.range(0));
+  exec::static_thread_pool pool{1U};
+  const auto scheduler = wh::core::detail::erase_resume_scheduler(pool.get_scheduler());
+  for (auto _ : state) {
+    auto waited = stdexec::sync_wait(wh::compose::detail::make_child_pump_sender(
+        wh::compose::detail::collect_policy{
+            .reader = make_token_reader(tokens),
+            .drain_budget = budget,
+        },
+        scheduler));
+    benchmark::DoNotOptimize(waited);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * token_count));
+  state.counters["max_turns"] = static_cast<double>((token_count + budget - 1U) / budget);
+}
+
+auto BM_stream_rewrite_pump(benchmark::State &state) -> void {
+  const auto tokens = make_tokens();
+  const auto budget = static_cast<std::size_t>(state.range(0));
+  exec::static_thread_pool pool{1U};
+  const auto scheduler = wh::core::detail::erase_resume_scheduler(pool.get_scheduler());
+  for (auto _ : state) {
+    auto [writer, rewritten] = wh::compose::make_graph_stream(rewrite_capacity);
+    auto waited = stdexec::sync_wait(wh::compose::detail::make_rewrite_stream_sender(
+        make_token_reader(tokens), std::move(writer),
+        [](wh::compose::graph_value &chunk) -> wh::core::result<void> {
+          *wh::core::any_cast<int>(&chunk) += 1;
+          return {};
+        },
+        scheduler, budget));
+    benchmark::DoNotOptimize(waited);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * token_count));
+  state.counters["max_turns"] = static_cast<double>((token_count + budget - 1U) / budget);
+}
+
+BENCHMARK(BM_stream_collect_direct)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_stream_collect_pump)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_stream_rewrite_pump)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256)
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
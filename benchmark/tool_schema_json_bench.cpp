@@ -0,0 +1,114 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/core/json.hpp"
+#include "wh/schema/tool/types.hpp"
+
+namespace {
+
+constexpr std::size_t properties_per_tool = 6U;
+constexpr std::size_t nested_properties = 4U;
+
+// One realistic function tool: scalar, enum, array, and nested-object fields.
+[[nodiscard]] auto make_tool(const std::size_t index) -> wh::schema::tool_schema_definition {
+  wh::schema::tool_schema_definition definition{
+      .name = "tool_" + std::to_string(index),
+      .description = "Performs operation " + std::to_string(index) + " on the workspace.",
+  };
+  for (std::size_t field = properties_per_tool; field > 0U; --field) {
+    wh::schema::tool_parameter_schema parameter{
+        .name = "field_" + std::to_string(field),
+        .type = wh::schema::tool_parameter_type::string,
+        .description = "Input field " + std::to_string(field),
+        .required = field % 2U == 0U,
+    };
+    if (field == 1U) {
+      parameter.enum_values = {"fast", "balanced", "exact"};
+    } else if (field == 2U) {
+      parameter.type = wh::schema::tool_parameter_type::array;
+      parameter.item_types.push_back(wh::schema::tool_parameter_schema{
+          .name = "item", .type = wh::schema::tool_parameter_type::integer});
+    } else if (field == 3U) {
+      parameter.type = wh::schema::tool_parameter_type::object;
+      for (std::size_t nested = nested_properties; nested > 0U; --nested) {
+        parameter.properties.push_back(wh::schema::tool_parameter_schema{
+            .name = "option_" + std::to_string(nested),
+            .type = wh::schema::tool_parameter_type::boolean,
+            .required = nested == 1U,
+        });
+      }
+    }
+    definition.parameters.push_back(std::move(parameter));
+  }
+  return definition;
+}
+
+[[nodiscard]] auto make_tools(const std::size_t count)
+    -> std::vector<wh::schema::tool_schema_definition> {
+  std::vector<wh::schema::tool_schema_definition> tools{};
+  tools.reserve(count);
+  for (std::size_t index = 0U; index < count; ++index) {
+    tools.push_back(make_tool(index));
+  }
+  return tools;
+}
+
+// Arg is the bound tool count; each iteration renders the tools for one request.
+auto BM_tool_schema_json_rebuild(benchmark::State &state) -> void {
+  const auto tools = make_tools(static_cast<std::size_t>(state.range(0)));
+  std::size_t bytes = 0U;
+  for (auto _ : state) {
+    std::string request{};
+    request.push_back('[');
+    for (std::size_t index = 0U; index < tools.size(); ++index) {
+      if (index != 0U) {
+        request.push_back(',');
+      }
+      auto built = wh::schema::build_default_tool_json_schema(tools[index]);
+      request.append(wh::core::json_to_string(built.value()).value());
+    }
+    request.push_back(']');
+    bytes = request.size();
+    benchmark::DoNotOptimize(request);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+}
+
+auto BM_tool_schema_json_compiled(benchmark::State &state) -> void {
+  const auto definitions = make_tools(static_cast<std::size_t>(state.range(0)));
+  std::vector<wh::schema::compiled_tool_json_schema> tools{};
+  tools.reserve(definitions.size());
+  for (const auto &definition : definitions) {
+    tools.push_back(wh::schema::compiled_tool_json_schema::compile(definition).value());
+  }
+  std::size_t bytes = 0U;
+  for (auto _ : state) {
+    std::string request{};
+    wh::schema::append_tool_schemas_json(tools, request);
+    bytes = request.size();
+    benchmark::DoNotOptimize(request);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+}
+
+// One-time cost paid when a tool list is registered.
+auto BM_tool_schema_compile(benchmark::State &state) -> void {
+  const auto definitions = make_tools(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    for (const auto &definition : definitions) {
+      auto compiled = wh::schema::compiled_tool_json_schema::compile(definition);
+      benchmark::DoNotOptimize(compiled);
+    }
+  }
+}
+
+BENCHMARK(BM_tool_schema_json_rebuild)->Arg(50)->Arg(200)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_tool_schema_json_compiled)->Arg(50)->Arg(200)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_tool_schema_compile)->Arg(50)->Arg(200)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "wh/core/json.hpp"
+#include "wh/schema/tool/validator.hpp"
+
+namespace {
+
+constexpr std::size_t field_count = 20U;
+
+[[nodiscard]] auto make_field(const std::size_t index) -> wh::schema::tool_parameter_schema {
+  wh::schema::tool_parameter_schema field{};
+  field.name = "field_" + std::to_string(index);
+  field.required = index % 2U == 0U;
+  switch (index % 4U) {
+  case 0U:
+    field.type = wh::schema::tool_parameter_type::string;
+    break;
+  case 1U:
+    field.type = wh::schema::tool_parameter_type::integer;
+    break;
+  case 2U:
+    field.type = wh::schema::tool_parameter_type::boolean;
+    break;
+  default:
+    field.type = wh::schema::tool_parameter_type::string;
+    field.enum_values = {"low", "medium", "high"};
+    break;
+  }
+  return field;
+}
+
+// Twenty scalar fields plus one nested object of twenty fields per level.
+[[nodiscard]] auto make_schema(const std::size_t depth)
+    -> std::vector<wh::schema::tool_parameter_schema> {
+  std::vector<wh::schema::tool_parameter_schema> fields{};
+  for (std::size_t index = 0U; index < field_count; ++index) {
+    fields.push_back(make_field(index));
+  }
+  if (depth > 0U) {
+    wh::schema::tool_parameter_schema nested{};
+    nested.name = "nested";
+    nested.type = wh::schema::tool_parameter_type::object;
+    nested.required = true;
+    nested.properties = make_schema(depth - 1U);
+    fields.push_back(std::move(nested));
+  }
+  return fields;
+}
+
+auto append_arguments(std::string &output, const std::size_t depth) -> void {
+  output.push_back('{');
+  for (std::size_t index = field_count; index-- > 0U;) {
+    output += "\"field_" + std::to_string(index) + "\":";
+    switch (index % 4U) {
+    case 0U:
+      output += "\"value\"";
+      break;
+    case 1U:
+      output += std::to_string(index);
+      break;
+    case 2U:
+      output += "true";
+      break;
+    default:
+      output += "\"medium\"";
+      break;
+    }
+    output.push_back(',');
+  }
+  if (depth > 0U) {
+    output += "\"nested\":";
+    append_arguments(output, depth - 1U);
+  } else {
+    output.pop_back();
+  }
+  output.push_back('}');
+}
+
+// Mirrors the recursive walker used before schemas were compiled.
+[[nodiscard]] auto legacy_validate(const wh::core::json_value &value,
+                                   const wh::schema::tool_parameter_schema &schema) -> bool {
+  switch (schema.type) {
+  case wh::schema::tool_parameter_type::string:
+    if (!value.IsString()) {
+      return false;
+    }
+    break;
+  case wh::schema::tool_parameter_type::integer:
+    if (!value.IsInt64() && !value.IsUint64()) {
+      return false;
+    }
+    break;
+  case wh::schema::tool_parameter_type::number:
+    if (!value.IsNumber()) {
+      return false;
+    }
+    break;
+  case wh::schema::tool_parameter_type::boolean:
+    if (!value.IsBool()) {
+      return false;
+    }
+    break;
+  case wh::schema::tool_parameter_type::object:
+    if (!value.IsObject()) {
+      return false;
+    }
+    break;
+  case wh::schema::tool_parameter_type::array:
+    if (!value.IsArray()) {
+      return false;
+    }
+    break;
+  }
+  if (schema.type == wh::schema::tool_parameter_type::string && !schema.enum_values.empty()) {
+    const std::string_view current{value.GetString(), value.GetStringLength()};
+    if (std::ranges::find(schema.enum_values, current) == schema.enum_values.end()) {
+      return false;
+    }
+  }
+  if (schema.type == wh::schema::tool_parameter_type::object) {
+    for (const auto &property : schema.properties) {
+      // The legacy walker rebuilt the JSON path string for every property.
+      const std::string child_path = "$." + property.name;
+      benchmark::DoNotOptimize(child_path.data());
+      const auto member = value.FindMember(rapidjson::StringRef(
+          property.name.data(), static_cast<rapidjson::SizeType>(property.name.size())));
+      if (member == value.MemberEnd()) {
+        if (property.required) {
+          return false;
+        }
+        continue;
+      }
+      if (!legacy_validate(member->value, property)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+auto BM_tool_schema_validate_legacy(benchmark::State &state) -> void {
+  const auto depth = static_cast<std::size_t>(state.range(0));
+  wh::schema::tool_parameter_schema root{};
+  root.type = wh::schema::tool_parameter_type::object;
+  root.properties = make_schema(depth);
+  std::string input{};
+  append_arguments(input, depth);
+
+  for (auto _ : state) {
+    auto parsed = wh::core::parse_json(input);
+    const auto ok = parsed.has_value() && legacy_validate(parsed.value(), root);
+    benchmark::DoNotOptimize(ok);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(input.size()));
+}
+
+auto BM_tool_schema_validate_compiled(benchmark::State &state) -> void {
+  const auto depth = static_cast<std::size_t>(state.range(0));
+  const auto parameters = make_schema(depth);
+  const wh::schema::compiled_tool_schema compiled{parameters};
+  std::string input{};
+  append_arguments(input, depth);
+
+  std::string error_path{};
+  for (auto _ : state) {
+    const auto status = compiled.validate(input, error_path);
+    benchmark::DoNotOptimize(status.has_value());
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(input.size()));
+}
+
+auto BM_tool_schema_compile(benchmark::State &state) -> void {
+  const auto parameters = make_schema(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    const wh::schema::compiled_tool_schema compiled{parameters};
+    benchmark::DoNotOptimize(compiled.node_count());
+  }
+}
+
+BENCHMARK(BM_tool_schema_validate_legacy)->Arg(0)->Arg(2)->Arg(4);
+
+BENCHMARK(BM_tool_schema_validate_compiled)->Arg(0)->Arg(2)->Arg(4);
+
+BENCHMARK(BM_tool_schema_compile)->Arg(0)->Arg(4);
+
+} // namespace
@@ -187,13 +187,15 @@ struct agent_tool_access {
   };
 }
 
+/// Forwards one child event through the tool scope. The scope location is
+/// deferred onto `path_prefix` until the event leaves through the bridge.
 [[nodiscard]] inline auto normalize_child_metadata(const agent_tool_runtime &runtime,
-                                                   const agent_tool_scope_snapshot &scope,
+                                                   run_path_forwarder &forwarder,
                                                    event_metadata metadata) -> event_metadata {
   if (metadata.path.empty()) {
     metadata.path = run_path{{"agent", runtime.agent_name}};
   }
-  metadata.path = append_run_path_prefix(scope.location, metadata.path);
+  metadata.path_prefix = forwarder.forward(metadata.path_prefix);
   if (metadata.agent_name.empty()) {
     metadata.agent_name = runtime.agent_name;
   }
@@ -206,7 +208,10 @@ struct agent_tool_access {
 [[nodiscard]] inline auto default_tool_metadata(const agent_tool_runtime &runtime,
                                                 const agent_tool_scope_snapshot &scope)
     -> event_metadata {
-  return normalize_child_metadata(runtime, scope, event_metadata{});
+  run_path_forwarder forwarder{scope.location};
+  auto metadata = normalize_child_metadata(runtime, forwarder, event_metadata{});
+  materialize_run_path(metadata);
+  return metadata;
 }
 
 [[nodiscard]] inline auto into_owned_bridge_state(const wh::core::any &payload)
@@ -494,6 +499,7 @@ make_owned_agent_tool_checkpoint_state(const agent_tool_output_summary &output)
       return wh::core::result<agent_tool_checkpoint_state>::failure(owned_record.error());
     }
     checkpoint.events.push_back(std::move(owned_record).value());
+    materialize_run_path(checkpoint.events.back().metadata);
   }
   checkpoint.output_chunks = output.text_chunks;
   checkpoint.final_message = output.final_message;
@@ -502,6 +508,9 @@ make_owned_agent_tool_checkpoint_state(const agent_tool_output_summary &output)
 
 [[nodiscard]] inline auto make_owned_agent_tool_checkpoint_state(agent_tool_output_summary &&output)
     -> wh::core::result<agent_tool_checkpoint_state> {
+  for (auto &record : output.checkpoint_events) {
+    materialize_run_path(record.metadata);
+  }
   return agent_tool_checkpoint_state{
       .events = std::move(output.checkpoint_events),
       .output_chunks = std::move(output.text_chunks),
@@ -829,6 +838,7 @@ inline auto restore_outer_interrupt(wh::core::run_context &context, agent_tool_r
                                                         agent_tool_output_summary &output)
     -> wh::core::result<void> {
   bool emitted_boundary_event = false;
+  run_path_forwarder forwarder{scope.location};
   while (true) {
     auto next = read_agent_event_stream(artifact.events);
     if (next.has_error()) {
@@ -847,7 +857,8 @@ inline auto restore_outer_interrupt(wh::core::run_context &context, agent_tool_r
     }
 
     auto event = std::move(*chunk.value);
-    auto normalized_metadata = normalize_child_metadata(runtime, scope, std::move(event.metadata));
+    auto normalized_metadata =
+        normalize_child_metadata(runtime, forwarder, std::move(event.metadata));
 
     if (auto *message = std::get_if<message_event>(&event.payload); message != nullptr) {
       auto consumed = consume_message_event_messages(
@@ -888,7 +899,7 @@ inline auto restore_outer_interrupt(wh::core::run_context &context, agent_tool_r
         output.interrupted = true;
         output.child_interrupt = agent_tool_child_interrupt{
             .interrupt_id = action->interrupt_id,
-            .location = normalized_metadata.path,
+            .location = resolve_run_path(normalized_metadata),
         };
         emitted_boundary_event = true;
         auto owned_metadata = into_owned_bridge_metadata(std::move(normalized_metadata));
@@ -1115,7 +1126,8 @@ public:
   agent_tool_live_stream_reader(agent_tool_runtime runtime, agent_tool_scope_snapshot scope,
                                 wh::core::run_context &context, agent_tool_run_setup setup,
                                 agent_run_output artifact)
-      : runtime_(std::move(runtime)), scope_(std::move(scope)), context_(&context),
+      : runtime_(std::move(runtime)), scope_(std::move(scope)), forwarder_(scope_.location),
+        context_(&context),
         projection_(std::move(setup.projection)),
         saved_outer_interrupt_(std::move(setup.saved_outer_interrupt)),
         live_events_(std::move(artifact.events)),
@@ -1627,7 +1639,7 @@ private:
     }
     return agent_tool_child_interrupt{
         .interrupt_id = action.interrupt_id,
-        .location = metadata.path,
+        .location = resolve_run_path(metadata),
         .trigger_reason =
             action.reason.empty() ? std::string{agent_tool_interrupt_reason} : action.reason,
     };
@@ -1747,7 +1759,7 @@ private:
 
     auto event = std::move(*chunk.value);
     auto normalized_metadata =
-        normalize_child_metadata(runtime_, scope_, std::move(event.metadata));
+        normalize_child_metadata(runtime_, forwarder_, std::move(event.metadata));
 
     if (auto *message = std::get_if<message_event>(&event.payload); message != nullptr) {
       boundary_event_seen_ = true;
@@ -1780,6 +1792,7 @@ private:
 
   agent_tool_runtime runtime_{};
   agent_tool_scope_snapshot scope_{};
+  run_path_forwarder forwarder_{};
   wh::core::run_context *context_{nullptr};
   std::optional<agent_tool_resume_projection> projection_{};
   std::optional<wh::core::interrupt_context> saved_outer_interrupt_{};
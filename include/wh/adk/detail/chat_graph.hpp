@@ -2,7 +2,7 @@
 // shell onto one compose chain without introducing a second runtime.
 #pragma once
 
-#include <optional>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -10,6 +10,7 @@
 #include <stdexec/execution.hpp>
 
 #include "wh/adk/detail/agent_graph_view.hpp"
+#include "wh/adk/detail/instruction_message.hpp"
 #include "wh/adk/deterministic_transfer.hpp"
 #include "wh/agent/agent.hpp"
 #include "wh/agent/chat.hpp"
@@ -28,29 +29,6 @@ namespace chat_detail {
 
 inline constexpr std::string_view chat_model_messages_node_key = "__chat_model_messages__";
 
-[[nodiscard]] inline auto make_instruction_message(const std::string_view description,
-                                                   const std::string_view instruction)
-    -> std::optional<wh::schema::message> {
-  std::string text{};
-  if (!description.empty()) {
-    text.append(description);
-  }
-  if (!instruction.empty()) {
-    if (!text.empty()) {
-      text.push_back('\n');
-    }
-    text.append(instruction);
-  }
-  if (text.empty()) {
-    return std::nullopt;
-  }
-
-  wh::schema::message message{};
-  message.role = wh::schema::message_role::system;
-  message.parts.emplace_back(wh::schema::text_part{std::move(text)});
-  return message;
-}
-
 [[nodiscard]] inline auto render_message_text(const wh::schema::message &message) -> std::string {
   std::string text{};
   for (const auto &part : message.parts) {
@@ -121,8 +99,8 @@ private:
       return wh::core::result<wh::compose::graph>::failure(model_node.error());
     }
 
-    auto description = std::string{authored_->description()};
-    auto instruction = authored_->render_instruction();
+    auto instruction = make_instruction_message(authored_->description(),
+                                                authored_->instruction_snapshot().text());
     auto request_transforms = std::vector<wh::agent::middlewares::request_transform_binding>{
         authored_->request_transforms().begin(), authored_->request_transforms().end()};
     wh::compose::graph_compile_options compile_options{};
@@ -134,8 +112,7 @@ private:
                                                          wh::compose::node_contract::value,
                                                          wh::compose::node_exec_mode::async>(
         "prepare_request",
-        [description = std::move(description), instruction = std::move(instruction),
-         request_transforms = std::move(request_transforms)](
+        [instruction = std::move(instruction), request_transforms = std::move(request_transforms)](
             wh::compose::graph_value &input, wh::core::run_context &context,
             const wh::compose::graph_call_scope &) -> wh::compose::graph_value_sender {
           auto *messages = wh::core::any_cast<std::vector<wh::schema::message>>(&input);
@@ -147,9 +124,9 @@ private:
 
           wh::model::chat_request request{};
           request.messages.reserve(messages->size() + 1U);
-          if (auto system = chat_detail::make_instruction_message(description, instruction);
-              system.has_value()) {
-            request.messages.push_back(std::move(*system));
+          if (instruction != nullptr) {
+            // Requests own their messages; the frozen one is copied, not rebuilt.
+            request.messages.push_back(*instruction);
           }
           for (auto &message : *messages) {
             request.messages.push_back(std::move(message));
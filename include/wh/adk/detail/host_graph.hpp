@@ -71,6 +71,7 @@ struct host_step_decision {
 
 struct runtime_state {
   std::vector<wh::schema::message> visible_history{};
+  wh::adk::transfer_history_view history_view{};
   std::size_t input_message_count{0U};
   std::string active_agent_name{};
   std::vector<wh::schema::message> active_request_messages{};
@@ -91,19 +92,23 @@ struct runtime_state {
   }
   if (const auto *lhs = std::get_if<wh::schema::image_part>(&left); lhs != nullptr) {
     const auto *rhs = std::get_if<wh::schema::image_part>(&right);
-    return rhs != nullptr && lhs->uri == rhs->uri;
+    return rhs != nullptr && lhs->uri == rhs->uri && lhs->mime_type == rhs->mime_type &&
+           lhs->data == rhs->data;
   }
   if (const auto *lhs = std::get_if<wh::schema::audio_part>(&left); lhs != nullptr) {
     const auto *rhs = std::get_if<wh::schema::audio_part>(&right);
-    return rhs != nullptr && lhs->base64 == rhs->base64 && lhs->uri == rhs->uri;
+    return rhs != nullptr && lhs->base64 == rhs->base64 && lhs->uri == rhs->uri &&
+           lhs->data == rhs->data;
   }
   if (const auto *lhs = std::get_if<wh::schema::video_part>(&left); lhs != nullptr) {
     const auto *rhs = std::get_if<wh::schema::video_part>(&right);
-    return rhs != nullptr && lhs->uri == rhs->uri;
+    return rhs != nullptr && lhs->uri == rhs->uri && lhs->mime_type == rhs->mime_type &&
+           lhs->data == rhs->data;
   }
   if (const auto *lhs = std::get_if<wh::schema::file_part>(&left); lhs != nullptr) {
     const auto *rhs = std::get_if<wh::schema::file_part>(&right);
-    return rhs != nullptr && lhs->uri == rhs->uri && lhs->mime_type == rhs->mime_type;
+    return rhs != nullptr && lhs->uri == rhs->uri && lhs->mime_type == rhs->mime_type &&
+           lhs->data == rhs->data;
   }
   if (const auto *lhs = std::get_if<wh::schema::tool_call_part>(&left); lhs != nullptr) {
     const auto *rhs = std::get_if<wh::schema::tool_call_part>(&right);
@@ -422,16 +427,17 @@ inline auto append_visible_history(runtime_state &state,
           return wh::core::result<void>::failure(wh::core::errc::not_found);
         }
 
-        auto request = wh::adk::rewrite_transfer_history(
+        // The state keeps the one materialized rewrite for prefix matching in
+        // capture; the agent consumes its own copy of it.
+        runtime_state.active_request_messages = runtime_state.history_view.rewrite(
             runtime_state.visible_history, runtime_state.active_agent_name,
             wh::adk::resolved_transfer_trim_options{
                 .trim_assistant_transfer_message = true,
                 .trim_tool_transfer_pair = true,
             });
-        runtime_state.active_request_messages = request;
         payload = wh::core::any(host_request{
             .agent_name = runtime_state.active_agent_name,
-            .messages = std::move(request),
+            .messages = runtime_state.active_request_messages,
         });
         return {};
       });
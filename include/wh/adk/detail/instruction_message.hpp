@@ -0,0 +1,39 @@
+// Defines the frozen system message that chat and ReAct lowerings prepend to
+// every model request.
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "wh/schema/message/types.hpp"
+
+namespace wh::adk::detail {
+
+/// Joins description and rendered instruction into one system message, built
+/// once per lowering; null when both are empty.
+[[nodiscard]] inline auto make_instruction_message(const std::string_view description,
+                                                   const std::string_view instruction)
+    -> std::shared_ptr<const wh::schema::message> {
+  std::string text{};
+  text.reserve(description.size() + instruction.size() + 1U);
+  if (!description.empty()) {
+    text.append(description);
+  }
+  if (!instruction.empty()) {
+    if (!text.empty()) {
+      text.push_back('\n');
+    }
+    text.append(instruction);
+  }
+  if (text.empty()) {
+    return nullptr;
+  }
+  wh::schema::message message{};
+  message.role = wh::schema::message_role::system;
+  message.parts.emplace_back(wh::schema::text_part{std::move(text)});
+  return std::make_shared<const wh::schema::message>(std::move(message));
+}
+
+} // namespace wh::adk::detail
@@ -15,8 +15,10 @@ struct live_event_bridge {
   /// Reader returned to the caller after the bridge closes.
   agent_event_stream_reader reader{};
 
-  /// Emits one event into the bridge.
+  /// Emits one event into the bridge. The reader is a public boundary, so any
+  /// deferred path prefix is folded into `metadata.path` here.
   [[nodiscard]] auto emit(agent_event event) -> wh::core::result<void> {
+    materialize_run_path(event.metadata);
     return send_agent_event(writer, std::move(event));
   }
 
@@ -2,6 +2,7 @@
 // onto one compose graph without introducing a second runtime.
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <span>
 #include <string>
@@ -13,6 +14,7 @@
 
 #include "wh/adk/detail/agent_graph_view.hpp"
 #include "wh/adk/detail/history_request.hpp"
+#include "wh/adk/detail/instruction_message.hpp"
 #include "wh/adk/detail/shared_state.hpp"
 #include "wh/adk/deterministic_transfer.hpp"
 #include "wh/agent/agent.hpp"
@@ -54,29 +56,6 @@ struct apply_tools_decision {
   return wh::adk::detail::shared_state_ref<wh::agent::react_state>(process_state);
 }
 
-[[nodiscard]] inline auto make_instruction_message(const std::string_view description,
-                                                   const std::string_view instruction)
-    -> std::optional<wh::schema::message> {
-  std::string text{};
-  if (!description.empty()) {
-    text.append(description);
-  }
-  if (!instruction.empty()) {
-    if (!text.empty()) {
-      text.push_back('\n');
-    }
-    text.append(instruction);
-  }
-  if (text.empty()) {
-    return std::nullopt;
-  }
-
-  wh::schema::message message{};
-  message.role = wh::schema::message_role::system;
-  message.parts.emplace_back(wh::schema::text_part{std::move(text)});
-  return message;
-}
-
 [[nodiscard]] inline auto render_message_text(const wh::schema::message &message) -> std::string {
   std::string text{};
   for (const auto &part : message.parts) {
@@ -376,13 +355,12 @@ normalize_tools_registry_for_stream(const wh::compose::tool_registry &registry,
 }
 
 [[nodiscard]] inline auto
-make_prepare_request_options(std::string description, std::string instruction,
+make_prepare_request_options(std::shared_ptr<const wh::schema::message> instruction,
                              std::vector<wh::schema::tool_schema_definition> tools)
     -> wh::compose::graph_add_node_options {
   wh::compose::graph_add_node_options options{};
   options.state.bind_pre(
-      [description = std::move(description), instruction = std::move(instruction),
-       tools = std::move(tools)](
+      [instruction = std::move(instruction), tools = std::move(tools)](
           const wh::compose::graph_state_cause &, wh::compose::graph_process_state &process_state,
           wh::compose::graph_value &payload, wh::core::run_context &) -> wh::core::result<void> {
         auto state = read_react_state(process_state);
@@ -396,8 +374,9 @@ make_prepare_request_options(std::string description, std::string instruction,
 
         wh::model::chat_request request{};
         request.messages.reserve(react_state.messages.size() + 1U);
-        if (auto system = make_instruction_message(description, instruction); system.has_value()) {
-          request.messages.push_back(std::move(*system));
+        if (instruction != nullptr) {
+          // Requests own their messages; the frozen one is copied, not rebuilt.
+          request.messages.push_back(*instruction);
         }
         for (const auto &message : react_state.messages) {
           request.messages.push_back(message);
@@ -566,8 +545,8 @@ private:
       }
       runtime_options.missing = std::move(normalized_missing).value();
     }
-    auto description = std::string{authored_->description()};
-    auto instruction = authored_->render_instruction();
+    auto instruction = make_instruction_message(authored_->description(),
+                                                authored_->instruction_snapshot().text());
     const auto max_iterations = authored_->max_iterations();
 
     wh::compose::graph_compile_options compile_options{};
@@ -613,7 +592,7 @@ private:
                   })};
         },
         react_detail::make_prepare_request_options(
-            std::move(description), std::move(instruction),
+            std::move(instruction),
             std::vector<wh::schema::tool_schema_definition>{toolset.schemas().begin(),
                                                             toolset.schemas().end()}));
     auto prepare_request_added = lowered.add_lambda(std::move(prepare_request));
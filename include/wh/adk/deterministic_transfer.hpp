@@ -2,10 +2,14 @@
 // history rewriting, and idempotent transfer-message emission.
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -51,6 +55,26 @@ enum class transfer_completion_kind {
   interrupt,
 };
 
+/// How one run of history messages is presented to a target agent.
+enum class transfer_rewrite_kind : std::uint8_t {
+  /// Messages are forwarded unchanged.
+  keep = 0U,
+  /// Transfer assistant/tool messages are dropped by the trim options.
+  trim,
+  /// Foreign assistant/tool messages are demoted to context text.
+  context,
+};
+
+/// One contiguous run of history indices sharing one rewrite kind.
+struct transfer_rewrite_span {
+  /// First history index covered by this span.
+  std::size_t begin{0U};
+  /// One past the last history index covered by this span.
+  std::size_t end{0U};
+  /// Rewrite applied to every message in `[begin, end)`.
+  transfer_rewrite_kind kind{transfer_rewrite_kind::keep};
+};
+
 /// Bridge-local deterministic transfer state that can be checkpointed or
 /// projected outward without leaking runtime internals.
 struct deterministic_transfer_state {
@@ -149,6 +173,50 @@ namespace detail::transfer {
          message.tool_name == deterministic_transfer_tool_name && !message.tool_call_id.empty();
 }
 
+[[nodiscard]] inline auto classify_rewrite(const wh::schema::message &message,
+                                           const std::string_view current_agent_name,
+                                           const resolved_transfer_trim_options trim)
+    -> transfer_rewrite_kind {
+  const bool trim_assistant =
+      trim.trim_assistant_transfer_message && is_transfer_assistant_message(message);
+  const bool trim_tool = trim.trim_tool_transfer_pair && is_transfer_tool_message(message);
+  if (trim_assistant || trim_tool) {
+    return transfer_rewrite_kind::trim;
+  }
+
+  const bool foreign_assistant = message.role == wh::schema::message_role::assistant &&
+                                 !message.name.empty() && message.name != current_agent_name;
+  const bool foreign_tool = message.role == wh::schema::message_role::tool &&
+                            !message.name.empty() && message.name != current_agent_name;
+  if (foreign_assistant || foreign_tool) {
+    return transfer_rewrite_kind::context;
+  }
+  return transfer_rewrite_kind::keep;
+}
+
+template <typename event_t>
+[[nodiscard]] inline auto parent_visible_message(const run_path &exact_run_path, event_t &event)
+    -> wh::core::result<std::conditional_t<std::is_const_v<event_t>, const wh::schema::message *,
+                                           wh::schema::message *>> {
+  using message_ptr = std::conditional_t<std::is_const_v<event_t>, const wh::schema::message *,
+                                         wh::schema::message *>;
+  if (!run_path_matches(event.metadata, exact_run_path)) {
+    return message_ptr{nullptr};
+  }
+  if (const auto *control = std::get_if<control_action>(&event.payload);
+      control != nullptr && control->kind == control_action_kind::interrupt) {
+    return message_ptr{nullptr};
+  }
+  auto *message = std::get_if<message_event>(&event.payload);
+  if (message == nullptr) {
+    return message_ptr{nullptr};
+  }
+  if (auto *value = std::get_if<wh::schema::message>(&message->content); value != nullptr) {
+    return message_ptr{value};
+  }
+  return wh::core::result<message_ptr>::failure(wh::core::errc::not_supported);
+}
+
 } // namespace detail::transfer
 
 /// Builds the assistant-side transfer tool-call message.
@@ -316,22 +384,27 @@ namespace detail::transfer {
 /// exact bridge-visible path and the payload is not an interrupt control.
 inline auto record_parent_visible_event(deterministic_transfer_state &state,
                                         const agent_event &event) -> wh::core::result<void> {
-  if (!(event.metadata.path == state.exact_run_path)) {
-    return {};
+  auto message = detail::transfer::parent_visible_message(state.exact_run_path, event);
+  if (message.has_error()) {
+    return wh::core::result<void>::failure(message.error());
   }
-  if (const auto *control = std::get_if<control_action>(&event.payload);
-      control != nullptr && control->kind == control_action_kind::interrupt) {
-    return {};
+  if (message.value() != nullptr) {
+    state.visible_history.push_back(*message.value());
   }
-  const auto *message = std::get_if<message_event>(&event.payload);
-  if (message == nullptr) {
-    return {};
+  return {};
+}
+
+/// Same as the const overload, but moves the recorded message out of `event`.
+inline auto record_parent_visible_event(deterministic_transfer_state &state, agent_event &&event)
+    -> wh::core::result<void> {
+  auto message = detail::transfer::parent_visible_message(state.exact_run_path, event);
+  if (message.has_error()) {
+    return wh::core::result<void>::failure(message.error());
   }
-  if (const auto *value = std::get_if<wh::schema::message>(&message->content); value != nullptr) {
-    state.visible_history.push_back(*value);
-    return {};
+  if (message.value() != nullptr) {
+    state.visible_history.push_back(std::move(*message.value()));
   }
-  return wh::core::result<void>::failure(wh::core::errc::not_supported);
+  return {};
 }
 
 /// Rewrites transfer history for one target agent by trimming configured
@@ -342,32 +415,139 @@ inline auto record_parent_visible_event(deterministic_transfer_state &state,
   std::vector<wh::schema::message> rewritten{};
   rewritten.reserve(history.size());
 
-  for (std::size_t index = 0U; index < history.size(); ++index) {
-    const auto &message = history[index];
-
-    const bool trim_assistant = trim.trim_assistant_transfer_message &&
-                                detail::transfer::is_transfer_assistant_message(message);
-    const bool trim_tool =
-        trim.trim_tool_transfer_pair && detail::transfer::is_transfer_tool_message(message);
-    if (trim_assistant || trim_tool) {
-      continue;
-    }
-
-    const bool foreign_assistant = message.role == wh::schema::message_role::assistant &&
-                                   !message.name.empty() && message.name != current_agent_name;
-    const bool foreign_tool = message.role == wh::schema::message_role::tool &&
-                              !message.name.empty() && message.name != current_agent_name;
-    if (foreign_assistant || foreign_tool) {
+  for (const auto &message : history) {
+    switch (detail::transfer::classify_rewrite(message, current_agent_name, trim)) {
+    case transfer_rewrite_kind::keep:
+      rewritten.push_back(message);
+      break;
+    case transfer_rewrite_kind::trim:
+      break;
+    case transfer_rewrite_kind::context:
       rewritten.push_back(
           detail::transfer::make_context_message(detail::transfer::make_context_text(message)));
-      continue;
+      break;
     }
-
-    rewritten.push_back(message);
   }
   return rewritten;
 }
 
+/// Incremental `rewrite_transfer_history` over one append-only history.
+///
+/// The caller keeps owning the messages; the view only records, per target
+/// agent, rewrite spans over history indices plus one cached context message
+/// per demoted history slot. Each call classifies and renders only messages
+/// appended since that agent's previous call, so a handoff no longer re-walks
+/// the whole conversation. Messages already observed must not be mutated; a
+/// history shorter than the observed one resets the view.
+class transfer_history_view {
+public:
+  /// Returns `agent_name`'s rewrite spans after extending them over new messages.
+  [[nodiscard]] auto overlay(const std::span<const wh::schema::message> history,
+                             const std::string_view agent_name,
+                             const resolved_transfer_trim_options trim = {})
+      -> std::span<const transfer_rewrite_span> {
+    return extend(history, agent_name, trim).spans;
+  }
+
+  /// Materializes the rewritten request for `agent_name`; equals
+  /// `rewrite_transfer_history(history, agent_name, trim)`.
+  [[nodiscard]] auto rewrite(const std::span<const wh::schema::message> history,
+                             const std::string_view agent_name,
+                             const resolved_transfer_trim_options trim = {})
+      -> std::vector<wh::schema::message> {
+    const auto &overlay = extend(history, agent_name, trim);
+    std::vector<wh::schema::message> rewritten{};
+    rewritten.reserve(overlay.output_size);
+    for (const auto &span : overlay.spans) {
+      switch (span.kind) {
+      case transfer_rewrite_kind::keep:
+        rewritten.insert(rewritten.end(), history.begin() + static_cast<std::ptrdiff_t>(span.begin),
+                         history.begin() + static_cast<std::ptrdiff_t>(span.end));
+        break;
+      case transfer_rewrite_kind::trim:
+        break;
+      case transfer_rewrite_kind::context:
+        for (auto index = span.begin; index < span.end; ++index) {
+          rewritten.push_back(*context_[index]);
+        }
+        break;
+      }
+    }
+    return rewritten;
+  }
+
+  /// Returns how many history messages the view has observed.
+  [[nodiscard]] auto observed_size() const noexcept -> std::size_t { return context_.size(); }
+
+  /// Drops every overlay and cached context message.
+  auto reset() -> void {
+    context_.clear();
+    overlays_.clear();
+  }
+
+private:
+  struct agent_overlay {
+    /// Trim options the spans were computed with.
+    resolved_transfer_trim_options trim{};
+    /// First history index not yet classified for this agent.
+    std::size_t cursor{0U};
+    /// Message count produced by `rewrite`.
+    std::size_t output_size{0U};
+    /// Coalesced rewrite spans over `[0, cursor)`.
+    std::vector<transfer_rewrite_span> spans{};
+  };
+
+  [[nodiscard]] auto extend(const std::span<const wh::schema::message> history,
+                            const std::string_view agent_name,
+                            const resolved_transfer_trim_options trim) -> const agent_overlay & {
+    if (history.size() < context_.size()) {
+      reset();
+    }
+    if (context_.size() < history.size()) {
+      context_.resize(history.size());
+    }
+
+    auto iter = overlays_.find(agent_name);
+    if (iter == overlays_.end()) {
+      iter = overlays_.emplace(std::string{agent_name}, agent_overlay{.trim = trim}).first;
+    }
+    auto &overlay = iter->second;
+    if (overlay.trim.trim_assistant_transfer_message != trim.trim_assistant_transfer_message ||
+        overlay.trim.trim_tool_transfer_pair != trim.trim_tool_transfer_pair) {
+      overlay = agent_overlay{.trim = trim};
+    }
+
+    for (; overlay.cursor < history.size(); ++overlay.cursor) {
+      const auto index = overlay.cursor;
+      const auto kind = detail::transfer::classify_rewrite(history[index], agent_name, trim);
+      if (kind == transfer_rewrite_kind::context && !context_[index].has_value()) {
+        context_[index] = detail::transfer::make_context_message(
+            detail::transfer::make_context_text(history[index]));
+      }
+      if (kind != transfer_rewrite_kind::trim) {
+        ++overlay.output_size;
+      }
+      if (!overlay.spans.empty() && overlay.spans.back().kind == kind) {
+        overlay.spans.back().end = index + 1U;
+        continue;
+      }
+      overlay.spans.push_back(transfer_rewrite_span{
+          .begin = index,
+          .end = index + 1U,
+          .kind = kind,
+      });
+    }
+    return overlay;
+  }
+
+  /// Context message cached per history slot, filled on first demotion.
+  std::vector<std::optional<wh::schema::message>> context_{};
+  /// Rewrite overlays keyed by target agent name.
+  std::unordered_map<std::string, agent_overlay, wh::core::transparent_string_hash,
+                     wh::core::transparent_string_equal>
+      overlays_{};
+};
+
 /// Appends one transfer assistant/tool message pair exactly once when the
 /// transfer completed normally.
 inline auto append_transfer_messages_once(std::vector<wh::schema::message> &history,
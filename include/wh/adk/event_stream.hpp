@@ -86,10 +86,17 @@ using agent_event_stream_try_result =
   return closed;
 }
 
+/// Default ring bounds for ADK event streams: a session that never emits holds
+/// no slots and a drained one keeps at most `initial`, while token-rate
+/// producers can run ahead of the consumer before hitting `full`.
+inline constexpr wh::core::ring_capacity_policy default_agent_event_stream_capacity{
+    .initial = 8U, .max = 1024U};
+
 /// Creates one ADK event-stream writer and reader pair.
-[[nodiscard]] inline auto make_agent_event_stream()
+[[nodiscard]] inline auto make_agent_event_stream(
+    const wh::core::ring_capacity_policy capacity = default_agent_event_stream_capacity)
     -> std::pair<agent_event_stream_writer, agent_event_stream_reader> {
-  auto [writer, reader] = wh::schema::stream::make_pipe_stream<agent_event>(64U);
+  auto [writer, reader] = wh::schema::stream::make_pipe_stream<agent_event>(capacity);
   return {agent_event_stream_writer{std::move(writer)},
           agent_event_stream_reader{std::move(reader)}};
 }
@@ -0,0 +1,148 @@
+// Defines ADK run-path values and the persistent prefix chain used to forward
+// events through nested agent scopes without rewriting their paths.
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "wh/core/address.hpp"
+#include "wh/core/small_vector.hpp"
+
+namespace wh::adk {
+
+/// Stable run-path alias shared across ADK authoring and diagnostics.
+using run_path = wh::core::address;
+
+/// Persistent, parent-linked run-path prefix shared by forwarded events.
+///
+/// Each node owns one outer scope block and links to the inner prefix it wraps,
+/// so prepending a nesting level is O(1) and never copies inner segments.
+class run_path_prefix {
+  struct node {
+    /// Segments contributed by this nesting level.
+    run_path block{};
+    /// Inner prefix wrapped by this level; null for the innermost level.
+    std::shared_ptr<const node> inner{};
+    /// Total segment count of this node and every inner node.
+    std::size_t segment_count{0U};
+  };
+
+public:
+  run_path_prefix() = default;
+
+  /// Returns a new prefix with `outer` placed before every current segment.
+  [[nodiscard]] auto prepend(run_path outer) const -> run_path_prefix {
+    if (outer.empty()) {
+      return *this;
+    }
+    const auto count = outer.size() + size();
+    run_path_prefix next{};
+    next.head_ = std::make_shared<const node>(node{
+        .block = std::move(outer),
+        .inner = head_,
+        .segment_count = count,
+    });
+    return next;
+  }
+
+  /// Returns true when no nesting level has been prepended.
+  [[nodiscard]] auto empty() const noexcept -> bool { return head_ == nullptr; }
+
+  /// Total number of deferred segments across all nesting levels.
+  [[nodiscard]] auto size() const noexcept -> std::size_t {
+    return head_ == nullptr ? 0U : head_->segment_count;
+  }
+
+  /// Returns true when both prefixes share the same chain head.
+  [[nodiscard]] auto same_chain(const run_path_prefix &other) const noexcept -> bool {
+    return head_ == other.head_;
+  }
+
+  /// Visits deferred segments outermost first, then every `suffix` segment.
+  template <typename visitor_t>
+  auto visit(const run_path &suffix, visitor_t &&visitor) const -> void {
+    for (const auto *level = head_.get(); level != nullptr; level = level->inner.get()) {
+      for (const auto &segment : level->block.segments()) {
+        visitor(std::string_view{segment});
+      }
+    }
+    for (const auto &segment : suffix.segments()) {
+      visitor(std::string_view{segment});
+    }
+  }
+
+  /// Materializes this prefix followed by `suffix` in one linear pass.
+  [[nodiscard]] auto materialize(const run_path &suffix) const -> run_path {
+    if (empty()) {
+      return suffix;
+    }
+    wh::core::small_vector<std::string_view, 16U> views{};
+    views.reserve(size() + suffix.size());
+    visit(suffix, [&views](const std::string_view segment) { views.push_back(segment); });
+    return run_path::from_segments({views.data(), views.size()});
+  }
+
+  /// Compares this prefix followed by `suffix` against `expected` in place.
+  [[nodiscard]] auto matches(const run_path &suffix, const run_path &expected) const -> bool {
+    if (size() + suffix.size() != expected.size()) {
+      return false;
+    }
+    const auto segments = expected.segments();
+    std::size_t index = 0U;
+    bool equal = true;
+    visit(suffix, [&](const std::string_view segment) {
+      equal = equal && segment == segments[index];
+      ++index;
+    });
+    return equal;
+  }
+
+private:
+  /// Outermost nesting level, or null when empty.
+  std::shared_ptr<const node> head_{};
+};
+
+/// Concatenates two run paths without mutating either source path.
+[[nodiscard]] inline auto append_run_path_prefix(const run_path &prefix, const run_path &suffix)
+    -> run_path {
+  return run_path_prefix{}.prepend(prefix).materialize(suffix);
+}
+
+/// Per-nesting-level forwarder that defers one scope prefix onto event chains.
+///
+/// Events streamed by the same child share their inner chain, so the forwarder
+/// reuses the node it prepended last and forwards each token without allocating.
+class run_path_forwarder {
+public:
+  run_path_forwarder() = default;
+
+  /// Binds this forwarder to the scope path of one nesting level.
+  explicit run_path_forwarder(run_path prefix) : prefix_(std::move(prefix)) {}
+
+  /// Returns the scope path prepended by this forwarder.
+  [[nodiscard]] auto prefix() const noexcept -> const run_path & { return prefix_; }
+
+  /// Returns `inner` wrapped by this level's scope path.
+  [[nodiscard]] auto forward(const run_path_prefix &inner) -> run_path_prefix {
+    if (!cached_ || !last_inner_.same_chain(inner)) {
+      last_inner_ = inner;
+      last_outer_ = inner.prepend(prefix_);
+      cached_ = true;
+    }
+    return last_outer_;
+  }
+
+private:
+  /// Scope path contributed by this nesting level.
+  run_path prefix_{};
+  /// Inner chain observed by the last forwarded event.
+  run_path_prefix last_inner_{};
+  /// Chain produced for `last_inner_`.
+  run_path_prefix last_outer_{};
+  /// True once `last_outer_` holds a forwarded chain.
+  bool cached_{false};
+};
+
+} // namespace wh::adk
@@ -13,8 +13,10 @@
 #include <stdexec/execution.hpp>
 
 #include "wh/adk/event_stream.hpp"
+#include "wh/adk/run_path.hpp"
 #include "wh/compose/graph/invoke_types.hpp"
 #include "wh/compose/node/execution.hpp"
+#include "wh/compose/runtime/checkpoint_parking.hpp"
 #include "wh/compose/runtime/resume.hpp"
 #include "wh/core/any.hpp"
 #include "wh/core/result.hpp"
@@ -43,20 +45,27 @@ struct agent_run_output {
 /// Canonical success/failure boundary for one wrapped agent execution.
 using agent_run_result = wh::core::result<agent_run_output>;
 
-/// Concatenates two run paths without mutating either source path.
-[[nodiscard]] inline auto append_run_path_prefix(const run_path &prefix, const run_path &suffix)
-    -> run_path {
-  run_path combined = prefix;
-  for (const auto &segment : suffix.segments()) {
-    combined = combined.append(segment);
-  }
-  return combined;
+/// Prefixes one event run path with the supplied parent path, materializing
+/// any deferred prefix in the same linear pass.
+[[nodiscard]] inline auto prefix_agent_event(agent_event event, const run_path &prefix)
+    -> agent_event {
+  event.metadata.path =
+      event.metadata.path_prefix.prepend(prefix).materialize(event.metadata.path);
+  event.metadata.path_prefix = {};
+  return event;
 }
 
-/// Prefixes one event run path with the supplied parent path.
-[[nodiscard]] inline auto prefix_agent_event(agent_event event, const run_path &prefix)
+/// Forwards one event through a nesting level in O(1) by deferring the level's
+/// scope path onto the shared prefix chain instead of rewriting `path`.
+[[nodiscard]] inline auto prefix_agent_event(agent_event event, run_path_forwarder &forwarder)
     -> agent_event {
-  event.metadata.path = append_run_path_prefix(prefix, event.metadata.path);
+  event.metadata.path_prefix = forwarder.forward(event.metadata.path_prefix);
+  return event;
+}
+
+/// Folds deferred prefixes into `path` so the event owns one flat run path.
+[[nodiscard]] inline auto materialize_agent_event_path(agent_event event) -> agent_event {
+  materialize_run_path(event.metadata);
   return event;
 }
 
@@ -148,6 +157,36 @@ struct resume_request {
   };
 }
 
+/// Routes one resume request to a run parked in `parking`.
+///
+/// Fills the restore checkpoint id and any missing target locations from the
+/// parked interrupt index, so the resume restores the live state directly and
+/// needs no prior run context. Returns true when at least one target matched.
+[[nodiscard]] inline auto route_parked_resume(const wh::compose::checkpoint_parking_lot &parking,
+                                              resume_request &request) -> bool {
+  auto &load = request.run.options.compose_controls.checkpoint.load;
+  bool matched = false;
+  for (auto &target : request.targets) {
+    auto parked = parking.find_interrupt(target.interrupt_id);
+    if (!parked.has_value()) {
+      continue;
+    }
+    if (!load.has_value()) {
+      load.emplace();
+    }
+    if (!load->checkpoint_id.has_value()) {
+      load->checkpoint_id = parked->checkpoint_id;
+    } else if (*load->checkpoint_id != parked->checkpoint_id) {
+      continue;
+    }
+    if (!target.location.has_value()) {
+      target.location = std::move(parked->location);
+    }
+    matched = true;
+  }
+  return matched;
+}
+
 namespace detail {
 
 template <typename impl_t>
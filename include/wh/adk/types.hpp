@@ -7,7 +7,7 @@
 #include <utility>
 #include <variant>
 
-#include "wh/core/address.hpp"
+#include "wh/adk/run_path.hpp"
 #include "wh/core/any.hpp"
 #include "wh/core/error.hpp"
 #include "wh/core/result.hpp"
@@ -17,9 +17,6 @@
 
 namespace wh::adk {
 
-/// Stable run-path alias shared across ADK authoring and diagnostics.
-using run_path = wh::core::address;
-
 /// Type-erased single-consumer reader used by ADK message-stream events.
 using agent_message_stream_reader = wh::schema::stream::any_stream_reader<wh::schema::message>;
 
@@ -76,8 +73,12 @@ struct error_event {
 
 /// Extra metadata attached to every ADK event.
 struct event_metadata {
-  /// Stable run-path snapshot for this event.
+  /// Stable run-path snapshot for this event, relative to `path_prefix`.
   run_path path{};
+  /// Outer nesting levels deferred while an event is forwarded internally;
+  /// the full path is `path_prefix` followed by `path`. Public event readers
+  /// fold it into `path` before events reach consumers.
+  run_path_prefix path_prefix{};
   /// Agent name that emitted the event.
   std::string agent_name{};
   /// Tool name associated with the event, if any.
@@ -88,6 +89,26 @@ struct event_metadata {
       attributes{};
 };
 
+/// Returns the full run path of one event, materializing deferred prefixes.
+[[nodiscard]] inline auto resolve_run_path(const event_metadata &metadata) -> run_path {
+  return metadata.path_prefix.materialize(metadata.path);
+}
+
+/// Folds deferred prefixes into `path` so `metadata` owns one flat run path.
+inline auto materialize_run_path(event_metadata &metadata) -> void {
+  if (!metadata.path_prefix.empty()) {
+    metadata.path = resolve_run_path(metadata);
+    metadata.path_prefix = {};
+  }
+}
+
+/// Checks whether the full run path of one event equals `expected` without
+/// materializing deferred prefixes.
+[[nodiscard]] inline auto run_path_matches(const event_metadata &metadata,
+                                           const run_path &expected) -> bool {
+  return metadata.path_prefix.matches(metadata.path, expected);
+}
+
 /// Canonical ADK event payload variant.
 using agent_event_payload = std::variant<message_event, control_action, custom_event, error_event>;
 
@@ -210,6 +231,7 @@ template <> struct any_owned_traits<wh::adk::event_metadata> {
     }
     return wh::adk::event_metadata{
         .path = value.path,
+        .path_prefix = value.path_prefix,
         .agent_name = value.agent_name,
         .tool_name = value.tool_name,
         .attributes = std::move(attributes).value(),
@@ -224,6 +246,7 @@ template <> struct any_owned_traits<wh::adk::event_metadata> {
     }
     return wh::adk::event_metadata{
         .path = std::move(value.path),
+        .path_prefix = std::move(value.path_prefix),
         .agent_name = std::move(value.agent_name),
         .tool_name = std::move(value.tool_name),
         .attributes = std::move(attributes).value(),
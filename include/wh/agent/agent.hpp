@@ -126,6 +126,12 @@ public:
     return instruction_.render(separator);
   }
 
+  /// Returns the cached authored instruction rendering shared across turns.
+  [[nodiscard]] auto instruction_snapshot(const std::string_view separator = "\n") const
+      -> wh::agent::frozen_instruction {
+    return instruction_.snapshot(separator);
+  }
+
   /// Adopts one child agent before freeze.
   auto add_child(agent &&child) -> wh::core::result<void> {
     auto mutable_status = ensure_mutable();
@@ -251,6 +257,8 @@ public:
         return frozen;
       }
     }
+    // Render once so lowering on other threads only reads the cache.
+    static_cast<void>(instruction_.freeze());
     frozen_ = true;
     return {};
   }
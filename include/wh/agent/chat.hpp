@@ -78,6 +78,12 @@ public:
     return instruction_.render(separator);
   }
 
+  /// Returns the cached authored instruction rendering shared across turns.
+  [[nodiscard]] auto instruction_snapshot(const std::string_view separator = "\n") const
+      -> wh::agent::frozen_instruction {
+    return instruction_.snapshot(separator);
+  }
+
   /// Sets the optional output slot name written at graph exit.
   auto set_output_key(std::string output_key) -> wh::core::result<void> {
     auto mutable_status = ensure_mutable();
@@ -189,6 +195,8 @@ public:
     if (!model_binding_.has_value()) {
       return wh::core::result<void>::failure(wh::core::errc::not_found);
     }
+    // Render once so lowering on other threads only reads the cache.
+    static_cast<void>(instruction_.freeze());
     frozen_ = true;
     return {};
   }
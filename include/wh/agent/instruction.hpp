@@ -4,9 +4,11 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <memory>
 #include <span>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace wh::agent {
@@ -31,11 +33,50 @@ struct instruction_entry {
   std::size_t sequence{0U};
 };
 
+/// Immutable rendered instruction shared by every model turn of one agent.
+///
+/// Copies share one rendered string, so request builders can splice the text
+/// without re-running precedence resolution or concatenation.
+class frozen_instruction {
+public:
+  frozen_instruction() = default;
+
+  frozen_instruction(std::shared_ptr<const std::string> text, const std::size_t revision) noexcept
+      : text_(std::move(text)), revision_(revision) {}
+
+  /// Returns true when the rendered instruction has no text.
+  [[nodiscard]] auto empty() const noexcept -> bool { return text_ == nullptr || text_->empty(); }
+
+  /// Returns the rendered instruction text.
+  [[nodiscard]] auto text() const noexcept -> std::string_view {
+    return text_ == nullptr ? std::string_view{} : std::string_view{*text_};
+  }
+
+  /// Returns the shared rendered string; null when nothing was rendered.
+  [[nodiscard]] auto shared_text() const noexcept -> const std::shared_ptr<const std::string> & {
+    return text_;
+  }
+
+  /// Returns the builder revision this snapshot was rendered from.
+  [[nodiscard]] auto revision() const noexcept -> std::size_t { return revision_; }
+
+private:
+  /// Rendered text shared across copies.
+  std::shared_ptr<const std::string> text_{};
+  /// Builder revision observed at render time.
+  std::size_t revision_{0U};
+};
+
 /// Mutable instruction builder with predictable append/replace precedence.
+///
+/// `freeze()` renders eagerly and caches the result until a fragment is added.
+/// Every const member only reads that cache, so a builder frozen before it is
+/// shared can be rendered from any number of threads without locking.
 class instruction {
 public:
   /// Appends one fragment at `priority`.
   auto append(std::string text, const std::int32_t priority = 0) -> void {
+    invalidate();
     entries_.push_back(instruction_entry{
         .text = std::move(text),
         .priority = priority,
@@ -46,6 +87,7 @@ public:
 
   /// Replaces the current base instruction at `priority`.
   auto replace(std::string text, const std::int32_t priority = 0) -> void {
+    invalidate();
     entries_.push_back(instruction_entry{
         .text = std::move(text),
         .priority = priority,
@@ -62,10 +104,50 @@ public:
     return {entries_.data(), entries_.size()};
   }
 
+  /// Returns the fragment revision; it changes whenever a fragment is added.
+  [[nodiscard]] auto revision() const noexcept -> std::size_t { return next_sequence_; }
+
   /// Renders the final instruction string using deterministic precedence:
   /// highest-priority replace becomes the base, then append fragments at the
   /// same or higher priority are concatenated in stable order.
   [[nodiscard]] auto render(const std::string_view separator = "\n") const -> std::string {
+    if (cache_matches(separator)) {
+      return std::string{cached_.text()};
+    }
+    return render_uncached(separator);
+  }
+
+  /// Renders for `separator` and caches the result, rendering only when the
+  /// fragments or the separator changed since the previous call.
+  auto freeze(const std::string_view separator = "\n") -> frozen_instruction {
+    if (!cache_matches(separator)) {
+      cached_ = frozen_instruction{std::make_shared<const std::string>(render_uncached(separator)),
+                                   revision()};
+      cached_separator_.assign(separator);
+    }
+    return cached_;
+  }
+
+  /// Returns the frozen rendering for `separator` without touching the cache;
+  /// renders a fresh uncached snapshot when `freeze` has not covered it.
+  [[nodiscard]] auto snapshot(const std::string_view separator = "\n") const
+      -> frozen_instruction {
+    if (cache_matches(separator)) {
+      return cached_;
+    }
+    return frozen_instruction{std::make_shared<const std::string>(render_uncached(separator)),
+                              revision()};
+  }
+
+private:
+  /// Drops the cached rendering before a fragment mutation.
+  auto invalidate() noexcept -> void { cached_ = frozen_instruction{}; }
+
+  [[nodiscard]] auto cache_matches(const std::string_view separator) const noexcept -> bool {
+    return cached_.shared_text() != nullptr && cached_separator_ == separator;
+  }
+
+  [[nodiscard]] auto render_uncached(const std::string_view separator) const -> std::string {
     if (entries_.empty()) {
       return {};
     }
@@ -122,11 +204,14 @@ public:
     return rendered;
   }
 
-private:
   /// Stable fragment storage in insertion order.
   std::vector<instruction_entry> entries_{};
   /// Monotonic insertion sequence for deterministic ties.
   std::size_t next_sequence_{0U};
+  /// Last rendering written by `freeze`, reused until fragments change.
+  frozen_instruction cached_{};
+  /// Separator used by `cached_`.
+  std::string cached_separator_{};
 };
 
 } // namespace wh::agent
@@ -6,6 +6,7 @@
 #include <cctype>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -369,7 +370,8 @@ render_skill_tool_description_sender(const skill_capabilities &backend,
 }
 
 /// Creates a request transform that refreshes the skill-tool description and
-/// prepends the configured instruction on every model turn.
+/// prepends the configured instruction on every model turn. The instruction is
+/// rendered once when the transform is built and shared by every turn.
 [[nodiscard]] inline auto make_skill_request_transform(const skill_capabilities &backend,
                                                        const skill_tool_options &options = {})
     -> wh::core::result<wh::agent::middlewares::request_transform_binding> {
@@ -383,13 +385,15 @@ render_skill_tool_description_sender(const skill_capabilities &backend,
         wh::core::errc::invalid_argument);
   }
 
+  auto instruction = std::make_shared<const std::string>(make_skill_instruction(options));
+
   return wh::agent::middlewares::request_transform_binding{
       .sync = backend.list.sync
                   ? wh::agent::middlewares::sync_operation<
                         wh::agent::middlewares::request_transform_result, wh::model::chat_request,
-                        wh::core::run_context
-                            &>{[backend, options, tool_name](wh::model::chat_request request,
-                                                             wh::core::run_context &)
+                        wh::core::run_context &>{[backend, options, tool_name, instruction](
+                                                     wh::model::chat_request request,
+                                                     wh::core::run_context &)
                                    -> wh::agent::middlewares::request_transform_result {
                       auto description = render_skill_tool_description(backend, options);
                       if (description.has_error()) {
@@ -401,28 +405,20 @@ render_skill_tool_description_sender(const skill_capabilities &backend,
                           tool.description = description.value();
                         }
                       }
-                      auto instruction = make_skill_instruction(options);
-                      if (!instruction.empty()) {
-                        wh::schema::message message{};
-                        message.role = wh::schema::message_role::system;
-                        message.parts.emplace_back(wh::schema::text_part{std::move(instruction)});
-                        request.messages.insert(request.messages.begin(), std::move(message));
-                      }
+                      wh::agent::middlewares::prepend_system_text(request, instruction);
                       return request;
                     }}
                   : nullptr,
       .async = backend.list.async
                    ? wh::agent::middlewares::async_operation<
                          wh::agent::middlewares::request_transform_result, wh::model::chat_request,
-                         wh::core::run_context
-                             &>{[backend,
-                                 options, tool_name](wh::model::chat_request request,
-                                                     wh::core::run_context &)
+                         wh::core::run_context &>{[backend, options, tool_name, instruction](
+                                                      wh::model::chat_request request,
+                                                      wh::core::run_context &)
                                     -> wh::agent::middlewares::request_transform_sender {
                        return wh::agent::middlewares::request_transform_sender{
                            render_skill_tool_description_sender(backend, options) |
-                           stdexec::then([request = std::move(request), tool_name,
-                                          instruction = make_skill_instruction(options)](
+                           stdexec::then([request = std::move(request), tool_name, instruction](
                                              wh::core::result<std::string> description) mutable
                                              -> wh::agent::middlewares::request_transform_result {
                              if (description.has_error()) {
@@ -434,14 +430,7 @@ render_skill_tool_description_sender(const skill_capabilities &backend,
                                  tool.description = description.value();
                                }
                              }
-                             if (!instruction.empty()) {
-                               wh::schema::message message{};
-                               message.role = wh::schema::message_role::system;
-                               message.parts.emplace_back(
-                                   wh::schema::text_part{std::move(instruction)});
-                               request.messages.insert(request.messages.begin(),
-                                                       std::move(message));
-                             }
+                             wh::agent::middlewares::prepend_system_text(request, instruction);
                              return request;
                            })};
                      }}
@@ -2,6 +2,7 @@
 // tool bindings, and request transforms without introducing a second runtime.
 #pragma once
 
+#include <memory>
 #include <span>
 #include <string>
 #include <utility>
@@ -59,6 +60,19 @@ struct middleware_surface {
   std::vector<request_transform_binding> request_transforms{};
 };
 
+/// Inserts one system message carrying pre-rendered `text` at the front of
+/// `request`. Null or empty text leaves the request unchanged.
+inline auto prepend_system_text(wh::model::chat_request &request,
+                                const std::shared_ptr<const std::string> &text) -> void {
+  if (text == nullptr || text->empty()) {
+    return;
+  }
+  wh::schema::message message{};
+  message.role = wh::schema::message_role::system;
+  message.parts.emplace_back(wh::schema::text_part{*text});
+  request.messages.insert(request.messages.begin(), std::move(message));
+}
+
 namespace detail {
 
 template <typename status_t>
@@ -140,6 +140,12 @@ public:
     return instruction_.render(separator);
   }
 
+  /// Returns the cached authored instruction rendering shared across turns.
+  [[nodiscard]] auto instruction_snapshot(const std::string_view separator = "\n") const
+      -> wh::agent::frozen_instruction {
+    return instruction_.snapshot(separator);
+  }
+
   /// Registers one raw compose tool entry before freeze.
   auto add_tool_entry(wh::schema::tool_schema_definition schema, wh::compose::tool_entry entry,
                       const wh::agent::tool_registration registration = {})
@@ -319,6 +325,8 @@ public:
     if (!tools_.node_options().has_value()) {
       return wh::core::result<void>::failure(wh::core::errc::contract_violation);
     }
+    // Render once so lowering on other threads only reads the cache.
+    static_cast<void>(instruction_.freeze());
     frozen_ = true;
     return {};
   }
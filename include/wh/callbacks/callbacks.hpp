@@ -2,6 +2,7 @@
 // helpers.
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <type_traits>
@@ -17,7 +18,15 @@
 namespace wh::callbacks {
 
 /// Optional callback-manager sink reusable across component execution helpers.
+///
+/// Sinks are only populated when the source manager has at least one
+/// registration, so `has_value()` doubles as the "anyone listening" check that
+/// lets wrappers skip building callback state altogether.
 struct callback_sink {
+  // User-provided so `callback_sink{}` does not zero the inline manager
+  // storage, which dominated the cost of an unobserved call.
+  callback_sink() noexcept {}
+
   /// Borrowed manager used by sync call paths that do not outlive the source
   /// context.
   const manager *borrowed{nullptr};
@@ -25,6 +34,8 @@ struct callback_sink {
   std::optional<manager> owned{};
   /// Optional metadata applied to emitted callback run-info.
   std::optional<run_metadata> metadata{};
+  /// Borrowed metadata used by sync call paths instead of `metadata`.
+  const run_metadata *borrowed_metadata{nullptr};
 
   [[nodiscard]] auto has_value() const noexcept -> bool { return manager_ptr() != nullptr; }
 
@@ -34,20 +45,52 @@ struct callback_sink {
     }
     return borrowed;
   }
+
+  /// Returns the metadata overlay, or null when none is attached.
+  [[nodiscard]] auto metadata_ptr() const noexcept -> const run_metadata * {
+    if (metadata.has_value()) {
+      return std::addressof(metadata.value());
+    }
+    return borrowed_metadata;
+  }
+
+  /// Returns true when `current_stage` has a registration this run samples.
+  [[nodiscard]] auto active(const stage current_stage) const noexcept -> bool {
+    return active_any(manager::stage_bit(current_stage));
+  }
+
+  /// Returns true when any stage in `stages` has a registration this run
+  /// samples.
+  [[nodiscard]] auto active_any(const manager::stage_mask stages) const noexcept -> bool {
+    const auto *sink_manager = manager_ptr();
+    return sink_manager != nullptr && (sink_manager->dispatched_stages() & stages) != 0U;
+  }
 };
 
+/// Stages emitted around one component call: start, end and error.
+inline constexpr manager::stage_mask component_call_stages =
+    manager::stage_bit(stage::start) | manager::stage_bit(stage::end) |
+    manager::stage_bit(stage::error);
+
 /// Returns an empty sink when callback emission is disabled.
 [[nodiscard]] inline auto make_callback_sink() -> callback_sink { return {}; }
 
+/// Returns true when the context carries a manager with any registration.
+[[nodiscard]] inline auto has_callback_listeners(const wh::core::run_context &context) noexcept
+    -> bool {
+  return context.callbacks.has_value() && !context.callbacks->manager.empty();
+}
+
 /// Borrows callback-manager state from the provided run context for sync paths.
 [[nodiscard]] inline auto borrow_callback_sink(const wh::core::run_context &context)
     -> callback_sink {
   callback_sink sink{};
-  if (context.callbacks.has_value()) {
-    sink.borrowed = std::addressof(context.callbacks->manager);
+  if (!has_callback_listeners(context)) {
+    return sink;
   }
-  if (context.callbacks.has_value() && !context.callbacks->metadata.empty()) {
-    sink.metadata = context.callbacks->metadata;
+  sink.borrowed = std::addressof(context.callbacks->manager);
+  if (!context.callbacks->metadata.empty()) {
+    sink.borrowed_metadata = std::addressof(context.callbacks->metadata);
   }
   return sink;
 }
@@ -56,10 +99,11 @@ struct callback_sink {
 [[nodiscard]] inline auto make_callback_sink(const wh::core::run_context &context)
     -> callback_sink {
   callback_sink sink{};
-  if (context.callbacks.has_value()) {
-    sink.owned = context.callbacks->manager;
+  if (!has_callback_listeners(context)) {
+    return sink;
   }
-  if (context.callbacks.has_value() && !context.callbacks->metadata.empty()) {
+  sink.owned = context.callbacks->manager;
+  if (!context.callbacks->metadata.empty()) {
     sink.metadata = context.callbacks->metadata;
   }
   return sink;
@@ -68,31 +112,52 @@ struct callback_sink {
 /// Moves callback-manager state out of the provided run context.
 [[nodiscard]] inline auto make_callback_sink(wh::core::run_context &&context) -> callback_sink {
   callback_sink sink{};
-  if (context.callbacks.has_value()) {
-    sink.owned = std::move(context.callbacks->manager);
+  if (!has_callback_listeners(context)) {
+    return sink;
   }
-  if (context.callbacks.has_value() && !context.callbacks->metadata.empty()) {
+  sink.owned = std::move(context.callbacks->manager);
+  if (!context.callbacks->metadata.empty()) {
     sink.metadata = std::move(context.callbacks->metadata);
   }
   return sink;
 }
 
+/// Applies sink metadata to `info` in place; returns it unchanged when none.
+[[nodiscard]] inline auto bind_run_info(const callback_sink &sink, run_info info) -> run_info {
+  const auto *metadata = sink.metadata_ptr();
+  if (metadata == nullptr) {
+    return info;
+  }
+  return apply_callback_run_metadata(std::move(info), *metadata);
+}
+
 template <typename payload_t>
 /// Emits one callback event through a detached callback sink.
 inline auto emit(const callback_sink &sink, const stage current_stage, const payload_t &payload,
                  const run_info &info) -> void {
-  const auto *sink_manager = sink.manager_ptr();
-  if (sink_manager == nullptr) {
+  if (!sink.active(current_stage)) {
     return;
   }
-  if (sink.metadata.has_value()) {
+  const auto *sink_manager = sink.manager_ptr();
+  if (const auto *metadata = sink.metadata_ptr(); metadata != nullptr) {
     sink_manager->dispatch(current_stage, make_event_view(payload),
-                           apply_callback_run_metadata(info, *sink.metadata));
+                           apply_callback_run_metadata(info, *metadata));
     return;
   }
   sink_manager->dispatch(current_stage, make_event_view(payload), info);
 }
 
+template <typename payload_t>
+/// Emits one callback event whose run-info already went through
+/// `bind_run_info`; the run-info is borrowed, never copied.
+inline auto emit_bound(const callback_sink &sink, const stage current_stage,
+                       const payload_t &payload, const run_info &bound_info) -> void {
+  if (!sink.active(current_stage)) {
+    return;
+  }
+  sink.manager_ptr()->dispatch(current_stage, make_event_view(payload), bound_info);
+}
+
 template <typename options_t>
 concept component_options_provider = requires(const options_t &options) {
   { options.component_options() } -> std::same_as<const wh::core::component_options &>;
@@ -129,4 +194,44 @@ inline auto emit(const callback_sink &sink, const stage current_stage, const sta
   emit(sink, current_stage, state.event, state.run_info);
 }
 
+template <typename state_t>
+  requires requires(const state_t &state) {
+    state.event;
+    state.run_info;
+  }
+/// Emits one callback event from a state bundle whose run-info is bound.
+inline auto emit_bound(const callback_sink &sink, const stage current_stage,
+                       const state_t &state) -> void {
+  emit_bound(sink, current_stage, state.event, state.run_info);
+}
+
+/// Builds one `{event, run_info}` state bundle only when `sink` has a listener
+/// for one of `stages`.
+///
+/// The returned state carries run-info already bound to the sink metadata, so
+/// every later emission borrows it instead of re-applying the overlay.
+template <typename make_state_t>
+[[nodiscard]] inline auto
+make_lazy_callback_state(const callback_sink &sink, make_state_t &&make_state,
+                         const manager::stage_mask stages = component_call_stages)
+    -> std::optional<std::remove_cvref_t<std::invoke_result_t<make_state_t &>>> {
+  using state_t = std::remove_cvref_t<std::invoke_result_t<make_state_t &>>;
+  if (!sink.active_any(stages)) {
+    return std::nullopt;
+  }
+  std::optional<state_t> state{std::in_place, std::invoke(make_state)};
+  state->run_info = bind_run_info(sink, std::move(state->run_info));
+  return state;
+}
+
+template <typename state_t>
+/// Emits one callback event from a lazily built state; no-op when absent.
+inline auto emit(const callback_sink &sink, const stage current_stage,
+                 const std::optional<state_t> &state) -> void {
+  if (!state.has_value()) {
+    return;
+  }
+  emit_bound(sink, current_stage, *state);
+}
+
 } // namespace wh::callbacks
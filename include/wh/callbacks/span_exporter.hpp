@@ -0,0 +1,583 @@
+// Defines a callback handler that turns start/end/error events into
+// OTLP-shaped span records and exports them in background batches.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "wh/callbacks/interface.hpp"
+#include "wh/callbacks/manager.hpp"
+#include "wh/core/error.hpp"
+#include "wh/core/function.hpp"
+#include "wh/core/result.hpp"
+
+namespace wh::callbacks {
+
+/// OTLP span status code.
+enum class span_status_code : std::uint8_t {
+  /// Status was not set.
+  unset = 0U,
+  /// Call completed successfully.
+  ok,
+  /// Call ended on the error stage.
+  error,
+};
+
+/// One string-valued span attribute.
+struct span_attribute {
+  /// Attribute key.
+  std::string key{};
+  /// Attribute value.
+  std::string value{};
+};
+
+/// One finished span in OTLP field layout.
+struct span_record {
+  /// Trace id copied from callback run info.
+  std::string trace_id{};
+  /// Span id from run info, or a generated id when the component set none.
+  std::string span_id{};
+  /// Parent span id from run info.
+  std::string parent_span_id{};
+  /// Span name, taken from the run-info name or type.
+  std::string name{};
+  /// Start time in nanoseconds since the Unix epoch.
+  std::uint64_t start_time_unix_nano{0U};
+  /// End time in nanoseconds since the Unix epoch.
+  std::uint64_t end_time_unix_nano{0U};
+  /// Final span status.
+  span_status_code status{span_status_code::unset};
+  /// Error description for `span_status_code::error`.
+  std::string status_message{};
+  /// Component implementation type, exported as `wh.component.type`.
+  std::string component_type{};
+  /// Component category, exported as `wh.component.kind`.
+  wh::core::component_kind component_kind{wh::core::component_kind::custom};
+  /// Slash-joined node path, exported as `wh.node_path` when non-empty.
+  std::string node_path{};
+  /// Additional attributes.
+  std::vector<span_attribute> attributes{};
+};
+
+/// Destination for one exported span batch.
+using span_sink =
+    wh::core::callback_function<wh::core::result<void>(std::span<const span_record>) const>;
+
+/// Buffering and batching limits for one exporter.
+struct span_exporter_options {
+  /// Finished spans buffered per producer thread; rounded up to a power of two.
+  std::size_t thread_buffer_capacity{512U};
+  /// Maximum spans handed to the sink in one call.
+  std::size_t max_batch_size{512U};
+  /// Background export period.
+  std::chrono::milliseconds flush_interval{200};
+  /// Started calls tracked at once; the oldest is abandoned beyond this.
+  std::size_t max_open_spans{4096U};
+  /// Age after which a started call that never ended is abandoned.
+  std::chrono::milliseconds open_span_timeout{std::chrono::minutes{10}};
+};
+
+/// Exporter counters.
+struct span_exporter_stats {
+  /// Spans accepted by the sink.
+  std::uint64_t exported{0U};
+  /// Spans lost because a thread buffer was full.
+  std::uint64_t dropped{0U};
+  /// Spans in batches the sink rejected.
+  std::uint64_t failed{0U};
+  /// Started calls evicted by age or capacity before their end event.
+  std::uint64_t abandoned{0U};
+};
+
+namespace detail {
+
+[[nodiscard]] inline auto span_now_unix_nano() noexcept -> std::uint64_t {
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                        std::chrono::system_clock::now().time_since_epoch())
+                                        .count());
+}
+
+[[nodiscard]] inline auto span_component_kind_name(const wh::core::component_kind kind) noexcept
+    -> std::string_view {
+  switch (kind) {
+  case wh::core::component_kind::model:
+    return "model";
+  case wh::core::component_kind::prompt:
+    return "prompt";
+  case wh::core::component_kind::tool:
+    return "tool";
+  case wh::core::component_kind::retriever:
+    return "retriever";
+  case wh::core::component_kind::embedding:
+    return "embedding";
+  case wh::core::component_kind::indexer:
+    return "indexer";
+  case wh::core::component_kind::document:
+    return "document";
+  case wh::core::component_kind::custom:
+    return "custom";
+  }
+  return "custom";
+}
+
+inline auto span_hash_append(std::uint64_t &hash, const std::string_view text) noexcept -> void {
+  hash ^= std::hash<std::string_view>{}(text) + 0x9e3779b97f4a7c15ULL + (hash << 6U) + (hash >> 2U);
+}
+
+/// Identity of one in-flight call; start and end of a call share run info.
+[[nodiscard]] inline auto open_span_key(const run_info &info) noexcept -> std::uint64_t {
+  std::uint64_t hash = 0U;
+  span_hash_append(hash, info.trace_id);
+  span_hash_append(hash, info.span_id);
+  span_hash_append(hash, info.parent_span_id);
+  span_hash_append(hash, info.name);
+  span_hash_append(hash, info.type);
+  for (const auto &segment : info.node_path.segments()) {
+    span_hash_append(hash, segment);
+  }
+  return hash;
+}
+
+[[nodiscard]] inline auto next_span_id_bits() noexcept -> std::uint64_t {
+  thread_local std::uint64_t state =
+      static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) ^
+      static_cast<std::uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+  state += 0x9e3779b97f4a7c15ULL;
+  auto mixed = state;
+  mixed = (mixed ^ (mixed >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+  mixed = (mixed ^ (mixed >> 27U)) * 0x94d049bb133111ebULL;
+  return mixed ^ (mixed >> 31U);
+}
+
+/// Formats 64 id bits as 16 lowercase hex digits.
+[[nodiscard]] inline auto format_span_id(const std::uint64_t bits) -> std::string {
+  constexpr char digits[] = "0123456789abcdef";
+  std::string id(16U, '0');
+  for (std::size_t index = 0U; index < id.size(); ++index) {
+    id[id.size() - 1U - index] = digits[(bits >> (index * 4U)) & 0xfU];
+  }
+  return id;
+}
+
+/// Single-producer single-consumer ring of finished spans.
+///
+/// The producing thread only writes `tail_`; the exporter only writes `head_`.
+/// The producer retires the ring when its thread exits; the exporter orphans
+/// it when the exporter is destroyed.
+class span_ring {
+public:
+  explicit span_ring(const std::size_t capacity) : slots_(round_up(capacity)) {
+    mask_ = slots_.size() - 1U;
+  }
+
+  /// Pushes one span; returns false when the ring is full.
+  auto try_push(span_record &&record) -> bool {
+    const auto tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) >= slots_.size()) {
+      return false;
+    }
+    slots_[tail & mask_] = std::move(record);
+    tail_.store(tail + 1U, std::memory_order_release);
+    return true;
+  }
+
+  /// Marks the producing thread as gone; its last span is already published.
+  auto retire() noexcept -> void { retired_.store(true, std::memory_order_release); }
+
+  [[nodiscard]] auto retired() const noexcept -> bool {
+    return retired_.load(std::memory_order_acquire);
+  }
+
+  /// Marks the owning exporter as gone so threads stop caching the ring.
+  auto orphan() noexcept -> void { orphaned_.store(true, std::memory_order_release); }
+
+  [[nodiscard]] auto orphaned() const noexcept -> bool {
+    return orphaned_.load(std::memory_order_acquire);
+  }
+
+  /// Moves every published span into `out`; returns the number moved.
+  auto drain(std::vector<span_record> &out) -> std::size_t {
+    auto head = head_.load(std::memory_order_relaxed);
+    const auto tail = tail_.load(std::memory_order_acquire);
+    const auto count = tail - head;
+    for (; head != tail; ++head) {
+      out.push_back(std::move(slots_[head & mask_]));
+    }
+    head_.store(head, std::memory_order_release);
+    return count;
+  }
+
+private:
+  [[nodiscard]] static auto round_up(const std::size_t capacity) -> std::size_t {
+    std::size_t rounded = 2U;
+    while (rounded < capacity) {
+      rounded <<= 1U;
+    }
+    return rounded;
+  }
+
+  std::vector<span_record> slots_{};
+  std::size_t mask_{0U};
+  alignas(64) std::atomic<std::size_t> head_{0U};
+  alignas(64) std::atomic<std::size_t> tail_{0U};
+  std::atomic<bool> retired_{false};
+  std::atomic<bool> orphaned_{false};
+};
+
+/// Rings the calling thread produces into, one per live exporter. Destroyed
+/// at thread exit, which retires every ring so `flush` can erase it.
+class span_ring_owner {
+public:
+  span_ring_owner() = default;
+  span_ring_owner(const span_ring_owner &) = delete;
+  auto operator=(const span_ring_owner &) -> span_ring_owner & = delete;
+
+  ~span_ring_owner() {
+    for (const auto &current : entries_) {
+      current.ring->retire();
+    }
+  }
+
+  /// Returns this thread's ring of exporter `state_id`, or null. Rings of
+  /// destroyed exporters are dropped on the way.
+  [[nodiscard]] auto find(const std::uint64_t state_id) -> span_ring * {
+    std::erase_if(entries_, [](const entry &current) { return current.ring->orphaned(); });
+    for (const auto &current : entries_) {
+      if (current.state_id == state_id) {
+        return current.ring.get();
+      }
+    }
+    return nullptr;
+  }
+
+  auto add(const std::uint64_t state_id, std::shared_ptr<span_ring> ring) -> void {
+    entries_.push_back(entry{.state_id = state_id, .ring = std::move(ring)});
+  }
+
+private:
+  struct entry {
+    std::uint64_t state_id{0U};
+    std::shared_ptr<span_ring> ring{};
+  };
+
+  std::vector<entry> entries_{};
+};
+
+[[nodiscard]] inline auto local_span_rings() -> span_ring_owner & {
+  thread_local span_ring_owner owner{};
+  return owner;
+}
+
+/// Shared exporter state captured by registered callbacks.
+class span_exporter_state {
+public:
+  span_exporter_state(span_sink sink, const span_exporter_options &options)
+      : sink_(std::move(sink)), options_(options),
+        id_(next_state_id().fetch_add(1U, std::memory_order_relaxed)) {}
+
+  span_exporter_state(const span_exporter_state &) = delete;
+  auto operator=(const span_exporter_state &) -> span_exporter_state & = delete;
+
+  ~span_exporter_state() {
+    for (const auto &ring : rings_) {
+      ring->orphan();
+    }
+  }
+
+  auto on_start(const run_info &info) -> void {
+    const auto key = open_span_key(info);
+    const open_span span{.key = key,
+                         .start_time_unix_nano = span_now_unix_nano(),
+                         .started = std::chrono::steady_clock::now(),
+                         .generated_id = info.span_id.empty() ? next_span_id_bits() : 0U};
+    auto &shard = shards_[key % shard_count];
+    std::lock_guard lock{shard.mutex};
+    evict_stale(shard, span.started);
+    shard.spans.push_back(span);
+  }
+
+  auto on_finish(const stage current_stage, const event_view event, const run_info &info)
+      -> void {
+    const auto end_time = span_now_unix_nano();
+    const auto key = open_span_key(info);
+    open_span span{.key = key, .start_time_unix_nano = end_time};
+    {
+      auto &shard = shards_[key % shard_count];
+      std::lock_guard lock{shard.mutex};
+      // Search from the back so nested calls with equal run info close LIFO.
+      for (auto iter = shard.spans.rbegin(); iter != shard.spans.rend(); ++iter) {
+        if (iter->key == key) {
+          span = *iter;
+          shard.spans.erase(std::next(iter).base());
+          break;
+        }
+      }
+    }
+
+    span_record record{};
+    record.trace_id = info.trace_id;
+    if (!info.span_id.empty()) {
+      record.span_id = info.span_id;
+    } else {
+      record.span_id =
+          format_span_id(span.generated_id != 0U ? span.generated_id : next_span_id_bits());
+    }
+    record.parent_span_id = info.parent_span_id;
+    record.name = info.name.empty() ? info.type : info.name;
+    record.start_time_unix_nano = span.start_time_unix_nano;
+    record.end_time_unix_nano = end_time;
+    if (current_stage == stage::error) {
+      record.status = span_status_code::error;
+      if (const auto *fatal = wh::core::any_cast<wh::core::callback_fatal_error>(&event);
+          fatal != nullptr) {
+        record.status_message = fatal->code.message();
+      } else if (const auto *text = wh::core::any_cast<std::string>(&event); text != nullptr) {
+        record.status_message = *text;
+      }
+    } else {
+      record.status = span_status_code::ok;
+    }
+    record.component_type = info.type;
+    record.component_kind = info.component;
+    if (!info.node_path.empty()) {
+      record.node_path = info.node_path.to_string();
+    }
+    if (!local_ring().try_push(std::move(record))) {
+      dropped_.fetch_add(1U, std::memory_order_relaxed);
+    }
+  }
+
+  /// Drains every thread ring and hands batches to the sink. Rings of exited
+  /// threads are erased once drained.
+  auto flush() -> wh::core::result<void> {
+    std::lock_guard export_lock{export_mutex_};
+    pending_.clear();
+    {
+      std::lock_guard lock{rings_mutex_};
+      std::erase_if(rings_, [this](const std::shared_ptr<span_ring> &ring) {
+        // Read retirement first: a retired ring has published its last span.
+        const auto retired = ring->retired();
+        ring->drain(pending_);
+        return retired;
+      });
+    }
+    wh::core::result<void> status{};
+    const auto batch_size = std::max<std::size_t>(options_.max_batch_size, 1U);
+    for (std::size_t offset = 0U; offset < pending_.size(); offset += batch_size) {
+      const auto count = std::min(batch_size, pending_.size() - offset);
+      auto exported = sink_(std::span<const span_record>{pending_.data() + offset, count});
+      if (exported.has_error()) {
+        failed_.fetch_add(count, std::memory_order_relaxed);
+        status = wh::core::result<void>::failure(exported.error());
+        continue;
+      }
+      exported_.fetch_add(count, std::memory_order_relaxed);
+    }
+    pending_.clear();
+    return status;
+  }
+
+  [[nodiscard]] auto stats() const noexcept -> span_exporter_stats {
+    return span_exporter_stats{.exported = exported_.load(std::memory_order_relaxed),
+                               .dropped = dropped_.load(std::memory_order_relaxed),
+                               .failed = failed_.load(std::memory_order_relaxed),
+                               .abandoned = abandoned_.load(std::memory_order_relaxed)};
+  }
+
+  [[nodiscard]] auto options() const noexcept -> const span_exporter_options & {
+    return options_;
+  }
+
+private:
+  static constexpr std::size_t shard_count = 16U;
+
+  struct open_span {
+    std::uint64_t key{0U};
+    std::uint64_t start_time_unix_nano{0U};
+    /// Monotonic start used for age, immune to wall-clock steps.
+    std::chrono::steady_clock::time_point started{};
+    /// Id bits generated at start when run info carries no span id.
+    std::uint64_t generated_id{0U};
+  };
+
+  /// In-flight calls of one shard; few enough that a scan beats hashing.
+  struct open_span_shard {
+    std::mutex mutex{};
+    std::vector<open_span> spans{};
+  };
+
+  /// Drops expired spans from the front of `shard` (oldest first) and makes
+  /// room for one more under the per-shard share of `max_open_spans`. Calls
+  /// whose start was dropped still export on end, with a zero-length span.
+  auto evict_stale(open_span_shard &shard, const std::chrono::steady_clock::time_point now)
+      -> void {
+    std::size_t expired = 0U;
+    while (expired < shard.spans.size() &&
+           now - shard.spans[expired].started >= options_.open_span_timeout) {
+      ++expired;
+    }
+    const auto limit = std::max<std::size_t>(options_.max_open_spans / shard_count, 1U);
+    if (shard.spans.size() - expired >= limit) {
+      expired = shard.spans.size() - limit + 1U;
+    }
+    if (expired == 0U) {
+      return;
+    }
+    shard.spans.erase(shard.spans.begin(),
+                      shard.spans.begin() + static_cast<std::ptrdiff_t>(expired));
+    abandoned_.fetch_add(expired, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] static auto next_state_id() noexcept -> std::atomic<std::uint64_t> & {
+    static std::atomic<std::uint64_t> id{1U};
+    return id;
+  }
+
+  /// Returns the calling thread's ring, registering it on first use. Ids are
+  /// never reused, so rings of destroyed exporters never match.
+  [[nodiscard]] auto local_ring() -> span_ring & {
+    auto &owner = local_span_rings();
+    if (auto *ring = owner.find(id_); ring != nullptr) {
+      return *ring;
+    }
+    auto ring = std::make_shared<span_ring>(options_.thread_buffer_capacity);
+    auto *raw = ring.get();
+    {
+      std::lock_guard lock{rings_mutex_};
+      rings_.push_back(ring);
+    }
+    owner.add(id_, std::move(ring));
+    return *raw;
+  }
+
+  span_sink sink_{nullptr};
+  span_exporter_options options_{};
+  std::uint64_t id_{0U};
+  std::array<open_span_shard, shard_count> shards_{};
+  std::mutex rings_mutex_{};
+  std::vector<std::shared_ptr<span_ring>> rings_{};
+  std::mutex export_mutex_{};
+  std::vector<span_record> pending_{};
+  std::atomic<std::uint64_t> exported_{0U};
+  std::atomic<std::uint64_t> dropped_{0U};
+  std::atomic<std::uint64_t> failed_{0U};
+  std::atomic<std::uint64_t> abandoned_{0U};
+};
+
+} // namespace detail
+
+/// Callback handler that builds spans and exports them in batches.
+///
+/// Start events record a start time in a sharded open-span table; end and
+/// error events close the span and push it into a lock-free ring owned by the
+/// emitting thread, so the callback never waits on the sink. A background
+/// thread drains all rings every `flush_interval` and hands the sink batches of
+/// at most `max_batch_size` spans. Full rings drop spans and count them;
+/// started calls that never end are abandoned once older than
+/// `open_span_timeout` or beyond `max_open_spans`.
+class span_exporter {
+public:
+  explicit span_exporter(span_sink sink, span_exporter_options options = {})
+      : state_(std::make_shared<detail::span_exporter_state>(std::move(sink), options)) {
+    worker_ = std::thread{[this]() -> void { run(); }};
+  }
+
+  span_exporter(const span_exporter &) = delete;
+  auto operator=(const span_exporter &) -> span_exporter & = delete;
+  span_exporter(span_exporter &&) = delete;
+  auto operator=(span_exporter &&) -> span_exporter & = delete;
+
+  ~span_exporter() { shutdown(); }
+
+  /// Returns the registration config selecting start, end and error stages.
+  [[nodiscard]] static auto config() -> callback_config {
+    return make_callback_config(
+        [](const stage current_stage) noexcept {
+          return current_stage == stage::start || current_stage == stage::end ||
+                 current_stage == stage::error;
+        },
+        "span_exporter");
+  }
+
+  /// Returns the stage callbacks feeding this exporter. Callbacks keep the
+  /// exporter state alive, but spans closed after `shutdown` are not exported.
+  [[nodiscard]] auto callbacks() const -> stage_callbacks {
+    stage_callbacks callbacks{};
+    callbacks.on_start = [state = state_](const stage, const event_view,
+                                          const run_info &info) -> void { state->on_start(info); };
+    const auto finish = [state = state_](const stage current_stage, const event_view event,
+                                         const run_info &info) -> void {
+      state->on_finish(current_stage, event, info);
+    };
+    callbacks.on_end = finish;
+    callbacks.on_error = finish;
+    return callbacks;
+  }
+
+  /// Drains every thread ring and exports the spans synchronously on the
+  /// calling thread, serialized with the background export; returns the last
+  /// sink error. Spans still being pushed by other threads may miss the drain.
+  auto flush() -> wh::core::result<void> { return state_->flush(); }
+
+  /// Stops the background thread and exports the remaining spans.
+  auto shutdown() -> void {
+    {
+      std::lock_guard lock{worker_mutex_};
+      if (stopping_) {
+        return;
+      }
+      stopping_ = true;
+    }
+    worker_cv_.notify_all();
+    if (worker_.joinable()) {
+      worker_.join();
+    }
+    static_cast<void>(state_->flush());
+  }
+
+  /// Returns exporter counters.
+  [[nodiscard]] auto stats() const noexcept -> span_exporter_stats { return state_->stats(); }
+
+private:
+  auto run() -> void {
+    std::unique_lock lock{worker_mutex_};
+    while (!stopping_) {
+      worker_cv_.wait_for(lock, state_->options().flush_interval,
+                          [this]() noexcept { return stopping_; });
+      if (stopping_) {
+        return;
+      }
+      lock.unlock();
+      static_cast<void>(state_->flush());
+      lock.lock();
+    }
+  }
+
+  std::shared_ptr<detail::span_exporter_state> state_{};
+  std::mutex worker_mutex_{};
+  std::condition_variable worker_cv_{};
+  bool stopping_{false};
+  std::thread worker_{};
+};
+
+/// Registers `exporter` as a global handler on `target`.
+inline auto register_span_exporter(manager &target, const span_exporter &exporter) -> void {
+  target.register_global_callbacks(span_exporter::config(), exporter.callbacks());
+}
+
+} // namespace wh::callbacks
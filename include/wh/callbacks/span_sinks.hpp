@@ -0,0 +1,312 @@
+// Defines OTLP/JSON span encoding plus JSON-lines file and OTLP/HTTP sinks
+// for `span_exporter`.
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "wh/callbacks/span_exporter.hpp"
+#include "wh/core/compiler.hpp"
+#include "wh/core/error.hpp"
+#include "wh/core/json/escape.hpp"
+#include "wh/core/result.hpp"
+
+#if WH_OS_POSIX_LIKE
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+namespace wh::callbacks {
+
+namespace detail {
+
+[[nodiscard]] inline auto is_lower_hex(const std::string_view text) noexcept -> bool {
+  for (const auto ch : text) {
+    if (!((ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'f'))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Appends `text` as an OTLP id of `hex_size` lowercase hex digits. Ids that
+/// are not already in that form are hashed, so parent links stay consistent.
+inline auto append_otlp_id(std::string &out, const std::string_view text,
+                           const std::size_t hex_size) -> void {
+  if (text.size() == hex_size && is_lower_hex(text)) {
+    wh::core::append_json_string(out, text);
+    return;
+  }
+  constexpr char digits[] = "0123456789abcdef";
+  out.push_back('"');
+  for (std::size_t word = 0U; word * 16U < hex_size; ++word) {
+    std::uint64_t hash = 14695981039346656037ULL + word;
+    for (const auto ch : text) {
+      hash ^= static_cast<std::uint8_t>(ch);
+      hash *= 1099511628211ULL;
+    }
+    hash ^= hash >> 33U;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33U;
+    for (std::size_t index = 16U; index > 0U; --index) {
+      out.push_back(digits[(hash >> ((index - 1U) * 4U)) & 0xfU]);
+    }
+  }
+  out.push_back('"');
+}
+
+inline auto append_otlp_attribute(std::string &out, const std::string_view key,
+                                  const std::string_view value) -> void {
+  out.append(R"({"key":)");
+  wh::core::append_json_string(out, key);
+  out.append(R"(,"value":{"stringValue":)");
+  wh::core::append_json_string(out, value);
+  out.append("}}");
+}
+
+} // namespace detail
+
+/// Appends one span as an OTLP/JSON `Span` object.
+inline auto append_otlp_span_json(std::string &out, const span_record &span) -> void {
+  out.append(R"({"traceId":)");
+  detail::append_otlp_id(out, span.trace_id, 32U);
+  out.append(R"(,"spanId":)");
+  detail::append_otlp_id(out, span.span_id, 16U);
+  if (!span.parent_span_id.empty()) {
+    out.append(R"(,"parentSpanId":)");
+    detail::append_otlp_id(out, span.parent_span_id, 16U);
+  }
+  out.append(R"(,"name":)");
+  wh::core::append_json_string(out, span.name);
+  // OTLP encodes 64-bit integers as JSON strings; kind 1 is SPAN_KIND_INTERNAL.
+  out.append(R"(,"kind":1,"startTimeUnixNano":")");
+  out.append(std::to_string(span.start_time_unix_nano));
+  out.append(R"(","endTimeUnixNano":")");
+  out.append(std::to_string(span.end_time_unix_nano));
+  out.append(R"(","attributes":[)");
+  detail::append_otlp_attribute(out, "wh.component.type", span.component_type);
+  out.push_back(',');
+  detail::append_otlp_attribute(out, "wh.component.kind",
+                                detail::span_component_kind_name(span.component_kind));
+  if (!span.node_path.empty()) {
+    out.push_back(',');
+    detail::append_otlp_attribute(out, "wh.node_path", span.node_path);
+  }
+  for (const auto &attribute : span.attributes) {
+    out.push_back(',');
+    detail::append_otlp_attribute(out, attribute.key, attribute.value);
+  }
+  out.append(R"(],"status":{"code":)");
+  out.append(std::to_string(static_cast<int>(span.status)));
+  if (!span.status_message.empty()) {
+    out.append(R"(,"message":)");
+    wh::core::append_json_string(out, span.status_message);
+  }
+  out.append("}}");
+}
+
+/// Encodes one batch as an OTLP/JSON `ExportTraceServiceRequest` body.
+[[nodiscard]] inline auto encode_otlp_trace_request(const std::span<const span_record> spans,
+                                                    const std::string_view service_name)
+    -> std::string {
+  std::string body{};
+  body.reserve(256U + spans.size() * 384U);
+  body.append(R"({"resourceSpans":[{"resource":{"attributes":[{"key":"service.name",)");
+  body.append(R"("value":{"stringValue":)");
+  wh::core::append_json_string(body, service_name);
+  body.append(R"(}}]},"scopeSpans":[{"scope":{"name":"wh.callbacks"},"spans":[)");
+  for (std::size_t index = 0U; index < spans.size(); ++index) {
+    if (index != 0U) {
+      body.push_back(',');
+    }
+    append_otlp_span_json(body, spans[index]);
+  }
+  body.append("]}]}]}");
+  return body;
+}
+
+/// Returns a sink appending one OTLP/JSON span object per line to `path`.
+[[nodiscard]] inline auto make_jsonl_span_sink(std::string path) -> span_sink {
+  struct file_state {
+    std::mutex mutex{};
+    std::ofstream stream{};
+    std::string line{};
+  };
+  auto state = std::make_shared<file_state>();
+  state->stream.open(path, std::ios::out | std::ios::app);
+  return [state = std::move(state)](
+             const std::span<const span_record> spans) -> wh::core::result<void> {
+    std::lock_guard lock{state->mutex};
+    if (!state->stream.is_open()) {
+      return wh::core::result<void>::failure(wh::core::errc::unavailable);
+    }
+    for (const auto &span : spans) {
+      state->line.clear();
+      append_otlp_span_json(state->line, span);
+      state->line.push_back('\n');
+      state->stream.write(state->line.data(), static_cast<std::streamsize>(state->line.size()));
+    }
+    state->stream.flush();
+    if (!state->stream.good()) {
+      return wh::core::result<void>::failure(wh::core::errc::unavailable);
+    }
+    return {};
+  };
+}
+
+/// Collector endpoint for the OTLP/HTTP JSON sink.
+struct otlp_http_options {
+  /// Collector host name or address.
+  std::string host{"127.0.0.1"};
+  /// Collector port.
+  std::uint16_t port{4318U};
+  /// Trace export path.
+  std::string path{"/v1/traces"};
+  /// `service.name` resource attribute.
+  std::string service_name{"wh"};
+  /// Send and receive timeout for one export.
+  std::chrono::milliseconds timeout{2000};
+};
+
+namespace detail {
+
+#if WH_OS_POSIX_LIKE
+
+class otlp_socket {
+public:
+  otlp_socket() = default;
+  explicit otlp_socket(const int handle) noexcept : handle_(handle) {}
+  otlp_socket(const otlp_socket &) = delete;
+  auto operator=(const otlp_socket &) -> otlp_socket & = delete;
+  ~otlp_socket() {
+    if (handle_ >= 0) {
+      ::close(handle_);
+    }
+  }
+
+  [[nodiscard]] auto get() const noexcept -> int { return handle_; }
+
+private:
+  int handle_{-1};
+};
+
+[[nodiscard]] inline auto connect_otlp_collector(const otlp_http_options &options)
+    -> wh::core::result<int> {
+  addrinfo hints{};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo *resolved = nullptr;
+  const auto port = std::to_string(options.port);
+  if (::getaddrinfo(options.host.c_str(), port.c_str(), &hints, &resolved) != 0) {
+    return wh::core::result<int>::failure(wh::core::errc::network_error);
+  }
+  std::unique_ptr<addrinfo, decltype(&::freeaddrinfo)> guard{resolved, &::freeaddrinfo};
+  timeval timeout{};
+  timeout.tv_sec = static_cast<decltype(timeout.tv_sec)>(options.timeout.count() / 1000);
+  timeout.tv_usec = static_cast<decltype(timeout.tv_usec)>((options.timeout.count() % 1000) * 1000);
+  for (auto *entry = resolved; entry != nullptr; entry = entry->ai_next) {
+    const auto handle = ::socket(entry->ai_family, entry->ai_socktype, entry->ai_protocol);
+    if (handle < 0) {
+      continue;
+    }
+    ::setsockopt(handle, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    ::setsockopt(handle, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+#if defined(SO_NOSIGPIPE)
+    const int no_sigpipe = 1;
+    ::setsockopt(handle, SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe, sizeof(no_sigpipe));
+#endif
+    if (::connect(handle, entry->ai_addr, entry->ai_addrlen) == 0) {
+      return handle;
+    }
+    ::close(handle);
+  }
+  return wh::core::result<int>::failure(wh::core::errc::network_error);
+}
+
+#if defined(MSG_NOSIGNAL)
+inline constexpr int otlp_send_flags = MSG_NOSIGNAL;
+#else
+inline constexpr int otlp_send_flags = 0;
+#endif
+
+[[nodiscard]] inline auto post_otlp_request(const otlp_http_options &options,
+                                            const std::string_view body)
+    -> wh::core::result<void> {
+  auto connected = connect_otlp_collector(options);
+  if (connected.has_error()) {
+    return wh::core::result<void>::failure(connected.error());
+  }
+  const otlp_socket socket{connected.value()};
+
+  std::string request{};
+  request.reserve(160U + body.size());
+  request.append("POST ").append(options.path).append(" HTTP/1.1\r\nHost: ");
+  request.append(options.host).append(":").append(std::to_string(options.port));
+  request.append("\r\nContent-Type: application/json\r\nContent-Length: ");
+  request.append(std::to_string(body.size()));
+  request.append("\r\nConnection: close\r\n\r\n");
+  request.append(body);
+  std::size_t sent = 0U;
+  while (sent < request.size()) {
+    // A collector closing early must fail the batch, not raise SIGPIPE.
+    const auto written = ::send(socket.get(), request.data() + sent, request.size() - sent,
+                                otlp_send_flags);
+    if (written <= 0) {
+      return wh::core::result<void>::failure(wh::core::errc::network_error);
+    }
+    sent += static_cast<std::size_t>(written);
+  }
+
+  std::string response{};
+  char buffer[512];
+  while (response.find("\r\n") == std::string::npos) {
+    const auto received = ::recv(socket.get(), buffer, sizeof(buffer), 0);
+    if (received <= 0) {
+      return wh::core::result<void>::failure(wh::core::errc::network_error);
+    }
+    response.append(buffer, static_cast<std::size_t>(received));
+  }
+  // Status line: "HTTP/1.1 200 OK".
+  const auto code_begin = response.find(' ');
+  if (code_begin == std::string::npos || code_begin + 4U > response.size() ||
+      response[code_begin + 1U] != '2') {
+    return wh::core::result<void>::failure(wh::core::errc::protocol_error);
+  }
+  return {};
+}
+
+#endif
+
+} // namespace detail
+
+/// Returns a sink posting OTLP/JSON batches to a collector over plain HTTP.
+/// Each batch uses one short-lived connection; non-2xx responses fail with
+/// `errc::protocol_error`. Only POSIX platforms are supported.
+[[nodiscard]] inline auto make_otlp_http_span_sink(otlp_http_options options) -> span_sink {
+  return [options = std::move(options)](
+             const std::span<const span_record> spans) -> wh::core::result<void> {
+#if WH_OS_POSIX_LIKE
+    if (spans.empty()) {
+      return {};
+    }
+    return detail::post_otlp_request(options,
+                                     encode_otlp_trace_request(spans, options.service_name));
+#else
+    static_cast<void>(spans);
+    return wh::core::result<void>::failure(wh::core::errc::not_supported);
+#endif
+  };
+}
+
+} // namespace wh::callbacks
@@ -12,3 +12,4 @@
 #include "wh/compose/graph/pregel.hpp"
 #include "wh/compose/graph/restore_validation.hpp"
 #include "wh/compose/graph/stream.hpp"
+#include "wh/compose/graph/versioned.hpp"
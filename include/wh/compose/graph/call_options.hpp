@@ -163,6 +163,10 @@ using graph_component_option_map =
 struct graph_call_options {
   /// Invoke-scoped distributed trace input.
   std::optional<graph_trace_context> trace{};
+  /// Callback trace sampling decided once when this invoke starts. The decision
+  /// lives on the run_context's callback manager, so one context must not be
+  /// shared by concurrent sampled invokes.
+  std::optional<wh::core::callback_sampling_options> callback_sampling{};
   /// Ordered node observation override list (`last` scalar match wins).
   std::vector<graph_node_observation_override> node_observations{};
   /// Global component defaults broadcast to all compatible nodes.
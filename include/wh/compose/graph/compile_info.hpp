@@ -131,6 +131,10 @@ struct graph_compile_info {
   std::size_t max_parallel_nodes{1U};
   /// Graph-level default per-node parallel gate (`>=1`).
   std::size_t max_parallel_per_node{1U};
+  /// In-flight budget for independent children of one input stage (`>=1`).
+  std::size_t max_child_concurrency{1U};
+  /// Buffered stream chunks one collect/rewrite pump may consume per turn (`>=1`).
+  std::size_t stream_drain_budget{64U};
   /// True means graph enables local state generation features.
   bool state_generator_enabled{true};
   /// Deterministic compile order (topological/SCC-condensed order).
@@ -12,6 +12,7 @@
 #include "wh/compose/graph/policy.hpp"
 #include "wh/compose/types.hpp"
 #include "wh/core/function.hpp"
+#include "wh/core/metrics/registry.hpp"
 #include "wh/core/result.hpp"
 
 namespace wh::compose {
@@ -47,10 +48,19 @@ struct graph_compile_options {
   std::size_t max_parallel_nodes{1U};
   /// Graph-level default per-node parallel gate (`>=1`).
   std::size_t max_parallel_per_node{1U};
+  /// In-flight budget for independent children of one input stage, such as
+  /// per-source stream collects (`>=1`; `1` keeps them serial).
+  std::size_t max_child_concurrency{1U};
+  /// Stream chunks one collect or state-rewrite pump may consume per scheduler
+  /// turn when they are already buffered (`>=1`; `1` yields after every chunk).
+  std::size_t stream_drain_budget{64U};
   /// Enables node-local state generation/handler capability for this graph.
   bool enable_local_state_generation{true};
   /// Optional compile callback invoked once compile snapshot is finalized.
   graph_compile_callback compile_callback{nullptr};
+  /// Optional registry receiving per-node queue and execution latency; it must
+  /// outlive the graph. Null disables node timing.
+  wh::core::metrics_registry *metrics{nullptr};
 };
 
 /// Serializes compile-options snapshot into one stable diagnostic string.
@@ -93,6 +103,10 @@ struct graph_compile_options {
   text += std::to_string(options.max_parallel_nodes);
   text += ";max_parallel_per_node=";
   text += std::to_string(options.max_parallel_per_node);
+  text += ";max_child_concurrency=";
+  text += std::to_string(options.max_child_concurrency);
+  text += ";stream_drain_budget=";
+  text += std::to_string(options.stream_drain_budget);
   text += ";enable_local_state_generation=";
   text += options.enable_local_state_generation ? "true" : "false";
   text += ";compile_callback=";
@@ -1,14 +1,17 @@
-// Defines the shared serial child-orchestration skeleton used by graph input
-// and stream stages.
+// Defines the shared child-orchestration skeletons used by graph input and
+// stream stages: a serial pump and a bounded-concurrency batch variant.
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <exception>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <type_traits>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include <exec/trampoline_scheduler.hpp>
@@ -41,6 +44,33 @@ template <typename child_sender_t> struct child_pump_step {
   }
 };
 
+/// Hands `reader` chunks that are already buffered to `consume` after the async
+/// completion that woke the pump, so a ready burst costs one scheduler turn
+/// instead of one per chunk.
+///
+/// Fairness: one turn consumes at most `budget` chunks (the waking one
+/// included), stops as soon as the reader reports pending, and never spins.
+/// The pump then re-arms through `read_async`, whose completion resumes on the
+/// graph scheduler, so sibling work interleaves at least every `budget` chunks.
+/// A budget of one keeps the one-chunk-per-turn behavior.
+template <typename reader_t, typename consume_fn_t>
+[[nodiscard]] inline auto drain_ready_chunks(reader_t &reader, const std::size_t budget,
+                                             consume_fn_t &&consume)
+    -> std::optional<wh::core::result<graph_value>> {
+  using chunk_result_t = typename reader_t::chunk_result_type;
+  for (std::size_t drained = 1U; drained < budget; ++drained) {
+    auto ready = reader.try_read();
+    if (std::holds_alternative<wh::schema::stream::stream_signal>(ready)) {
+      return std::nullopt;
+    }
+    auto status = consume(std::move(std::get<chunk_result_t>(ready)));
+    if (status.has_value()) {
+      return status;
+    }
+  }
+  return std::nullopt;
+}
+
 template <typename stage_t, typename consume_fn_t, typename finish_fn_t> class child_batch_policy {
 public:
   using child_sender_type = graph_sender;
@@ -420,4 +450,353 @@ make_child_batch_sender(std::vector<graph_sender> senders, stage_t &&stage, cons
                                 std::move(graph_scheduler));
 }
 
+/// Bounded-concurrency child batch: keeps up to `max_in_flight` children in
+/// flight on the graph scheduler and hands each completion to `consume` in
+/// index order as soon as every earlier child has been consumed. A child that
+/// finishes ahead of its prefix keeps its slot until consumed, so at most
+/// `max_in_flight` outputs are buffered. Consume and completion both run in
+/// the resume turn on the graph scheduler, never on a child's thread. After
+/// the first consume error no further child is launched; children already in
+/// flight drain before the error is reported.
+template <typename stage_t, typename consume_fn_t, typename finish_fn_t>
+class bounded_child_batch_sender {
+  template <typename receiver_t> class operation {
+    using self_t = operation;
+    using completion_t = wh::core::result<graph_value>;
+    using receiver_type = std::remove_cvref_t<receiver_t>;
+    using graph_scheduler_t = wh::core::detail::any_resume_scheduler_t;
+    using receiver_env_t =
+        std::remove_cvref_t<decltype(stdexec::get_env(std::declval<const receiver_type &>()))>;
+    friend class wh::core::detail::scheduled_resume_turn<self_t, graph_scheduler_t>;
+
+    struct child_slot;
+
+    struct child_receiver {
+      using receiver_concept = stdexec::receiver_t;
+
+      operation *self{nullptr};
+      child_slot *slot{nullptr};
+      const receiver_env_t *env{nullptr};
+      const graph_scheduler_t *graph_scheduler{nullptr};
+
+      auto set_value(completion_t value) && noexcept -> void {
+        self->finish_child(*slot, std::move(value));
+      }
+
+      template <typename error_t> auto set_error(error_t &&error) && noexcept -> void {
+        self->finish_child(*slot, completion_t::failure(operation::map_async_error(
+                                      std::forward<error_t>(error))));
+      }
+
+      auto set_stopped() && noexcept -> void {
+        self->finish_child(*slot, completion_t::failure(wh::core::errc::canceled));
+      }
+
+      [[nodiscard]] auto get_env() const noexcept {
+        return wh::core::detail::make_scheduler_env(*env, *graph_scheduler);
+      }
+    };
+
+    using resumed_child_sender_t = decltype(stdexec::starts_on(
+        exec::trampoline_scheduler{}, stdexec::starts_on(std::declval<const graph_scheduler_t &>(),
+                                                         std::declval<graph_sender>())));
+    using child_op_t = stdexec::connect_result_t<resumed_child_sender_t, child_receiver>;
+
+    struct child_slot {
+      wh::core::detail::manual_storage<sizeof(child_op_t), alignof(child_op_t)> op{};
+      std::optional<completion_t> status{};
+      std::atomic<bool> ready{false};
+      bool engaged{false};
+    };
+
+  public:
+    using operation_state_concept = stdexec::operation_state_t;
+
+    template <typename stored_receiver_t>
+    operation(bounded_child_batch_sender &&sender, stored_receiver_t &&receiver)
+        : receiver_(std::forward<stored_receiver_t>(receiver)),
+          receiver_env_(stdexec::get_env(receiver_)),
+          graph_scheduler_(std::move(sender.graph_scheduler_)),
+          senders_(std::move(sender.senders_)), stage_(std::move(sender.stage_)),
+          consume_(std::move(sender.consume_)), finish_(std::move(sender.finish_)),
+          slot_count_(std::min(sender.max_in_flight_, senders_.size())),
+          slots_(std::make_unique<child_slot[]>(slot_count_)) {}
+
+    operation(const operation &) = delete;
+    auto operator=(const operation &) -> operation & = delete;
+    operation(operation &&) = delete;
+    auto operator=(operation &&) -> operation & = delete;
+
+    ~operation() { cleanup(); }
+
+    auto start() & noexcept -> void {
+      request_resume();
+      arrive();
+    }
+
+  private:
+    template <typename error_t>
+    [[nodiscard]] static auto map_async_error(error_t &&error) noexcept -> wh::core::error_code {
+      if constexpr (std::same_as<std::remove_cvref_t<error_t>, wh::core::error_code>) {
+        return std::forward<error_t>(error);
+      } else if constexpr (std::same_as<std::remove_cvref_t<error_t>, std::exception_ptr>) {
+        try {
+          std::rethrow_exception(std::forward<error_t>(error));
+        } catch (...) {
+          return wh::core::map_current_exception();
+        }
+      } else {
+        return wh::core::make_error(wh::core::errc::internal_error);
+      }
+    }
+
+    [[nodiscard]] auto completed() const noexcept -> bool {
+      return completed_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] auto slot_for(const std::size_t index) noexcept -> child_slot & {
+      return slots_[index % slot_count_];
+    }
+
+    auto cleanup() noexcept -> void {
+      resume_turn_.destroy();
+      for (std::size_t index = 0U; index < slot_count_; ++index) {
+        destroy_child(slots_[index]);
+        slots_[index].status.reset();
+        slots_[index].ready.store(false, std::memory_order_release);
+      }
+      senders_.clear();
+    }
+
+    auto finish_child(child_slot &slot, completion_t status) noexcept -> void {
+      if (completed()) {
+        return;
+      }
+      wh_invariant(!slot.ready.load(std::memory_order_acquire));
+      slot.status.emplace(std::move(status));
+      slot.ready.store(true, std::memory_order_release);
+      request_resume();
+      arrive();
+    }
+
+    auto set_terminal(wh::core::result<graph_value> status) noexcept -> void {
+      if (terminal_.has_value()) {
+        return;
+      }
+      terminal_.emplace(std::move(status));
+      maybe_complete();
+    }
+
+    [[nodiscard]] auto resume_turn_completed() const noexcept -> bool { return completed(); }
+
+    auto request_resume() noexcept -> void { resume_turn_.request(this); }
+
+    auto arrive() noexcept -> void {
+      if (count_.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+        maybe_complete();
+      }
+    }
+
+    auto resume_turn_arrive() noexcept -> void { arrive(); }
+
+    auto resume_turn_add_ref() noexcept -> void { count_.fetch_add(1U, std::memory_order_relaxed); }
+
+    auto resume_turn_schedule_error(const wh::core::error_code error) noexcept -> void {
+      set_terminal(wh::core::result<graph_value>::failure(error));
+    }
+
+    auto resume_turn_run() noexcept -> void {
+      resume();
+      maybe_complete();
+    }
+
+    auto resume_turn_idle() noexcept -> void { maybe_complete(); }
+
+    auto maybe_complete() noexcept -> void {
+      if (completed()) {
+        return;
+      }
+      if (count_.load(std::memory_order_acquire) != 0U || !should_complete()) {
+        return;
+      }
+      complete();
+    }
+
+    [[nodiscard]] auto should_complete() const noexcept -> bool {
+      return terminal_.has_value() && in_flight_ == 0U && !resume_turn_.running();
+    }
+
+    auto complete() noexcept -> void {
+      if (!terminal_.has_value() || completed_.exchange(true, std::memory_order_acq_rel)) {
+        return;
+      }
+      auto status = std::move(*terminal_);
+      terminal_.reset();
+      cleanup();
+      stdexec::set_value(std::move(receiver_), std::move(status));
+    }
+
+    /// Takes the finished child of `slot`, releasing its slot.
+    [[nodiscard]] auto take_ready(child_slot &slot) noexcept -> completion_t {
+      slot.ready.store(false, std::memory_order_relaxed);
+      destroy_child(slot);
+      --in_flight_;
+      auto status = std::move(*slot.status);
+      slot.status.reset();
+      return status;
+    }
+
+    /// After a terminal status, drops finished children in any order.
+    auto reap_ready() noexcept -> void {
+      for (std::size_t index = next_consume_; index < next_launch_; ++index) {
+        auto &slot = slot_for(index);
+        if (slot.engaged && slot.ready.load(std::memory_order_acquire)) {
+          static_cast<void>(take_ready(slot));
+        }
+      }
+    }
+
+    auto resume() noexcept -> void {
+      while (!completed()) {
+        if (terminal_.has_value()) {
+          reap_ready();
+          return;
+        }
+
+        if (next_consume_ < next_launch_) {
+          auto &slot = slot_for(next_consume_);
+          if (slot.ready.load(std::memory_order_acquire)) {
+            const auto index = next_consume_++;
+            auto current = take_ready(slot);
+            try {
+              auto consumed = consume_(stage_, index, std::move(current));
+              if (consumed.has_error()) {
+                set_terminal(wh::core::result<graph_value>::failure(consumed.error()));
+              }
+            } catch (...) {
+              set_terminal(
+                  wh::core::result<graph_value>::failure(wh::core::map_current_exception()));
+            }
+            continue;
+          }
+        }
+
+        if (next_launch_ < senders_.size() && next_launch_ - next_consume_ < slot_count_) {
+          launch(next_launch_++);
+          continue;
+        }
+
+        if (next_consume_ == senders_.size()) {
+          try {
+            set_terminal(finish_(std::move(stage_)));
+          } catch (...) {
+            set_terminal(
+                wh::core::result<graph_value>::failure(wh::core::map_current_exception()));
+          }
+          continue;
+        }
+        return;
+      }
+    }
+
+    auto launch(const std::size_t index) noexcept -> void {
+      auto &slot = slot_for(index);
+      try {
+        slot.op.template construct_with<child_op_t>([&]() -> child_op_t {
+          return stdexec::connect(
+              stdexec::starts_on(exec::trampoline_scheduler{},
+                                 stdexec::starts_on(graph_scheduler_, std::move(senders_[index]))),
+              child_receiver{this, std::addressof(slot), std::addressof(receiver_env_),
+                             std::addressof(graph_scheduler_)});
+        });
+      } catch (...) {
+        set_terminal(wh::core::result<graph_value>::failure(wh::core::map_current_exception()));
+        return;
+      }
+      slot.engaged = true;
+      ++in_flight_;
+      count_.fetch_add(1U, std::memory_order_relaxed);
+      stdexec::start(slot.op.template get<child_op_t>());
+    }
+
+    auto destroy_child(child_slot &slot) noexcept -> void {
+      if (!slot.engaged) {
+        return;
+      }
+      slot.op.template destruct<child_op_t>();
+      slot.engaged = false;
+    }
+
+    receiver_type receiver_;
+    receiver_env_t receiver_env_;
+    graph_scheduler_t graph_scheduler_;
+    std::vector<graph_sender> senders_{};
+    std::remove_cvref_t<stage_t> stage_;
+    wh_no_unique_address std::remove_cvref_t<consume_fn_t> consume_;
+    wh_no_unique_address std::remove_cvref_t<finish_fn_t> finish_;
+    std::size_t slot_count_{0U};
+    std::unique_ptr<child_slot[]> slots_{};
+    std::size_t next_launch_{0U};
+    std::size_t next_consume_{0U};
+    std::size_t in_flight_{0U};
+    std::optional<wh::core::result<graph_value>> terminal_{};
+    std::atomic<std::size_t> count_{1U};
+    std::atomic<bool> completed_{false};
+    wh::core::detail::scheduled_resume_turn<self_t, graph_scheduler_t> resume_turn_{
+        graph_scheduler_};
+  };
+
+public:
+  using sender_concept = stdexec::sender_t;
+  using completion_signatures =
+      stdexec::completion_signatures<stdexec::set_value_t(wh::core::result<graph_value>)>;
+
+  bounded_child_batch_sender(std::vector<graph_sender> senders, stage_t stage,
+                             consume_fn_t consume, finish_fn_t finish,
+                             wh::core::detail::any_resume_scheduler_t graph_scheduler,
+                             const std::size_t max_in_flight)
+      : senders_(std::move(senders)), stage_(std::move(stage)), consume_(std::move(consume)),
+        finish_(std::move(finish)), graph_scheduler_(std::move(graph_scheduler)),
+        max_in_flight_(max_in_flight) {}
+
+  bounded_child_batch_sender(const bounded_child_batch_sender &) = delete;
+  auto operator=(const bounded_child_batch_sender &) -> bounded_child_batch_sender & = delete;
+  bounded_child_batch_sender(bounded_child_batch_sender &&) noexcept = default;
+  auto operator=(bounded_child_batch_sender &&) noexcept
+      -> bounded_child_batch_sender & = default;
+
+  template <stdexec::receiver_of<completion_signatures> receiver_t>
+  [[nodiscard]] auto connect(receiver_t receiver) && -> operation<receiver_t> {
+    return operation<receiver_t>{std::move(*this), std::move(receiver)};
+  }
+
+private:
+  std::vector<graph_sender> senders_{};
+  std::remove_cvref_t<stage_t> stage_;
+  wh_no_unique_address std::remove_cvref_t<consume_fn_t> consume_;
+  wh_no_unique_address std::remove_cvref_t<finish_fn_t> finish_;
+  wh::core::detail::any_resume_scheduler_t graph_scheduler_;
+  std::size_t max_in_flight_{1U};
+};
+
+/// Runs independent stage children with up to `max_in_flight` in flight; see
+/// `bounded_child_batch_sender`. A budget of one, or a single child, keeps the
+/// serial pump.
+template <typename stage_t, typename consume_fn_t, typename finish_fn_t>
+[[nodiscard]] inline auto make_bounded_child_batch_sender(
+    std::vector<graph_sender> senders, stage_t &&stage, consume_fn_t &&consume,
+    finish_fn_t &&finish, wh::core::detail::any_resume_scheduler_t graph_scheduler,
+    const std::size_t max_in_flight) -> graph_sender {
+  if (max_in_flight <= 1U || senders.size() <= 1U) {
+    return bridge_graph_sender(make_child_batch_sender(
+        std::move(senders), std::forward<stage_t>(stage), std::forward<consume_fn_t>(consume),
+        std::forward<finish_fn_t>(finish), std::move(graph_scheduler)));
+  }
+  return bridge_graph_sender(
+      bounded_child_batch_sender<std::remove_cvref_t<stage_t>, std::remove_cvref_t<consume_fn_t>,
+                                 std::remove_cvref_t<finish_fn_t>>{
+          std::move(senders), std::forward<stage_t>(stage), std::forward<consume_fn_t>(consume),
+          std::forward<finish_fn_t>(finish), std::move(graph_scheduler), max_in_flight});
+}
+
 } // namespace wh::compose::detail
@@ -1,4 +1,5 @@
 // Defines graph reader-to-value collection policy used by input lowering.
+// Ready chunk bursts are drained in one scheduler turn up to a budget.
 #pragma once
 
 #include "wh/compose/graph/detail/child_pump.hpp"
@@ -12,10 +13,14 @@ struct collect_policy {
 
   graph_stream_reader reader{};
   edge_limits limits{};
+  const edge_fold *fold{nullptr};
   std::vector<graph_value> collected{};
+  std::optional<wh::internal::dynamic_stream_concat_accumulator> accumulator{};
+  /// Chunks consumed per scheduler turn; see `drain_ready_chunks`.
+  std::size_t drain_budget{1U};
 
   auto start() noexcept -> void {
-    if (limits.max_items > 0U && limits.max_items <= 64U) {
+    if (fold == nullptr && limits.max_items > 0U && limits.max_items <= 64U) {
       collected.reserve(limits.max_items);
     }
   }
@@ -26,6 +31,18 @@ struct collect_policy {
 
   [[nodiscard]] auto handle_completion(completion_type next)
       -> std::optional<wh::core::result<graph_value>> {
+    auto status = consume_chunk(std::move(next));
+    if (status.has_value()) {
+      return status;
+    }
+    return drain_ready_chunks(reader, drain_budget, [this](completion_type ready) {
+      return consume_chunk(std::move(ready));
+    });
+  }
+
+private:
+  [[nodiscard]] auto consume_chunk(completion_type next)
+      -> std::optional<wh::core::result<graph_value>> {
     if (next.has_error()) {
       return wh::core::result<graph_value>::failure(next.error());
     }
@@ -36,6 +53,13 @@ struct collect_policy {
       if (closed.has_error()) {
         return wh::core::result<graph_value>::failure(closed.error());
       }
+      if (fold != nullptr) {
+        // A folded stream with no chunks yields the fold's identity value.
+        if (!accumulator.has_value()) {
+          return wh::core::result<graph_value>{fold->empty_value};
+        }
+        return accumulator->finish();
+      }
       return wh::core::result<graph_value>{wh::core::any(std::move(collected))};
     }
     if (chunk.is_source_eof()) {
@@ -46,6 +70,9 @@ struct collect_policy {
     }
 
     if (chunk.value.has_value()) {
+      if (fold != nullptr) {
+        return fold_chunk(std::move(*chunk.value));
+      }
       collected.push_back(std::move(*chunk.value));
       if (limits.max_items > 0U && collected.size() > limits.max_items) {
         return wh::core::result<graph_value>::failure(wh::core::errc::resource_exhausted);
@@ -53,6 +80,29 @@ struct collect_policy {
     }
     return std::nullopt;
   }
+
+  // Folds one chunk into the running value instead of buffering it.
+  [[nodiscard]] auto fold_chunk(graph_value value)
+      -> std::optional<wh::core::result<graph_value>> {
+    if (!accumulator.has_value()) {
+      auto begun = fold->registry->begin_concat(value.key());
+      if (begun.has_error()) {
+        return wh::core::result<graph_value>::failure(begun.error());
+      }
+      accumulator.emplace(std::move(begun).value());
+    }
+    auto appended = accumulator->append(std::move(value));
+    if (appended.has_error()) {
+      return wh::core::result<graph_value>::failure(appended.error());
+    }
+    if (limits.max_items > 0U && accumulator->count() > limits.max_items) {
+      return wh::core::result<graph_value>::failure(wh::core::errc::resource_exhausted);
+    }
+    if (static_cast<bool>(fold->on_partial) && accumulator->partial().has_value()) {
+      fold->on_partial(accumulator->partial());
+    }
+    return std::nullopt;
+  }
 };
 
 } // namespace wh::compose::detail
@@ -61,12 +111,15 @@ namespace wh::compose {
 
 inline auto
 graph::collect_reader_value(graph_stream_reader reader, const edge_limits limits,
+                            const edge_fold *fold, const std::size_t drain_budget,
                             const wh::core::detail::any_resume_scheduler_t &graph_scheduler)
     -> graph_sender {
   return detail::bridge_graph_sender(detail::make_child_pump_sender(
       detail::collect_policy{
           .reader = std::move(reader),
           .limits = limits,
+          .fold = fold,
+          .drain_budget = drain_budget,
       },
       graph_scheduler));
 }
@@ -33,6 +33,8 @@ namespace detail {
       .node_timeout = options.node_timeout,
       .max_parallel_nodes = options.max_parallel_nodes,
       .max_parallel_per_node = options.max_parallel_per_node,
+      .max_child_concurrency = options.max_child_concurrency,
+      .stream_drain_budget = options.stream_drain_budget,
       .enable_local_state_generation = options.enable_local_state_generation,
       .has_compile_callback = static_cast<bool>(options.compile_callback),
   };
@@ -265,6 +267,14 @@ inline auto graph::compile() -> wh::core::result<void> {
     return fail_fast(wh::core::errc::invalid_argument,
                      "max_parallel_per_node must be greater than zero");
   }
+  if (core().options_.max_child_concurrency == 0U) {
+    return fail_fast(wh::core::errc::invalid_argument,
+                     "max_child_concurrency must be greater than zero");
+  }
+  if (core().options_.stream_drain_budget == 0U) {
+    return fail_fast(wh::core::errc::invalid_argument,
+                     "stream_drain_budget must be greater than zero");
+  }
   if (core().options_.node_timeout.has_value() &&
       core().options_.node_timeout.value() <= std::chrono::milliseconds{0}) {
     return fail_fast(wh::core::errc::invalid_argument, "node_timeout must be greater than zero");
@@ -328,6 +338,15 @@ inline auto graph::compile() -> wh::core::result<void> {
   }
   core().node_id_index_.clear();
   core().node_id_index_.rehash(0U);
+  core().node_metrics_.clear();
+  if (core().options_.metrics != nullptr) {
+    const auto &id_to_key = core().compiled_execution_index_.index.id_to_key;
+    core().node_metrics_.reserve(id_to_key.size());
+    for (const auto &key : id_to_key) {
+      core().node_metrics_.push_back(
+          wh::core::make_graph_node_metrics(*core().options_.metrics, core().options_.name, key));
+    }
+  }
   if (!core().options_.retain_cold_data) {
     release_cold_data_after_compile();
   }
@@ -601,6 +620,8 @@ inline auto graph::build_compile_info_snapshot() const -> graph_compile_info {
   info.node_timeout = core().options_.node_timeout;
   info.max_parallel_nodes = core().options_.max_parallel_nodes;
   info.max_parallel_per_node = core().options_.max_parallel_per_node;
+  info.max_child_concurrency = core().options_.max_child_concurrency;
+  info.stream_drain_budget = core().options_.stream_drain_budget;
   info.state_generator_enabled = core().options_.enable_local_state_generation;
   info.compile_order = core().compile_order_;
   info.node_key_to_id.reserve(node_id_index.size());
@@ -1080,6 +1101,7 @@ inline auto graph::build_compiled_execution_index() -> wh::core::result<void> {
         .no_data = edge.options.no_data,
         .adapter = edge.options.adapter,
         .limits = edge.options.limits,
+        .fold = edge.options.fold,
     });
   }
 
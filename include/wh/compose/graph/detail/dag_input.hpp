@@ -122,7 +122,11 @@ inline auto graph::make_reader_lowering(const indexed_edge &edge)
     return wh::core::result<reader_lowering>::failure(wh::core::errc::invalid_argument);
   }
   if (edge.lowering_kind == edge_lowering_kind::stream_to_value) {
-    return reader_lowering{.limits = edge.limits, .project = nullptr};
+    return reader_lowering{
+        .limits = edge.limits,
+        .project = nullptr,
+        .fold = edge.fold.registry != nullptr ? std::addressof(edge.fold) : nullptr,
+    };
   }
   if (edge.lowering_kind == edge_lowering_kind::custom) {
     if (!edge.adapter.custom.to_value.has_value()) {
@@ -139,9 +143,10 @@ inline auto graph::make_reader_lowering(const indexed_edge &edge)
 inline auto graph::lower_reader(graph_stream_reader reader, reader_lowering lowering,
                                 wh::core::run_context &context,
                                 const wh::core::detail::any_resume_scheduler_t &graph_scheduler)
-    -> graph_sender {
+    const -> graph_sender {
   if (lowering.project == nullptr) {
-    return collect_reader_value(std::move(reader), lowering.limits, graph_scheduler);
+    return collect_reader_value(std::move(reader), lowering.limits, lowering.fold,
+                                core().options_.stream_drain_budget, graph_scheduler);
   }
   return detail::bridge_graph_sender(wh::core::detail::write_sender_scheduler(
       (*lowering.project)(std::move(reader), lowering.limits, context), graph_scheduler));
@@ -1053,7 +1058,7 @@ inline auto graph::build_node_input_sender(
                                    graph_scheduler));
   }
 
-  return detail::bridge_graph_sender(detail::make_child_batch_sender(
+  return detail::make_bounded_child_batch_sender(
       std::move(senders), std::move(input_state),
       [](input_stage &stage_state, const std::size_t index,
          wh::core::result<graph_value> current) -> wh::core::result<void> {
@@ -1084,7 +1089,7 @@ inline auto graph::build_node_input_sender(
         }
         return std::move(finalized).value();
       },
-      graph_scheduler));
+      graph_scheduler, core().options_.max_child_concurrency);
 }
 
 } // namespace wh::compose
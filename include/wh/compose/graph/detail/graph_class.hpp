@@ -537,7 +537,8 @@ private:
       -> pregel_ready_state;
 
   [[nodiscard]] static auto
-  collect_reader_value(graph_stream_reader reader, edge_limits limits,
+  collect_reader_value(graph_stream_reader reader, edge_limits limits, const edge_fold *fold,
+                       std::size_t drain_budget,
                        const wh::core::detail::any_resume_scheduler_t &graph_scheduler)
       -> graph_sender;
 
@@ -549,9 +550,10 @@ private:
   [[nodiscard]] static auto make_reader_lowering(const indexed_edge &edge)
       -> wh::core::result<reader_lowering>;
 
-  [[nodiscard]] static auto
-  lower_reader(graph_stream_reader reader, reader_lowering lowering, wh::core::run_context &context,
-               const wh::core::detail::any_resume_scheduler_t &graph_scheduler) -> graph_sender;
+  [[nodiscard]] auto lower_reader(graph_stream_reader reader, reader_lowering lowering,
+                                  wh::core::run_context &context,
+                                  const wh::core::detail::any_resume_scheduler_t &graph_scheduler)
+      const -> graph_sender;
 
   [[nodiscard]] auto needs_reader_merge(const std::uint32_t node_id) const noexcept -> bool;
 
@@ -685,6 +687,9 @@ private:
 
   [[nodiscard]] auto resolve_node_sync_dispatch(const std::uint32_t node_id) const -> sync_dispatch;
 
+  [[nodiscard]] auto resolve_node_metrics(const std::uint32_t node_id) const noexcept
+      -> const wh::core::graph_node_metrics *;
+
   [[nodiscard]] static auto
   resolve_branch_merge(const detail::runtime_state::invoke_config &config) noexcept
       -> graph_branch_merge;
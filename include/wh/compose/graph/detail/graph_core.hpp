@@ -33,6 +33,7 @@
 #include "wh/compose/graph/snapshot.hpp"
 #include "wh/compose/node/authored.hpp"
 #include "wh/compose/types.hpp"
+#include "wh/core/metrics/hooks.hpp"
 
 namespace wh::compose::detail {
 
@@ -76,6 +77,7 @@ struct graph_core {
     bool no_data{false};
     edge_adapter adapter{};
     edge_limits limits{};
+    edge_fold fold{};
   };
 
   enum class edge_flow : std::uint8_t {
@@ -256,6 +258,8 @@ struct graph_core {
   std::vector<graph_diagnostic> diagnostics_{};
   std::vector<std::string> compile_order_{};
   compiled_execution_index compiled_execution_index_{};
+  /// Node latency handles by node id; empty when `options_.metrics` is null.
+  std::vector<wh::core::graph_node_metrics> node_metrics_{};
   mutable std::optional<graph_snapshot> snapshot_cache_{};
   mutable std::optional<std::once_flag> snapshot_once_{std::in_place};
   graph_restore_shape restore_shape_{};
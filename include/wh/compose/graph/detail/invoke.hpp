@@ -53,7 +53,9 @@ auto start_nested_graph(const graph &graph, wh::core::run_context &context, grap
 
 } // namespace wh::compose::detail
 
+#include <memory>
 #include <new>
+#include <string_view>
 
 #include "wh/compose/graph/detail/graph_class.hpp"
 #include "wh/compose/node/detail/runtime_access.hpp"
@@ -189,6 +191,7 @@ private:
     if (delivered_.exchange(true, std::memory_order_acq_rel)) {
       return;
     }
+    finish_callback_sampling(status.has_error());
     graph_invoke_result invoke_result{};
     invoke_result.report = detail::make_graph_run_report(status, std::move(report_outputs_));
     invoke_result.output_status = std::move(status);
@@ -200,6 +203,7 @@ private:
     if (delivered_.exchange(true, std::memory_order_acq_rel)) {
       return;
     }
+    finish_callback_sampling(true);
     stdexec::set_value(std::move(receiver_), wh::core::result<graph_invoke_result>::failure(code));
   }
 
@@ -210,7 +214,39 @@ private:
     complete_status(std::move(status));
   }
 
+  /// Decides callback sampling for the whole run. Nested invokes inherit the
+  /// decision already installed on the shared manager.
+  auto start_callback_sampling() noexcept -> void {
+    const auto &sampling = request_.controls.call.callback_sampling;
+    if (!sampling.has_value() || !context_.callbacks.has_value() ||
+        context_.callbacks->manager.sampler() != nullptr) {
+      return;
+    }
+    try {
+      const auto &trace = request_.controls.call.trace;
+      const auto decision = wh::core::decide_callback_sampling(
+          *sampling, trace.has_value() ? std::string_view{trace->trace_id} : std::string_view{});
+      context_.callbacks->manager.set_sampler(
+          std::make_shared<wh::core::callback_trace_sampler>(decision, *sampling));
+      owns_callback_sampler_ = true;
+    } catch (...) {
+      owns_callback_sampler_ = false;
+    }
+  }
+
+  auto finish_callback_sampling(const bool failed) noexcept -> void {
+    if (!owns_callback_sampler_ || !context_.callbacks.has_value()) {
+      return;
+    }
+    owns_callback_sampler_ = false;
+    try {
+      static_cast<void>(context_.callbacks->manager.finish_sampled_run(failed));
+    } catch (...) {
+    }
+  }
+
   auto start_runtime() noexcept -> void {
+    start_callback_sampling();
     const auto *control_scheduler = this->control_scheduler();
     const auto *work_scheduler = this->work_scheduler();
     if (control_scheduler == nullptr || work_scheduler == nullptr) {
@@ -275,6 +311,7 @@ private:
   alignas(child_op_t) std::byte child_op_storage_[sizeof(child_op_t)];
   std::atomic<bool> delivered_{false};
   bool child_op_engaged_{false};
+  bool owns_callback_sampler_{false};
 };
 
 template <typename request_t> class graph::invoke_sender {
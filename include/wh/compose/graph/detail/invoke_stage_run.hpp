@@ -200,6 +200,7 @@ protected:
     }
     auto &live_input = *attempt_slot.input->payload;
     const auto dispatch = session().resolve_node_sync_dispatch(attempt_slot.node_id);
+    session().mark_node_started(attempt_slot);
     if (compiled_node_is_sync(*attempt_slot.node)) {
       if (dispatch == sync_dispatch::work) {
         return this->start_child(invoke_session::make_sync_node_attempt_sender(
@@ -422,6 +423,7 @@ protected:
   auto settle_node(const attempt_id attempt, wh::core::result<graph_value> &&executed)
       -> wh::core::result<void> {
     auto &attempt_slot = session().slot(attempt);
+    session().mark_node_finished(attempt_slot);
     if (executed.has_error()) {
       if (!session().freeze_requested() && attempt_slot.attempt < attempt_slot.retry_budget) {
         if (session().should_retain_input(attempt_slot) && attempt_slot.input.has_value()) {
@@ -22,6 +22,12 @@ inline auto graph::resolve_node_timeout_budget(const std::uint32_t node_id) cons
   return core().options_.node_timeout;
 }
 
+inline auto graph::resolve_node_metrics(const std::uint32_t node_id) const noexcept
+    -> const wh::core::graph_node_metrics * {
+  const auto &node_metrics = core().node_metrics_;
+  return node_id < node_metrics.size() ? &node_metrics[node_id] : nullptr;
+}
+
 inline auto graph::resolve_node_parallel_gate(const std::uint32_t node_id) const -> std::size_t {
   const auto *node = core().compiled_execution_index_.index.nodes_by_id[node_id];
   if (node != nullptr && node->meta.options.max_parallel_override.has_value()) {
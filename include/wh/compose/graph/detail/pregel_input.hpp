@@ -291,7 +291,7 @@ inline auto graph::build_pregel_node_input_sender(
                                    graph_scheduler));
   }
 
-  return detail::bridge_graph_sender(detail::make_child_batch_sender(
+  return detail::make_bounded_child_batch_sender(
       std::move(senders), std::move(input_state),
       [](input_stage &stage_state, const std::size_t index,
          wh::core::result<graph_value> current) -> wh::core::result<void> {
@@ -323,7 +323,7 @@ inline auto graph::build_pregel_node_input_sender(
         }
         return std::move(finalized).value();
       },
-      graph_scheduler));
+      graph_scheduler, core().options_.max_child_concurrency);
 }
 
 } // namespace wh::compose
@@ -1,4 +1,5 @@
 // Defines graph stream rewrite policy used by graph state-stream rewriting.
+// Ready chunk bursts are rewritten in one scheduler turn up to a budget.
 #pragma once
 
 #include "wh/compose/graph/detail/child_pump.hpp"
@@ -13,6 +14,8 @@ template <typename handler_t> struct rewrite_policy {
   graph_stream_reader reader{};
   graph_stream_writer writer{};
   wh_no_unique_address handler_t handler;
+  /// Chunks rewritten per scheduler turn; see `drain_ready_chunks`.
+  std::size_t drain_budget{1U};
 
   [[nodiscard]] auto next_step() -> wh::core::result<child_pump_step<child_sender_type>> {
     return child_pump_step<child_sender_type>::launch(reader.read_async());
@@ -20,6 +23,18 @@ template <typename handler_t> struct rewrite_policy {
 
   [[nodiscard]] auto handle_completion(completion_type next)
       -> std::optional<wh::core::result<graph_value>> {
+    auto status = rewrite_chunk(std::move(next));
+    if (status.has_value()) {
+      return status;
+    }
+    return drain_ready_chunks(reader, drain_budget, [this](completion_type ready) {
+      return rewrite_chunk(std::move(ready));
+    });
+  }
+
+private:
+  [[nodiscard]] auto rewrite_chunk(completion_type next)
+      -> std::optional<wh::core::result<graph_value>> {
     if (next.has_error()) {
       return wh::core::result<graph_value>::failure(next.error());
     }
@@ -60,12 +75,14 @@ template <typename handler_t>
 [[nodiscard]] inline auto
 make_rewrite_stream_sender(graph_stream_reader source, graph_stream_writer writer,
                            handler_t &&handler,
-                           const wh::core::detail::any_resume_scheduler_t &graph_scheduler) {
+                           const wh::core::detail::any_resume_scheduler_t &graph_scheduler,
+                           const std::size_t drain_budget = 1U) {
   return make_child_pump_sender(
       rewrite_policy<std::remove_cvref_t<handler_t>>{
           .reader = std::move(source),
           .writer = std::move(writer),
           .handler = std::forward<handler_t>(handler),
+          .drain_budget = drain_budget,
       },
       graph_scheduler);
 }
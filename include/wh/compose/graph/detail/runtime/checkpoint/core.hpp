@@ -1003,6 +1003,7 @@ inline auto prepare_restore(wh::core::run_context &context, const restore_scope
   const auto forwarded_restore_key = resolve_forwarded_restore_key(graph_name, runtime_path);
 
   std::optional<checkpoint_state> checkpoint_value{};
+  bool live_state = false;
   const auto forwarded_iter = forwarded_checkpoints.find(forwarded_restore_key);
   if (forwarded_iter != forwarded_checkpoints.end()) {
     checkpoint_value.emplace(std::move(forwarded_iter->second));
@@ -1043,17 +1044,22 @@ inline auto prepare_restore(wh::core::run_context &context, const restore_scope
     if (!plan.restore_from_checkpoint || !plan.checkpoint.has_value()) {
       return std::optional<prepared_restore>{};
     }
+    live_state = plan.live_state;
     checkpoint_value.emplace(std::move(plan.checkpoint).value());
   }
 
-  auto serializer_roundtrip =
-      roundtrip_with_serializer(std::move(checkpoint_value).value(), context, config);
-  if (serializer_roundtrip.has_error()) {
-    set_error_detail(outputs, serializer_roundtrip.error(), checkpoint_id_hint,
-                     "restore_serializer_roundtrip");
-    return wh::core::result<std::optional<prepared_restore>>::failure(serializer_roundtrip.error());
+  if (!live_state) {
+    auto serializer_roundtrip =
+        roundtrip_with_serializer(std::move(checkpoint_value).value(), context, config);
+    if (serializer_roundtrip.has_error()) {
+      set_error_detail(outputs, serializer_roundtrip.error(), checkpoint_id_hint,
+                       "restore_serializer_roundtrip");
+      return wh::core::result<std::optional<prepared_restore>>::failure(
+          serializer_roundtrip.error());
+    }
+    checkpoint_value.emplace(std::move(serializer_roundtrip).value());
   }
-  auto checkpoint = std::move(serializer_roundtrip).value();
+  auto checkpoint = std::move(checkpoint_value).value();
 
   auto pre_load = apply_modifier(context, config.checkpoint_before_load,
                                  std::addressof(config.checkpoint_before_load_nodes), checkpoint);
@@ -1167,21 +1173,28 @@ inline auto make_persist_sender(
               return wh::compose::detail::failure_graph_sender(pre_save.error());
             }
 
+            // Backends must never hold borrowed ref/cref aliases, including
+            // live-state backends that keep the state past this invoke.
             auto owned_checkpoint = wh::core::into_owned(std::move(persisted_checkpoint));
             if (owned_checkpoint.has_error()) {
               set_error_detail(outputs, owned_checkpoint.error(), checkpoint_id_hint,
                                "persist_snapshot_own");
               return wh::compose::detail::failure_graph_sender(owned_checkpoint.error());
             }
-            auto serializer_roundtrip =
-                roundtrip_with_serializer(std::move(owned_checkpoint).value(), context, config);
-            if (serializer_roundtrip.has_error()) {
-              set_error_detail(outputs, serializer_roundtrip.error(), checkpoint_id_hint,
-                               "persist_serializer_roundtrip");
-              return wh::compose::detail::failure_graph_sender(serializer_roundtrip.error());
+            persisted_checkpoint = std::move(owned_checkpoint).value();
+            const bool live_state = runtime_backend.backend != nullptr &&
+                                    runtime_backend.backend->retains_live_state;
+            if (!live_state) {
+              auto serializer_roundtrip =
+                  roundtrip_with_serializer(std::move(persisted_checkpoint), context, config);
+              if (serializer_roundtrip.has_error()) {
+                set_error_detail(outputs, serializer_roundtrip.error(), checkpoint_id_hint,
+                                 "persist_serializer_roundtrip");
+                return wh::compose::detail::failure_graph_sender(serializer_roundtrip.error());
+              }
+              persisted_checkpoint = std::move(serializer_roundtrip).value();
             }
 
-            persisted_checkpoint = std::move(serializer_roundtrip).value();
             checkpoint_save_options write_options =
                 config.checkpoint_save.value_or(checkpoint_save_options{});
             if (!write_options.checkpoint_id.has_value()) {
@@ -1191,7 +1204,13 @@ inline auto make_persist_sender(
             persisted_checkpoint.branch = write_options.branch;
             persisted_checkpoint.parent_branch = write_options.parent_branch;
 
-            auto post_save_state = persisted_checkpoint;
+            const bool has_post_save =
+                static_cast<bool>(config.checkpoint_after_save) ||
+                !config.checkpoint_after_save_nodes.empty();
+            std::optional<checkpoint_state> post_save_state{};
+            if (has_post_save) {
+              post_save_state.emplace(persisted_checkpoint);
+            }
             if (runtime_backend.backend != nullptr) {
               auto saved = runtime_backend.backend->save(std::move(persisted_checkpoint),
                                                         std::move(write_options), context);
@@ -1209,9 +1228,12 @@ inline auto make_persist_sender(
               }
             }
 
-            auto post_save =
-                apply_modifier(context, config.checkpoint_after_save,
-                               std::addressof(config.checkpoint_after_save_nodes), post_save_state);
+            if (!post_save_state.has_value()) {
+              return wh::compose::detail::ready_graph_unit_sender();
+            }
+            auto post_save = apply_modifier(context, config.checkpoint_after_save,
+                                            std::addressof(config.checkpoint_after_save_nodes),
+                                            *post_save_state);
             if (post_save.has_error()) {
               set_error_detail(outputs, post_save.error(), checkpoint_id_hint,
                                "post_save_modifier");
@@ -36,6 +36,7 @@ enum class reader_lane_state : std::uint8_t { unseen = 0U, attached, disabled };
 struct reader_lowering {
   edge_limits limits{};
   const edge_to_value_adapter *project{nullptr};
+  const edge_fold *fold{nullptr};
 };
 
 struct resolved_input {
@@ -137,6 +137,9 @@ struct attempt_slot {
   std::size_t retry_budget{0U};
   std::size_t attempt{0U};
   std::optional<std::chrono::milliseconds> timeout_budget{};
+  /// Set only when node metrics are enabled.
+  std::chrono::steady_clock::time_point ready_at{};
+  std::chrono::steady_clock::time_point started_at{};
   std::optional<attempt_input> input{};
   std::optional<route_payload> route{};
   node_runtime runtime{};
@@ -239,6 +239,12 @@ protected:
 
   [[nodiscard]] auto finalize_node_attempt(attempt_id attempt) -> wh::core::result<void>;
 
+  auto mark_node_ready(attempt_slot &slot) const noexcept -> void;
+
+  auto mark_node_started(attempt_slot &slot) const noexcept -> void;
+
+  auto mark_node_finished(const attempt_slot &slot) const noexcept -> void;
+
   [[nodiscard]] auto begin_state_post(attempt_id attempt, graph_value &output)
       -> wh::core::result<std::optional<graph_sender>>;
 
@@ -30,6 +30,7 @@ inline auto detail::invoke_runtime::invoke_session::make_input_attempt(const std
   if (node_id < cache_state().resolved_state_handlers.size()) {
     slot_state.state_handlers = cache_state().resolved_state_handlers[node_id];
   }
+  mark_node_ready(slot_state);
   return attempt;
 }
 
@@ -271,6 +272,37 @@ inline auto detail::invoke_runtime::invoke_session::finalize_node_attempt(const
   return {};
 }
 
+inline auto
+detail::invoke_runtime::invoke_session::mark_node_ready(attempt_slot &slot) const noexcept -> void {
+  if (owner_->resolve_node_metrics(slot.node_id) != nullptr) {
+    slot.ready_at = std::chrono::steady_clock::now();
+  }
+}
+
+inline auto
+detail::invoke_runtime::invoke_session::mark_node_started(attempt_slot &slot) const noexcept
+    -> void {
+  const auto *metrics = owner_->resolve_node_metrics(slot.node_id);
+  if (metrics == nullptr) {
+    return;
+  }
+  slot.started_at = std::chrono::steady_clock::now();
+  // Retries re-enter here; only the first attempt waited in the ready queue.
+  if (slot.attempt == 0U && metrics->queue_latency != nullptr &&
+      slot.ready_at != std::chrono::steady_clock::time_point{}) {
+    metrics->queue_latency->record(slot.started_at - slot.ready_at);
+  }
+}
+
+inline auto
+detail::invoke_runtime::invoke_session::mark_node_finished(const attempt_slot &slot) const noexcept
+    -> void {
+  const auto *metrics = owner_->resolve_node_metrics(slot.node_id);
+  if (metrics != nullptr && slot.started_at != std::chrono::steady_clock::time_point{}) {
+    wh::core::record_elapsed(metrics->execution_latency, slot.started_at);
+  }
+}
+
 inline auto detail::invoke_runtime::invoke_session::begin_state_post(const attempt_id attempt,
                                                                      graph_value &output)
     -> wh::core::result<std::optional<graph_sender>> {
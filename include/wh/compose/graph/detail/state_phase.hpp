@@ -63,15 +63,17 @@ inline auto graph::apply_state_phase_async(
     return detail::ready_graph_sender(wh::core::result<graph_value>{std::move(state.payload)});
   };
 
-  const auto run_stream = [finish, fail_stream,
-                           &graph_scheduler](phase_state state) -> graph_sender {
+  const auto run_stream = [finish, fail_stream, &graph_scheduler,
+                           drain_budget = core().options_.stream_drain_budget](
+                              phase_state state) -> graph_sender {
     if (state.stream_handler == nullptr) {
       return finish(std::move(state));
     }
 
     if (auto *reader = wh::core::any_cast<graph_stream_reader>(&state.payload); reader != nullptr) {
       auto source = std::move(*reader);
-      auto [writer, rewritten] = make_graph_stream();
+      constexpr std::size_t rewrite_capacity = 16U;
+      auto [writer, rewritten] = make_graph_stream(rewrite_capacity);
       auto handler = [cause = state.cause, context = state.context,
                       process_state = state.process_state, stream_handler = state.stream_handler](
                          graph_value &chunk_payload) -> wh::core::result<void> {
@@ -80,7 +82,8 @@ inline auto graph::apply_state_phase_async(
       state.payload = wh::core::any(std::move(rewritten));
       return detail::bridge_graph_sender(
           detail::make_rewrite_stream_sender(std::move(source), std::move(writer),
-                                             std::move(handler), graph_scheduler) |
+                                             std::move(handler), graph_scheduler,
+                                             std::min(drain_budget, rewrite_capacity)) |
           stdexec::let_value([state = std::move(state), finish, fail_stream](
                                  wh::core::result<graph_value> status) mutable -> graph_sender {
             if (status.has_error()) {
@@ -358,6 +358,12 @@ inline auto compare_graph_snapshots(graph_diff &diff, const graph_snapshot &base
   compare_compile_option("max_parallel_per_node",
                          size_text(baseline.compile_options.max_parallel_per_node),
                          size_text(candidate.compile_options.max_parallel_per_node));
+  compare_compile_option("max_child_concurrency",
+                         size_text(baseline.compile_options.max_child_concurrency),
+                         size_text(candidate.compile_options.max_child_concurrency));
+  compare_compile_option("stream_drain_budget",
+                         size_text(baseline.compile_options.stream_drain_budget),
+                         size_text(candidate.compile_options.stream_drain_budget));
   compare_compile_option("enable_local_state_generation",
                          bool_text(baseline.compile_options.enable_local_state_generation),
                          bool_text(candidate.compile_options.enable_local_state_generation));
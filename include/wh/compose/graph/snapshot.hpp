@@ -43,6 +43,10 @@ struct graph_snapshot_compile_options {
   std::size_t max_parallel_nodes{1U};
   /// Default per-node parallel limit.
   std::size_t max_parallel_per_node{1U};
+  /// In-flight limit for independent children of one input stage.
+  std::size_t max_child_concurrency{1U};
+  /// Buffered stream chunks one pump may consume per scheduler turn.
+  std::size_t stream_drain_budget{64U};
   /// True enables local-state generation capability.
   bool enable_local_state_generation{true};
   /// True when a compile callback is installed.
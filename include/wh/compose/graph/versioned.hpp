@@ -0,0 +1,66 @@
+// Defines hot-swappable compiled graphs built on `wh::core::versioned`.
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <stdexec/execution.hpp>
+
+#include "wh/compose/graph/graph.hpp"
+#include "wh/compose/graph/invoke_types.hpp"
+#include "wh/core/error.hpp"
+#include "wh/core/result.hpp"
+#include "wh/core/run_context.hpp"
+#include "wh/core/stdexec/ready_result_sender.hpp"
+#include "wh/core/stdexec/variant_sender.hpp"
+#include "wh/core/versioned.hpp"
+
+namespace wh::compose {
+
+/// Compiled graph that can be replaced while invokes are running. Each
+/// `invoke_latest` pins the version current at call time and keeps it alive
+/// until that run completes.
+using versioned_graph = wh::core::versioned<graph>;
+
+/// Publishes `compiled` as the latest version of `graphs` and returns its
+/// version number. Fails with `contract_violation` when `compiled` has not
+/// been compiled, so callers never observe a half-built graph.
+[[nodiscard]] inline auto publish_compiled_graph(versioned_graph &graphs, graph compiled)
+    -> wh::core::result<std::uint64_t> {
+  if (!compiled.compiled()) {
+    return wh::core::result<std::uint64_t>::failure(wh::core::errc::contract_violation);
+  }
+  return graphs.publish(std::move(compiled));
+}
+
+template <typename request_t>
+  requires std::same_as<std::remove_cvref_t<request_t>, graph_invoke_request>
+/// Invokes the latest published graph. The returned sender owns its pinned
+/// version; completes with `contract_violation` when nothing was published.
+[[nodiscard]] inline auto invoke_latest(const versioned_graph &graphs,
+                                        wh::core::run_context &context, request_t &&request) {
+  using output_status = wh::core::result<graph_invoke_result>;
+  using graph_ptr = std::shared_ptr<const graph>;
+  auto invoke_pinned = [&context, request = graph_invoke_request{std::forward<request_t>(
+                                      request)}](const graph_ptr &pinned) mutable {
+    return pinned->invoke(context, std::move(request));
+  };
+  using failure_sender_t = decltype(wh::core::detail::failure_result_sender<output_status>(
+      wh::core::errc::contract_violation));
+  using pinned_sender_t = decltype(stdexec::let_value(stdexec::just(std::declval<graph_ptr>()),
+                                                      std::move(invoke_pinned)));
+  using dispatch_sender_t = wh::core::detail::variant_sender<failure_sender_t, pinned_sender_t>;
+
+  auto pinned = graphs.snapshot();
+  if (!pinned) {
+    return dispatch_sender_t{wh::core::detail::failure_result_sender<output_status>(
+        wh::core::errc::contract_violation)};
+  }
+  return dispatch_sender_t{
+      stdexec::let_value(stdexec::just(std::move(pinned.value)), std::move(invoke_pinned))};
+}
+
+} // namespace wh::compose
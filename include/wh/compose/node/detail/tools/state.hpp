@@ -5,6 +5,7 @@
 #include <concepts>
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 #include <utility>
@@ -139,6 +140,7 @@ struct tools_state {
   const tools_options *options{nullptr};
   const tool_registry *default_tools{nullptr};
   std::optional<std::reference_wrapper<const tool_registry>> override_tools{};
+  std::shared_ptr<const tool_registry> pinned_tools{};
   tools_rerun local_rerun{};
   std::optional<std::reference_wrapper<tools_rerun>> shared_rerun{};
   tool_after_chain_ptr afters{};
@@ -151,6 +153,9 @@ struct tools_state {
     if (override_tools.has_value()) {
       return override_tools->get();
     }
+    if (pinned_tools != nullptr) {
+      return *pinned_tools;
+    }
     return *default_tools;
   }
 
@@ -197,12 +202,18 @@ struct tools_state {
   state.default_tools = std::addressof(tools);
   state.afters = make_tool_after_chain(options);
   state.sequential = options.sequential;
+  if (options.live_registry != nullptr) {
+    state.pinned_tools = options.live_registry->snapshot().value;
+  }
 
   if (runtime.call_options() != nullptr && runtime.call_options()->tools().has_value()) {
     const auto &tool_options = *runtime.call_options()->tools();
     if (tool_options.registry.has_value()) {
       state.override_tools = tool_options.registry;
     }
+    if (tool_options.versioned_registry != nullptr) {
+      state.pinned_tools = tool_options.versioned_registry->snapshot().value;
+    }
     if (tool_options.sequential.has_value()) {
       state.sequential = *tool_options.sequential;
     }
@@ -1,6 +1,7 @@
 // Defines the public tools-node contract surface.
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -14,7 +15,9 @@
 #include "wh/compose/graph/stream.hpp"
 #include "wh/compose/types.hpp"
 #include "wh/core/function.hpp"
+#include "wh/core/small_string.hpp"
 #include "wh/core/type_traits.hpp"
+#include "wh/core/versioned.hpp"
 #include "wh/tool/call_scope.hpp"
 
 namespace wh::compose {
@@ -22,7 +25,7 @@ namespace wh::compose {
 /// One concrete tool call carried into tools-node execution.
 struct tool_call {
   /// Stable correlation id for this call.
-  std::string call_id{};
+  wh::core::small_string<> call_id{};
   /// Registered tool name.
   std::string tool_name{};
   /// Structured arguments payload encoded for the target tool.
@@ -97,6 +100,10 @@ struct tool_entry {
 using tool_registry = std::unordered_map<std::string, tool_entry, wh::core::transparent_string_hash,
                                          wh::core::transparent_string_equal>;
 
+/// Hot-reloadable tool registry. Each tools-node invoke pins the latest
+/// published registry for its whole run.
+using versioned_tool_registry = wh::core::versioned<tool_registry>;
+
 /// Before/after hooks shared by invoke and stream paths.
 struct tool_middleware {
   /// Optional pre-call hook that may rewrite the concrete tool call.
@@ -117,6 +124,9 @@ struct tools_options {
   std::vector<tool_middleware> middleware{};
   /// True executes tool calls sequentially.
   bool sequential{true};
+  /// Optional live registry replacing the frozen one; publishing to it
+  /// reaches new invokes without rebuilding the graph.
+  std::shared_ptr<const versioned_tool_registry> live_registry{};
 };
 
 /// Rerun state shared across tools-node invocations when caller opts in.
@@ -141,6 +151,9 @@ struct tools_rerun {
 struct tools_call_options {
   /// Optional host-owned override registry borrowed for this invoke only.
   std::optional<std::reference_wrapper<const tool_registry>> registry{};
+  /// Optional host-owned versioned registry; this invoke pins its latest
+  /// version. An explicit `registry` still takes precedence.
+  const versioned_tool_registry *versioned_registry{nullptr};
   /// Optional sequential override.
   std::optional<bool> sequential{};
   /// Optional caller-owned rerun state shared by reference with this invoke.
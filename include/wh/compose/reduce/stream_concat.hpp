@@ -3,10 +3,14 @@
 #pragma once
 
 #include <span>
+#include <string>
 #include <string_view>
+#include <vector>
 
+#include "wh/core/any.hpp"
 #include "wh/core/result.hpp"
 #include "wh/internal/concat.hpp"
+#include "wh/schema/message/types.hpp"
 
 namespace wh::compose {
 
@@ -26,4 +30,43 @@ template <typename value_t>
   return registry.concat_as<value_t>(values);
 }
 
+/// Runtime concat path that moves out of type-erased chunks the caller owns.
+[[nodiscard]] inline auto
+stream_concat_owned(const wh::internal::stream_concat_registry &registry,
+                    const wh::core::any_type_key type,
+                    const wh::internal::dynamic_owned_stream_chunks values)
+    -> wh::core::result<wh::internal::dynamic_stream_chunk> {
+  return registry.concat_owned(type, values);
+}
+
+/// Typed concat path that moves out of chunks the caller owns.
+template <typename value_t>
+[[nodiscard]] inline auto stream_concat_owned(const wh::internal::stream_concat_registry &registry,
+                                              const std::span<value_t> values)
+    -> wh::core::result<value_t> {
+  return registry.concat_owned_as<value_t>(values);
+}
+
+/// Registers built-in incremental accumulators for strings, messages and vectors.
+inline auto register_builtin_concat_accumulators(wh::internal::stream_concat_registry &registry)
+    -> wh::core::result<void> {
+  auto registered =
+      registry.register_concat_accumulator<std::string>(wh::internal::string_accumulate{});
+  if (registered.has_error()) {
+    return registered;
+  }
+  registered = registry.register_concat_accumulator<wh::schema::message>(
+      wh::schema::append_message_chunk, wh::schema::finish_message_chunks);
+  if (registered.has_error()) {
+    return registered;
+  }
+  registered = registry.register_concat_accumulator<std::vector<wh::schema::message>>(
+      wh::internal::vector_accumulate{});
+  if (registered.has_error()) {
+    return registered;
+  }
+  return registry.register_concat_accumulator<std::vector<wh::core::any>>(
+      wh::internal::vector_accumulate{});
+}
+
 } // namespace wh::compose
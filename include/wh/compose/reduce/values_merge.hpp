@@ -3,10 +3,14 @@
 #pragma once
 
 #include <span>
+#include <string>
 #include <string_view>
+#include <vector>
 
+#include "wh/core/any.hpp"
 #include "wh/core/result.hpp"
 #include "wh/internal/merge.hpp"
+#include "wh/schema/message/types.hpp"
 
 namespace wh::compose {
 
@@ -26,4 +30,42 @@ template <typename value_t>
   return registry.merge_as<value_t>(values);
 }
 
+/// Runtime merge path that moves out of type-erased values the caller owns.
+[[nodiscard]] inline auto values_merge_owned(const wh::internal::values_merge_registry &registry,
+                                             const wh::core::any_type_key type,
+                                             const wh::internal::dynamic_owned_merge_values values)
+    -> wh::core::result<wh::internal::dynamic_merge_value> {
+  return registry.merge_owned(type, values);
+}
+
+/// Typed merge path that moves out of values the caller owns.
+template <typename value_t>
+[[nodiscard]] inline auto values_merge_owned(const wh::internal::values_merge_registry &registry,
+                                             const std::span<value_t> values)
+    -> wh::core::result<value_t> {
+  return registry.merge_owned_as<value_t>(values);
+}
+
+/// Registers built-in incremental accumulators for strings, messages and vectors.
+inline auto register_builtin_merge_accumulators(wh::internal::values_merge_registry &registry)
+    -> wh::core::result<void> {
+  auto registered =
+      registry.register_merge_accumulator<std::string>(wh::internal::string_accumulate{});
+  if (registered.has_error()) {
+    return registered;
+  }
+  registered = registry.register_merge_accumulator<wh::schema::message>(
+      wh::schema::append_message_chunk, wh::schema::finish_message_chunks);
+  if (registered.has_error()) {
+    return registered;
+  }
+  registered = registry.register_merge_accumulator<std::vector<wh::schema::message>>(
+      wh::internal::vector_accumulate{});
+  if (registered.has_error()) {
+    return registered;
+  }
+  return registry.register_merge_accumulator<std::vector<wh::core::any>>(
+      wh::internal::vector_accumulate{});
+}
+
 } // namespace wh::compose
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "wh/compose/runtime/checkpoint.hpp"
+#include "wh/compose/runtime/checkpoint_parking.hpp"
 #include "wh/compose/runtime/interrupt.hpp"
 #include "wh/compose/runtime/resume.hpp"
 #include "wh/compose/runtime/state.hpp"
@@ -156,6 +156,8 @@ struct checkpoint_restore_plan {
   bool restore_from_checkpoint{false};
   /// Loaded checkpoint when `restore_from_checkpoint == true`.
   std::optional<checkpoint_state> checkpoint{};
+  /// True when `checkpoint` is a live in-memory state that skips serializer decode.
+  bool live_state{false};
 };
 
 /// Structured checkpoint failure detail with checkpoint-id context.
@@ -328,6 +330,9 @@ struct checkpoint_backend {
   checkpoint_backend_prepare_restore prepare_restore{nullptr};
   /// Save callback for runtime checkpoint persists.
   checkpoint_backend_save save{nullptr};
+  /// True hands `save` the live state without ownerize or serializer roundtrip;
+  /// the backend then owns durable encoding when it persists.
+  bool retains_live_state{false};
 };
 
 class checkpoint_store;
@@ -0,0 +1,429 @@
+// Defines in-memory parking for interrupted runs: live checkpoint states kept
+// under a TTL and written durably only on eviction or shutdown.
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "wh/compose/runtime/checkpoint.hpp"
+#include "wh/core/address.hpp"
+#include "wh/core/error.hpp"
+#include "wh/core/function.hpp"
+#include "wh/core/result.hpp"
+#include "wh/core/run_context.hpp"
+#include "wh/core/type_traits.hpp"
+
+namespace wh::compose {
+
+/// Payload sink write callback receiving one encoded parked run.
+using checkpoint_payload_save = wh::core::callback_function<wh::core::result<void>(
+    graph_value &&, checkpoint_save_options &&, wh::core::run_context &) const>;
+/// Payload sink read callback returning one encoded run for restore.
+using checkpoint_payload_load = wh::core::callback_function<wh::core::result<graph_value>(
+    const checkpoint_load_options &, wh::core::run_context &) const>;
+
+/// Durable sink that stores parked runs in their serialized form.
+struct checkpoint_payload_sink {
+  /// Writes one encoded run.
+  checkpoint_payload_save save{nullptr};
+  /// Loads one encoded run for restore.
+  checkpoint_payload_load load{nullptr};
+};
+
+/// Observer told about each parked run whose durable write failed.
+using checkpoint_parking_error_handler =
+    wh::core::callback_function<void(std::string_view, wh::core::error_code) const>;
+
+/// Parking policy and durable sink for one `checkpoint_parking_lot`.
+///
+/// Exactly one of `durable_store`, `durable_backend`, and `durable_payload_sink`
+/// must be set; otherwise every durable write fails and the run stays parked.
+struct checkpoint_parking_options {
+  /// How long one parked run stays in memory before it is written durably.
+  std::chrono::milliseconds ttl{std::chrono::seconds{30}};
+  /// Most runs kept in memory; parking one more first persists the oldest.
+  std::size_t max_parked{1024U};
+  /// Durable store receiving the owned state on eviction/shutdown.
+  checkpoint_store *durable_store{nullptr};
+  /// Durable backend receiving the owned state on eviction/shutdown.
+  checkpoint_backend *durable_backend{nullptr};
+  /// Durable sink receiving `serializer`'s encoded payload on eviction/shutdown.
+  const checkpoint_payload_sink *durable_payload_sink{nullptr};
+  /// Serializer for `durable_payload_sink`; required with it, unused otherwise.
+  const checkpoint_serializer *serializer{nullptr};
+  /// Called for every failed durable write, including those during destruction.
+  checkpoint_parking_error_handler on_persist_error{nullptr};
+};
+
+/// Interrupt routing entry for one parked run.
+struct parked_interrupt {
+  /// Checkpoint id the parked run is restored from.
+  std::string checkpoint_id{};
+  /// Interrupt capture location recorded in the parked state.
+  wh::core::address location{};
+};
+
+/// Checkpoint backend that parks interrupted runs in memory.
+///
+/// The runtime hands `save` the live checkpoint (no ownerize or serializer
+/// roundtrip) and `prepare_restore` moves it back out, so a resume inside the
+/// TTL skips the durable path entirely. Expired, flushed, or over-capacity
+/// entries are written to the durable sink exactly once; expiry is swept on
+/// every `park` and `prepare_restore`, so memory stays bounded by `max_parked`.
+class checkpoint_parking_lot {
+public:
+  using clock = std::chrono::steady_clock;
+
+  explicit checkpoint_parking_lot(checkpoint_parking_options options = {})
+      : options_(std::move(options)) {
+    backend_.prepare_restore = checkpoint_backend_prepare_restore{
+        [this](const checkpoint_load_options &load_options, wh::core::run_context &context)
+            -> wh::core::result<checkpoint_restore_plan> {
+          return prepare_restore(load_options, context);
+        }};
+    backend_.save = checkpoint_backend_save{
+        [this](checkpoint_state &&state, checkpoint_save_options &&save_options,
+               wh::core::run_context &) -> wh::core::result<void> {
+          return park(std::move(state), std::move(save_options));
+        }};
+    backend_.retains_live_state = true;
+  }
+
+  checkpoint_parking_lot(const checkpoint_parking_lot &) = delete;
+  checkpoint_parking_lot(checkpoint_parking_lot &&) = delete;
+  auto operator=(const checkpoint_parking_lot &) -> checkpoint_parking_lot & = delete;
+  auto operator=(checkpoint_parking_lot &&) -> checkpoint_parking_lot & = delete;
+
+  /// Writes every still-parked run durably. Failed writes are reported through
+  /// `on_persist_error`; call `flush` first to observe them as a result.
+  ~checkpoint_parking_lot() { static_cast<void>(flush()); }
+
+  /// Returns the backend to install in `graph_runtime_services::checkpoint`.
+  [[nodiscard]] auto backend() noexcept -> checkpoint_backend * {
+    return std::addressof(backend_);
+  }
+
+  /// Parks one live checkpoint, replacing any entry with the same id. Expired
+  /// runs are written durably first; when the lot is full the oldest run is
+  /// too, and a failed write fails the park and leaves that run parked.
+  auto park(checkpoint_state &&state, checkpoint_save_options &&save_options,
+            const clock::time_point now = clock::now()) -> wh::core::result<void> {
+    auto checkpoint_id = resolve_checkpoint_id(save_options);
+    state.checkpoint_id = checkpoint_id;
+    // Failed expiry writes stay parked and reach `on_persist_error`; only a
+    // failure to make room for this run fails the park.
+    static_cast<void>(evict_expired(now));
+    std::unique_lock lock{lock_};
+    // Capacity is re-checked under the insert lock, so concurrent parks can
+    // never push the lot past `max_parked`.
+    while (at_capacity(checkpoint_id)) {
+      auto evicted = extract_oldest();
+      lock.unlock();
+      auto persisted = persist_evicted(evicted);
+      if (persisted.has_error()) {
+        return wh::core::result<void>::failure(persisted.error());
+      }
+      lock.lock();
+    }
+    erase_interrupts(checkpoint_id);
+    for (const auto &[interrupt_id, location] : state.interrupt_snapshot.interrupt_id_to_address) {
+      interrupts_.insert_or_assign(interrupt_id, parked_interrupt{
+                                                     .checkpoint_id = checkpoint_id,
+                                                     .location = location,
+                                                 });
+    }
+    save_options.checkpoint_id = checkpoint_id;
+    entries_.insert_or_assign(std::move(checkpoint_id),
+                              parked_entry{
+                                  .state = std::move(state),
+                                  .options = std::move(save_options),
+                                  .expires_at = now + options_.ttl,
+                              });
+    return {};
+  }
+
+  /// Finds the parked run that raised `interrupt_id`, when it is still parked.
+  [[nodiscard]] auto find_interrupt(const std::string_view interrupt_id) const
+      -> std::optional<parked_interrupt> {
+    std::lock_guard lock{lock_};
+    const auto iter = interrupts_.find(interrupt_id);
+    if (iter == interrupts_.end()) {
+      return std::nullopt;
+    }
+    return iter->second;
+  }
+
+  /// Returns whether `checkpoint_id` is currently parked.
+  [[nodiscard]] auto contains(const std::string_view checkpoint_id) const -> bool {
+    std::lock_guard lock{lock_};
+    return entries_.find(checkpoint_id) != entries_.end();
+  }
+
+  /// Returns the number of parked runs.
+  [[nodiscard]] auto size() const -> std::size_t {
+    std::lock_guard lock{lock_};
+    return entries_.size();
+  }
+
+  /// Restores from parking when the run is parked and live, else from the durable sink.
+  [[nodiscard]] auto prepare_restore(const checkpoint_load_options &load_options,
+                                     wh::core::run_context &context,
+                                     const clock::time_point now = clock::now())
+      -> wh::core::result<checkpoint_restore_plan> {
+    if (load_options.force_new_run) {
+      return checkpoint_restore_plan{};
+    }
+    // As in `park`, failed expiry writes stay parked and reach
+    // `on_persist_error`; they must not block resuming a live parked run.
+    static_cast<void>(evict_expired(now));
+    if (auto parked = take(load_options); parked.has_value()) {
+      return checkpoint_restore_plan{
+          .restore_from_checkpoint = true,
+          .checkpoint = std::move(parked),
+          .live_state = true,
+      };
+    }
+    if (options_.durable_backend != nullptr) {
+      return options_.durable_backend->prepare_restore(load_options, context);
+    }
+    if (options_.durable_store != nullptr) {
+      return options_.durable_store->prepare_restore(load_options);
+    }
+    if (options_.durable_payload_sink != nullptr) {
+      return restore_payload(load_options, context);
+    }
+    return wh::core::result<checkpoint_restore_plan>::failure(wh::core::errc::not_found);
+  }
+
+  /// Writes runs parked past their TTL to the durable sink; returns how many.
+  auto evict_expired(const clock::time_point now = clock::now())
+      -> wh::core::result<std::size_t> {
+    return persist_where([now](const clock::time_point expires_at) { return expires_at <= now; });
+  }
+
+  /// Writes every parked run to the durable sink, e.g. on shutdown; returns how
+  /// many. Runs whose write fails stay parked and the first error is returned.
+  auto flush() -> wh::core::result<std::size_t> {
+    return persist_where([](const clock::time_point) { return true; });
+  }
+
+private:
+  struct parked_entry {
+    checkpoint_state state{};
+    checkpoint_save_options options{};
+    clock::time_point expires_at{};
+  };
+
+  [[nodiscard]] static auto resolve_checkpoint_id(const checkpoint_save_options &save_options)
+      -> std::string {
+    if (save_options.checkpoint_id.has_value() && !save_options.checkpoint_id->empty()) {
+      return *save_options.checkpoint_id;
+    }
+    return std::string{"default"};
+  }
+
+  [[nodiscard]] auto take(const checkpoint_load_options &load_options)
+      -> std::optional<checkpoint_state> {
+    std::lock_guard lock{lock_};
+    auto iter = entries_.end();
+    if (load_options.checkpoint_id.has_value() && !load_options.checkpoint_id->empty()) {
+      iter = entries_.find(*load_options.checkpoint_id);
+    } else if (load_options.thread_key.has_value()) {
+      iter = std::find_if(entries_.begin(), entries_.end(), [&load_options](const auto &entry) {
+        return entry.second.options.thread_key == load_options.thread_key;
+      });
+    }
+    if (iter == entries_.end()) {
+      return std::nullopt;
+    }
+    if (load_options.branch.has_value() && iter->second.options.branch != *load_options.branch) {
+      return std::nullopt;
+    }
+    auto state = std::move(iter->second.state);
+    erase_interrupts(iter->first);
+    entries_.erase(iter);
+    return state;
+  }
+
+  auto erase_interrupts(const std::string_view checkpoint_id) -> void {
+    std::erase_if(interrupts_,
+                  [checkpoint_id](const auto &entry) {
+                    return entry.second.checkpoint_id == checkpoint_id;
+                  });
+  }
+
+  template <typename predicate_t>
+  auto persist_where(predicate_t &&should_persist) -> wh::core::result<std::size_t> {
+    std::vector<std::pair<std::string, parked_entry>> evicted{};
+    {
+      std::lock_guard lock{lock_};
+      for (auto iter = entries_.begin(); iter != entries_.end();) {
+        if (!should_persist(iter->second.expires_at)) {
+          ++iter;
+          continue;
+        }
+        erase_interrupts(iter->first);
+        auto node = entries_.extract(iter++);
+        evicted.emplace_back(std::move(node.key()), std::move(node.mapped()));
+      }
+    }
+    return persist_evicted(evicted);
+  }
+
+  /// Returns whether parking `checkpoint_id` would exceed `max_parked`.
+  /// Requires `lock_`.
+  [[nodiscard]] auto at_capacity(const std::string_view checkpoint_id) const -> bool {
+    return entries_.size() >= std::max<std::size_t>(options_.max_parked, 1U) &&
+           entries_.find(checkpoint_id) == entries_.end();
+  }
+
+  /// Removes the parked run closest to expiry for a durable write. Requires
+  /// `lock_` and a non-empty lot.
+  [[nodiscard]] auto extract_oldest() -> std::vector<std::pair<std::string, parked_entry>> {
+    const auto oldest = std::ranges::min_element(
+        entries_, {}, [](const auto &entry) { return entry.second.expires_at; });
+    erase_interrupts(oldest->first);
+    auto node = entries_.extract(oldest);
+    std::vector<std::pair<std::string, parked_entry>> evicted{};
+    evicted.emplace_back(std::move(node.key()), std::move(node.mapped()));
+    return evicted;
+  }
+
+  /// Persists every evicted entry, reparks the failures, and returns the
+  /// number written or the first error.
+  auto persist_evicted(std::vector<std::pair<std::string, parked_entry>> &evicted)
+      -> wh::core::result<std::size_t> {
+    std::optional<wh::core::error_code> first_error{};
+    std::size_t failed = 0U;
+    for (std::size_t index = 0U; index < evicted.size(); ++index) {
+      auto persisted = persist(evicted[index].second);
+      if (persisted.has_value()) {
+        continue;
+      }
+      if (options_.on_persist_error) {
+        options_.on_persist_error(evicted[index].first, persisted.error());
+      }
+      if (!first_error.has_value()) {
+        first_error = persisted.error();
+      }
+      if (failed != index) {
+        std::swap(evicted[failed], evicted[index]);
+      }
+      ++failed;
+    }
+    if (!first_error.has_value()) {
+      return evicted.size();
+    }
+    repark(std::span{evicted}.first(failed));
+    return wh::core::result<std::size_t>::failure(*first_error);
+  }
+
+  /// Puts entries whose durable write did not happen back into parking.
+  auto repark(const std::span<std::pair<std::string, parked_entry>> entries) -> void {
+    std::lock_guard lock{lock_};
+    for (auto &[checkpoint_id, entry] : entries) {
+      for (const auto &[interrupt_id, location] :
+           entry.state.interrupt_snapshot.interrupt_id_to_address) {
+        interrupts_.insert_or_assign(interrupt_id, parked_interrupt{
+                                                       .checkpoint_id = checkpoint_id,
+                                                       .location = location,
+                                                   });
+      }
+      entries_.try_emplace(std::move(checkpoint_id), std::move(entry));
+    }
+  }
+
+  /// Returns how many durable sinks are configured.
+  [[nodiscard]] auto sink_count() const noexcept -> std::size_t {
+    return static_cast<std::size_t>(options_.durable_store != nullptr) +
+           static_cast<std::size_t>(options_.durable_backend != nullptr) +
+           static_cast<std::size_t>(options_.durable_payload_sink != nullptr);
+  }
+
+  /// Writes one parked run; leaves `entry` intact on failure. State sinks get
+  /// the owned state; the payload sink gets the serializer's encoded form.
+  auto persist(const parked_entry &entry) -> wh::core::result<void> {
+    if (sink_count() != 1U) {
+      return wh::core::result<void>::failure(wh::core::errc::invalid_argument);
+    }
+    const auto *payload_sink = options_.durable_payload_sink;
+    if (payload_sink != nullptr &&
+        (!payload_sink->save || options_.serializer == nullptr || !options_.serializer->encode)) {
+      return wh::core::result<void>::failure(wh::core::errc::invalid_argument);
+    }
+    wh::core::run_context context{};
+    auto owned = wh::core::into_owned(entry.state);
+    if (owned.has_error()) {
+      return wh::core::result<void>::failure(owned.error());
+    }
+    auto save_options = entry.options;
+    if (payload_sink != nullptr) {
+      auto encoded = options_.serializer->encode(std::move(owned).value(), context);
+      if (encoded.has_error()) {
+        return wh::core::result<void>::failure(encoded.error());
+      }
+      return payload_sink->save(std::move(encoded).value(), std::move(save_options), context);
+    }
+    if (options_.durable_backend != nullptr) {
+      return options_.durable_backend->save(std::move(owned).value(), std::move(save_options),
+                                            context);
+    }
+    auto saved = options_.durable_store->save(std::move(owned).value(), std::move(save_options));
+    if (saved.has_error()) {
+      return wh::core::result<void>::failure(saved.error());
+    }
+    return {};
+  }
+
+  /// Loads and decodes one run from the payload sink.
+  [[nodiscard]] auto restore_payload(const checkpoint_load_options &load_options,
+                                     wh::core::run_context &context)
+      -> wh::core::result<checkpoint_restore_plan> {
+    const auto *payload_sink = options_.durable_payload_sink;
+    if (!payload_sink->load || options_.serializer == nullptr || !options_.serializer->decode) {
+      return wh::core::result<checkpoint_restore_plan>::failure(
+          wh::core::errc::invalid_argument);
+    }
+    auto payload = payload_sink->load(load_options, context);
+    if (payload.has_error()) {
+      return wh::core::result<checkpoint_restore_plan>::failure(payload.error());
+    }
+    auto decoded = options_.serializer->decode(std::move(payload).value(), context);
+    if (decoded.has_error()) {
+      return wh::core::result<checkpoint_restore_plan>::failure(decoded.error());
+    }
+    // Already decoded here, so the runtime must not decode it again.
+    return checkpoint_restore_plan{
+        .restore_from_checkpoint = true,
+        .checkpoint = std::move(decoded).value(),
+        .live_state = true,
+    };
+  }
+
+  /// Parking policy and durable sink.
+  checkpoint_parking_options options_{};
+  /// Backend view handed to graph runtime services.
+  checkpoint_backend backend_{};
+  /// Guards parked entries and the interrupt index.
+  mutable std::mutex lock_{};
+  /// Parked runs keyed by checkpoint id.
+  std::unordered_map<std::string, parked_entry, wh::core::transparent_string_hash,
+                     wh::core::transparent_string_equal>
+      entries_{};
+  /// Interrupt id to parked run routing index.
+  std::unordered_map<std::string, parked_interrupt, wh::core::transparent_string_hash,
+                     wh::core::transparent_string_equal>
+      interrupts_{};
+};
+
+} // namespace wh::compose
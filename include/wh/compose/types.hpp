@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -21,6 +22,7 @@
 #include "wh/core/run_context.hpp"
 #include "wh/core/type_traits.hpp"
 #include "wh/core/stdexec/result_sender.hpp"
+#include "wh/internal/concat.hpp"
 #include "wh/schema/stream/core/any_stream.hpp"
 
 namespace wh::compose {
@@ -167,6 +169,21 @@ struct edge_adapter {
   custom_edge_adapter custom{};
 };
 
+/// Observer invoked with the running partial value after each folded chunk.
+using edge_partial_observer = wh::core::callback_function<void(const graph_value &) const>;
+
+/// Incremental fold used by default `stream -> value` lowering.
+struct edge_fold {
+  /// Registry whose accumulators fold chunks as they arrive; null collects
+  /// chunks into one `std::vector<graph_value>` instead.
+  std::shared_ptr<const wh::internal::stream_concat_registry> registry{};
+  /// Optional observer for the running partial value.
+  edge_partial_observer on_partial{nullptr};
+  /// Value produced when the stream ends before its first chunk, e.g.
+  /// `std::string{}` for text; empty by default.
+  graph_value empty_value{};
+};
+
 /// Extra edge configuration beyond pure topology.
 struct edge_options {
   /// Disables control dependency tracking for this edge when true.
@@ -177,6 +194,8 @@ struct edge_options {
   edge_adapter adapter{};
   /// Optional runtime guardrails for default/custom adapters.
   edge_limits limits{};
+  /// Optional incremental fold for default `stream -> value` lowering.
+  edge_fold fold{};
 };
 /// Graph edge definition between two node keys.
 struct graph_edge {
@@ -1,5 +1,6 @@
 #pragma once
 
 #include "wh/core/bounded_queue/bounded_queue.hpp"
+#include "wh/core/bounded_queue/capacity.hpp"
 #include "wh/core/bounded_queue/single_ended.hpp"
 #include "wh/core/bounded_queue/status.hpp"
@@ -13,6 +13,7 @@
 
 #include <stdexec/execution.hpp>
 
+#include "wh/core/bounded_queue/capacity.hpp"
 #include "wh/core/bounded_queue/detail/critical_section.hpp"
 #include "wh/core/bounded_queue/detail/queue_wait_state.hpp"
 #include "wh/core/bounded_queue/detail/ring_storage.hpp"
@@ -227,6 +228,11 @@ public:
                          const allocator_type &allocator = allocator_type{})
       : buffer_(capacity, allocator) {}
 
+  /// Creates a queue whose ring grows and shrinks within `policy`.
+  explicit bounded_queue(const ring_capacity_policy policy,
+                         const allocator_type &allocator = allocator_type{})
+      : buffer_(policy, allocator) {}
+
   bounded_queue(const bounded_queue &) = delete;
   auto operator=(const bounded_queue &) -> bounded_queue & = delete;
   bounded_queue(bounded_queue &&) = delete;
@@ -375,6 +381,19 @@ public:
     return buffer_.size();
   }
 
+  /// Returns ring allocation and high-water counters.
+  [[nodiscard]] auto capacity_stats() const noexcept -> ring_capacity_stats {
+    std::unique_lock<critical_section> lock(lock_);
+    return buffer_.stats();
+  }
+
+  /// Keeps `gauge` equal to the buffered item count until it is replaced or
+  /// the queue is destroyed; null detaches. The gauge must outlive the queue.
+  auto attach_depth_gauge(metric_gauge *gauge) noexcept -> void {
+    std::unique_lock<critical_section> lock(lock_);
+    buffer_.attach_depth_gauge(gauge);
+  }
+
 private:
   struct sync_push_waiter final : push_waiter_base_t {
     std::atomic_flag ready = ATOMIC_FLAG_INIT;
@@ -781,7 +800,7 @@ private:
           } else if (auto *waiter = op.queue->wait_state_.take_pop()) {
             ready_pop = waiter;
             store_status(op, status_type::success);
-          } else if (!op.queue->buffer_.full()) {
+          } else if (op.queue->buffer_.reserve_slot()) {
             try {
               op.queue->buffer_.push_back(std::move(op.value));
               store_status(op, status_type::success);
@@ -1447,7 +1466,7 @@ private:
 
       if (auto *waiter = wait_state_.take_pop()) {
         ready_pop = waiter;
-      } else if (!buffer_.full()) {
+      } else if (buffer_.reserve_slot()) {
         buffer_.push_back(std::forward<value_u>(value));
         return true;
       } else {
@@ -1547,7 +1566,7 @@ private:
           return status_type::busy_async;
         }
         ready_pop = wait_state_.take_pop();
-      } else if (buffer_.full()) {
+      } else if (!buffer_.reserve_slot()) {
         return status_type::full;
       } else {
         buffer_.push_back(std::forward<value_u>(value));
@@ -1593,7 +1612,7 @@ private:
           return status_type::busy_async;
         }
         ready_pop = wait_state_.take_pop();
-      } else if (buffer_.full()) {
+      } else if (!buffer_.reserve_slot()) {
         return status_type::full;
       } else {
         buffer_.emplace_back(std::forward<args_t>(args)...);
@@ -1659,7 +1678,7 @@ private:
         return try_pop_result::failure(status_type::empty);
       }
 
-      if (buffer_.full() && has_try_complete(wait_state_.front_push())) {
+      if (buffer_.saturated() && has_try_complete(wait_state_.front_push())) {
         if (!try_complete_waiter(wait_state_.front_push())) {
           return try_pop_result::failure(status_type::busy_async);
         }
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+namespace wh::core {
+
+/// Growth bounds for an adaptive bounded-queue ring.
+///
+/// The ring allocates nothing until the first push, starts with `initial`
+/// slots, doubles while producers keep it saturated, and never holds more than
+/// `max` items. A drained ring that grew past `initial` and whose recent peak
+/// was far below its allocation releases its storage and restarts at
+/// `initial` on the next push; the initial block itself is kept so a ring
+/// cycling one item does not allocate on every push.
+struct ring_capacity_policy {
+  /// Slots allocated on first push.
+  std::size_t initial{8U};
+  /// Logical queue capacity; pushes report `full` beyond this bound.
+  std::size_t max{64U};
+};
+
+/// Occupancy and allocation counters for one bounded-queue ring.
+struct ring_capacity_stats {
+  /// Logical queue capacity.
+  std::size_t capacity{0U};
+  /// Slots currently allocated.
+  std::size_t allocated{0U};
+  /// Largest number of queued items ever observed.
+  std::size_t high_water{0U};
+  /// Number of storage growth steps.
+  std::size_t grow_count{0U};
+  /// Number of idle storage releases.
+  std::size_t shrink_count{0U};
+};
+
+} // namespace wh::core
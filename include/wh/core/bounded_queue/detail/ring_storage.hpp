@@ -1,13 +1,17 @@
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <concepts>
+#include <cstdint>
 #include <memory>
 #include <new>
 #include <optional>
 #include <utility>
 
+#include "wh/core/bounded_queue/capacity.hpp"
 #include "wh/core/compiler.hpp"
+#include "wh/core/metrics/instruments.hpp"
 
 namespace wh::core::detail {
 
@@ -19,57 +23,111 @@ public:
 
   explicit ring_storage(const std::size_t capacity,
                         const allocator_type &allocator = allocator_type{})
-      : allocator_(allocator), capacity_(capacity) {
+      : allocator_(allocator), capacity_(capacity), allocated_(capacity), initial_(capacity) {
     if (capacity_ != 0U) {
       storage_ = allocator_traits::allocate(allocator_, capacity_);
     }
   }
 
+  /// Creates an adaptive ring that allocates lazily and grows toward `policy.max`.
+  explicit ring_storage(const ring_capacity_policy policy,
+                        const allocator_type &allocator = allocator_type{})
+      : allocator_(allocator), capacity_(std::max<std::size_t>(policy.max, 1U)),
+        initial_(std::clamp<std::size_t>(policy.initial, 1U, capacity_)), adaptive_(true) {}
+
   ring_storage(const ring_storage &) = delete;
   auto operator=(const ring_storage &) -> ring_storage & = delete;
 
   ring_storage(ring_storage &&other) noexcept
-      : allocator_(std::move(other.allocator_)), capacity_(other.capacity_), size_(other.size_),
-        head_(other.head_), storage_(other.storage_) {
-    other.capacity_ = 0U;
-    other.size_ = 0U;
-    other.head_ = 0U;
-    other.storage_ = nullptr;
+      : allocator_(std::move(other.allocator_)), capacity_(other.capacity_),
+        allocated_(other.allocated_), initial_(other.initial_), adaptive_(other.adaptive_),
+        size_(other.size_), head_(other.head_), window_peak_(other.window_peak_),
+        stats_(other.stats_), storage_(other.storage_), depth_gauge_(other.depth_gauge_) {
+    other.reset_moved_from();
   }
 
   auto operator=(ring_storage &&other) noexcept -> ring_storage & {
     if (this == &other) {
       return *this;
     }
+    attach_depth_gauge(nullptr);
     destroy_all();
 
     allocator_ = std::move(other.allocator_);
     capacity_ = other.capacity_;
+    allocated_ = other.allocated_;
+    initial_ = other.initial_;
+    adaptive_ = other.adaptive_;
     size_ = other.size_;
     head_ = other.head_;
+    window_peak_ = other.window_peak_;
+    stats_ = other.stats_;
     storage_ = other.storage_;
+    depth_gauge_ = other.depth_gauge_;
 
-    other.capacity_ = 0U;
-    other.size_ = 0U;
-    other.head_ = 0U;
-    other.storage_ = nullptr;
+    other.reset_moved_from();
     return *this;
   }
 
-  ~ring_storage() { destroy_all(); }
+  ~ring_storage() {
+    attach_depth_gauge(nullptr);
+    destroy_all();
+  }
 
   [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0U; }
   [[nodiscard]] auto full() const noexcept -> bool { return size_ == capacity_; }
+  /// True when every allocated slot is occupied; equals `full()` for fixed rings.
+  [[nodiscard]] auto saturated() const noexcept -> bool { return size_ == allocated_; }
   [[nodiscard]] auto capacity() const noexcept -> std::size_t { return capacity_; }
+  [[nodiscard]] auto allocated() const noexcept -> std::size_t { return allocated_; }
   [[nodiscard]] auto size() const noexcept -> std::size_t { return size_; }
   [[nodiscard]] auto get_allocator() const noexcept -> allocator_type { return allocator_; }
 
+  /// Mirrors the element count into `gauge` by deltas, so several rings may
+  /// share one gauge; null detaches.
+  auto attach_depth_gauge(metric_gauge *gauge) noexcept -> void {
+    if (depth_gauge_ != nullptr) {
+      depth_gauge_->add(-static_cast<std::int64_t>(size_));
+    }
+    depth_gauge_ = gauge;
+    if (depth_gauge_ != nullptr) {
+      depth_gauge_->add(static_cast<std::int64_t>(size_));
+    }
+  }
+
+  [[nodiscard]] auto stats() const noexcept -> ring_capacity_stats {
+    auto current = stats_;
+    current.capacity = capacity_;
+    current.allocated = allocated_;
+    return current;
+  }
+
+  /// Ensures one free slot, growing an adaptive ring when needed. Returns false
+  /// when the ring is full or growth could not allocate.
+  [[nodiscard]] auto reserve_slot() noexcept -> bool {
+    if (size_ < allocated_) {
+      return true;
+    }
+    if (size_ == capacity_) {
+      return false;
+    }
+    return grow();
+  }
+
   template <typename... args_t>
     requires std::constructible_from<value_t, args_t &&...>
   auto emplace_back(args_t &&...args) -> void {
     assert(!full());
+    if (!reserve_slot()) {
+      throw std::bad_alloc{};
+    }
     allocator_traits::construct(allocator_, storage_ + tail_index(), std::forward<args_t>(args)...);
     ++size_;
+    if (depth_gauge_ != nullptr) {
+      depth_gauge_->add(1);
+    }
+    window_peak_ = std::max(window_peak_, size_);
+    stats_.high_water = std::max(stats_.high_water, size_);
   }
 
   auto push_back(const value_t &value) -> void
@@ -96,6 +154,9 @@ public:
     auto *slot = storage_ + head_;
     head_ = advance_index(head_);
     --size_;
+    if (depth_gauge_ != nullptr) {
+      depth_gauge_->add(-1);
+    }
 
     try {
       std::forward<sink_t>(sink)(std::move(*slot));
@@ -104,23 +165,98 @@ public:
       allocator_traits::destroy(allocator_, slot);
       throw;
     }
+    if (size_ == 0U) {
+      release_if_idle();
+    }
   }
 
 private:
+  /// A drained ring that grew past `initial_` releases storage when its peak
+  /// since the last drain used at most one eighth of the allocation; hot rings
+  /// and rings still at their initial block keep their slots.
+  static constexpr std::size_t idle_release_ratio = 8U;
+
   [[nodiscard]] auto tail_index() const noexcept -> std::size_t {
-    if (capacity_ == 0U) {
+    if (allocated_ == 0U) {
       return 0U;
     }
     const auto tail = head_ + size_;
-    return tail >= capacity_ ? (tail - capacity_) : tail;
+    return tail >= allocated_ ? (tail - allocated_) : tail;
   }
 
   [[nodiscard]] auto advance_index(const std::size_t index) const noexcept -> std::size_t {
-    if (capacity_ == 0U) {
+    if (allocated_ == 0U) {
       return 0U;
     }
     const auto next = index + 1U;
-    return next == capacity_ ? 0U : next;
+    return next == allocated_ ? 0U : next;
+  }
+
+  [[nodiscard]] auto grow() noexcept -> bool {
+    if (!adaptive_) {
+      return false;
+    }
+    const auto next_allocated =
+        allocated_ == 0U ? initial_ : std::min(capacity_, allocated_ * 2U);
+    value_t *next_storage = nullptr;
+    try {
+      next_storage = allocator_traits::allocate(allocator_, next_allocated);
+    } catch (...) {
+      return false;
+    }
+
+    std::size_t moved = 0U;
+    try {
+      auto index = head_;
+      for (; moved < size_; ++moved) {
+        allocator_traits::construct(allocator_, next_storage + moved,
+                                    std::move_if_noexcept(storage_[index]));
+        index = advance_index(index);
+      }
+    } catch (...) {
+      for (std::size_t offset = 0U; offset < moved; ++offset) {
+        allocator_traits::destroy(allocator_, next_storage + offset);
+      }
+      allocator_traits::deallocate(allocator_, next_storage, next_allocated);
+      return false;
+    }
+
+    const auto count = size_;
+    destroy_all();
+    storage_ = next_storage;
+    allocated_ = next_allocated;
+    size_ = count;
+    head_ = 0U;
+    if (count != 0U) {
+      ++stats_.grow_count;
+    }
+    return true;
+  }
+
+  auto release_if_idle() noexcept -> void {
+    const auto peak = window_peak_;
+    window_peak_ = 0U;
+    if (!adaptive_ || allocated_ <= initial_ || peak * idle_release_ratio > allocated_) {
+      return;
+    }
+    allocator_traits::deallocate(allocator_, storage_, allocated_);
+    storage_ = nullptr;
+    allocated_ = 0U;
+    head_ = 0U;
+    ++stats_.shrink_count;
+  }
+
+  auto reset_moved_from() noexcept -> void {
+    capacity_ = 0U;
+    allocated_ = 0U;
+    initial_ = 0U;
+    adaptive_ = false;
+    size_ = 0U;
+    head_ = 0U;
+    window_peak_ = 0U;
+    stats_ = {};
+    storage_ = nullptr;
+    depth_gauge_ = nullptr;
   }
 
   auto destroy_all() noexcept -> void {
@@ -133,18 +269,24 @@ private:
       allocator_traits::destroy(allocator_, storage_ + index);
       index = advance_index(index);
     }
-    allocator_traits::deallocate(allocator_, storage_, capacity_);
+    allocator_traits::deallocate(allocator_, storage_, allocated_);
     storage_ = nullptr;
     size_ = 0U;
     head_ = 0U;
-    capacity_ = 0U;
+    allocated_ = 0U;
   }
 
   wh_no_unique_address allocator_type allocator_{};
   std::size_t capacity_{0U};
+  std::size_t allocated_{0U};
+  std::size_t initial_{0U};
+  bool adaptive_{false};
   std::size_t size_{0U};
   std::size_t head_{0U};
+  std::size_t window_peak_{0U};
+  ring_capacity_stats stats_{};
   value_t *storage_{nullptr};
+  metric_gauge *depth_gauge_{nullptr};
 };
 
 } // namespace wh::core::detail
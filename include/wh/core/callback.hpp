@@ -2,4 +2,5 @@
 #pragma once
 
 #include "wh/core/callback/concepts.hpp"
+#include "wh/core/callback/sampling.hpp"
 #include "wh/core/callback/types.hpp"
@@ -0,0 +1,212 @@
+// Defines trace-level callback sampling decided once per run, including the
+// tail-sampling buffer that replays a run's events only when it is kept.
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "wh/core/callback/types.hpp"
+
+namespace wh::core {
+
+/// Sampling policy applied to every callback event of one run.
+struct callback_sampling_options {
+  /// Fraction of runs traced in full, in `[0, 1]`.
+  double ratio{1.0};
+  /// True still dispatches error-stage events of runs that were not sampled.
+  bool always_trace_errors{true};
+  /// True buffers unsampled runs and replays them when they error or run slow.
+  bool tail_sampling{false};
+  /// Tail-sampled runs at least this slow are replayed.
+  std::chrono::nanoseconds tail_latency_threshold{std::chrono::nanoseconds::max()};
+  /// Maximum number of events buffered for one tail-sampled run.
+  std::size_t tail_event_capacity{256U};
+};
+
+/// Per-run sampling outcome.
+enum class callback_sampling_decision : std::uint8_t {
+  /// Every event is dispatched.
+  sampled = 0U,
+  /// Events are dropped, except errors when `always_trace_errors` is set.
+  dropped,
+  /// Events are buffered and replayed only if the run is kept.
+  tail,
+};
+
+/// How one event of a sampled run is handled.
+enum class callback_sampling_route : std::uint8_t {
+  /// Dispatch immediately.
+  dispatch = 0U,
+  /// Discard the event.
+  drop,
+  /// Buffer the event for a later replay.
+  buffer,
+};
+
+namespace detail {
+
+[[nodiscard]] inline auto sampling_hash(const std::string_view text) noexcept -> std::uint64_t {
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (const auto ch : text) {
+    hash ^= static_cast<std::uint8_t>(ch);
+    hash *= 1099511628211ULL;
+  }
+  // FNV-1a leaves the high bits poorly mixed for short ids.
+  hash ^= hash >> 33U;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33U;
+  return hash;
+}
+
+[[nodiscard]] inline auto next_sampling_seed() noexcept -> std::uint64_t {
+  thread_local std::uint64_t state =
+      static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+  state += 0x9e3779b97f4a7c15ULL;
+  auto mixed = state;
+  mixed = (mixed ^ (mixed >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+  mixed = (mixed ^ (mixed >> 27U)) * 0x94d049bb133111ebULL;
+  return mixed ^ (mixed >> 31U);
+}
+
+} // namespace detail
+
+/// Decides sampling for one run. Non-empty trace ids decide deterministically,
+/// so every process that sees the same trace keeps or drops it together.
+[[nodiscard]] inline auto decide_callback_sampling(const callback_sampling_options &options,
+                                                   const std::string_view trace_id = {}) noexcept
+    -> callback_sampling_decision {
+  if (options.ratio >= 1.0) {
+    return callback_sampling_decision::sampled;
+  }
+  if (options.ratio > 0.0) {
+    const auto seed =
+        trace_id.empty() ? detail::next_sampling_seed() : detail::sampling_hash(trace_id);
+    const auto unit = static_cast<double>(seed >> 11U) * 0x1.0p-53;
+    if (unit < options.ratio) {
+      return callback_sampling_decision::sampled;
+    }
+  }
+  return options.tail_sampling ? callback_sampling_decision::tail
+                               : callback_sampling_decision::dropped;
+}
+
+/// Sampling state shared by every callback manager copied from one run.
+///
+/// Head decisions are immutable, so routing an event is a field read. Tail runs
+/// copy each event into a bounded buffer under a mutex together with the
+/// callback chain that would have received it; `finish` replays the buffer in
+/// arrival order when the run errored or exceeded the latency threshold.
+class callback_trace_sampler {
+public:
+  /// One buffered event and the callback chain it is replayed into.
+  struct buffered_event {
+    callback_stage stage{callback_stage::start};
+    callback_event_payload payload{};
+    callback_run_info run_info{};
+    stage_view_callback replay{nullptr};
+  };
+
+  explicit callback_trace_sampler(const callback_sampling_decision decision,
+                                  callback_sampling_options options = {})
+      : decision_(decision), options_(std::move(options)),
+        started_(std::chrono::steady_clock::now()) {
+    if (decision_ == callback_sampling_decision::tail) {
+      buffer_.reserve(std::min<std::size_t>(options_.tail_event_capacity, 32U));
+    }
+  }
+
+  /// Returns the run's sampling decision.
+  [[nodiscard]] auto decision() const noexcept -> callback_sampling_decision { return decision_; }
+
+  /// Returns the sampling policy.
+  [[nodiscard]] auto options() const noexcept -> const callback_sampling_options & {
+    return options_;
+  }
+
+  /// Returns how one event of `stage` is handled.
+  [[nodiscard]] auto route(const callback_stage stage) const noexcept -> callback_sampling_route {
+    switch (decision_) {
+    case callback_sampling_decision::sampled:
+      return callback_sampling_route::dispatch;
+    case callback_sampling_decision::dropped:
+      return stage == callback_stage::error && options_.always_trace_errors
+                 ? callback_sampling_route::dispatch
+                 : callback_sampling_route::drop;
+    case callback_sampling_decision::tail:
+      return callback_sampling_route::buffer;
+    }
+    return callback_sampling_route::dispatch;
+  }
+
+  /// Buffers one event of a tail-sampled run; events past capacity are counted
+  /// and dropped, but an error stage still marks the run as kept.
+  auto buffer(const callback_stage stage, const callback_event_view event,
+              const callback_run_info &run_info, stage_view_callback replay) -> void {
+    std::lock_guard lock{mutex_};
+    if (stage == callback_stage::error) {
+      errored_ = true;
+    }
+    if (buffer_.size() >= options_.tail_event_capacity) {
+      ++overflowed_;
+      return;
+    }
+    auto owned = event.into_owned();
+    if (owned.has_error()) {
+      ++overflowed_;
+      return;
+    }
+    buffer_.push_back(buffered_event{.stage = stage,
+                                     .payload = std::move(owned).value(),
+                                     .run_info = run_info,
+                                     .replay = std::move(replay)});
+  }
+
+  /// Returns the number of buffered events.
+  [[nodiscard]] auto buffered_count() const -> std::size_t {
+    std::lock_guard lock{mutex_};
+    return buffer_.size();
+  }
+
+  /// Returns the number of events dropped because the buffer was full.
+  [[nodiscard]] auto overflow_count() const -> std::size_t {
+    std::lock_guard lock{mutex_};
+    return overflowed_;
+  }
+
+  /// Ends the run and replays buffered events when it is kept; returns the
+  /// number of replayed events.
+  auto finish(const bool run_failed) -> std::size_t {
+    std::vector<buffered_event> kept{};
+    {
+      std::lock_guard lock{mutex_};
+      const auto elapsed = std::chrono::steady_clock::now() - started_;
+      if (errored_ || run_failed || elapsed >= options_.tail_latency_threshold) {
+        kept = std::move(buffer_);
+      }
+      buffer_.clear();
+    }
+    for (const auto &event : kept) {
+      if (static_cast<bool>(event.replay)) {
+        event.replay(event.stage, event.payload.as_ref(), event.run_info);
+      }
+    }
+    return kept.size();
+  }
+
+private:
+  callback_sampling_decision decision_{callback_sampling_decision::sampled};
+  callback_sampling_options options_{};
+  std::chrono::steady_clock::time_point started_{};
+  mutable std::mutex mutex_{};
+  std::vector<buffered_event> buffer_{};
+  std::size_t overflowed_{0U};
+  bool errored_{false};
+};
+
+} // namespace wh::core
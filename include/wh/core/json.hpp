@@ -2,5 +2,7 @@
 #pragma once
 
 #include "wh/core/json/api.hpp"
+#include "wh/core/json/arena.hpp"
 #include "wh/core/json/concepts.hpp"
+#include "wh/core/json/escape.hpp"
 #include "wh/core/json/types.hpp"
@@ -0,0 +1,251 @@
+// Defines a reusable JSON arena that keeps RapidJSON pool memory, parse
+// buffers, and output buffers alive across parses on hot tool/message paths.
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <rapidjson/document.h>
+#include <rapidjson/writer.h>
+
+#include "wh/core/error.hpp"
+#include "wh/core/json/types.hpp"
+#include "wh/core/result.hpp"
+
+namespace wh::core {
+
+/// DOM document whose parse stack also lives in pool memory, so reparsing reuses it.
+using json_arena_document =
+    rapidjson::GenericDocument<rapidjson::UTF8<>, json_allocator, json_allocator>;
+
+/// Reusable pool for JSON values, parse documents, and text buffers.
+///
+/// Everything handed out by the arena stays valid until the outermost
+/// `json_arena_scope` ends (or `reset()` is called). The value pool and the
+/// parse-stack pool each retain their first chunk across resets and grow it to
+/// the observed high-water mark, so a steady workload stops calling `malloc`
+/// after warm-up.
+class json_arena {
+public:
+  /// Initial retained pool capacity in bytes.
+  static constexpr std::size_t default_initial_capacity = 16U * 1024U;
+  /// Initial retained parse-stack pool capacity in bytes.
+  static constexpr std::size_t default_stack_pool_capacity = 4U * 1024U;
+  /// Upper bound for the retained first chunk; larger bursts are freed on reset.
+  static constexpr std::size_t default_max_retained_capacity = 4U * 1024U * 1024U;
+
+  explicit json_arena(const std::size_t initial_capacity = default_initial_capacity,
+                      const std::size_t max_retained_capacity = default_max_retained_capacity)
+      : max_retained_capacity_(std::max(initial_capacity, max_retained_capacity)) {
+    rebuild_value_pool(initial_capacity);
+    rebuild_stack_pool(default_stack_pool_capacity);
+  }
+
+  json_arena(const json_arena &) = delete;
+  auto operator=(const json_arena &) -> json_arena & = delete;
+  json_arena(json_arena &&) = delete;
+  auto operator=(json_arena &&) -> json_arena & = delete;
+
+  ~json_arena() = default;
+
+  /// Returns the calling thread's arena.
+  [[nodiscard]] static auto thread_local_instance() -> json_arena & {
+    thread_local json_arena arena{};
+    return arena;
+  }
+
+  /// Returns the pool allocator backing arena-owned values.
+  [[nodiscard]] auto allocator() noexcept -> json_allocator & { return *value_pool_; }
+
+  /// Returns a cleared parse document that is reused after the next reset.
+  [[nodiscard]] auto acquire_document() -> json_arena_document & {
+    if (next_document_ == documents_.size()) {
+      documents_.emplace_back(std::addressof(*value_pool_), stack_capacity,
+                              std::addressof(*stack_pool_));
+    }
+    auto &document = documents_[next_document_++];
+    document.SetNull();
+    return document;
+  }
+
+  /// Returns a cleared text buffer whose capacity is kept across resets.
+  [[nodiscard]] auto acquire_buffer() -> std::string & {
+    if (next_buffer_ == buffers_.size()) {
+      buffers_.emplace_back();
+    }
+    auto &buffer = buffers_[next_buffer_++];
+    buffer.clear();
+    return buffer;
+  }
+
+  /// Allocates one null value in pool memory.
+  [[nodiscard]] auto make_value() -> json_value * {
+    void *storage = value_pool_->Malloc(sizeof(json_value));
+    if (storage == nullptr) {
+      throw std::bad_alloc{};
+    }
+    return ::new (storage) json_value{};
+  }
+
+  /// Releases every value, document, and buffer handed out since the last reset.
+  auto reset() -> void {
+    for (std::size_t index = 0U; index < next_document_; ++index) {
+      documents_[index].SetNull();
+    }
+    next_document_ = 0U;
+    next_buffer_ = 0U;
+    // Parse stacks are released after every parse, which is a no-op on a pool,
+    // so the stack pool is reclaimed here and sized like the value pool.
+    const auto stack_used = stack_pool_->Size();
+    if (stack_pool_->Capacity() > retained_stack_capacity_ &&
+        retained_stack_capacity_ < max_retained_capacity_) {
+      rebuild_stack_pool(
+          std::min(std::bit_ceil(stack_used + pool_overhead), max_retained_capacity_));
+    } else {
+      stack_pool_->Clear();
+    }
+
+    const auto used = value_pool_->Size();
+    high_water_bytes_ = std::max(high_water_bytes_, used);
+    if (value_pool_->Capacity() > retained_capacity_ &&
+        retained_capacity_ < max_retained_capacity_) {
+      rebuild_value_pool(std::min(std::bit_ceil(used + pool_overhead), max_retained_capacity_));
+      return;
+    }
+    value_pool_->Clear();
+  }
+
+  /// Returns the retained first-chunk capacity in bytes.
+  [[nodiscard]] auto retained_capacity() const noexcept -> std::size_t {
+    return retained_capacity_;
+  }
+
+  /// Returns the parse-stack pool capacity in bytes, including chunks added
+  /// since the last reset.
+  [[nodiscard]] auto stack_capacity() const noexcept -> std::size_t {
+    return stack_pool_->Capacity();
+  }
+
+  /// Returns the largest pool usage observed at reset time.
+  [[nodiscard]] auto high_water_bytes() const noexcept -> std::size_t {
+    return high_water_bytes_;
+  }
+
+  /// Returns current nesting depth of active scopes.
+  [[nodiscard]] auto scope_depth() const noexcept -> std::size_t { return scope_depth_; }
+
+private:
+  friend class json_arena_scope;
+
+  static constexpr std::size_t stack_capacity = 1024U;
+  static constexpr std::size_t pool_overhead = 256U;
+
+  auto rebuild_value_pool(const std::size_t capacity) -> void {
+    for (auto &document : documents_) {
+      document.SetNull();
+    }
+    // Parse documents keep a pointer to the value pool, so they are rebuilt with it.
+    documents_.clear();
+    auto next_buffer = std::make_unique<char[]>(capacity);
+    value_pool_.reset();
+    value_pool_.emplace(next_buffer.get(), capacity);
+    pool_buffer_ = std::move(next_buffer);
+    retained_capacity_ = value_pool_->Capacity();
+  }
+
+  auto rebuild_stack_pool(const std::size_t capacity) -> void {
+    // Documents keep a pointer to the stack pool object and hold no stack
+    // between parses, so the pool is rebuilt in place at the same address.
+    auto next_buffer = std::make_unique<char[]>(capacity);
+    stack_pool_.reset();
+    stack_pool_.emplace(next_buffer.get(), capacity);
+    stack_buffer_ = std::move(next_buffer);
+    retained_stack_capacity_ = stack_pool_->Capacity();
+  }
+
+  std::unique_ptr<char[]> pool_buffer_{};
+  std::optional<json_allocator> value_pool_{};
+  std::unique_ptr<char[]> stack_buffer_{};
+  std::optional<json_allocator> stack_pool_{};
+  std::deque<json_arena_document> documents_{};
+  std::deque<std::string> buffers_{};
+  std::size_t next_document_{0U};
+  std::size_t next_buffer_{0U};
+  std::size_t retained_capacity_{0U};
+  std::size_t retained_stack_capacity_{0U};
+  std::size_t max_retained_capacity_{default_max_retained_capacity};
+  std::size_t high_water_bytes_{0U};
+  std::size_t scope_depth_{0U};
+};
+
+/// RAII scope that resets its arena when the outermost scope on it exits.
+class json_arena_scope {
+public:
+  explicit json_arena_scope(json_arena &arena = json_arena::thread_local_instance()) noexcept
+      : arena_(std::addressof(arena)) {
+    ++arena_->scope_depth_;
+  }
+
+  json_arena_scope(const json_arena_scope &) = delete;
+  auto operator=(const json_arena_scope &) -> json_arena_scope & = delete;
+
+  ~json_arena_scope() {
+    if (--arena_->scope_depth_ == 0U) {
+      arena_->reset();
+    }
+  }
+
+  [[nodiscard]] auto arena() const noexcept -> json_arena & { return *arena_; }
+
+private:
+  json_arena *arena_{nullptr};
+};
+
+/// Parses text into arena memory; strings in the result point into an arena buffer.
+[[nodiscard]] inline auto parse_json_into(json_arena &arena, const std::string_view text)
+    -> result<json_value *> {
+  auto &buffer = arena.acquire_buffer();
+  buffer.assign(text);
+  auto &document = arena.acquire_document();
+  document.ParseInsitu(buffer.data());
+  if (document.HasParseError()) {
+    return result<json_value *>::failure(errc::parse_error);
+  }
+  return static_cast<json_value *>(std::addressof(document));
+}
+
+namespace detail {
+
+/// RapidJSON output stream writing into one reusable `std::string`.
+struct json_string_output {
+  using Ch = char;
+
+  auto Put(const char value) -> void { target->push_back(value); }
+
+  auto Flush() noexcept -> void {}
+
+  std::string *target{nullptr};
+};
+
+} // namespace detail
+
+/// Serializes `value` into an arena buffer and returns a view valid for the scope.
+[[nodiscard]] inline auto json_to_string(json_arena &arena, const json_value &value)
+    -> result<std::string_view> {
+  auto &buffer = arena.acquire_buffer();
+  detail::json_string_output output{std::addressof(buffer)};
+  rapidjson::Writer<detail::json_string_output> writer(output);
+  if (!value.Accept(writer)) {
+    return result<std::string_view>::failure(errc::serialize_error);
+  }
+  return std::string_view{buffer};
+}
+
+} // namespace wh::core
@@ -0,0 +1,53 @@
+// Defines the dependency-free JSON string escaper shared by hand-written JSON
+// emitters (cached tool schemas, OTLP span encoding).
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace wh::core {
+
+/// Appends `value` as one JSON string literal, escaped exactly like the
+/// RapidJSON writer so hand-emitted bytes match `json_to_string`.
+inline auto append_json_string(std::string &output, const std::string_view value) -> void {
+  constexpr std::string_view hex_digits = "0123456789ABCDEF";
+  output.push_back('"');
+  for (const char ch : value) {
+    const auto byte = static_cast<unsigned char>(ch);
+    switch (ch) {
+    case '"':
+      output.append("\\\"");
+      break;
+    case '\\':
+      output.append("\\\\");
+      break;
+    case '\b':
+      output.append("\\b");
+      break;
+    case '\f':
+      output.append("\\f");
+      break;
+    case '\n':
+      output.append("\\n");
+      break;
+    case '\r':
+      output.append("\\r");
+      break;
+    case '\t':
+      output.append("\\t");
+      break;
+    default:
+      if (byte < 0x20U) {
+        output.append("\\u00");
+        output.push_back(hex_digits[byte >> 4U]);
+        output.push_back(hex_digits[byte & 0xFU]);
+      } else {
+        output.push_back(ch);
+      }
+      break;
+    }
+  }
+  output.push_back('"');
+}
+
+} // namespace wh::core
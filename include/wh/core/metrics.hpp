@@ -0,0 +1,7 @@
+// Defines the public runtime metrics facade.
+#pragma once
+
+#include "wh/core/metrics/hooks.hpp"
+#include "wh/core/metrics/instruments.hpp"
+#include "wh/core/metrics/prometheus.hpp"
+#include "wh/core/metrics/registry.hpp"
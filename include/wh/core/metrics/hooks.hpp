@@ -0,0 +1,181 @@
+// Defines the metric handle bundles recorded by components, graph nodes and
+// streams, and the metric names they register.
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "wh/core/component/types.hpp"
+#include "wh/core/metrics/registry.hpp"
+
+namespace wh::core {
+
+/// Metric names registered by the built-in hooks.
+struct metric_names {
+  static constexpr std::string_view component_calls = "wh_component_calls_total";
+  static constexpr std::string_view component_errors = "wh_component_errors_total";
+  static constexpr std::string_view node_queue_latency = "wh_graph_node_queue_seconds";
+  static constexpr std::string_view node_execution_latency = "wh_graph_node_execution_seconds";
+  static constexpr std::string_view stream_chunks = "wh_stream_chunks_total";
+  static constexpr std::string_view stream_stall = "wh_stream_stall_seconds";
+  static constexpr std::string_view queue_depth = "wh_queue_depth";
+};
+
+/// Call and error counters of one component descriptor. Null handles disable
+/// recording.
+struct component_call_metrics {
+  /// Calls completed, successfully or not.
+  metric_counter *calls{nullptr};
+  /// Calls that completed with an error.
+  metric_counter *errors{nullptr};
+
+  /// Records one finished call.
+  auto record(const bool failed) const noexcept -> void {
+    if (calls != nullptr) {
+      calls->add();
+    }
+    if (failed && errors != nullptr) {
+      errors->add();
+    }
+  }
+};
+
+/// Readiness-to-start and execution latency of one graph node.
+struct graph_node_metrics {
+  /// Time from the node's attempt being scheduled to its body starting.
+  metric_histogram *queue_latency{nullptr};
+  /// Time spent in the node body, recorded once per attempt.
+  metric_histogram *execution_latency{nullptr};
+
+  [[nodiscard]] auto enabled() const noexcept -> bool {
+    return queue_latency != nullptr || execution_latency != nullptr;
+  }
+};
+
+/// Chunk count, stall time and backlog depth of one stream.
+struct stream_read_metrics {
+  /// Value chunks delivered to the reader; its rate is the chunk rate.
+  metric_counter *chunks{nullptr};
+  /// Time a blocking read waited for the next chunk.
+  metric_histogram *stall{nullptr};
+  /// Buffered chunks not yet read.
+  metric_gauge *depth{nullptr};
+
+  [[nodiscard]] auto enabled() const noexcept -> bool {
+    return chunks != nullptr || stall != nullptr || depth != nullptr;
+  }
+};
+
+namespace detail {
+
+[[nodiscard]] inline auto metric_component_kind_name(const component_kind kind) noexcept
+    -> std::string_view {
+  switch (kind) {
+  case component_kind::model:
+    return "model";
+  case component_kind::prompt:
+    return "prompt";
+  case component_kind::tool:
+    return "tool";
+  case component_kind::retriever:
+    return "retriever";
+  case component_kind::embedding:
+    return "embedding";
+  case component_kind::indexer:
+    return "indexer";
+  case component_kind::document:
+    return "document";
+  case component_kind::custom:
+    return "custom";
+  }
+  return "custom";
+}
+
+/// Registers the help text of every built-in metric once per registry.
+inline auto describe_hook_metrics(metrics_registry &registry) -> void {
+  registry.describe_once([](metrics_registry &target) {
+    target.describe(metric_names::component_calls, "Component calls completed.");
+    target.describe(metric_names::component_errors, "Component calls that failed.");
+    target.describe(metric_names::node_queue_latency,
+                    "Time from a node attempt being scheduled to its body starting.");
+    target.describe(metric_names::node_execution_latency, "Time spent in one node attempt.");
+    target.describe(metric_names::stream_chunks, "Value chunks delivered to stream readers.");
+    target.describe(metric_names::stream_stall, "Time blocking stream reads waited for a chunk.");
+    target.describe(metric_names::queue_depth, "Buffered items not yet consumed.");
+  });
+}
+
+template <typename instrument_t>
+[[nodiscard]] inline auto metric_handle(result<std::reference_wrapper<instrument_t>> resolved)
+    -> instrument_t * {
+  return resolved.has_value() ? &resolved.value().get() : nullptr;
+}
+
+} // namespace detail
+
+/// Resolves the call counters of `descriptor` in `registry`.
+[[nodiscard]] inline auto make_component_call_metrics(metrics_registry &registry,
+                                                      const component_descriptor &descriptor)
+    -> component_call_metrics {
+  detail::describe_hook_metrics(registry);
+  const metric_labels labels{
+      {.name = "component", .value = descriptor.type_name},
+      {.name = "kind", .value = std::string{detail::metric_component_kind_name(descriptor.kind)}},
+  };
+  return component_call_metrics{
+      .calls = detail::metric_handle(registry.counter(metric_names::component_calls, labels)),
+      .errors = detail::metric_handle(registry.counter(metric_names::component_errors, labels)),
+  };
+}
+
+/// Returns the global-registry call counters of `descriptor`. The lookup takes
+/// the registry lock, so components resolve their counters once at
+/// construction and record through the stored handles.
+[[nodiscard]] inline auto component_call_metrics_for(const component_descriptor &descriptor)
+    -> component_call_metrics {
+  return make_component_call_metrics(metrics_registry::global(), descriptor);
+}
+
+/// Resolves the latency histograms of node `node_key` in graph `graph_name`.
+[[nodiscard]] inline auto make_graph_node_metrics(metrics_registry &registry,
+                                                  const std::string_view graph_name,
+                                                  const std::string_view node_key)
+    -> graph_node_metrics {
+  detail::describe_hook_metrics(registry);
+  const metric_labels labels{
+      {.name = "graph", .value = std::string{graph_name}},
+      {.name = "node", .value = std::string{node_key}},
+  };
+  return graph_node_metrics{
+      .queue_latency =
+          detail::metric_handle(registry.histogram(metric_names::node_queue_latency, labels)),
+      .execution_latency =
+          detail::metric_handle(registry.histogram(metric_names::node_execution_latency, labels)),
+  };
+}
+
+/// Resolves the chunk, stall and depth metrics of stream `stream_name`.
+[[nodiscard]] inline auto make_stream_read_metrics(metrics_registry &registry,
+                                                   const std::string_view stream_name)
+    -> stream_read_metrics {
+  detail::describe_hook_metrics(registry);
+  const metric_labels labels{{.name = "stream", .value = std::string{stream_name}}};
+  return stream_read_metrics{
+      .chunks = detail::metric_handle(registry.counter(metric_names::stream_chunks, labels)),
+      .stall = detail::metric_handle(registry.histogram(metric_names::stream_stall, labels)),
+      .depth = detail::metric_handle(registry.gauge(metric_names::queue_depth, labels)),
+  };
+}
+
+/// Records the time since `started` into `histogram` when it is set.
+inline auto record_elapsed(metric_histogram *histogram,
+                           const std::chrono::steady_clock::time_point started) noexcept -> void {
+  if (histogram != nullptr) {
+    histogram->record(std::chrono::steady_clock::now() - started);
+  }
+}
+
+} // namespace wh::core
@@ -0,0 +1,195 @@
+// Defines lock-free runtime metric instruments: sharded counters, gauges and
+// log-linear latency histograms.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "wh/core/compiler.hpp"
+
+namespace wh::core {
+
+/// Number of independently updated shards per counter and histogram.
+inline constexpr std::size_t metric_shard_count = 16U;
+
+namespace detail {
+
+/// Returns the calling thread's metric shard. Threads are assigned
+/// round-robin on first use, so concurrent recorders rarely share a line.
+[[nodiscard]] inline auto metric_shard_index() noexcept -> std::size_t {
+  static std::atomic<std::size_t> next_shard{0U};
+  thread_local const std::size_t index =
+      next_shard.fetch_add(1U, std::memory_order_relaxed) % metric_shard_count;
+  return index;
+}
+
+struct wh_cacheline_align metric_counter_cell {
+  std::atomic<std::uint64_t> value{0U};
+};
+
+} // namespace detail
+
+/// Monotonic counter whose increments land on a per-thread shard.
+class metric_counter {
+public:
+  /// Adds `delta` to the counter.
+  auto add(const std::uint64_t delta = 1U) noexcept -> void {
+    cells_[detail::metric_shard_index()].value.fetch_add(delta, std::memory_order_relaxed);
+  }
+
+  /// Returns the sum over all shards.
+  [[nodiscard]] auto value() const noexcept -> std::uint64_t {
+    std::uint64_t total = 0U;
+    for (const auto &cell : cells_) {
+      total += cell.value.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+private:
+  std::array<detail::metric_counter_cell, metric_shard_count> cells_{};
+};
+
+/// Point-in-time value. Gauges are set as often as they are read, so one
+/// atomic keeps `set` exact instead of sharding it.
+class metric_gauge {
+public:
+  /// Replaces the current value.
+  auto set(const std::int64_t value) noexcept -> void {
+    value_.store(value, std::memory_order_relaxed);
+  }
+
+  /// Adds `delta`, which may be negative.
+  auto add(const std::int64_t delta) noexcept -> void {
+    value_.fetch_add(delta, std::memory_order_relaxed);
+  }
+
+  /// Returns the current value.
+  [[nodiscard]] auto value() const noexcept -> std::int64_t {
+    return value_.load(std::memory_order_relaxed);
+  }
+
+private:
+  wh_cacheline_align std::atomic<std::int64_t> value_{0};
+};
+
+/// Merged bucket counts of one histogram.
+struct metric_histogram_snapshot {
+  /// Number of log-linear buckets.
+  static constexpr std::size_t bucket_count = 188U;
+
+  /// Per-bucket sample counts; see `metric_histogram::bucket_index`.
+  std::array<std::uint64_t, bucket_count> buckets{};
+  /// Total number of samples.
+  std::uint64_t count{0U};
+  /// Sum of all samples in nanoseconds.
+  std::uint64_t sum_nanos{0U};
+
+  /// Returns the upper bound of the bucket holding quantile `q` in `[0, 1]`;
+  /// `nanoseconds::max()` when it falls in the unbounded overflow bucket.
+  [[nodiscard]] auto quantile(double q) const noexcept -> std::chrono::nanoseconds;
+};
+
+/// Latency histogram with four linear sub-buckets per power of two, giving a
+/// relative error under 25% from 1 ns up to about 39 hours. The last bucket
+/// also takes every larger sample, so it has no finite upper bound. Recording
+/// is one relaxed increment on the caller's shard.
+class metric_histogram {
+public:
+  static constexpr std::size_t bucket_count = metric_histogram_snapshot::bucket_count;
+
+  /// Records one duration; negative durations count as zero.
+  auto record(const std::chrono::nanoseconds duration) noexcept -> void {
+    record_nanos(duration.count() <= 0 ? 0U : static_cast<std::uint64_t>(duration.count()));
+  }
+
+  /// Records one sample expressed in nanoseconds.
+  auto record_nanos(const std::uint64_t nanos) noexcept -> void {
+    auto &slot = shards_[detail::metric_shard_index() % histogram_shard_count];
+    slot.buckets[bucket_index(nanos)].fetch_add(1U, std::memory_order_relaxed);
+    slot.sum.fetch_add(nanos, std::memory_order_relaxed);
+  }
+
+  /// Merges every shard into one snapshot.
+  [[nodiscard]] auto snapshot() const noexcept -> metric_histogram_snapshot {
+    metric_histogram_snapshot merged{};
+    for (const auto &slot : shards_) {
+      for (std::size_t index = 0U; index < bucket_count; ++index) {
+        const auto count = slot.buckets[index].load(std::memory_order_relaxed);
+        merged.buckets[index] += count;
+        merged.count += count;
+      }
+      merged.sum_nanos += slot.sum.load(std::memory_order_relaxed);
+    }
+    return merged;
+  }
+
+  /// Maps a sample to its bucket: values below 4 get their own bucket, larger
+  /// values use the exponent plus the two bits after the leading one.
+  [[nodiscard]] static constexpr auto bucket_index(const std::uint64_t nanos) noexcept
+      -> std::size_t {
+    if (nanos < 4U) {
+      return static_cast<std::size_t>(nanos);
+    }
+    const auto exponent = static_cast<std::size_t>(std::bit_width(nanos) - 1);
+    if (exponent > max_exponent) {
+      return bucket_count - 1U;
+    }
+    const auto sub = static_cast<std::size_t>((nanos >> (exponent - 2U)) & 3U);
+    return 4U + (exponent - 2U) * 4U + sub;
+  }
+
+  /// Returns the exclusive upper bound of `index` in nanoseconds, or the
+  /// largest value for the overflow bucket, which exposition reports as +Inf.
+  [[nodiscard]] static constexpr auto bucket_upper_bound(const std::size_t index) noexcept
+      -> std::uint64_t {
+    if (index >= bucket_count - 1U) {
+      return std::numeric_limits<std::uint64_t>::max();
+    }
+    if (index < 4U) {
+      return static_cast<std::uint64_t>(index) + 1U;
+    }
+    const auto exponent = (index - 4U) / 4U + 2U;
+    const auto sub = (index - 4U) % 4U;
+    return (std::uint64_t{5U} + sub) << (exponent - 2U);
+  }
+
+private:
+  static constexpr std::size_t max_exponent = 47U;
+  static constexpr std::size_t histogram_shard_count = 8U;
+  static_assert(4U + (max_exponent - 2U) * 4U + 3U == bucket_count - 1U);
+
+  struct wh_cacheline_align shard {
+    std::array<std::atomic<std::uint64_t>, bucket_count> buckets{};
+    std::atomic<std::uint64_t> sum{0U};
+  };
+
+  std::array<shard, histogram_shard_count> shards_{};
+};
+
+inline auto metric_histogram_snapshot::quantile(const double q) const noexcept
+    -> std::chrono::nanoseconds {
+  if (count == 0U) {
+    return std::chrono::nanoseconds{0};
+  }
+  const auto clamped = std::clamp(q, 0.0, 1.0);
+  const auto rank = std::max<std::uint64_t>(
+      1U, static_cast<std::uint64_t>(clamped * static_cast<double>(count) + 0.5));
+  std::uint64_t seen = 0U;
+  for (std::size_t index = 0U; index + 1U < bucket_count; ++index) {
+    seen += buckets[index];
+    if (seen >= rank) {
+      return std::chrono::nanoseconds{
+          static_cast<std::int64_t>(metric_histogram::bucket_upper_bound(index))};
+    }
+  }
+  return std::chrono::nanoseconds::max();
+}
+
+} // namespace wh::core
@@ -0,0 +1,189 @@
+// Defines the Prometheus text exposition writer for `metrics_registry`.
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <variant>
+
+#include "wh/core/error.hpp"
+#include "wh/core/metrics/registry.hpp"
+#include "wh/core/result.hpp"
+
+namespace wh::core {
+
+/// Histogram `le` boundaries are powers of two in nanoseconds from 2^10
+/// (about 1 us) to 2^40 (about 18 minutes); each one is also a bucket edge of
+/// `metric_histogram`, so the cumulative counts are exact.
+inline constexpr std::size_t prometheus_first_bucket_exponent = 10U;
+inline constexpr std::size_t prometheus_last_bucket_exponent = 40U;
+
+namespace detail {
+
+inline auto append_prometheus_double(std::string &out, const double value) -> void {
+  char buffer[32];
+  const auto [end, code] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  if (code == std::errc{}) {
+    out.append(buffer, end);
+  }
+}
+
+inline auto append_prometheus_escaped(std::string &out, const std::string_view text,
+                                      const bool quote) -> void {
+  for (const auto ch : text) {
+    if (ch == '\\') {
+      out.append("\\\\");
+    } else if (ch == '\n') {
+      out.append("\\n");
+    } else if (quote && ch == '"') {
+      out.append("\\\"");
+    } else {
+      out.push_back(ch);
+    }
+  }
+}
+
+/// Appends `{a="x",b="y"}`, plus an optional trailing `le` label.
+inline auto append_prometheus_labels(std::string &out, const metric_labels &labels,
+                                     const std::string_view le = {}) -> void {
+  if (labels.empty() && le.empty()) {
+    return;
+  }
+  out.push_back('{');
+  bool first = true;
+  for (const auto &label : labels) {
+    if (!first) {
+      out.push_back(',');
+    }
+    first = false;
+    out.append(label.name).append("=\"");
+    append_prometheus_escaped(out, label.value, true);
+    out.push_back('"');
+  }
+  if (!le.empty()) {
+    if (!first) {
+      out.push_back(',');
+    }
+    out.append("le=\"").append(le).push_back('"');
+  }
+  out.push_back('}');
+}
+
+[[nodiscard]] inline auto prometheus_type_name(const metric_kind kind) noexcept
+    -> std::string_view {
+  switch (kind) {
+  case metric_kind::counter:
+    return "counter";
+  case metric_kind::gauge:
+    return "gauge";
+  case metric_kind::histogram:
+    return "histogram";
+  }
+  return "untyped";
+}
+
+inline auto append_prometheus_histogram(std::string &out, const std::string_view name,
+                                        const metric_labels &labels,
+                                        const metric_histogram_snapshot &histogram) -> void {
+  std::string le{};
+  std::size_t bucket = 0U;
+  std::uint64_t cumulative = 0U;
+  for (auto exponent = prometheus_first_bucket_exponent;
+       exponent <= prometheus_last_bucket_exponent; ++exponent) {
+    const auto bound = std::uint64_t{1U} << exponent;
+    while (bucket < metric_histogram::bucket_count &&
+           metric_histogram::bucket_upper_bound(bucket) <= bound) {
+      cumulative += histogram.buckets[bucket];
+      ++bucket;
+    }
+    le.clear();
+    append_prometheus_double(le, static_cast<double>(bound) * 1e-9);
+    out.append(name).append("_bucket");
+    append_prometheus_labels(out, labels, le);
+    out.push_back(' ');
+    out.append(std::to_string(cumulative)).push_back('\n');
+  }
+  out.append(name).append("_bucket");
+  append_prometheus_labels(out, labels, "+Inf");
+  out.push_back(' ');
+  out.append(std::to_string(histogram.count)).push_back('\n');
+  out.append(name).append("_sum");
+  append_prometheus_labels(out, labels);
+  out.push_back(' ');
+  append_prometheus_double(out, static_cast<double>(histogram.sum_nanos) * 1e-9);
+  out.push_back('\n');
+  out.append(name).append("_count");
+  append_prometheus_labels(out, labels);
+  out.push_back(' ');
+  out.append(std::to_string(histogram.count)).push_back('\n');
+}
+
+} // namespace detail
+
+/// Appends every family of `registry` in Prometheus text format 0.0.4.
+/// Histograms record nanoseconds and are exposed in seconds.
+inline auto write_prometheus_text(const metrics_registry &registry, std::string &out) -> void {
+  for (const auto &family : registry.collect()) {
+    if (!family.help.empty()) {
+      out.append("# HELP ").append(family.name).push_back(' ');
+      detail::append_prometheus_escaped(out, family.help, false);
+      out.push_back('\n');
+    }
+    out.append("# TYPE ").append(family.name).push_back(' ');
+    out.append(detail::prometheus_type_name(family.kind)).push_back('\n');
+    for (const auto &series : family.series) {
+      if (const auto *histogram = std::get_if<metric_histogram_snapshot>(&series.value)) {
+        detail::append_prometheus_histogram(out, family.name, series.labels, *histogram);
+        continue;
+      }
+      out.append(family.name);
+      detail::append_prometheus_labels(out, series.labels);
+      out.push_back(' ');
+      if (const auto *counter = std::get_if<std::uint64_t>(&series.value)) {
+        out.append(std::to_string(*counter));
+      } else {
+        out.append(std::to_string(std::get<std::int64_t>(series.value)));
+      }
+      out.push_back('\n');
+    }
+  }
+}
+
+/// Returns the Prometheus text exposition of `registry`, ready to serve from
+/// a scrape endpoint.
+[[nodiscard]] inline auto encode_prometheus_text(const metrics_registry &registry)
+    -> std::string {
+  std::string out{};
+  write_prometheus_text(registry, out);
+  return out;
+}
+
+/// Writes the exposition to `path` through a temporary file and a rename, so
+/// a textfile collector never reads a partial dump.
+[[nodiscard]] inline auto dump_prometheus_text(const metrics_registry &registry,
+                                               const std::string &path) -> result<void> {
+  const auto text = encode_prometheus_text(registry);
+  const auto staging = path + ".tmp";
+  {
+    std::ofstream stream{staging, std::ios::out | std::ios::trunc | std::ios::binary};
+    if (!stream.is_open()) {
+      return result<void>::failure(errc::unavailable);
+    }
+    stream.write(text.data(), static_cast<std::streamsize>(text.size()));
+    if (!stream.good()) {
+      return result<void>::failure(errc::unavailable);
+    }
+  }
+  if (std::rename(staging.c_str(), path.c_str()) != 0) {
+    std::remove(staging.c_str());
+    return result<void>::failure(errc::unavailable);
+  }
+  return {};
+}
+
+} // namespace wh::core
@@ -0,0 +1,242 @@
+// Defines the metrics registry that owns named, labeled instruments and
+// snapshots them for exposition.
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "wh/core/error.hpp"
+#include "wh/core/metrics/instruments.hpp"
+#include "wh/core/result.hpp"
+
+namespace wh::core {
+
+/// Instrument type shared by every series of one metric name.
+enum class metric_kind : std::uint8_t {
+  /// Monotonic `metric_counter`.
+  counter = 0U,
+  /// Point-in-time `metric_gauge`.
+  gauge,
+  /// Latency `metric_histogram`.
+  histogram,
+};
+
+/// One `name="value"` label pair.
+struct metric_label {
+  /// Label name matching `[a-zA-Z_][a-zA-Z0-9_]*`.
+  std::string name{};
+  /// Arbitrary label value.
+  std::string value{};
+};
+
+/// Label set identifying one series; order does not matter.
+using metric_labels = std::vector<metric_label>;
+
+/// Values of one series at snapshot time.
+struct metric_series_snapshot {
+  /// Labels sorted by name.
+  metric_labels labels{};
+  /// Counter total, gauge value or merged histogram, matching the family kind.
+  std::variant<std::uint64_t, std::int64_t, metric_histogram_snapshot> value{};
+};
+
+/// Every series sharing one metric name.
+struct metric_family_snapshot {
+  /// Metric name.
+  std::string name{};
+  /// Help text from `describe`, possibly empty.
+  std::string help{};
+  /// Instrument type.
+  metric_kind kind{metric_kind::counter};
+  /// Series in registration order.
+  std::vector<metric_series_snapshot> series{};
+};
+
+namespace detail {
+
+[[nodiscard]] inline auto is_metric_name(const std::string_view name,
+                                         const bool allow_colon) noexcept -> bool {
+  if (name.empty()) {
+    return false;
+  }
+  for (std::size_t index = 0U; index < name.size(); ++index) {
+    const auto ch = name[index];
+    const bool alpha = (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '_' ||
+                       (allow_colon && ch == ':');
+    if (!alpha && !(index != 0U && ch >= '0' && ch <= '9')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace detail
+
+/// Owns instruments keyed by name and label set.
+///
+/// Lookups take a mutex and are meant to run once per call site; the returned
+/// references stay valid for the registry's lifetime, so recording never
+/// touches the registry again.
+class metrics_registry {
+public:
+  metrics_registry() = default;
+  metrics_registry(const metrics_registry &) = delete;
+  auto operator=(const metrics_registry &) -> metrics_registry & = delete;
+
+  /// Returns the counter `name{labels}`, creating it on first use. Fails with
+  /// `invalid_argument` for malformed names and `type_mismatch` when `name`
+  /// is registered as another kind.
+  [[nodiscard]] auto counter(const std::string_view name, metric_labels labels = {})
+      -> result<std::reference_wrapper<metric_counter>> {
+    return find_or_create<metric_counter>(name, std::move(labels), metric_kind::counter);
+  }
+
+  /// Returns the gauge `name{labels}`, creating it on first use.
+  [[nodiscard]] auto gauge(const std::string_view name, metric_labels labels = {})
+      -> result<std::reference_wrapper<metric_gauge>> {
+    return find_or_create<metric_gauge>(name, std::move(labels), metric_kind::gauge);
+  }
+
+  /// Returns the histogram `name{labels}`, creating it on first use.
+  [[nodiscard]] auto histogram(const std::string_view name, metric_labels labels = {})
+      -> result<std::reference_wrapper<metric_histogram>> {
+    return find_or_create<metric_histogram>(name, std::move(labels), metric_kind::histogram);
+  }
+
+  /// Sets the help text reported for `name`.
+  auto describe(const std::string_view name, std::string help) -> void {
+    std::lock_guard lock{mutex_};
+    help_.insert_or_assign(std::string{name}, std::move(help));
+  }
+
+  /// Runs `describe_all(*this)` the first time any caller reaches it on this
+  /// registry; later calls cost one atomic load instead of the registry lock.
+  /// Built-in hooks register their help text through it.
+  template <typename describe_fn_t> auto describe_once(describe_fn_t &&describe_all) -> void {
+    std::call_once(described_, std::forward<describe_fn_t>(describe_all), *this);
+  }
+
+  /// Returns the number of registered series over all names.
+  [[nodiscard]] auto series_count() const -> std::size_t {
+    std::lock_guard lock{mutex_};
+    std::size_t total = 0U;
+    for (const auto &[name, family] : families_) {
+      total += family.entries.size();
+    }
+    return total;
+  }
+
+  /// Snapshots every family, sorted by name.
+  [[nodiscard]] auto collect() const -> std::vector<metric_family_snapshot> {
+    std::lock_guard lock{mutex_};
+    std::vector<metric_family_snapshot> families{};
+    families.reserve(families_.size());
+    for (const auto &[name, family] : families_) {
+      auto &snapshot = families.emplace_back();
+      snapshot.name = name;
+      snapshot.kind = family.kind;
+      if (const auto help = help_.find(name); help != help_.end()) {
+        snapshot.help = help->second;
+      }
+      snapshot.series.reserve(family.entries.size());
+      for (const auto &entry : family.entries) {
+        auto &series = snapshot.series.emplace_back();
+        series.labels = entry.labels;
+        std::visit(
+            [&series](const auto &instrument) {
+              using instrument_t = typename std::decay_t<decltype(instrument)>::element_type;
+              if constexpr (std::same_as<instrument_t, metric_histogram>) {
+                series.value = instrument->snapshot();
+              } else {
+                series.value = instrument->value();
+              }
+            },
+            entry.instrument);
+      }
+    }
+    return families;
+  }
+
+  /// Returns the process-wide registry used by built-in runtime hooks.
+  [[nodiscard]] static auto global() -> metrics_registry & {
+    static metrics_registry registry{};
+    return registry;
+  }
+
+private:
+  struct series_entry {
+    metric_labels labels{};
+    std::variant<std::unique_ptr<metric_counter>, std::unique_ptr<metric_gauge>,
+                 std::unique_ptr<metric_histogram>>
+        instrument{};
+  };
+
+  struct family_entry {
+    metric_kind kind{metric_kind::counter};
+    std::vector<series_entry> entries{};
+  };
+
+  [[nodiscard]] static auto normalize_labels(metric_labels &labels) -> bool {
+    std::ranges::sort(labels, {}, &metric_label::name);
+    for (std::size_t index = 0U; index < labels.size(); ++index) {
+      if (!detail::is_metric_name(labels[index].name, false) ||
+          (index != 0U && labels[index].name == labels[index - 1U].name)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  [[nodiscard]] static auto same_labels(const metric_labels &left, const metric_labels &right)
+      -> bool {
+    return std::ranges::equal(left, right, [](const metric_label &lhs, const metric_label &rhs) {
+      return lhs.name == rhs.name && lhs.value == rhs.value;
+    });
+  }
+
+  template <typename instrument_t>
+  [[nodiscard]] auto find_or_create(const std::string_view name, metric_labels labels,
+                                    const metric_kind kind)
+      -> result<std::reference_wrapper<instrument_t>> {
+    using result_t = result<std::reference_wrapper<instrument_t>>;
+    if (!detail::is_metric_name(name, true) || !normalize_labels(labels)) {
+      return result_t::failure(errc::invalid_argument);
+    }
+    std::lock_guard lock{mutex_};
+    auto iter = families_.find(name);
+    if (iter == families_.end()) {
+      iter = families_.emplace(std::string{name}, family_entry{.kind = kind}).first;
+    } else if (iter->second.kind != kind) {
+      return result_t::failure(errc::type_mismatch);
+    }
+    auto &entries = iter->second.entries;
+    for (auto &entry : entries) {
+      if (same_labels(entry.labels, labels)) {
+        return std::ref(*std::get<std::unique_ptr<instrument_t>>(entry.instrument));
+      }
+    }
+    auto instrument = std::make_unique<instrument_t>();
+    auto &stored = *instrument;
+    entries.push_back(
+        series_entry{.labels = std::move(labels), .instrument = std::move(instrument)});
+    return std::ref(stored);
+  }
+
+  mutable std::mutex mutex_{};
+  std::map<std::string, family_entry, std::less<>> families_{};
+  std::map<std::string, std::string, std::less<>> help_{};
+  std::once_flag described_{};
+};
+
+} // namespace wh::core
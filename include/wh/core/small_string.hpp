@@ -0,0 +1,5 @@
+// Defines the public small-string facade.
+#pragma once
+
+#include "wh/core/small_string/intern.hpp"
+#include "wh/core/small_string/string.hpp"
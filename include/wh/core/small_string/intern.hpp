@@ -0,0 +1,134 @@
+// Defines a process-wide string intern pool and a pointer-sized handle for
+// identifiers that repeat across many objects (tool names, source labels).
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+#include "wh/core/type_traits.hpp"
+
+namespace wh::core {
+
+class string_intern_pool;
+
+/// Immutable handle to one interned string; copies are pointer copies.
+class interned_string {
+public:
+  interned_string() noexcept = default;
+
+  [[nodiscard]] auto view() const noexcept -> std::string_view {
+    return entry_ == nullptr ? std::string_view{} : std::string_view{*entry_};
+  }
+
+  /// Returns the pooled `std::string`; empty handles return a shared empty string.
+  [[nodiscard]] auto str() const noexcept -> const std::string & {
+    static const std::string empty{};
+    return entry_ == nullptr ? empty : *entry_;
+  }
+
+  [[nodiscard]] auto empty() const noexcept -> bool { return entry_ == nullptr || entry_->empty(); }
+
+  [[nodiscard]] auto size() const noexcept -> std::size_t {
+    return entry_ == nullptr ? 0U : entry_->size();
+  }
+
+  [[nodiscard]] auto data() const noexcept -> const char * { return view().data(); }
+
+  operator std::string_view() const noexcept { return view(); } // NOLINT
+
+  /// Equal handles from one pool share an entry, so that pointer check is the
+  /// fast path; handles from separate pools fall back to comparing text, which
+  /// keeps equality consistent with the text-based hash and ordering.
+  [[nodiscard]] friend auto operator==(const interned_string &left,
+                                       const interned_string &right) noexcept -> bool {
+    return left.entry_ == right.entry_ || left.view() == right.view();
+  }
+
+  [[nodiscard]] friend auto operator==(const interned_string &left,
+                                       const std::string_view right) noexcept -> bool {
+    return left.view() == right;
+  }
+
+  [[nodiscard]] friend auto operator<=>(const interned_string &left,
+                                        const interned_string &right) noexcept
+      -> std::strong_ordering {
+    return left.view() <=> right.view();
+  }
+
+private:
+  friend class string_intern_pool;
+
+  explicit interned_string(const std::string *entry) noexcept : entry_(entry) {}
+
+  const std::string *entry_{nullptr};
+};
+
+/// Thread-safe pool that keeps one stable copy of every interned string.
+class string_intern_pool {
+public:
+  string_intern_pool() = default;
+  string_intern_pool(const string_intern_pool &) = delete;
+  auto operator=(const string_intern_pool &) -> string_intern_pool & = delete;
+
+  /// Returns the process-wide pool used by `intern`.
+  [[nodiscard]] static auto global() -> string_intern_pool & {
+    static string_intern_pool pool{};
+    return pool;
+  }
+
+  /// Returns the pooled handle for `text`, inserting it on first use.
+  [[nodiscard]] auto intern(const std::string_view text) -> interned_string {
+    if (text.empty()) {
+      return interned_string{};
+    }
+    {
+      std::shared_lock lock{mutex_};
+      if (const auto iter = entries_.find(text); iter != entries_.end()) {
+        return interned_string{std::addressof(*iter)};
+      }
+    }
+    std::unique_lock lock{mutex_};
+    const auto [iter, inserted] = entries_.emplace(text);
+    static_cast<void>(inserted);
+    return interned_string{std::addressof(*iter)};
+  }
+
+  /// Returns the pooled handle for `text` without inserting.
+  [[nodiscard]] auto find(const std::string_view text) const -> interned_string {
+    std::shared_lock lock{mutex_};
+    if (const auto iter = entries_.find(text); iter != entries_.end()) {
+      return interned_string{std::addressof(*iter)};
+    }
+    return interned_string{};
+  }
+
+  /// Returns the number of distinct pooled strings.
+  [[nodiscard]] auto size() const -> std::size_t {
+    std::shared_lock lock{mutex_};
+    return entries_.size();
+  }
+
+private:
+  mutable std::shared_mutex mutex_{};
+  std::unordered_set<std::string, transparent_string_hash, transparent_string_equal> entries_{};
+};
+
+/// Interns `text` into the process-wide pool.
+[[nodiscard]] inline auto intern(const std::string_view text) -> interned_string {
+  return string_intern_pool::global().intern(text);
+}
+
+} // namespace wh::core
+
+template <> struct std::hash<wh::core::interned_string> {
+  [[nodiscard]] auto operator()(const wh::core::interned_string &value) const noexcept
+      -> std::size_t {
+    return std::hash<std::string_view>{}(value.view());
+  }
+};
@@ -0,0 +1,419 @@
+// Defines a small-buffer-optimized string with a configurable inline capacity
+// large enough for provider call ids, tool names, and stream source labels.
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace wh::core {
+
+/// Default inline capacity used by framework identifier fields.
+inline constexpr std::size_t small_string_default_inline_capacity = 48U;
+
+/// Text sources accepted by `small_string` converting constructors and assignment.
+template <typename value_t, typename string_t>
+concept small_string_source = std::convertible_to<const value_t &, std::string_view> &&
+                              !std::same_as<std::remove_cvref_t<value_t>, string_t>;
+
+template <std::size_t inline_capacity = small_string_default_inline_capacity>
+/// Inline-first string storing up to `inline_capacity` bytes without heap allocation.
+class small_string {
+  static_assert(inline_capacity > 0U, "small_string inline_capacity must be greater than zero");
+
+public:
+  using value_type = char;
+  using traits_type = std::char_traits<char>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = char *;
+  using const_pointer = const char *;
+  using reference = char &;
+  using const_reference = const char &;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+
+  static constexpr size_type npos = std::string_view::npos;
+
+  small_string() noexcept : data_(inline_data()) { inline_buffer_[0] = '\0'; }
+
+  template <small_string_source<small_string> source_t>
+  small_string(const source_t &source) : small_string() { // NOLINT(google-explicit-constructor)
+    assign(std::string_view{source});
+  }
+
+  small_string(const char *text, const size_type count) : small_string() {
+    assign(std::string_view{text, count});
+  }
+
+  small_string(const size_type count, const char value) : small_string() {
+    reserve(count);
+    std::memset(data_, value, count);
+    set_size(count);
+  }
+
+  template <std::input_iterator input_it>
+  small_string(input_it first, input_it last) : small_string() {
+    for (; first != last; ++first) {
+      push_back(static_cast<char>(*first));
+    }
+  }
+
+  small_string(const small_string &other) : small_string() { assign(other.view()); }
+
+  small_string(small_string &&other) noexcept : small_string() { steal_from(other); }
+
+  auto operator=(const small_string &other) -> small_string & {
+    if (this != &other) {
+      assign(other.view());
+    }
+    return *this;
+  }
+
+  auto operator=(small_string &&other) noexcept -> small_string & {
+    if (this != &other) {
+      release_heap();
+      reset_to_inline();
+      steal_from(other);
+    }
+    return *this;
+  }
+
+  template <small_string_source<small_string> source_t>
+  auto operator=(const source_t &source) -> small_string & {
+    return assign(std::string_view{source});
+  }
+
+  auto operator=(const char value) -> small_string & {
+    clear();
+    push_back(value);
+    return *this;
+  }
+
+  ~small_string() { release_heap(); }
+
+  /// Replaces current content with `text`; `text` may alias this string.
+  auto assign(const std::string_view text) -> small_string & {
+    if (text.size() <= capacity_) {
+      std::memmove(data_, text.data(), text.size());
+      set_size(text.size());
+      return *this;
+    }
+
+    auto *next = allocate(text.size());
+    std::memcpy(next, text.data(), text.size());
+    release_heap();
+    data_ = next;
+    capacity_ = text.size();
+    set_size(text.size());
+    return *this;
+  }
+
+  [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0U; }
+
+  [[nodiscard]] auto size() const noexcept -> size_type { return size_; }
+
+  [[nodiscard]] auto length() const noexcept -> size_type { return size_; }
+
+  [[nodiscard]] auto capacity() const noexcept -> size_type { return capacity_; }
+
+  [[nodiscard]] static constexpr auto max_size() noexcept -> size_type {
+    return std::string_view{}.max_size();
+  }
+
+  [[nodiscard]] static constexpr auto inline_size() noexcept -> size_type {
+    return inline_capacity;
+  }
+
+  /// Returns true when content currently lives in the inline buffer.
+  [[nodiscard]] auto is_small() const noexcept -> bool { return data_ == inline_data(); }
+
+  [[nodiscard]] auto data() noexcept -> pointer { return data_; }
+
+  [[nodiscard]] auto data() const noexcept -> const_pointer { return data_; }
+
+  [[nodiscard]] auto c_str() const noexcept -> const_pointer { return data_; }
+
+  [[nodiscard]] auto view() const noexcept -> std::string_view { return {data_, size_}; }
+
+  /// Materializes an owning `std::string` copy.
+  [[nodiscard]] auto str() const -> std::string { return std::string{data_, size_}; }
+
+  operator std::string_view() const noexcept { // NOLINT(google-explicit-constructor)
+    return view();
+  }
+
+  operator std::string() const { return str(); } // NOLINT(google-explicit-constructor)
+
+  [[nodiscard]] auto operator[](const size_type index) noexcept -> reference {
+    return data_[index];
+  }
+
+  [[nodiscard]] auto operator[](const size_type index) const noexcept -> const_reference {
+    return data_[index];
+  }
+
+  [[nodiscard]] auto at(const size_type index) const -> const_reference {
+    if (index >= size_) {
+      throw std::out_of_range("small_string::at");
+    }
+    return data_[index];
+  }
+
+  [[nodiscard]] auto front() const noexcept -> const_reference { return data_[0]; }
+
+  [[nodiscard]] auto back() const noexcept -> const_reference { return data_[size_ - 1U]; }
+
+  [[nodiscard]] auto begin() noexcept -> iterator { return data_; }
+
+  [[nodiscard]] auto begin() const noexcept -> const_iterator { return data_; }
+
+  [[nodiscard]] auto cbegin() const noexcept -> const_iterator { return data_; }
+
+  [[nodiscard]] auto end() noexcept -> iterator { return data_ + size_; }
+
+  [[nodiscard]] auto end() const noexcept -> const_iterator { return data_ + size_; }
+
+  [[nodiscard]] auto cend() const noexcept -> const_iterator { return data_ + size_; }
+
+  auto clear() noexcept -> void { set_size(0U); }
+
+  auto reserve(const size_type requested) -> void {
+    if (requested <= capacity_) {
+      return;
+    }
+    auto *next = allocate(requested);
+    std::memcpy(next, data_, size_ + 1U);
+    release_heap();
+    data_ = next;
+    capacity_ = requested;
+  }
+
+  /// Moves heap content back into the inline buffer when it fits.
+  auto shrink_to_fit() noexcept -> void {
+    if (is_small() || size_ > inline_capacity) {
+      return;
+    }
+    auto *heap = data_;
+    std::memcpy(inline_buffer_, heap, size_ + 1U);
+    deallocate(heap, capacity_);
+    reset_to_inline();
+  }
+
+  auto resize(const size_type count, const char value = '\0') -> void {
+    if (count > size_) {
+      reserve(count);
+      std::memset(data_ + size_, value, count - size_);
+    }
+    set_size(count);
+  }
+
+  auto push_back(const char value) -> void {
+    if (size_ == capacity_) {
+      reserve(next_capacity(size_ + 1U));
+    }
+    data_[size_] = value;
+    set_size(size_ + 1U);
+  }
+
+  auto pop_back() noexcept -> void { set_size(size_ - 1U); }
+
+  /// Appends `text`; `text` may alias this string.
+  auto append(const std::string_view text) -> small_string & {
+    if (text.empty()) {
+      return *this;
+    }
+    const auto next_size = size_ + text.size();
+    if (next_size <= capacity_) {
+      std::memmove(data_ + size_, text.data(), text.size());
+      set_size(next_size);
+      return *this;
+    }
+
+    const auto next_cap = next_capacity(next_size);
+    auto *next = allocate(next_cap);
+    std::memcpy(next, data_, size_);
+    std::memcpy(next + size_, text.data(), text.size());
+    release_heap();
+    data_ = next;
+    capacity_ = next_cap;
+    set_size(next_size);
+    return *this;
+  }
+
+  auto append(const char *text, const size_type count) -> small_string & {
+    return append(std::string_view{text, count});
+  }
+
+  auto append(const size_type count, const char value) -> small_string & {
+    const auto old_size = size_;
+    resize(old_size + count, value);
+    return *this;
+  }
+
+  auto operator+=(const std::string_view text) -> small_string & { return append(text); }
+
+  auto operator+=(const char value) -> small_string & {
+    push_back(value);
+    return *this;
+  }
+
+  [[nodiscard]] auto compare(const std::string_view other) const noexcept -> int {
+    return view().compare(other);
+  }
+
+  [[nodiscard]] auto starts_with(const std::string_view prefix) const noexcept -> bool {
+    return view().starts_with(prefix);
+  }
+
+  [[nodiscard]] auto ends_with(const std::string_view suffix) const noexcept -> bool {
+    return view().ends_with(suffix);
+  }
+
+  [[nodiscard]] auto find(const std::string_view needle, const size_type position = 0U) const
+      noexcept -> size_type {
+    return view().find(needle, position);
+  }
+
+  [[nodiscard]] auto substr(const size_type position = 0U, const size_type count = npos) const
+      -> std::string {
+    return std::string{view().substr(position, count)};
+  }
+
+  auto swap(small_string &other) noexcept -> void {
+    small_string temp{std::move(other)};
+    other = std::move(*this);
+    *this = std::move(temp);
+  }
+
+  [[nodiscard]] friend auto operator==(const small_string &left, const small_string &right) noexcept
+      -> bool {
+    return left.view() == right.view();
+  }
+
+  template <small_string_source<small_string> source_t>
+  [[nodiscard]] friend auto operator==(const small_string &left, const source_t &right) noexcept
+      -> bool {
+    return left.view() == std::string_view{right};
+  }
+
+  [[nodiscard]] friend auto operator<=>(const small_string &left,
+                                        const small_string &right) noexcept
+      -> std::strong_ordering {
+    return left.view() <=> right.view();
+  }
+
+  template <small_string_source<small_string> source_t>
+  [[nodiscard]] friend auto operator<=>(const small_string &left, const source_t &right) noexcept
+      -> std::strong_ordering {
+    return left.view() <=> std::string_view{right};
+  }
+
+  [[nodiscard]] friend auto operator+(const small_string &left, const small_string &right)
+      -> std::string {
+    return concat(left.view(), right.view());
+  }
+
+  template <small_string_source<small_string> source_t>
+  [[nodiscard]] friend auto operator+(const small_string &left, const source_t &right)
+      -> std::string {
+    return concat(left.view(), std::string_view{right});
+  }
+
+  template <small_string_source<small_string> source_t>
+  [[nodiscard]] friend auto operator+(const source_t &left, const small_string &right)
+      -> std::string {
+    return concat(std::string_view{left}, right.view());
+  }
+
+  friend auto operator<<(std::ostream &stream, const small_string &value) -> std::ostream & {
+    return stream << value.view();
+  }
+
+private:
+  [[nodiscard]] static auto concat(const std::string_view left, const std::string_view right)
+      -> std::string {
+    std::string joined{};
+    joined.reserve(left.size() + right.size());
+    joined.append(left);
+    joined.append(right);
+    return joined;
+  }
+
+  [[nodiscard]] auto inline_data() noexcept -> pointer { return inline_buffer_; }
+
+  [[nodiscard]] auto inline_data() const noexcept -> const_pointer { return inline_buffer_; }
+
+  [[nodiscard]] auto next_capacity(const size_type required) const noexcept -> size_type {
+    return std::max(required, capacity_ + capacity_ / 2U);
+  }
+
+  [[nodiscard]] static auto allocate(const size_type capacity) -> pointer {
+    return std::allocator<char>{}.allocate(capacity + 1U);
+  }
+
+  static auto deallocate(pointer storage, const size_type capacity) noexcept -> void {
+    std::allocator<char>{}.deallocate(storage, capacity + 1U);
+  }
+
+  auto set_size(const size_type count) noexcept -> void {
+    size_ = count;
+    data_[size_] = '\0';
+  }
+
+  auto reset_to_inline() noexcept -> void {
+    data_ = inline_data();
+    capacity_ = inline_capacity;
+  }
+
+  auto release_heap() noexcept -> void {
+    if (!is_small()) {
+      deallocate(data_, capacity_);
+    }
+  }
+
+  auto steal_from(small_string &other) noexcept -> void {
+    if (other.is_small()) {
+      std::memcpy(inline_buffer_, other.inline_buffer_, other.size_ + 1U);
+      size_ = other.size_;
+    } else {
+      data_ = other.data_;
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      other.reset_to_inline();
+    }
+    other.set_size(0U);
+  }
+
+  pointer data_{nullptr};
+  size_type size_{0U};
+  size_type capacity_{inline_capacity};
+  char inline_buffer_[inline_capacity + 1U];
+};
+
+template <std::size_t inline_capacity>
+auto swap(small_string<inline_capacity> &lhs, small_string<inline_capacity> &rhs) noexcept
+    -> void {
+  lhs.swap(rhs);
+}
+
+} // namespace wh::core
+
+template <std::size_t inline_capacity>
+struct std::hash<wh::core::small_string<inline_capacity>> {
+  [[nodiscard]] auto operator()(const wh::core::small_string<inline_capacity> &value) const noexcept
+      -> std::size_t {
+    return std::hash<std::string_view>{}(value.view());
+  }
+};
@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "wh/callbacks/callbacks.hpp"
+#include "wh/core/metrics/hooks.hpp"
 #include "wh/core/stdexec/inspect_result_sender.hpp"
 #include "wh/core/stdexec/resume_policy.hpp"
 
@@ -28,8 +29,9 @@ template <wh::core::resume_mode Resume, typename request_t, typename scheduler_t
   requires callback_filterable_request<request_t>
 [[nodiscard]] inline auto
 component_async_entry(request_t &&request, wh::callbacks::callback_sink sink, scheduler_t scheduler,
-                      make_sender_t &&make_sender, make_state_t &&make_state, on_start_t &&on_start,
-                      on_success_t &&on_success, on_error_t &&on_error) {
+                      const wh::core::component_call_metrics metrics, make_sender_t &&make_sender,
+                      make_state_t &&make_state, on_start_t &&on_start, on_success_t &&on_success,
+                      on_error_t &&on_error) {
   using request_value_t = std::remove_cvref_t<request_t>;
   using state_t =
       std::remove_cvref_t<std::invoke_result_t<make_state_t &, const request_value_t &>>;
@@ -37,9 +39,14 @@ component_async_entry(request_t &&request, wh::callbacks::callback_sink sink, sc
   using error_t = std::remove_cvref_t<on_error_t>;
 
   sink = wh::callbacks::filter_callback_sink(std::move(sink), request.options);
+  // Callback state is only built when a listener exists; bundles with a
+  // `run_info` member get the sink metadata bound once here.
   auto state = std::optional<state_t>{};
-  if (sink.has_value()) {
+  if (sink.active_any(wh::callbacks::component_call_stages)) {
     state.emplace(std::invoke(make_state, static_cast<const request_value_t &>(request)));
+    if constexpr (requires { state->run_info; }) {
+      state->run_info = wh::callbacks::bind_run_info(sink, std::move(state->run_info));
+    }
     std::invoke(on_start, sink, *state);
   }
 
@@ -47,9 +54,10 @@ component_async_entry(request_t &&request, wh::callbacks::callback_sink sink, sc
       wh::core::detail::resume_if<Resume>(
           std::invoke(std::forward<make_sender_t>(make_sender), std::forward<request_t>(request)),
           std::move(scheduler)),
-      [sink = std::move(sink), state = std::move(state),
+      [sink = std::move(sink), state = std::move(state), metrics,
        on_success = success_t{std::forward<on_success_t>(on_success)},
        on_error = error_t{std::forward<on_error_t>(on_error)}](auto &status) mutable {
+        metrics.record(status.has_error());
         if (!state.has_value()) {
           return;
         }
@@ -61,4 +69,20 @@ component_async_entry(request_t &&request, wh::callbacks::callback_sink sink, sc
       });
 }
 
+/// Overload for entries that record no call metrics.
+template <wh::core::resume_mode Resume, typename request_t, typename scheduler_t,
+          typename make_sender_t, typename make_state_t, typename on_start_t, typename on_success_t,
+          typename on_error_t>
+  requires callback_filterable_request<request_t>
+[[nodiscard]] inline auto
+component_async_entry(request_t &&request, wh::callbacks::callback_sink sink, scheduler_t scheduler,
+                      make_sender_t &&make_sender, make_state_t &&make_state, on_start_t &&on_start,
+                      on_success_t &&on_success, on_error_t &&on_error) {
+  return component_async_entry<Resume>(
+      std::forward<request_t>(request), std::move(sink), std::move(scheduler),
+      wh::core::component_call_metrics{}, std::forward<make_sender_t>(make_sender),
+      std::forward<make_state_t>(make_state), std::forward<on_start_t>(on_start),
+      std::forward<on_success_t>(on_success), std::forward<on_error_t>(on_error));
+}
+
 } // namespace wh::core::detail
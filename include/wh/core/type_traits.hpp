@@ -35,6 +35,13 @@ struct transparent_string_hash {
   [[nodiscard]] auto operator()(const char *value) const noexcept -> std::size_t {
     return (*this)(std::string_view{value});
   }
+
+  /// Hashes other string-view-convertible keys such as `small_string`.
+  template <typename value_t>
+    requires std::convertible_to<const value_t &, std::string_view>
+  [[nodiscard]] auto operator()(const value_t &value) const noexcept -> std::size_t {
+    return (*this)(std::string_view{value});
+  }
 };
 
 /// Transparent equality comparator for heterogeneous `std::string` key lookup.
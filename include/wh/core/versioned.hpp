@@ -0,0 +1,183 @@
+// Defines `versioned<T>`, an RCU-style handle that publishes immutable
+// versions of a value while readers keep running on the version they pinned.
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace wh::core {
+
+/// One pinned version of a `versioned<T>` value.
+template <typename value_t> struct version_snapshot {
+  /// Shared immutable value; keeps the version alive while held.
+  std::shared_ptr<const value_t> value{};
+  /// Monotonic version number, 0 when nothing was published.
+  std::uint64_t version{0U};
+
+  [[nodiscard]] explicit operator bool() const noexcept { return value != nullptr; }
+
+  [[nodiscard]] auto operator*() const noexcept -> const value_t & { return *value; }
+
+  [[nodiscard]] auto operator->() const noexcept -> const value_t * { return value.get(); }
+};
+
+/// Publishes immutable versions of one value.
+///
+/// `snapshot` is a single atomic load, so readers never wait for writers. A
+/// publish replaces the current version for new readers only; callers that
+/// already pinned a snapshot keep using it, and each version is destroyed
+/// when its last snapshot is released.
+template <typename value_t> class versioned {
+  struct node {
+    template <typename... args_t>
+    explicit node(const std::uint64_t version_value, args_t &&...args)
+        : version(version_value), value(std::forward<args_t>(args)...) {}
+
+    std::uint64_t version{0U};
+    value_t value;
+  };
+
+  using node_ptr = std::shared_ptr<const node>;
+
+public:
+  versioned() = default;
+
+  /// Publishes `initial` as version 1.
+  explicit versioned(value_t initial)
+    requires std::move_constructible<value_t>
+  {
+    emplace(std::move(initial));
+  }
+
+  /// Copies share the source's current version but publish independently.
+  versioned(const versioned &other) noexcept
+      : next_version_(other.next_version_.load(std::memory_order_relaxed)) {
+    store(other.load(std::memory_order_acquire), std::memory_order_relaxed);
+  }
+
+  auto operator=(const versioned &other) noexcept -> versioned & {
+    if (this != std::addressof(other)) {
+      advance_version(other.next_version_.load(std::memory_order_relaxed));
+      store(other.load(std::memory_order_acquire), std::memory_order_release);
+    }
+    return *this;
+  }
+
+  versioned(versioned &&other) noexcept : versioned(std::as_const(other)) {}
+
+  auto operator=(versioned &&other) noexcept -> versioned & {
+    return *this = std::as_const(other);
+  }
+
+  ~versioned() = default;
+
+  /// Pins the current version.
+  [[nodiscard]] auto snapshot() const noexcept -> version_snapshot<value_t> {
+    auto current = load(std::memory_order_acquire);
+    if (current == nullptr) {
+      return {};
+    }
+    const auto version = current->version;
+    const auto *value = std::addressof(current->value);
+    return version_snapshot<value_t>{
+        .value = std::shared_ptr<const value_t>{std::move(current), value},
+        .version = version,
+    };
+  }
+
+  /// Returns true once a version has been published.
+  [[nodiscard]] auto has_value() const noexcept -> bool {
+    return load(std::memory_order_acquire) != nullptr;
+  }
+
+  /// Returns the current version number, 0 when nothing was published.
+  [[nodiscard]] auto version() const noexcept -> std::uint64_t {
+    const auto current = load(std::memory_order_acquire);
+    return current == nullptr ? 0U : current->version;
+  }
+
+  /// Publishes `next` as the new current version and returns its number.
+  auto publish(value_t next) -> std::uint64_t
+    requires std::move_constructible<value_t>
+  {
+    return emplace(std::move(next));
+  }
+
+  /// Constructs and publishes a new version in place.
+  template <typename... args_t>
+    requires std::constructible_from<value_t, args_t &&...>
+  auto emplace(args_t &&...args) -> std::uint64_t {
+    const auto version = next_version_.fetch_add(1U, std::memory_order_relaxed) + 1U;
+    store(std::make_shared<const node>(version, std::forward<args_t>(args)...),
+          std::memory_order_release);
+    return version;
+  }
+
+  /// Publishes `update(current)` unless another writer published first, in
+  /// which case `update` runs again on the newer version. Returns the
+  /// published version number.
+  template <typename update_t>
+    requires std::invocable<update_t &, const value_t &> &&
+             std::constructible_from<value_t, std::invoke_result_t<update_t &, const value_t &>>
+  auto update(update_t update) -> std::uint64_t {
+    auto expected = load(std::memory_order_acquire);
+    while (true) {
+      if (expected == nullptr) {
+        return 0U;
+      }
+      const auto version = next_version_.fetch_add(1U, std::memory_order_relaxed) + 1U;
+      auto desired = std::make_shared<const node>(version, update(expected->value));
+      if (compare_exchange(expected, std::move(desired))) {
+        return version;
+      }
+    }
+  }
+
+private:
+  auto advance_version(const std::uint64_t floor) noexcept -> void {
+    auto current = next_version_.load(std::memory_order_relaxed);
+    while (current < floor &&
+           !next_version_.compare_exchange_weak(current, floor, std::memory_order_relaxed)) {
+    }
+  }
+
+  auto store(node_ptr next, const std::memory_order order) noexcept -> void {
+#if defined(__cpp_lib_atomic_shared_ptr) && __cpp_lib_atomic_shared_ptr >= 201711L
+    current_.store(std::move(next), order);
+#else
+    std::atomic_store_explicit(&current_, std::move(next), order);
+#endif
+  }
+
+  [[nodiscard]] auto load(const std::memory_order order) const noexcept -> node_ptr {
+#if defined(__cpp_lib_atomic_shared_ptr) && __cpp_lib_atomic_shared_ptr >= 201711L
+    return current_.load(order);
+#else
+    return std::atomic_load_explicit(&current_, order);
+#endif
+  }
+
+  [[nodiscard]] auto compare_exchange(node_ptr &expected, node_ptr desired) noexcept -> bool {
+#if defined(__cpp_lib_atomic_shared_ptr) && __cpp_lib_atomic_shared_ptr >= 201711L
+    return current_.compare_exchange_strong(expected, std::move(desired),
+                                            std::memory_order_acq_rel, std::memory_order_acquire);
+#else
+    return std::atomic_compare_exchange_strong_explicit(&current_, &expected, std::move(desired),
+                                                        std::memory_order_acq_rel,
+                                                        std::memory_order_acquire);
+#endif
+  }
+
+#if defined(__cpp_lib_atomic_shared_ptr) && __cpp_lib_atomic_shared_ptr >= 201711L
+  std::atomic<node_ptr> current_{};
+#else
+  node_ptr current_{};
+#endif
+  std::atomic<std::uint64_t> next_version_{0U};
+};
+
+} // namespace wh::core
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <concepts>
+#include <functional>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -31,15 +32,21 @@ using callback_sink = wh::callbacks::callback_sink;
 using wh::callbacks::borrow_callback_sink;
 using wh::callbacks::make_callback_sink;
 
-template <typename payload_t>
+/// Builds run-info and payload only when `stage` has a listener.
+template <typename make_payload_t>
+  requires std::invocable<make_payload_t &>
 inline auto emit_callback(const callback_sink &sink, const wh::callbacks::stage stage,
-                          const payload_t &payload, const loader_options &options) -> void {
+                          make_payload_t &&make_payload, const loader_options &options) -> void {
+  if (!sink.active(stage)) {
+    return;
+  }
   wh::callbacks::run_info run_info{};
   run_info.name = "DocumentProcessor";
   run_info.type = "DocumentProcessor";
   run_info.component = wh::core::component_kind::document;
   run_info = wh::callbacks::apply_component_run_info(std::move(run_info), options);
-  wh::callbacks::emit(sink, stage, payload, run_info);
+  run_info = wh::callbacks::bind_run_info(sink, std::move(run_info));
+  wh::callbacks::emit_bound(sink, stage, std::invoke(make_payload), run_info);
 }
 
 } // namespace detail
@@ -150,12 +157,11 @@ private:
     document_request stored{std::forward<request_t>(request)};
     sink = wh::callbacks::filter_callback_sink(std::move(sink), stored.options);
     std::string source_uri = stored.source;
-    detail::emit_callback(sink, wh::callbacks::stage::start,
-                          parser_callback_event{source_uri, 0U, 0U}, stored.options);
+    const auto source_event = [&] { return parser_callback_event{source_uri, 0U, 0U}; };
+    detail::emit_callback(sink, wh::callbacks::stage::start, source_event, stored.options);
 
     if (!parser_.has_value()) {
-      detail::emit_callback(sink, wh::callbacks::stage::error,
-                            parser_callback_event{source_uri, 0U, 0U}, stored.options);
+      detail::emit_callback(sink, wh::callbacks::stage::error, source_event, stored.options);
       return wh::core::result<document_batch>::failure(wh::core::errc::not_supported);
     }
 
@@ -164,13 +170,13 @@ private:
     if (stored.source_kind == document_source_kind::uri && loader_) {
       auto loaded = loader_(source_uri, stored.options);
       if (loaded.has_error()) {
-        detail::emit_callback(sink, wh::callbacks::stage::error,
-                              parser_callback_event{source_uri, 0U, 0U}, stored.options);
+        detail::emit_callback(sink, wh::callbacks::stage::error, source_event, stored.options);
         return wh::core::result<document_batch>::failure(loaded.error());
       }
       content = std::move(loaded).value();
-      detail::emit_callback(sink, wh::callbacks::stage::end,
-                            loader_callback_event{source_uri, content.size()}, stored.options);
+      detail::emit_callback(
+          sink, wh::callbacks::stage::end,
+          [&] { return loader_callback_event{source_uri, content.size()}; }, stored.options);
     } else {
       content = source_uri;
     }
@@ -178,13 +184,13 @@ private:
     if (transformer_) {
       auto transformed = transformer_(content);
       if (transformed.has_error()) {
-        detail::emit_callback(sink, wh::callbacks::stage::error,
-                              parser_callback_event{source_uri, 0U, 0U}, stored.options);
+        detail::emit_callback(sink, wh::callbacks::stage::error, source_event, stored.options);
         return wh::core::result<document_batch>::failure(transformed.error());
       }
       content = std::move(transformed).value();
-      detail::emit_callback(sink, wh::callbacks::stage::end, transformer_callback_event{1U, 1U},
-                            stored.options);
+      detail::emit_callback(
+          sink, wh::callbacks::stage::end, [] { return transformer_callback_event{1U, 1U}; },
+          stored.options);
     }
 
     const std::string_view parse_source_uri = resolved_options.parser_uri().empty()
@@ -210,7 +216,9 @@ private:
     if (parsed.has_error()) {
       detail::emit_callback(
           sink, wh::callbacks::stage::error,
-          parser_callback_event{std::string{parse_source_uri}, parser_input_bytes, 0U},
+          [&] {
+            return parser_callback_event{std::string{parse_source_uri}, parser_input_bytes, 0U};
+          },
           stored.options);
       return parsed;
     }
@@ -227,7 +235,10 @@ private:
 
     detail::emit_callback(
         sink, wh::callbacks::stage::end,
-        parser_callback_event{std::string{parse_source_uri}, parser_input_bytes, documents.size()},
+        [&] {
+          return parser_callback_event{std::string{parse_source_uri}, parser_input_bytes,
+                                       documents.size()};
+        },
         stored.options);
     return documents;
   }
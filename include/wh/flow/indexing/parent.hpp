@@ -58,8 +58,20 @@ concept sub_id_generator = requires(generator_t generator, const wh::schema::doc
   } -> std::same_as<wh::core::result<std::vector<std::string>>>;
 };
 
+/// Interned parent-id key so per-chunk lookups compare one pointer.
+[[nodiscard]] inline auto parent_id_key() -> const wh::schema::document_metadata_key & {
+  static const auto key = wh::schema::make_document_metadata_key(parent_id_metadata_key);
+  return key;
+}
+
+/// Interned sub-id key for generated chunks.
+[[nodiscard]] inline auto sub_id_key() -> const wh::schema::document_metadata_key & {
+  static const auto key = wh::schema::make_document_metadata_key(sub_id_metadata_key);
+  return key;
+}
+
 [[nodiscard]] inline auto effective_parent_id(const wh::schema::document &document) -> std::string {
-  if (const auto *typed = document.metadata_ptr<std::string>(parent_id_metadata_key);
+  if (const auto *typed = document.metadata_ptr<std::string>(parent_id_key());
       typed != nullptr && !typed->empty()) {
     return *typed;
   }
@@ -215,8 +227,8 @@ public:
 
             for (std::size_t index = 0U; index < transformed.value().size(); ++index) {
               auto document = std::move(transformed.value()[index]);
-              document.set_metadata(parent_id_metadata_key, parent_id);
-              document.set_metadata(sub_id_metadata_key, sub_ids.value()[index]);
+              document.set_metadata(detail::indexing::parent_id_key(), parent_id);
+              document.set_metadata(detail::indexing::sub_id_key(), sub_ids.value()[index]);
               sub_documents.push_back(std::move(document));
             }
           }
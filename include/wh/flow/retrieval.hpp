@@ -3,4 +3,6 @@
 
 #include "wh/flow/retrieval/multi_query.hpp"
 #include "wh/flow/retrieval/parent.hpp"
+#include "wh/flow/retrieval/parent_cache.hpp"
 #include "wh/flow/retrieval/router.hpp"
+#include "wh/flow/retrieval/streaming.hpp"
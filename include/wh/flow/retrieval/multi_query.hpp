@@ -180,6 +180,8 @@ build_rewrite_state(const rewrite_t &rewriter, const wh::retriever::retriever_re
       seen_queries{};
   rewrite_state state{};
   state.base_request = request;
+  // Every rewritten query shares one compiled filter.
+  state.base_request.compiled_filter = wh::retriever::request_filter(request);
   state.queries.reserve(max_queries);
 
   const auto push_query = [&](const std::string &query) -> void {
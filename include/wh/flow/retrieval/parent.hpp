@@ -23,14 +23,12 @@
 #include "wh/core/stdexec/ready_result_sender.hpp"
 #include "wh/core/stdexec/result_sender.hpp"
 #include "wh/core/stdexec/variant_sender.hpp"
-#include "wh/document/keys.hpp"
+#include "wh/flow/retrieval/parent_cache.hpp"
 #include "wh/retriever/retriever.hpp"
 #include "wh/schema/document.hpp"
 
 namespace wh::flow::retrieval {
 
-inline constexpr std::string_view parent_id_metadata_key = wh::document::parent_id_metadata_key;
-
 namespace detail::parent {
 
 template <typename retriever_t>
@@ -94,13 +92,85 @@ template <typename value_t>
   return wh::core::result<value_t>::failure(wh::core::errc::type_mismatch);
 }
 
-[[nodiscard]] inline auto map_parent_result_sender(auto &&sender) {
-  using retrieve_result = wh::core::result<wh::retriever::retriever_response>;
-  return wh::core::detail::normalize_result_sender<retrieve_result>(
-      wh::core::detail::map_result_sender<retrieve_result>(
+/// Reads the load-node output as owned documents. Cached parents arrive as
+/// shared handles and are copied here only, because responses own theirs.
+[[nodiscard]] inline auto read_parent_documents(wh::compose::graph_value &&value)
+    -> wh::core::result<wh::retriever::retriever_response> {
+  auto *shared = wh::core::any_cast<std::vector<shared_parent_document>>(&value);
+  if (shared == nullptr) {
+    return read_graph_value<wh::retriever::retriever_response>(std::move(value));
+  }
+  wh::retriever::retriever_response documents{};
+  documents.reserve(shared->size());
+  for (const auto &document : *shared) {
+    documents.push_back(*document);
+  }
+  return documents;
+}
+
+/// Reads the load-node output as shared handles without copying cached
+/// parents; uncached parents are moved into fresh handles.
+[[nodiscard]] inline auto read_shared_parent_documents(wh::compose::graph_value &&value)
+    -> wh::core::result<std::vector<shared_parent_document>> {
+  if (auto *shared = wh::core::any_cast<std::vector<shared_parent_document>>(&value);
+      shared != nullptr) {
+    return std::move(*shared);
+  }
+  auto owned = read_graph_value<wh::retriever::retriever_response>(std::move(value));
+  if (owned.has_error()) {
+    return wh::core::result<std::vector<shared_parent_document>>::failure(owned.error());
+  }
+  std::vector<shared_parent_document> documents{};
+  documents.reserve(owned.value().size());
+  for (auto &document : owned.value()) {
+    documents.push_back(std::make_shared<const wh::schema::document>(std::move(document)));
+  }
+  return documents;
+}
+
+/// Loads `parent_ids` without a cache, moving each hit into first-hit order.
+template <typename loader_t>
+[[nodiscard]] inline auto load_uncached(loader_t &loader,
+                                        const std::vector<std::string> &parent_ids,
+                                        wh::core::run_context &context)
+    -> wh::core::result<wh::compose::graph_value> {
+  auto loaded = loader(parent_ids, context);
+  if (loaded.has_error()) {
+    return wh::core::result<wh::compose::graph_value>::failure(loaded.error());
+  }
+
+  std::unordered_map<std::string, wh::schema::document, wh::core::transparent_string_hash,
+                     wh::core::transparent_string_equal>
+      documents{};
+  for (auto &document : loaded.value()) {
+    const auto *parent_id = document.template metadata_ptr<std::string>(parent_id_key());
+    if (parent_id == nullptr) {
+      continue;
+    }
+    // Copy the key first: it lives inside the document being moved.
+    std::string key{*parent_id};
+    documents.insert_or_assign(std::move(key), std::move(document));
+  }
+
+  wh::retriever::retriever_response ordered{};
+  ordered.reserve(parent_ids.size());
+  for (const auto &parent_id : parent_ids) {
+    const auto iter = documents.find(parent_id);
+    if (iter != documents.end()) {
+      ordered.push_back(std::move(iter->second));
+    }
+  }
+  return wh::compose::graph_value{std::move(ordered)};
+}
+
+template <typename output_t, typename reader_t>
+[[nodiscard]] inline auto map_parent_result_sender(auto &&sender, reader_t reader) {
+  using output_result = wh::core::result<output_t>;
+  return wh::core::detail::normalize_result_sender<output_result>(
+      wh::core::detail::map_result_sender<output_result>(
           std::forward<decltype(sender)>(sender),
-          [](wh::compose::graph_value value) -> retrieve_result {
-            return read_graph_value<wh::retriever::retriever_response>(std::move(value));
+          [reader](wh::compose::graph_value value) -> output_result {
+            return reader(std::move(value));
           }));
 }
 
@@ -111,27 +181,39 @@ template <detail::parent::retriever_component retriever_t,
           detail::parent::parent_loader parent_loader_t>
 class parent {
   struct authored_state {
-    authored_state(retriever_t child_retriever_value, parent_loader_t parent_loader_value) noexcept
+    authored_state(retriever_t child_retriever_value, parent_loader_t parent_loader_value,
+                   std::shared_ptr<parent_document_cache> cache_value) noexcept
         : child_retriever(std::move(child_retriever_value)),
-          parent_loader(std::move(parent_loader_value)) {}
+          parent_loader(std::move(parent_loader_value)), cache(std::move(cache_value)) {}
 
     retriever_t child_retriever;
     parent_loader_t parent_loader;
+    std::shared_ptr<parent_document_cache> cache;
   };
 
   struct runtime_state {
-    runtime_state(retriever_t child_retriever_value, parent_loader_t parent_loader_value) noexcept
+    runtime_state(retriever_t child_retriever_value, parent_loader_t parent_loader_value,
+                  std::shared_ptr<parent_document_cache> cache_value) noexcept
         : child_retriever(std::move(child_retriever_value)),
-          parent_loader(std::move(parent_loader_value)) {}
+          parent_loader(std::move(parent_loader_value)), cache(std::move(cache_value)) {}
 
     retriever_t child_retriever;
     parent_loader_t parent_loader;
+    /// Optional shared cache consulted before `parent_loader`.
+    std::shared_ptr<parent_document_cache> cache;
     wh::compose::chain runtime_graph{};
   };
 
 public:
   parent(retriever_t child_retriever, parent_loader_t parent_loader) noexcept
-      : authored_(std::in_place, std::move(child_retriever), std::move(parent_loader)) {}
+      : authored_(std::in_place, std::move(child_retriever), std::move(parent_loader), nullptr) {}
+
+  /// Serves parent documents through `cache`, which may be shared with other
+  /// parent flows reading the same store.
+  parent(retriever_t child_retriever, parent_loader_t parent_loader,
+         std::shared_ptr<parent_document_cache> cache) noexcept
+      : authored_(std::in_place, std::move(child_retriever), std::move(parent_loader),
+                  std::move(cache)) {}
 
   parent(const parent &) = default;
   auto operator=(const parent &) -> parent & = default;
@@ -157,7 +239,8 @@ public:
     }
 
     auto runtime = std::make_shared<runtime_state>(std::move(authored_->child_retriever),
-                                                   std::move(authored_->parent_loader));
+                                                   std::move(authored_->parent_loader),
+                                                   std::move(authored_->cache));
 
     wh::compose::graph_compile_options options{};
     options.name = "retrieval_parent";
@@ -190,7 +273,7 @@ public:
           detail::parent::parent_lookup_state state{};
           for (const auto &document : child_hits.value()) {
             const auto *parent_id =
-                document.template metadata_ptr<std::string>(parent_id_metadata_key);
+                document.template metadata_ptr<std::string>(detail::parent::parent_id_key());
             if (parent_id == nullptr || parent_id->empty()) {
               continue;
             }
@@ -204,44 +287,39 @@ public:
       return collect_added;
     }
 
-    auto load_added = runtime->runtime_graph.append(wh::compose::make_lambda_node(
-        "parent_load_documents",
-        [loader = &runtime->parent_loader](
-            const wh::compose::graph_value &input, wh::core::run_context &context,
-            const wh::compose::graph_call_scope &) -> wh::core::result<wh::compose::graph_value> {
-          auto state = detail::parent::read_graph_value<detail::parent::parent_lookup_state>(
-              wh::compose::graph_value{input});
-          if (state.has_error()) {
-            return wh::core::result<wh::compose::graph_value>::failure(state.error());
-          }
-
-          auto loaded = (*loader)(state.value().parent_ids, context);
-          if (loaded.has_error()) {
-            return wh::core::result<wh::compose::graph_value>::failure(loaded.error());
-          }
-
-          std::unordered_map<std::string, wh::schema::document, wh::core::transparent_string_hash,
-                             wh::core::transparent_string_equal>
-              documents{};
-          for (auto &document : loaded.value()) {
-            const auto *parent_id =
-                document.template metadata_ptr<std::string>(parent_id_metadata_key);
-            if (parent_id == nullptr) {
-              continue;
-            }
-            documents.insert_or_assign(*parent_id, std::move(document));
-          }
-
-          wh::retriever::retriever_response ordered{};
-          ordered.reserve(state.value().parent_ids.size());
-          for (const auto &parent_id : state.value().parent_ids) {
-            const auto iter = documents.find(parent_id);
-            if (iter != documents.end()) {
-              ordered.push_back(iter->second);
-            }
-          }
-          return wh::compose::graph_value{std::move(ordered)};
-        }));
+    auto load_added = runtime->runtime_graph.append(
+        wh::compose::make_lambda_node<wh::compose::node_contract::value,
+                                      wh::compose::node_contract::value,
+                                      wh::compose::node_exec_mode::async>(
+            "parent_load_documents",
+            [loader = &runtime->parent_loader, cache = runtime->cache.get()](
+                wh::compose::graph_value &input, wh::core::run_context &context,
+                const wh::compose::graph_call_scope &) -> wh::compose::graph_value_sender {
+              using graph_result = wh::core::result<wh::compose::graph_value>;
+              auto state = detail::parent::read_graph_value<detail::parent::parent_lookup_state>(
+                  std::move(input));
+              if (state.has_error()) {
+                return wh::compose::graph_value_sender{
+                    wh::core::detail::failure_result_sender<graph_result>(state.error())};
+              }
+              if (cache == nullptr) {
+                return wh::compose::graph_value_sender{
+                    wh::core::detail::ready_sender(detail::parent::load_uncached(
+                        *loader, state.value().parent_ids, context))};
+              }
+              // Parked on another flow's load, this completes from its loader
+              // instead of blocking a scheduler thread.
+              return wh::compose::graph_value_sender{
+                  wh::core::detail::map_result_sender<graph_result>(
+                      cache->async_get_or_load(
+                          std::move(state).value().parent_ids,
+                          [loader, &context](const std::vector<std::string> &missing_ids) {
+                            return (*loader)(missing_ids, context);
+                          }),
+                      [](std::vector<shared_parent_document> shared) -> wh::compose::graph_value {
+                        return wh::core::any(std::move(shared));
+                      })};
+            }));
     if (load_added.has_error()) {
       return load_added;
     }
@@ -274,28 +352,50 @@ public:
     return dispatch_request(std::move(request), context);
   }
 
+  /// Like `async_retrieve`, but completes with the shared parent handles so
+  /// cached parents reach the caller without a copy.
+  [[nodiscard]] auto async_retrieve_shared(wh::retriever::retriever_request request,
+                                           wh::core::run_context &context) const {
+    return dispatch_mapped<std::vector<shared_parent_document>>(
+        std::move(request), context, [](wh::compose::graph_value value) {
+          return detail::parent::read_shared_parent_documents(std::move(value));
+        });
+  }
+
 private:
   template <typename request_t>
     requires std::same_as<std::remove_cvref_t<request_t>, wh::retriever::retriever_request>
   [[nodiscard]] auto dispatch_request(request_t &&request, wh::core::run_context &context) const {
-    using retrieve_result = wh::core::result<wh::retriever::retriever_response>;
-    using failure_sender_t = decltype(wh::core::detail::failure_result_sender<retrieve_result>(
+    return dispatch_mapped<wh::retriever::retriever_response>(
+        std::forward<request_t>(request), context, [](wh::compose::graph_value value) {
+          return detail::parent::read_parent_documents(std::move(value));
+        });
+  }
+
+  template <typename output_t, typename request_t, typename reader_t>
+    requires std::same_as<std::remove_cvref_t<request_t>, wh::retriever::retriever_request>
+  [[nodiscard]] auto dispatch_mapped(request_t &&request, wh::core::run_context &context,
+                                     reader_t reader) const {
+    using output_result = wh::core::result<output_t>;
+    using failure_sender_t = decltype(wh::core::detail::failure_result_sender<output_result>(
         wh::core::errc::internal_error));
-    using mapped_sender_t = decltype(detail::parent::map_parent_result_sender(
+    using mapped_sender_t = decltype(detail::parent::map_parent_result_sender<output_t>(
         std::declval<const wh::compose::chain &>().invoke(
             context, wh::compose::graph_value{
-                         wh::core::any(std::declval<wh::retriever::retriever_request>())})));
+                         wh::core::any(std::declval<wh::retriever::retriever_request>())}),
+        reader));
     using dispatch_sender_t = wh::core::detail::variant_sender<failure_sender_t, mapped_sender_t>;
 
     if (runtime_ == nullptr) {
-      return dispatch_sender_t{wh::core::detail::failure_result_sender<retrieve_result>(
+      return dispatch_sender_t{wh::core::detail::failure_result_sender<output_result>(
           wh::core::errc::contract_violation)};
     }
 
-    return dispatch_sender_t{
-        detail::parent::map_parent_result_sender(runtime_->runtime_graph.invoke(
+    return dispatch_sender_t{detail::parent::map_parent_result_sender<output_t>(
+        runtime_->runtime_graph.invoke(
             context, wh::compose::graph_value{wh::core::any(
-                         wh::retriever::retriever_request{std::forward<request_t>(request)})}))};
+                         wh::retriever::retriever_request{std::forward<request_t>(request)})}),
+        std::move(reader))};
   }
 
   std::optional<authored_state> authored_{};
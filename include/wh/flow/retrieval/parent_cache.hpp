@@ -0,0 +1,508 @@
+// Defines `parent_document_cache`, a shared byte-bounded LRU of parent
+// documents that coalesces concurrent loads of the same ids.
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <stdexec/execution.hpp>
+
+#include "wh/core/error.hpp"
+#include "wh/core/result.hpp"
+#include "wh/core/type_traits.hpp"
+#include "wh/document/keys.hpp"
+#include "wh/flow/indexing/parent.hpp"
+#include "wh/schema/document.hpp"
+
+namespace wh::flow::retrieval {
+
+inline constexpr std::string_view parent_id_metadata_key = wh::document::parent_id_metadata_key;
+
+/// Immutable parent document shared by the cache and every caller holding it.
+using shared_parent_document = std::shared_ptr<const wh::schema::document>;
+
+/// Sizing of one `parent_document_cache`.
+struct parent_cache_options {
+  /// Upper bound of the approximate bytes held by cached documents.
+  std::size_t max_bytes{64U * 1024U * 1024U};
+};
+
+/// Counters of one `parent_document_cache`.
+struct parent_cache_stats {
+  /// Ids served from cached documents.
+  std::uint64_t hits{0U};
+  /// Ids this caller loaded itself.
+  std::uint64_t misses{0U};
+  /// Ids served by waiting on another caller's in-flight load.
+  std::uint64_t coalesced{0U};
+  /// Documents dropped to stay within `max_bytes`.
+  std::uint64_t evictions{0U};
+  /// Documents currently cached.
+  std::size_t entries{0U};
+  /// Approximate bytes currently cached.
+  std::size_t bytes{0U};
+};
+
+class parent_document_cache;
+
+namespace detail::parent {
+
+/// Parent ids are read with the key the indexing flow writes them under.
+using wh::flow::indexing::detail::indexing::parent_id_key;
+
+template <typename loader_t> class parent_load_sender;
+
+} // namespace detail::parent
+
+/// Returns the approximate heap footprint charged for caching `document`.
+[[nodiscard]] inline auto parent_document_bytes(const wh::schema::document &document)
+    -> std::size_t {
+  std::size_t bytes = sizeof(wh::schema::document) + document.content().size();
+  const auto *metadata = document.metadata();
+  if (metadata == nullptr) {
+    return bytes;
+  }
+  for (const auto &entry : *metadata) {
+    bytes += sizeof(entry);
+    bytes += std::visit(
+        [](const auto &value) -> std::size_t {
+          using value_t = std::remove_cvref_t<decltype(value)>;
+          if constexpr (std::same_as<value_t, std::string>) {
+            return value.size();
+          } else if constexpr (std::same_as<value_t, std::vector<std::string>>) {
+            std::size_t total = value.size() * sizeof(std::string);
+            for (const auto &item : value) {
+              total += item.size();
+            }
+            return total;
+          } else if constexpr (requires { value.size(); }) {
+            return value.size() * sizeof(typename value_t::value_type);
+          } else {
+            return 0U;
+          }
+        },
+        entry.second);
+  }
+  return bytes;
+}
+
+/// Byte-bounded LRU of parent documents shared across parent flows.
+///
+/// `get_or_load` serves cached ids directly, loads the ids nobody else is
+/// loading with one loader call, and parks on ids another caller is already
+/// loading instead of loading them again; that caller's loader completes the
+/// parked ones. Documents are held as
+/// `shared_parent_document`, so every caller and the cache share one copy.
+/// Ids the loader does not return are not cached and are skipped in results.
+class parent_document_cache {
+public:
+  explicit parent_document_cache(const parent_cache_options options = {}) noexcept
+      : options_(options) {}
+
+  parent_document_cache(const parent_document_cache &) = delete;
+  auto operator=(const parent_document_cache &) -> parent_document_cache & = delete;
+  parent_document_cache(parent_document_cache &&) = delete;
+  auto operator=(parent_document_cache &&) -> parent_document_cache & = delete;
+  ~parent_document_cache() = default;
+
+  using load_result = wh::core::result<std::vector<shared_parent_document>>;
+
+  /// Resolves `parent_ids` in order and completes `on_ready(load_result)`
+  /// exactly once without blocking. `loader(missing_ids)` must return
+  /// `result<std::vector<wh::schema::document>>` whose documents carry
+  /// `parent_id_metadata_key`; it runs on this thread. Ids another caller is
+  /// loading park this call on that load, and `on_ready` then runs on the
+  /// thread that finishes the last of them. A loader failure fails this call
+  /// and every caller parked on the same ids.
+  template <typename loader_t, typename callback_t>
+    requires std::same_as<
+                 std::invoke_result_t<loader_t &, const std::vector<std::string> &>,
+                 wh::core::result<std::vector<wh::schema::document>>> &&
+             std::is_nothrow_invocable_v<std::remove_cvref_t<callback_t> &, load_result>
+  auto get_or_load(const std::vector<std::string> &parent_ids, loader_t &&loader,
+                   callback_t &&on_ready) -> void {
+    auto join = std::make_shared<typed_join<std::remove_cvref_t<callback_t>>>(
+        std::forward<callback_t>(on_ready));
+    join->resolved.resize(parent_ids.size());
+    std::vector<pending_slot> owned{};
+    std::vector<std::string> missing{};
+    owned.reserve(parent_ids.size());
+    missing.reserve(parent_ids.size());
+    {
+      std::lock_guard lock{mutex_};
+      for (std::size_t index = 0U; index < parent_ids.size(); ++index) {
+        const auto &parent_id = parent_ids[index];
+        if (auto cached = find_locked(parent_id); cached != nullptr) {
+          join->resolved[index] = std::move(cached);
+          ++stats_.hits;
+          continue;
+        }
+        if (const auto iter = in_flight_.find(parent_id); iter != in_flight_.end()) {
+          join->waiting.push_back(pending_slot{.index = index, .flight = iter->second});
+          iter->second->waiters.push_back(join);
+          ++stats_.coalesced;
+          continue;
+        }
+        auto flight = std::make_shared<flight_state>();
+        in_flight_.emplace(parent_id, flight);
+        owned.push_back(pending_slot{.index = index, .flight = std::move(flight)});
+        missing.push_back(parent_id);
+        ++stats_.misses;
+      }
+      // One count per parked flight plus this call's own arrival below.
+      join->remaining.store(join->waiting.size() + 1U, std::memory_order_relaxed);
+    }
+
+    if (!owned.empty()) {
+      auto loaded = invoke_loader(loader, missing);
+      if (loaded.has_error()) {
+        join->error = loaded.error();
+        complete_flights(owned, missing, loaded.error());
+      } else {
+        complete_flights(owned, missing, std::move(loaded).value());
+        for (const auto &slot : owned) {
+          join->resolved[slot.index] = slot.flight->document;
+        }
+      }
+    }
+    arrive(*join);
+  }
+
+  /// Blocking form of `get_or_load` for callers outside a scheduler; the
+  /// calling thread waits while another caller loads shared ids. Graph nodes
+  /// use `async_get_or_load` instead.
+  template <typename loader_t>
+    requires std::same_as<
+        std::invoke_result_t<loader_t &, const std::vector<std::string> &>,
+        wh::core::result<std::vector<wh::schema::document>>>
+  [[nodiscard]] auto get_or_load(const std::vector<std::string> &parent_ids, loader_t &&loader)
+      -> load_result {
+    std::mutex ready_mutex{};
+    std::condition_variable ready{};
+    std::optional<load_result> output{};
+    get_or_load(parent_ids, loader, [&](load_result status) noexcept {
+      // Notify under the lock: the waiter owns `ready` and returns as soon
+      // as it observes `output`.
+      std::lock_guard lock{ready_mutex};
+      output.emplace(std::move(status));
+      ready.notify_one();
+    });
+    std::unique_lock lock{ready_mutex};
+    ready.wait(lock, [&output] { return output.has_value(); });
+    return std::move(*output);
+  }
+
+  /// Sender form of `get_or_load`: completes with `load_result` from the
+  /// thread that finishes the last awaited load, never parking a thread.
+  template <typename loader_t>
+    requires std::same_as<
+        std::invoke_result_t<loader_t &, const std::vector<std::string> &>,
+        wh::core::result<std::vector<wh::schema::document>>>
+  [[nodiscard]] auto async_get_or_load(std::vector<std::string> parent_ids, loader_t loader)
+      -> detail::parent::parent_load_sender<loader_t> {
+    return detail::parent::parent_load_sender<loader_t>{this, std::move(parent_ids),
+                                                        std::move(loader)};
+  }
+
+  /// Returns the cached document of `parent_id`, or null.
+  [[nodiscard]] auto find(const std::string_view parent_id) -> shared_parent_document {
+    std::lock_guard lock{mutex_};
+    return find_locked(parent_id);
+  }
+
+  /// Caches `document` under its parent id and returns the shared copy.
+  /// Documents without a parent id are returned uncached.
+  auto insert(wh::schema::document document) -> shared_parent_document {
+    const auto *parent_id = document.metadata_ptr<std::string>(
+        detail::parent::parent_id_key());
+    if (parent_id == nullptr || parent_id->empty()) {
+      return std::make_shared<const wh::schema::document>(std::move(document));
+    }
+    std::string key{*parent_id};
+    std::lock_guard lock{mutex_};
+    return insert_locked(std::move(key), std::move(document));
+  }
+
+  /// Drops `parent_id`; an in-flight load of it is returned to its callers
+  /// but not cached.
+  auto invalidate(const std::string_view parent_id) -> void {
+    std::lock_guard lock{mutex_};
+    erase_locked(parent_id);
+    if (const auto iter = in_flight_.find(parent_id); iter != in_flight_.end()) {
+      iter->second->invalidated = true;
+    }
+  }
+
+  /// Drops every cached document.
+  auto clear() -> void {
+    std::lock_guard lock{mutex_};
+    lru_.clear();
+    index_.clear();
+    stats_.bytes = 0U;
+    for (auto &[parent_id, flight] : in_flight_) {
+      flight->invalidated = true;
+    }
+  }
+
+  /// Returns a consistent copy of the counters.
+  [[nodiscard]] auto stats() const -> parent_cache_stats {
+    std::lock_guard lock{mutex_};
+    auto stats = stats_;
+    stats.entries = lru_.size();
+    return stats;
+  }
+
+  /// Returns the configured byte bound.
+  [[nodiscard]] auto options() const noexcept -> const parent_cache_options & { return options_; }
+
+private:
+  struct entry {
+    std::string parent_id{};
+    shared_parent_document document{};
+    std::size_t bytes{0U};
+  };
+
+  struct flight_state;
+
+  struct pending_slot {
+    std::size_t index{0U};
+    std::shared_ptr<flight_state> flight{};
+  };
+
+  /// One caller's outstanding ids; completes once every awaited flight and
+  /// the caller's own load have arrived.
+  struct load_join {
+    std::vector<shared_parent_document> resolved{};
+    std::vector<pending_slot> waiting{};
+    std::optional<wh::core::error_code> error{};
+    std::atomic<std::size_t> remaining{0U};
+    void (*complete_fn)(load_join &, load_result) noexcept {nullptr};
+  };
+
+  template <typename callback_t> struct typed_join final : load_join {
+    explicit typed_join(callback_t callback_value) : callback(std::move(callback_value)) {
+      this->complete_fn = [](load_join &join, load_result status) noexcept {
+        static_cast<typed_join &>(join).callback(std::move(status));
+      };
+    }
+
+    callback_t callback;
+  };
+
+  struct flight_state {
+    shared_parent_document document{};
+    std::optional<wh::core::error_code> error{};
+    bool invalidated{false};
+    /// Callers parked on this load; arrived once the loader finishes.
+    std::vector<std::shared_ptr<load_join>> waiters{};
+  };
+
+  template <typename loader_t>
+  [[nodiscard]] static auto invoke_loader(loader_t &loader,
+                                          const std::vector<std::string> &missing) noexcept
+      -> wh::core::result<std::vector<wh::schema::document>> {
+    try {
+      return loader(missing);
+    } catch (...) {
+      // Parked callers are only completed by this load, so it must finish.
+      return wh::core::result<std::vector<wh::schema::document>>::failure(
+          wh::core::errc::internal_error);
+    }
+  }
+
+  /// Counts one arrival on `join` and completes it on the last one.
+  static auto arrive(load_join &join) noexcept -> void {
+    if (join.remaining.fetch_sub(1U, std::memory_order_acq_rel) != 1U) {
+      return;
+    }
+    if (join.error.has_value()) {
+      join.complete_fn(join, load_result::failure(*join.error));
+      return;
+    }
+    // Flights are written under the cache lock before their waiters arrive.
+    for (const auto &slot : join.waiting) {
+      if (slot.flight->error.has_value()) {
+        join.complete_fn(join, load_result::failure(*slot.flight->error));
+        return;
+      }
+      join.resolved[slot.index] = slot.flight->document;
+    }
+    std::erase(join.resolved, nullptr);
+    join.complete_fn(join, std::move(join.resolved));
+  }
+
+  auto complete_flights(const std::vector<pending_slot> &owned,
+                        const std::vector<std::string> &missing,
+                        const wh::core::error_code error) noexcept -> void {
+    finish_flights(owned, missing,
+                   [error](const std::string &, flight_state &flight) { flight.error = error; });
+  }
+
+  auto complete_flights(const std::vector<pending_slot> &owned,
+                        const std::vector<std::string> &missing,
+                        std::vector<wh::schema::document> loaded) -> void {
+    std::unordered_map<std::string_view, wh::schema::document *> by_id{};
+    by_id.reserve(loaded.size());
+    for (auto &document : loaded) {
+      const auto *parent_id =
+          document.metadata_ptr<std::string>(detail::parent::parent_id_key());
+      if (parent_id != nullptr) {
+        by_id.insert_or_assign(std::string_view{*parent_id}, &document);
+      }
+    }
+    finish_flights(owned, missing, [this, &by_id](const std::string &parent_id,
+                                                  flight_state &flight) {
+      const auto iter = by_id.find(parent_id);
+      if (iter == by_id.end()) {
+        return;
+      }
+      auto document = std::move(*iter->second);
+      by_id.erase(iter);
+      if (flight.invalidated) {
+        flight.document = std::make_shared<const wh::schema::document>(std::move(document));
+      } else {
+        flight.document = insert_locked(parent_id, std::move(document));
+      }
+    });
+  }
+
+  /// Resolves every owned flight under the lock, then arrives its parked
+  /// callers after unlocking because their completions may re-enter.
+  template <typename resolve_t>
+  auto finish_flights(const std::vector<pending_slot> &owned,
+                      const std::vector<std::string> &missing, resolve_t resolve) -> void {
+    std::vector<std::shared_ptr<load_join>> parked{};
+    {
+      std::lock_guard lock{mutex_};
+      for (std::size_t index = 0U; index < owned.size(); ++index) {
+        const auto &parent_id = missing[index];
+        auto &flight = *owned[index].flight;
+        resolve(parent_id, flight);
+        parked.insert(parked.end(), std::make_move_iterator(flight.waiters.begin()),
+                      std::make_move_iterator(flight.waiters.end()));
+        flight.waiters.clear();
+        in_flight_.erase(parent_id);
+      }
+    }
+    for (const auto &join : parked) {
+      arrive(*join);
+    }
+  }
+
+  [[nodiscard]] auto find_locked(const std::string_view parent_id) -> shared_parent_document {
+    const auto iter = index_.find(parent_id);
+    if (iter == index_.end()) {
+      return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, iter->second);
+    return iter->second->document;
+  }
+
+  auto erase_locked(const std::string_view parent_id) -> void {
+    const auto iter = index_.find(parent_id);
+    if (iter == index_.end()) {
+      return;
+    }
+    stats_.bytes -= iter->second->bytes;
+    lru_.erase(iter->second);
+    index_.erase(iter);
+  }
+
+  auto insert_locked(std::string parent_id, wh::schema::document document)
+      -> shared_parent_document {
+    const auto bytes = parent_document_bytes(document);
+    auto shared = std::make_shared<const wh::schema::document>(std::move(document));
+    erase_locked(parent_id);
+    if (bytes > options_.max_bytes) {
+      return shared;
+    }
+    while (!lru_.empty() && stats_.bytes + bytes > options_.max_bytes) {
+      auto &victim = lru_.back();
+      stats_.bytes -= victim.bytes;
+      index_.erase(victim.parent_id);
+      lru_.pop_back();
+      ++stats_.evictions;
+    }
+    lru_.push_front(entry{.parent_id = std::move(parent_id), .document = shared, .bytes = bytes});
+    index_.emplace(lru_.front().parent_id, lru_.begin());
+    stats_.bytes += bytes;
+    return shared;
+  }
+
+  parent_cache_options options_{};
+  mutable std::mutex mutex_{};
+  std::list<entry> lru_{};
+  std::unordered_map<std::string, std::list<entry>::iterator, wh::core::transparent_string_hash,
+                     wh::core::transparent_string_equal>
+      index_{};
+  std::unordered_map<std::string, std::shared_ptr<flight_state>,
+                     wh::core::transparent_string_hash, wh::core::transparent_string_equal>
+      in_flight_{};
+  parent_cache_stats stats_{};
+};
+
+namespace detail::parent {
+
+/// Sender returned by `parent_document_cache::async_get_or_load`.
+template <typename loader_t> class parent_load_sender {
+public:
+  using sender_concept = stdexec::sender_t;
+  using completion_signatures =
+      stdexec::completion_signatures<stdexec::set_value_t(parent_document_cache::load_result)>;
+
+  parent_load_sender(parent_document_cache *cache, std::vector<std::string> parent_ids,
+                     loader_t loader)
+      : cache_(cache), parent_ids_(std::move(parent_ids)), loader_(std::move(loader)) {}
+
+  template <typename receiver_t> struct operation {
+    using operation_state_concept = stdexec::operation_state_t;
+
+    parent_document_cache *cache{nullptr};
+    std::vector<std::string> parent_ids{};
+    loader_t loader;
+    receiver_t receiver;
+
+    auto start() & noexcept -> void {
+      cache->get_or_load(parent_ids, loader,
+                         [this](parent_document_cache::load_result status) noexcept {
+                           stdexec::set_value(std::move(receiver), std::move(status));
+                         });
+    }
+  };
+
+  template <stdexec::receiver_of<completion_signatures> receiver_t>
+  [[nodiscard]] auto connect(receiver_t receiver) && -> operation<receiver_t> {
+    return operation<receiver_t>{cache_, std::move(parent_ids_), std::move(loader_),
+                                 std::move(receiver)};
+  }
+
+  template <stdexec::receiver_of<completion_signatures> receiver_t>
+  [[nodiscard]] auto connect(receiver_t receiver) const & -> operation<receiver_t> {
+    return operation<receiver_t>{cache_, parent_ids_, loader_, std::move(receiver)};
+  }
+
+  [[nodiscard]] auto get_env() const noexcept -> stdexec::env<> { return {}; }
+
+private:
+  parent_document_cache *cache_{nullptr};
+  std::vector<std::string> parent_ids_{};
+  loader_t loader_;
+};
+
+} // namespace detail::parent
+
+} // namespace wh::flow::retrieval
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <ranges>
@@ -29,6 +30,7 @@
 #include "wh/core/stdexec/ready_result_sender.hpp"
 #include "wh/core/stdexec/result_sender.hpp"
 #include "wh/core/stdexec/variant_sender.hpp"
+#include "wh/core/versioned.hpp"
 #include "wh/retriever/retriever.hpp"
 #include "wh/schema/document.hpp"
 
@@ -430,11 +432,14 @@ public:
   }
 
   /// Returns true after registration has frozen successfully.
-  [[nodiscard]] auto frozen() const noexcept -> bool { return runtime_ != nullptr; }
+  [[nodiscard]] auto frozen() const noexcept -> bool { return runtime_.has_value(); }
+
+  /// Returns the published retriever-set version, 0 before freeze.
+  [[nodiscard]] auto version() const noexcept -> std::uint64_t { return runtime_.version(); }
 
   /// Registers one named retriever before freeze.
   auto add_retriever(std::string name, retriever_t retriever) -> wh::core::result<void> {
-    if (!authored_.has_value() || runtime_ != nullptr) {
+    if (!authored_.has_value() || runtime_.has_value()) {
       return wh::core::result<void>::failure(wh::core::errc::contract_violation);
     }
     if (name.empty()) {
@@ -451,7 +456,7 @@ public:
 
   /// Freezes the retriever registry and route lookup tables.
   auto freeze() -> wh::core::result<void> {
-    if (runtime_ != nullptr) {
+    if (runtime_.has_value()) {
       return {};
     }
     if (!authored_.has_value()) {
@@ -460,13 +465,45 @@ public:
     if (authored_->retrievers.empty()) {
       return wh::core::result<void>::failure(wh::core::errc::invalid_argument);
     }
-    runtime_ = std::make_shared<runtime_state_t>(std::move(authored_->route_policy),
-                                                 std::move(authored_->fusion_policy),
-                                                 std::move(authored_->retrievers));
+    runtime_.emplace(std::move(authored_->route_policy), std::move(authored_->fusion_policy),
+                     std::move(authored_->retrievers));
     authored_.reset();
     return {};
   }
 
+  /// Replaces the retriever set of a frozen router. New requests route over
+  /// `retrievers` while requests already in flight finish on the set they
+  /// started with; the old set is released with its last request.
+  auto reload_retrievers(std::vector<std::pair<std::string, retriever_t>> retrievers)
+      -> wh::core::result<void>
+    requires std::copy_constructible<route_t> && std::copy_constructible<fusion_t>
+  {
+    const auto current = runtime_.snapshot();
+    if (!current) {
+      return wh::core::result<void>::failure(wh::core::errc::contract_violation);
+    }
+    if (retrievers.empty()) {
+      return wh::core::result<void>::failure(wh::core::errc::invalid_argument);
+    }
+    std::unordered_set<std::string_view> seen{};
+    std::vector<detail::router::retriever_binding<retriever_t>> bindings{};
+    bindings.reserve(retrievers.size());
+    for (auto &[name, retriever] : retrievers) {
+      if (name.empty()) {
+        return wh::core::result<void>::failure(wh::core::errc::invalid_argument);
+      }
+      if (seen.contains(name)) {
+        return wh::core::result<void>::failure(wh::core::errc::already_exists);
+      }
+      bindings.push_back(detail::router::retriever_binding<retriever_t>{
+          .name = std::move(name), .retriever = std::move(retriever)});
+      // View the moved-to name; `bindings` is reserved, so it never relocates.
+      seen.insert(bindings.back().name);
+    }
+    runtime_.emplace(current->route_policy, current->fusion_policy, std::move(bindings));
+    return {};
+  }
+
   /// Convenience alias kept at flow level.
   [[nodiscard]] auto retrieve(const wh::retriever::retriever_request &request,
                               wh::core::run_context &context) const {
@@ -503,17 +540,19 @@ private:
         std::declval<wh::retriever::retriever_request>(), std::declval<wh::core::run_context &>()));
     using dispatch_sender_t = wh::core::detail::variant_sender<failure_sender_t, pipeline_sender_t>;
 
-    if (runtime_ == nullptr) {
+    auto pinned = runtime_.snapshot();
+    if (!pinned) {
       return dispatch_sender_t{wh::core::detail::failure_result_sender<output_status>(
           wh::core::errc::contract_violation)};
     }
 
     return dispatch_sender_t{detail::router::make_pipeline_sender(
-        runtime_, wh::retriever::retriever_request{std::forward<request_t>(request)}, context)};
+        std::move(pinned.value), wh::retriever::retriever_request{std::forward<request_t>(request)},
+        context)};
   }
 
   std::optional<authored_state_t> authored_{};
-  std::shared_ptr<const runtime_state_t> runtime_{};
+  wh::core::versioned<runtime_state_t> runtime_{};
 };
 
 } // namespace wh::flow::retrieval
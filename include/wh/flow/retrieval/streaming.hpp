@@ -0,0 +1,404 @@
+// Defines streaming retrieval fusion: routes report documents progressively
+// through one merged stream, and fusion emits a provisional top-k on quorum or
+// deadline before every route has finished.
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "wh/core/error.hpp"
+#include "wh/core/result.hpp"
+#include "wh/core/run_context.hpp"
+#include "wh/flow/retrieval/router.hpp"
+#include "wh/retriever/retriever.hpp"
+#include "wh/schema/document.hpp"
+#include "wh/schema/stream/core/status.hpp"
+#include "wh/schema/stream/core/stream_base.hpp"
+#include "wh/schema/stream/reader/merge_stream_reader.hpp"
+
+namespace wh::flow::retrieval {
+
+namespace detail::streaming {
+
+template <typename retriever_t>
+using route_reader_t = std::remove_cvref_t<
+    decltype(std::declval<const retriever_t &>()
+                 .stream_retrieve(std::declval<const wh::retriever::retriever_request &>(),
+                                  std::declval<wh::core::run_context &>())
+                 .value())>;
+
+} // namespace detail::streaming
+
+/// Streaming retriever contract: `stream_retrieve(request, context)` returns
+/// `result<reader>` whose reader yields documents best-first as the route
+/// produces them.
+template <typename retriever_t>
+concept streaming_retriever =
+    requires { typename detail::streaming::route_reader_t<retriever_t>; } &&
+    wh::schema::stream::stream_reader<detail::streaming::route_reader_t<retriever_t>> &&
+    std::same_as<typename detail::streaming::route_reader_t<retriever_t>::value_type,
+                 wh::schema::document>;
+
+/// Handling of documents that arrive after a provisional result.
+enum class late_result_policy : std::uint8_t {
+  /// Keep reading and emit a final result once every route finished.
+  merge = 0U,
+  /// Treat the provisional result as final and close the remaining routes.
+  drop,
+};
+
+/// Emission policy of one streaming fusion.
+struct streaming_fusion_options {
+  /// Documents kept in each emitted result; 0 keeps every fused document.
+  std::size_t top_k{0U};
+  /// Finished routes that trigger a provisional result; 0 waits for all.
+  std::size_t quorum{0U};
+  /// Time after the first read that triggers a provisional result; zero
+  /// disables the deadline.
+  std::chrono::steady_clock::duration deadline{};
+  /// What happens to documents arriving after a provisional result.
+  late_result_policy late_results{late_result_policy::merge};
+  /// Documents kept per route, best first; 0 keeps every document.
+  std::size_t per_route_limit{0U};
+};
+
+/// One fused result emitted by a streaming fusion.
+struct streaming_fusion_result {
+  /// Fused documents truncated to `top_k`.
+  wh::retriever::retriever_response documents{};
+  /// Routes that had finished when this result was fused.
+  std::vector<std::string> finished_routes{};
+  /// True when fused before every route finished.
+  bool provisional{false};
+};
+
+/// Running fusion state over named routes.
+///
+/// Each route keeps its documents in arrival order, which is its rank order,
+/// so any router fusion functor can fuse a partial snapshot without copies.
+template <detail::router::fusion_policy fusion_t = detail::router::reciprocal_rank_fusion>
+class streaming_fusion {
+public:
+  using clock = std::chrono::steady_clock;
+
+  streaming_fusion(std::vector<std::string> routes, const streaming_fusion_options &options,
+                   fusion_t fusion = {})
+      : options_(options), fusion_(std::move(fusion)), finished_(routes.size(), false) {
+    results_.reserve(routes.size());
+    for (auto &route : routes) {
+      results_.push_back(routed_retriever_result{.retriever_name = std::move(route)});
+    }
+  }
+
+  /// Starts the deadline clock; later calls keep the first start.
+  auto arm(const clock::time_point now) -> void {
+    if (!deadline_at_.has_value() && options_.deadline != clock::duration::zero()) {
+      deadline_at_ = now + options_.deadline;
+    }
+  }
+
+  /// Adds the next document of `route`. Returns false when the document was
+  /// dropped as late, exceeded the route limit or named an unknown route.
+  auto offer(const std::string_view route, wh::schema::document document) -> bool {
+    const auto index = route_index(route);
+    if (!index.has_value() || finished_[*index]) {
+      return false;
+    }
+    if (provisional_emitted_ && options_.late_results == late_result_policy::drop) {
+      ++dropped_;
+      return false;
+    }
+    auto &documents = results_[*index].documents;
+    if (options_.per_route_limit != 0U && documents.size() >= options_.per_route_limit) {
+      return false;
+    }
+    documents.push_back(std::move(document));
+    return true;
+  }
+
+  /// Marks `route` finished.
+  auto finish(const std::string_view route) -> void {
+    if (const auto index = route_index(route); index.has_value() && !finished_[*index]) {
+      finished_[*index] = true;
+      ++finished_count_;
+    }
+  }
+
+  /// Marks every route finished.
+  auto finish_all() -> void {
+    std::fill(finished_.begin(), finished_.end(), true);
+    finished_count_ = finished_.size();
+  }
+
+  /// Returns true once every route finished.
+  [[nodiscard]] auto complete() const noexcept -> bool {
+    return finished_count_ == finished_.size();
+  }
+
+  /// Returns true once no further result will be emitted.
+  [[nodiscard]] auto done() const noexcept -> bool {
+    return final_emitted_ ||
+           (provisional_emitted_ && options_.late_results == late_result_policy::drop);
+  }
+
+  /// Returns true while a provisional result may still be triggered by the
+  /// deadline alone.
+  [[nodiscard]] auto awaiting_deadline(const clock::time_point now) const noexcept -> bool {
+    return !provisional_emitted_ && !done() && deadline_at_.has_value() && now < *deadline_at_;
+  }
+
+  /// Returns the armed deadline, if any.
+  [[nodiscard]] auto deadline_at() const noexcept -> std::optional<clock::time_point> {
+    return deadline_at_;
+  }
+
+  /// Returns true when a result should be emitted now.
+  [[nodiscard]] auto ready(const clock::time_point now) const noexcept -> bool {
+    if (done()) {
+      return false;
+    }
+    if (complete()) {
+      return true;
+    }
+    if (provisional_emitted_) {
+      return false;
+    }
+    const auto quorum_reached = options_.quorum != 0U && finished_count_ >= options_.quorum;
+    const auto deadline_passed = deadline_at_.has_value() && now >= *deadline_at_;
+    return quorum_reached || deadline_passed;
+  }
+
+  /// Fuses the routes reported so far with the router fusion functor.
+  [[nodiscard]] auto emit() -> wh::core::result<streaming_fusion_result> {
+    auto fused = fusion_(results_);
+    if (fused.has_error()) {
+      return wh::core::result<streaming_fusion_result>::failure(fused.error());
+    }
+    streaming_fusion_result emitted{
+        .documents = std::move(fused).value(),
+        .provisional = !complete(),
+    };
+    if (options_.top_k != 0U && emitted.documents.size() > options_.top_k) {
+      emitted.documents.resize(options_.top_k);
+    }
+    emitted.finished_routes.reserve(finished_count_);
+    for (std::size_t index = 0U; index < results_.size(); ++index) {
+      if (finished_[index]) {
+        emitted.finished_routes.push_back(results_[index].retriever_name);
+      }
+    }
+    if (emitted.provisional) {
+      provisional_emitted_ = true;
+    } else {
+      final_emitted_ = true;
+    }
+    return emitted;
+  }
+
+  /// Returns the late documents discarded under `late_result_policy::drop`.
+  [[nodiscard]] auto dropped() const noexcept -> std::size_t { return dropped_; }
+
+  /// Returns the per-route documents gathered so far.
+  [[nodiscard]] auto results() const noexcept -> const std::vector<routed_retriever_result> & {
+    return results_;
+  }
+
+private:
+  [[nodiscard]] auto route_index(const std::string_view route) const noexcept
+      -> std::optional<std::size_t> {
+    for (std::size_t index = 0U; index < results_.size(); ++index) {
+      if (results_[index].retriever_name == route) {
+        return index;
+      }
+    }
+    return std::nullopt;
+  }
+
+  streaming_fusion_options options_{};
+  fusion_t fusion_;
+  std::vector<routed_retriever_result> results_{};
+  std::vector<bool> finished_{};
+  std::size_t finished_count_{0U};
+  std::size_t dropped_{0U};
+  std::optional<clock::time_point> deadline_at_{};
+  bool provisional_emitted_{false};
+  bool final_emitted_{false};
+};
+
+/// Reader of fused results over a merged stream of route documents.
+///
+/// Yields at most one provisional result followed, under
+/// `late_result_policy::merge`, by the final result, then EOF. While a
+/// deadline is armed, blocking reads poll the merged stream with an
+/// exponential sleep backoff capped by the deadline, so the deadline can fire
+/// between documents without spinning; afterwards they block on the stream.
+template <wh::schema::stream::stream_reader reader_t,
+          detail::router::fusion_policy fusion_t = detail::router::reciprocal_rank_fusion>
+  requires std::same_as<typename reader_t::value_type, wh::schema::document>
+class streaming_fusion_reader final
+    : public wh::schema::stream::stream_base<streaming_fusion_reader<reader_t, fusion_t>,
+                                             streaming_fusion_result> {
+  using merged_reader_t = wh::schema::stream::merge_stream_reader<reader_t>;
+  using input_chunk_t = wh::schema::stream::stream_chunk<wh::schema::document>;
+  using input_status_t = wh::schema::stream::stream_result<input_chunk_t>;
+
+public:
+  using value_type = streaming_fusion_result;
+  using chunk_type = wh::schema::stream::stream_chunk<streaming_fusion_result>;
+  using status_type = wh::schema::stream::stream_result<chunk_type>;
+
+  streaming_fusion_reader(merged_reader_t merged, streaming_fusion<fusion_t> fusion)
+      : merged_(std::move(merged)), fusion_(std::move(fusion)) {}
+
+  streaming_fusion_reader(const streaming_fusion_reader &) = delete;
+  auto operator=(const streaming_fusion_reader &) -> streaming_fusion_reader & = delete;
+  streaming_fusion_reader(streaming_fusion_reader &&) noexcept = default;
+  auto operator=(streaming_fusion_reader &&) noexcept -> streaming_fusion_reader & = default;
+  ~streaming_fusion_reader() = default;
+
+  /// Reads until the next fused result is due.
+  [[nodiscard]] auto read_impl() -> status_type {
+    if (closed_ || fusion_.done()) {
+      return finish_stream();
+    }
+    fusion_.arm(clock::now());
+    clock::duration backoff = min_poll_backoff;
+    while (true) {
+      const auto now = clock::now();
+      if (fusion_.ready(now)) {
+        return emit();
+      }
+      if (fusion_.awaiting_deadline(now)) {
+        auto next = merged_.try_read();
+        if (std::holds_alternative<wh::schema::stream::stream_signal>(next)) {
+          std::this_thread::sleep_until(std::min(now + backoff, *fusion_.deadline_at()));
+          backoff = std::min<clock::duration>(backoff * 2, max_poll_backoff);
+          continue;
+        }
+        backoff = min_poll_backoff;
+        if (auto failed = consume(std::move(std::get<input_status_t>(next)));
+            failed.has_value()) {
+          return status_type::failure(*failed);
+        }
+        continue;
+      }
+      if (auto failed = consume(merged_.read()); failed.has_value()) {
+        return status_type::failure(*failed);
+      }
+    }
+  }
+
+  /// Consumes every document available now and returns a fused result when
+  /// one is due, otherwise pending.
+  [[nodiscard]] auto try_read_impl() -> wh::schema::stream::stream_try_result<chunk_type> {
+    if (closed_ || fusion_.done()) {
+      return finish_stream();
+    }
+    fusion_.arm(clock::now());
+    while (!fusion_.ready(clock::now())) {
+      auto next = merged_.try_read();
+      if (std::holds_alternative<wh::schema::stream::stream_signal>(next)) {
+        return wh::schema::stream::stream_pending;
+      }
+      if (auto failed = consume(std::move(std::get<input_status_t>(next))); failed.has_value()) {
+        return status_type::failure(*failed);
+      }
+    }
+    return emit();
+  }
+
+  /// Closes every route stream.
+  auto close_impl() -> wh::core::result<void> {
+    if (closed_) {
+      return {};
+    }
+    closed_ = true;
+    return merged_.close();
+  }
+
+  [[nodiscard]] auto is_closed_impl() const noexcept -> bool { return closed_; }
+
+  /// Returns the fusion state for inspection.
+  [[nodiscard]] auto fusion() const noexcept -> const streaming_fusion<fusion_t> & {
+    return fusion_;
+  }
+
+private:
+  using clock = std::chrono::steady_clock;
+
+  /// First and largest sleep between empty polls while a deadline is armed.
+  static constexpr clock::duration min_poll_backoff = std::chrono::microseconds{20};
+  static constexpr clock::duration max_poll_backoff = std::chrono::milliseconds{2};
+
+  [[nodiscard]] auto consume(input_status_t status) -> std::optional<wh::core::error_code> {
+    if (status.has_error()) {
+      return status.error();
+    }
+    auto &chunk = status.value();
+    if (chunk.error.failed()) {
+      return chunk.error;
+    }
+    if (chunk.value.has_value()) {
+      fusion_.offer(chunk.source.view(), std::move(*chunk.value));
+    } else if (chunk.is_source_eof()) {
+      fusion_.finish(chunk.source.view());
+    } else if (chunk.is_terminal_eof()) {
+      fusion_.finish_all();
+    }
+    return std::nullopt;
+  }
+
+  [[nodiscard]] auto emit() -> status_type {
+    auto emitted = fusion_.emit();
+    if (emitted.has_error()) {
+      return status_type::failure(emitted.error());
+    }
+    if (fusion_.done()) {
+      // Late documents are no longer wanted; release slow routes now.
+      static_cast<void>(merged_.close());
+    }
+    return chunk_type::make_value(std::move(emitted).value());
+  }
+
+  [[nodiscard]] auto finish_stream() -> status_type {
+    if (!closed_) {
+      static_cast<void>(close_impl());
+    }
+    return chunk_type::make_eof();
+  }
+
+  merged_reader_t merged_;
+  streaming_fusion<fusion_t> fusion_;
+  bool closed_{false};
+};
+
+/// Merges `routes` and fuses their documents under `options`.
+template <wh::schema::stream::stream_reader reader_t,
+          detail::router::fusion_policy fusion_t = detail::router::reciprocal_rank_fusion>
+  requires std::same_as<typename reader_t::value_type, wh::schema::document>
+[[nodiscard]] inline auto
+make_streaming_fusion_reader(std::vector<wh::schema::stream::named_stream_reader<reader_t>> routes,
+                             const streaming_fusion_options &options, fusion_t fusion = {})
+    -> streaming_fusion_reader<reader_t, fusion_t> {
+  std::vector<std::string> names{};
+  names.reserve(routes.size());
+  for (const auto &route : routes) {
+    names.push_back(route.source);
+  }
+  return streaming_fusion_reader<reader_t, fusion_t>{
+      wh::schema::stream::make_merge_stream_reader(std::move(routes)),
+      streaming_fusion<fusion_t>{std::move(names), options, std::move(fusion)}};
+}
+
+} // namespace wh::flow::retrieval
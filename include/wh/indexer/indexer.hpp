@@ -14,6 +14,7 @@
 #include "wh/callbacks/callbacks.hpp"
 #include "wh/core/compiler.hpp"
 #include "wh/core/component/types.hpp"
+#include "wh/core/metrics/hooks.hpp"
 #include "wh/core/result.hpp"
 #include "wh/core/run_context.hpp"
 #include "wh/core/stdexec/component_async_entry.hpp"
@@ -209,25 +210,38 @@ template <typename impl_t, typename request_t>
       });
 }
 
+template <typename impl_t>
+[[nodiscard]] inline auto describe_impl(const impl_t &impl) -> wh::core::component_descriptor {
+  if constexpr (requires {
+                  { impl.descriptor() } -> std::same_as<wh::core::component_descriptor>;
+                }) {
+    return impl.descriptor();
+  } else {
+    return wh::core::component_descriptor{"Indexer", wh::core::component_kind::indexer};
+  }
+}
+
 template <wh::core::resume_mode Resume, typename impl_t, typename request_t, typename scheduler_t>
-[[nodiscard]] inline auto make_async_sender(const impl_t &impl, request_t &&request,
-                                            callback_sink sink, scheduler_t scheduler) {
+[[nodiscard]] inline auto make_async_sender(const impl_t &impl,
+                                            const wh::core::component_call_metrics metrics,
+                                            request_t &&request, callback_sink sink,
+                                            scheduler_t scheduler) {
   return wh::core::detail::component_async_entry<Resume>(
-      std::forward<request_t>(request), std::move(sink), std::move(scheduler),
+      std::forward<request_t>(request), std::move(sink), std::move(scheduler), metrics,
       [&impl](auto &&forwarded_request) {
         return make_impl_sender(impl, std::forward<decltype(forwarded_request)>(forwarded_request));
       },
       [](const indexer_request &state_request) { return make_callback_state(state_request); },
       [](const callback_sink &start_sink, const indexer_callback_state &state) {
-        emit_callback(start_sink, wh::callbacks::stage::start, state);
+        wh::callbacks::emit_bound(start_sink, wh::callbacks::stage::start, state);
       },
       [](const callback_sink &success_sink, indexer_callback_state &state, indexer_result &status) {
         state.event.success_count = status.value().success_count;
         state.event.failure_count = status.value().failure_count;
-        emit_callback(success_sink, wh::callbacks::stage::end, state);
+        wh::callbacks::emit_bound(success_sink, wh::callbacks::stage::end, state);
       },
       [](const callback_sink &error_sink, indexer_callback_state &state, indexer_result &) {
-        emit_callback(error_sink, wh::callbacks::stage::error, state);
+        wh::callbacks::emit_bound(error_sink, wh::callbacks::stage::error, state);
       });
 }
 
@@ -255,7 +269,7 @@ public:
 
   /// Returns static descriptor metadata for this component.
   [[nodiscard]] auto descriptor() const -> wh::core::component_descriptor {
-    return wh::core::component_descriptor{"Indexer", wh::core::component_kind::indexer};
+    return detail::describe_impl(impl_);
   }
 
   /// Writes documents synchronously and emits callbacks through the run
@@ -300,17 +314,21 @@ private:
   [[nodiscard]] auto write_sync_impl(request_t &&request, detail::callback_sink sink) const
       -> detail::indexer_result {
     sink = wh::callbacks::filter_callback_sink(std::move(sink), request.options);
-    auto callback_state = detail::make_callback_state(request);
+    auto callback_state = wh::callbacks::make_lazy_callback_state(
+        sink, [&request] { return detail::make_callback_state(request); });
     detail::emit_callback(sink, wh::callbacks::stage::start, callback_state);
 
     auto output = detail::run_sync_indexer_impl(impl_, std::forward<request_t>(request));
+    metrics_.record(output.has_error());
     if (output.has_error()) {
       detail::emit_callback(sink, wh::callbacks::stage::error, callback_state);
       return output;
     }
 
-    callback_state.event.success_count = output.value().success_count;
-    callback_state.event.failure_count = output.value().failure_count;
+    if (callback_state.has_value()) {
+      callback_state->event.success_count = output.value().success_count;
+      callback_state->event.failure_count = output.value().failure_count;
+    }
     detail::emit_callback(sink, wh::callbacks::stage::end, callback_state);
     return output;
   }
@@ -323,13 +341,16 @@ private:
     return wh::core::detail::defer_resume_sender<Resume>(
         [this, request = indexer_request{std::forward<request_t>(request)},
          sink = std::move(sink)](auto scheduler) mutable {
-          return detail::make_async_sender<Resume>(impl_, std::move(request), std::move(sink),
-                                                   std::move(scheduler));
+          return detail::make_async_sender<Resume>(impl_, metrics_, std::move(request),
+                                                   std::move(sink), std::move(scheduler));
         });
   }
 
   /// Stored indexer implementation object.
   wh_no_unique_address impl_t impl_;
+  /// Call counters of `descriptor()`, resolved once per instance.
+  wh::core::component_call_metrics metrics_{
+      wh::core::component_call_metrics_for(detail::describe_impl(impl_))};
 };
 
 template <typename impl_t> indexer(impl_t &&) -> indexer<std::remove_cvref_t<impl_t>>;
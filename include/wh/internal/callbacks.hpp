@@ -7,6 +7,7 @@
 #include <atomic>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <ranges>
@@ -42,6 +43,8 @@ public:
   /// Number of callback stages in `callback_stage`.
   static constexpr std::size_t stage_count =
       static_cast<std::size_t>(wh::core::callback_stage::stream_end) + 1U;
+  /// One bit per `callback_stage`, set when that stage has any registration.
+  using stage_mask = std::uint32_t;
   /// Compact registration container for one stage bucket.
   using registration_list = wh::core::small_vector<stage_registration, 4U>;
   /// Immutable stage registration snapshot shared across dispatchers.
@@ -113,15 +116,50 @@ public:
 #endif
   };
 
+  /// Copyable atomic stage mask published alongside global snapshots.
+  class stage_mask_slot {
+  public:
+    stage_mask_slot() = default;
+
+    stage_mask_slot(const stage_mask_slot &other) noexcept
+        : mask_(other.load(std::memory_order_acquire)) {}
+
+    auto operator=(const stage_mask_slot &other) noexcept -> stage_mask_slot & {
+      mask_.store(other.load(std::memory_order_acquire), std::memory_order_release);
+      return *this;
+    }
+
+    stage_mask_slot(stage_mask_slot &&other) noexcept
+        : mask_(other.load(std::memory_order_acquire)) {}
+
+    auto operator=(stage_mask_slot &&other) noexcept -> stage_mask_slot & {
+      mask_.store(other.load(std::memory_order_acquire), std::memory_order_release);
+      return *this;
+    }
+
+    auto set(const stage_mask bits) noexcept -> void {
+      mask_.fetch_or(bits, std::memory_order_release);
+    }
+
+    [[nodiscard]] auto load(const std::memory_order order) const noexcept -> stage_mask {
+      return mask_.load(order);
+    }
+
+  private:
+    std::atomic<stage_mask> mask_{0U};
+  };
+
   /// Global stage buckets published with snapshot semantics.
   using global_registration_buckets = std::array<registration_snapshot_slot, stage_count>;
-  /// Local stage buckets owned by current manager.
-  using local_registration_buckets = std::array<registration_list, stage_count>;
+  /// Local stage buckets owned by current manager; each registration replaces
+  /// the bucket snapshot so buffered replays can keep the old one alive.
+  using local_registration_buckets = std::array<shared_registration_list, stage_count>;
 
   callback_manager() {
     for (auto &registrations : global_registrations_) {
       registrations.store(std::make_shared<registration_list>(), std::memory_order_relaxed);
     }
+    local_registrations_.fill(empty_registrations());
   }
 
   callback_manager(const callback_manager &) = default;
@@ -151,6 +189,7 @@ public:
       registration.config = stable_config;
       registration.callback = make_stage_callback(*stage_callback);
       append_registration(global_registrations_[stage_index(stage)], std::move(registration));
+      global_stage_mask_.set(stage_bit(stage));
     });
   }
 
@@ -175,7 +214,11 @@ public:
       stage_registration registration{};
       registration.config = stable_config;
       registration.callback = make_stage_callback(*stage_callback);
-      local_registrations_[stage_index(stage)].push_back(std::move(registration));
+      auto &bucket = local_registrations_[stage_index(stage)];
+      auto next_registrations = std::make_shared<registration_list>(*bucket);
+      next_registrations->push_back(std::move(registration));
+      bucket = std::move(next_registrations);
+      local_stage_mask_ |= stage_bit(stage);
     });
   }
 
@@ -223,31 +266,32 @@ public:
   /// Dispatches one callback event through global/local registration pipelines.
   auto dispatch(const wh::core::callback_stage stage, const wh::core::callback_event_view event,
                 const wh::core::callback_run_info &run_info) const -> void {
+    if (!has_stage(stage)) {
+      return;
+    }
     const std::size_t current_stage_index = stage_index(stage);
-    const auto global_registrations = load_snapshot(global_registrations_[current_stage_index]);
-
-    auto execute_registrations = [&](const registration_list &registrations,
-                                     const bool reverse_order) -> void {
-      if (reverse_order) {
-        for (auto iter = registrations.rbegin(); iter != registrations.rend(); ++iter) {
-          iter->callback(stage, event, run_info);
-        }
+    auto global_registrations = load_snapshot(global_registrations_[current_stage_index]);
+    const auto &local_registrations = local_registrations_[current_stage_index];
+    if (sampler_ != nullptr) {
+      switch (sampler_->route(stage)) {
+      case wh::core::callback_sampling_route::dispatch:
+        break;
+      case wh::core::callback_sampling_route::drop:
+        return;
+      case wh::core::callback_sampling_route::buffer:
+        // Replays must reach the registrations visible now, even after this
+        // manager copy is gone; both buckets are shared snapshots, not copies.
+        sampler_->buffer(stage, event, run_info,
+                         [global = std::move(global_registrations), local = local_registrations](
+                             const wh::core::callback_stage replay_stage,
+                             const wh::core::callback_event_view replay_event,
+                             const wh::core::callback_run_info &replay_info) -> void {
+                           execute_stage(replay_stage, replay_event, replay_info, *global, *local);
+                         });
         return;
       }
-
-      for (const auto &entry : registrations) {
-        entry.callback(stage, event, run_info);
-      }
-    };
-
-    if (wh::core::is_reverse_callback_stage(stage)) {
-      execute_registrations(local_registrations_[current_stage_index], true);
-      execute_registrations(*global_registrations, true);
-      return;
     }
-
-    execute_registrations(*global_registrations, false);
-    execute_registrations(local_registrations_[current_stage_index], false);
+    execute_stage(stage, event, run_info, *global_registrations, *local_registrations);
   }
 
   /// Dispatches one owning payload to a single callback.
@@ -292,6 +336,58 @@ public:
                            run_info, std::forward<callback_t>(callback));
   }
 
+  /// Returns the mask bit of one stage.
+  [[nodiscard]] static constexpr auto stage_bit(const wh::core::callback_stage stage) noexcept
+      -> stage_mask {
+    return stage_mask{1U} << static_cast<std::size_t>(stage);
+  }
+
+  /// Returns the stages that have at least one global or local registration.
+  [[nodiscard]] auto registered_stages() const noexcept -> stage_mask {
+    return local_stage_mask_ | global_stage_mask_.load(std::memory_order_acquire);
+  }
+
+  /// Returns true when `stage` has any registration; costs one mask load.
+  [[nodiscard]] auto has_stage(const wh::core::callback_stage stage) const noexcept -> bool {
+    return (registered_stages() & stage_bit(stage)) != 0U;
+  }
+
+  /// Returns true when no stage has any registration.
+  [[nodiscard]] auto empty() const noexcept -> bool { return registered_stages() == 0U; }
+
+  /// Returns the registered stages whose events this run still dispatches or
+  /// buffers under its sampling decision.
+  [[nodiscard]] auto dispatched_stages() const noexcept -> stage_mask {
+    const auto registered = registered_stages();
+    if (sampler_ == nullptr ||
+        sampler_->decision() != wh::core::callback_sampling_decision::dropped) {
+      return registered;
+    }
+    return sampler_->options().always_trace_errors
+               ? registered & stage_bit(wh::core::callback_stage::error)
+               : stage_mask{0U};
+  }
+
+  /// Installs the run's sampling state; copies of this manager share it.
+  /// `sampler_` is a plain member, so a manager (and the run_context holding
+  /// it) must not be shared by concurrent invokes that sample callbacks.
+  auto set_sampler(std::shared_ptr<wh::core::callback_trace_sampler> sampler) noexcept -> void {
+    sampler_ = std::move(sampler);
+  }
+
+  /// Returns the run's sampling state, or null when every event is dispatched.
+  [[nodiscard]] auto sampler() const noexcept
+      -> const std::shared_ptr<wh::core::callback_trace_sampler> & {
+    return sampler_;
+  }
+
+  /// Ends the sampled run, replays kept tail events and detaches the sampler;
+  /// returns the number of replayed events.
+  auto finish_sampled_run(const bool run_failed) -> std::size_t {
+    const auto sampler = std::exchange(sampler_, nullptr);
+    return sampler == nullptr ? 0U : sampler->finish(run_failed);
+  }
+
   /// Returns current global registration count.
   [[nodiscard]] auto global_registration_count() const noexcept -> std::size_t {
     std::size_t count = 0U;
@@ -307,8 +403,8 @@ public:
   [[nodiscard]] auto local_registration_count() const noexcept -> std::size_t {
     std::size_t count = 0U;
     std::ranges::for_each(local_registrations_,
-                          [&count](const registration_list &registrations) -> void {
-                            count += registrations.size();
+                          [&count](const shared_registration_list &registrations) -> void {
+                            count += registrations->size();
                           });
     return count;
   }
@@ -325,11 +421,47 @@ private:
     return static_cast<std::size_t>(stage);
   }
 
+  /// Runs one stage through global and local registrations in stage order.
+  static auto execute_stage(const wh::core::callback_stage stage,
+                            const wh::core::callback_event_view event,
+                            const wh::core::callback_run_info &run_info,
+                            const registration_list &global_registrations,
+                            const registration_list &local_registrations) -> void {
+    auto execute_registrations = [&](const registration_list &registrations,
+                                     const bool reverse_order) -> void {
+      if (reverse_order) {
+        for (auto iter = registrations.rbegin(); iter != registrations.rend(); ++iter) {
+          iter->callback(stage, event, run_info);
+        }
+        return;
+      }
+
+      for (const auto &entry : registrations) {
+        entry.callback(stage, event, run_info);
+      }
+    };
+
+    if (wh::core::is_reverse_callback_stage(stage)) {
+      execute_registrations(local_registrations, true);
+      execute_registrations(global_registrations, true);
+      return;
+    }
+
+    execute_registrations(global_registrations, false);
+    execute_registrations(local_registrations, false);
+  }
+
   [[nodiscard]] static auto make_stage_callback(const wh::core::stage_view_callback &callback)
       -> wh::core::stage_view_callback {
     return callback;
   }
 
+  /// Returns the empty snapshot every fresh local bucket starts from.
+  [[nodiscard]] static auto empty_registrations() -> const shared_registration_list & {
+    static const shared_registration_list empty = std::make_shared<const registration_list>();
+    return empty;
+  }
+
   [[nodiscard]] static auto load_snapshot(const registration_snapshot_slot &slot)
       -> shared_registration_list {
     return slot.load(std::memory_order_acquire);
@@ -384,6 +516,12 @@ private:
   global_registration_buckets global_registrations_{};
   /// Local stage buckets registered for the current manager scope.
   local_registration_buckets local_registrations_{};
+  /// Stages with global registrations; bits are only ever added.
+  stage_mask_slot global_stage_mask_{};
+  /// Stages with local registrations.
+  stage_mask local_stage_mask_{0U};
+  /// Run-wide sampling state shared with every copy of this manager.
+  std::shared_ptr<wh::core::callback_trace_sampler> sampler_{};
 };
 
 /// Builds registration config from timing checker and optional debug name.
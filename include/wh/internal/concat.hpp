@@ -21,6 +21,10 @@ using dynamic_stream_chunk = dynamic_reduce_value;
 using dynamic_stream_chunks = dynamic_reduce_values;
 /// Runtime concat function signature for dynamic chunks.
 using dynamic_stream_concat_function = dynamic_reduce_function;
+/// Mutable span over type-erased stream chunks the concat may move from.
+using dynamic_owned_stream_chunks = dynamic_reduce_owned_values;
+/// Incremental concat fold returned by `stream_concat_registry::begin_concat`.
+using dynamic_stream_concat_accumulator = dynamic_reduce_accumulator;
 
 namespace detail {
 
@@ -65,6 +69,21 @@ public:
     return core_.template register_reducer<value_t>(std::forward<function_t>(function_value));
   }
 
+  /// Registers ownership-taking typed concat function plus const and dynamic bridges.
+  template <typename value_t, typename function_t>
+  auto register_owned_concat(function_t &&function_value) -> wh::core::result<void> {
+    return core_.template register_owned_reducer<value_t>(
+        std::forward<function_t>(function_value));
+  }
+
+  /// Registers incremental append/finish steps used to fold chunks as they arrive.
+  template <typename value_t, typename append_t, typename finish_t = std::nullptr_t>
+  auto register_concat_accumulator(append_t &&append, finish_t &&finish = nullptr)
+      -> wh::core::result<void> {
+    return core_.template register_accumulator<value_t>(std::forward<append_t>(append),
+                                                        std::forward<finish_t>(finish));
+  }
+
   /// Registers pointer-based typed concat function and dynamic bridge.
   template <typename value_t, typename function_t>
   auto register_concat_from_ptrs(function_t &&function_value) -> wh::core::result<void> {
@@ -90,6 +109,10 @@ public:
       return (*function)(values);
     }
 
+    if (core_.find_accumulator(type) != nullptr) {
+      return core_.reduce(type, values);
+    }
+
     if (values.size() == 1U) {
       if (values.front().key() != type) {
         return wh::core::result<dynamic_stream_chunk>::failure(wh::core::errc::type_mismatch);
@@ -100,6 +123,38 @@ public:
     return wh::core::result<dynamic_stream_chunk>::failure(wh::core::errc::not_supported);
   }
 
+  /// Begins one incremental concat for chunks of `type`.
+  [[nodiscard]] auto begin_concat(const wh::core::any_type_key type) const
+      -> wh::core::result<dynamic_stream_concat_accumulator> {
+    return core_.begin(type);
+  }
+
+  /// Concatenates type-erased chunks by runtime type key, moving out of `values`.
+  [[nodiscard]] auto concat_owned(const wh::core::any_type_key type,
+                                  const dynamic_owned_stream_chunks values) const
+      -> wh::core::result<dynamic_stream_chunk> {
+    if (values.empty()) {
+      return wh::core::result<dynamic_stream_chunk>::failure(wh::core::errc::invalid_argument);
+    }
+
+    if (const auto *function = core_.find_owned(type); function != nullptr) {
+      return (*function)(values);
+    }
+
+    if (core_.find_accumulator(type) != nullptr) {
+      return core_.reduce_owned(type, values);
+    }
+
+    if (values.size() == 1U) {
+      if (values.front().key() != type) {
+        return wh::core::result<dynamic_stream_chunk>::failure(wh::core::errc::type_mismatch);
+      }
+      return std::move(values.front());
+    }
+
+    return wh::core::result<dynamic_stream_chunk>::failure(wh::core::errc::not_supported);
+  }
+
   /// Concatenates typed chunks using ADL, registered, or single-value fallback.
   template <typename value_t>
   [[nodiscard]] auto concat_as(const std::span<const value_t> values) const
@@ -124,6 +179,35 @@ public:
     return wh::core::result<value_t>::failure(wh::core::errc::not_supported);
   }
 
+  /// Concatenates typed chunks by move; ADL and const-only reducers see the originals.
+  template <typename value_t>
+  [[nodiscard]] auto concat_owned_as(const std::span<value_t> values) const
+      -> wh::core::result<value_t> {
+    if (values.empty()) {
+      return wh::core::result<value_t>::failure(wh::core::errc::invalid_argument);
+    }
+
+    if constexpr (detail::adl_stream_concat_available<value_t>) {
+      return detail::static_stream_concat(std::span<const value_t>{values.data(), values.size()});
+    }
+
+    if (const auto *owned_function = core_.template find_typed_owned<value_t>();
+        owned_function != nullptr) {
+      return (*owned_function)(values);
+    }
+
+    if (const auto *typed_function = core_.template find_typed<value_t>();
+        typed_function != nullptr) {
+      return (*typed_function)(std::span<const value_t>{values.data(), values.size()});
+    }
+
+    if (values.size() == 1U) {
+      return std::move(values.front());
+    }
+
+    return wh::core::result<value_t>::failure(wh::core::errc::not_supported);
+  }
+
   /// Number of registered runtime concat handlers.
   [[nodiscard]] auto size() const noexcept -> std::size_t { return core_.size(); }
 
@@ -21,6 +21,10 @@ using dynamic_merge_value = dynamic_reduce_value;
 using dynamic_merge_values = dynamic_reduce_values;
 /// Runtime merge function signature for dynamic values.
 using dynamic_values_merge_function = dynamic_reduce_function;
+/// Mutable span over type-erased merge inputs the merge may move from.
+using dynamic_owned_merge_values = dynamic_reduce_owned_values;
+/// Incremental merge fold returned by `values_merge_registry::begin_merge`.
+using dynamic_merge_accumulator = dynamic_reduce_accumulator;
 
 namespace detail {
 
@@ -65,6 +69,21 @@ public:
     return core_.template register_reducer<value_t>(std::forward<function_t>(function_value));
   }
 
+  /// Registers ownership-taking typed merge function plus const and dynamic bridges.
+  template <typename value_t, typename function_t>
+  auto register_owned_merge(function_t &&function_value) -> wh::core::result<void> {
+    return core_.template register_owned_reducer<value_t>(
+        std::forward<function_t>(function_value));
+  }
+
+  /// Registers incremental append/finish steps used to merge values as they arrive.
+  template <typename value_t, typename append_t, typename finish_t = std::nullptr_t>
+  auto register_merge_accumulator(append_t &&append, finish_t &&finish = nullptr)
+      -> wh::core::result<void> {
+    return core_.template register_accumulator<value_t>(std::forward<append_t>(append),
+                                                        std::forward<finish_t>(finish));
+  }
+
   /// Registers pointer-based typed merge function and dynamic bridge.
   template <typename value_t, typename function_t>
   auto register_merge_from_ptrs(function_t &&function_value) -> wh::core::result<void> {
@@ -85,6 +104,19 @@ public:
     return core_.reduce(type, values);
   }
 
+  /// Begins one incremental merge for `type`.
+  [[nodiscard]] auto begin_merge(const wh::core::any_type_key type) const
+      -> wh::core::result<dynamic_merge_accumulator> {
+    return core_.begin(type);
+  }
+
+  /// Merges type-erased values by runtime type key, moving out of `values`.
+  [[nodiscard]] auto merge_owned(const wh::core::any_type_key type,
+                                 const dynamic_owned_merge_values values) const
+      -> wh::core::result<dynamic_merge_value> {
+    return core_.reduce_owned(type, values);
+  }
+
   /// Merges typed values with registered or built-in fallback strategies.
   template <typename value_t>
   [[nodiscard]] auto merge_as(const std::span<const value_t> values) const
@@ -105,6 +137,31 @@ public:
     return wh::core::result<value_t>::failure(wh::core::errc::not_supported);
   }
 
+  /// Merges typed values by move; const-only reducers still see the originals.
+  template <typename value_t>
+  [[nodiscard]] auto merge_owned_as(const std::span<value_t> values) const
+      -> wh::core::result<value_t> {
+    if (values.empty()) {
+      return wh::core::result<value_t>::failure(wh::core::errc::invalid_argument);
+    }
+
+    if (const auto *owned_function = core_.template find_typed_owned<value_t>();
+        owned_function != nullptr) {
+      return (*owned_function)(values);
+    }
+
+    if (const auto *typed_function = core_.template find_typed<value_t>();
+        typed_function != nullptr) {
+      return (*typed_function)(std::span<const value_t>{values.data(), values.size()});
+    }
+
+    if (values.size() == 1U) {
+      return std::move(values.front());
+    }
+
+    return wh::core::result<value_t>::failure(wh::core::errc::not_supported);
+  }
+
   /// Number of registered runtime merge handlers.
   [[nodiscard]] auto size() const noexcept -> std::size_t { return core_.size(); }
 
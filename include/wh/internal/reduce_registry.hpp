@@ -3,10 +3,13 @@
 #pragma once
 
 #include <cstddef>
+#include <iterator>
 #include <span>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "wh/core/any.hpp"
 #include "wh/core/error.hpp"
@@ -24,6 +27,169 @@ using dynamic_reduce_values = std::span<const dynamic_reduce_value>;
 /// Runtime reducer function signature for type-erased inputs.
 using dynamic_reduce_function =
     wh::core::function<wh::core::result<dynamic_reduce_value>(dynamic_reduce_values) const>;
+/// Mutable span over type-erased reducer inputs the reducer may move from.
+using dynamic_reduce_owned_values = std::span<dynamic_reduce_value>;
+/// Runtime reducer function signature that takes ownership of its inputs.
+using dynamic_reduce_owned_function =
+    wh::core::function<wh::core::result<dynamic_reduce_value>(dynamic_reduce_owned_values) const>;
+
+/// Type-erased append step that folds one chunk into the running value.
+using dynamic_accumulate_function = wh::core::function<wh::core::result<void>(
+    dynamic_reduce_value &, dynamic_reduce_value &&) const>;
+/// Type-erased finish step run once on the running value.
+using dynamic_accumulate_finish_function =
+    wh::core::function<wh::core::result<void>(dynamic_reduce_value &) const>;
+
+/// Registered append/finish pair for one runtime type.
+struct dynamic_accumulate_entry {
+  /// Folds one later chunk into the running value.
+  dynamic_accumulate_function append{nullptr};
+  /// Optional normalization applied before the running value is returned.
+  dynamic_accumulate_finish_function finish{nullptr};
+};
+
+/// Built-in accumulator step that appends one string chunk.
+struct string_accumulate {
+  auto operator()(std::string &target, std::string &&next) const -> wh::core::result<void> {
+    target.append(next);
+    return {};
+  }
+};
+
+/// Built-in accumulator step that moves one vector chunk's elements to the back.
+struct vector_accumulate {
+  template <typename element_t>
+  auto operator()(std::vector<element_t> &target, std::vector<element_t> &&next) const
+      -> wh::core::result<void> {
+    target.insert(target.end(), std::make_move_iterator(next.begin()),
+                  std::make_move_iterator(next.end()));
+    return {};
+  }
+};
+
+/// Incremental begin/append/finish fold over values of one runtime type.
+///
+/// With a registered append step the first chunk becomes the running value
+/// and later chunks fold into it as they arrive, so callers never buffer the
+/// whole input. Reducer-only types buffer chunks and reduce them once in
+/// `finish()`; their `partial()` stays empty. The accumulator borrows its
+/// handlers from the registry that began it, which must outlive it. After a
+/// failed append the running value is unspecified and the accumulator should
+/// be discarded.
+class dynamic_reduce_accumulator {
+public:
+  dynamic_reduce_accumulator() = default;
+
+  dynamic_reduce_accumulator(const wh::core::any_type_key type,
+                             const dynamic_accumulate_entry *entry) noexcept
+      : type_(type), entry_(entry) {}
+
+  dynamic_reduce_accumulator(const wh::core::any_type_key type,
+                             const dynamic_reduce_owned_function *reduce) noexcept
+      : type_(type), reduce_(reduce) {}
+
+  /// Folds one chunk into the running value.
+  auto append(dynamic_reduce_value value) -> wh::core::result<void> {
+    if (entry_ == nullptr && reduce_ == nullptr) {
+      return wh::core::result<void>::failure(wh::core::errc::contract_violation);
+    }
+    if (value.key() != type_) {
+      return wh::core::result<void>::failure(wh::core::errc::type_mismatch);
+    }
+    if (entry_ == nullptr) {
+      // Pairwise reduction would re-copy the running value per chunk, so
+      // reducer-only types are reduced once over every chunk in `finish()`.
+      pending_.push_back(std::move(value));
+    } else if (count_ == 0U) {
+      running_ = std::move(value);
+    } else {
+      auto appended = entry_->append(running_, std::move(value));
+      if (appended.has_error()) {
+        return appended;
+      }
+    }
+    ++count_;
+    return {};
+  }
+
+  /// Copies one shared chunk and folds the copy into the running value.
+  auto append_copy(const dynamic_reduce_value &value) -> wh::core::result<void> {
+    return append(dynamic_reduce_value{value});
+  }
+
+  /// Running partial value; empty until the first chunk arrives and always
+  /// empty for reducer-only types.
+  [[nodiscard]] auto partial() const noexcept -> const dynamic_reduce_value & { return running_; }
+
+  /// Typed view of the running partial value, or null before the first chunk.
+  template <typename value_t> [[nodiscard]] auto partial_as() const noexcept -> const value_t * {
+    return wh::core::any_cast<value_t>(&running_);
+  }
+
+  /// Finishes the fold and returns the combined value.
+  [[nodiscard]] auto finish() -> wh::core::result<dynamic_reduce_value> {
+    if (count_ == 0U) {
+      return wh::core::result<dynamic_reduce_value>::failure(wh::core::errc::invalid_argument);
+    }
+    if (entry_ == nullptr) {
+      count_ = 0U;
+      auto reduced = (*reduce_)(dynamic_reduce_owned_values{pending_});
+      pending_.clear();
+      return reduced;
+    }
+    if (static_cast<bool>(entry_->finish)) {
+      auto finished = entry_->finish(running_);
+      if (finished.has_error()) {
+        return wh::core::result<dynamic_reduce_value>::failure(finished.error());
+      }
+    }
+    count_ = 0U;
+    return std::move(running_);
+  }
+
+  /// Number of chunks folded since the accumulator began.
+  [[nodiscard]] auto count() const noexcept -> std::size_t { return count_; }
+
+  /// Runtime type this accumulator folds.
+  [[nodiscard]] auto type() const noexcept -> wh::core::any_type_key { return type_; }
+
+private:
+  wh::core::any_type_key type_{};
+  const dynamic_accumulate_entry *entry_{nullptr};
+  const dynamic_reduce_owned_function *reduce_{nullptr};
+  dynamic_reduce_value running_{};
+  std::vector<dynamic_reduce_value> pending_{};
+  std::size_t count_{0U};
+};
+
+namespace detail {
+
+/// Moves every typed payload out of `values` into `typed_values`.
+template <typename value_t, typename storage_t>
+[[nodiscard]] auto take_typed_reduce_values(const dynamic_reduce_owned_values values,
+                                            storage_t &typed_values) -> wh::core::result<void> {
+  typed_values.reserve(static_cast<typename storage_t::size_type>(values.size()));
+  for (auto &value : values) {
+    auto *typed = wh::core::any_cast<value_t>(&value);
+    if (typed == nullptr) {
+      return wh::core::result<void>::failure(wh::core::errc::type_mismatch);
+    }
+    typed_values.push_back(std::move(*typed));
+  }
+  return {};
+}
+
+/// Wraps one typed reduce result back into the type-erased result shape.
+template <typename value_t>
+[[nodiscard]] auto erase_reduce_result(wh::core::result<value_t> reduced)
+    -> wh::core::result<dynamic_reduce_value> {
+  if (reduced.has_error()) {
+    return wh::core::result<dynamic_reduce_value>::failure(reduced.error());
+  }
+  return dynamic_reduce_value{std::move(reduced).value()};
+}
+
+} // namespace detail
 
 /// Shared storage and registration logic for typed/type-erased reducers.
 class reduce_registry_core {
@@ -36,12 +202,20 @@ public:
   using typed_ptr_reduce_fn_t =
       wh::core::function<wh::core::result<value_t>(std::span<const value_t *>) const>;
 
+  /// Typed reducer that may move from every element of its input span.
+  template <typename value_t>
+  using typed_owned_reduce_fn_t =
+      wh::core::function<wh::core::result<value_t>(std::span<value_t>) const>;
+
   reduce_registry_core() = default;
 
   /// Reserves dynamic and typed registration tables.
   auto reserve(const std::size_t type_count) -> void {
     dynamic_table_.reserve(type_count);
+    owned_table_.reserve(type_count);
     typed_table_.reserve(type_count);
+    owned_typed_table_.reserve(type_count);
+    accumulate_table_.reserve(type_count);
   }
 
   /// Freezes registry and rejects future registrations.
@@ -67,6 +241,7 @@ public:
     }
 
     auto bridge = typed_reduce_fn_t<value_t>{function};
+    auto owned_bridge = typed_reduce_fn_t<value_t>{function};
     auto [typed_iter, typed_inserted] = typed_table_.emplace(type, std::move(function));
     if (!typed_inserted) {
       return wh::core::result<void>::failure(wh::core::errc::already_exists);
@@ -103,6 +278,79 @@ public:
       return wh::core::result<void>::failure(wh::core::errc::already_exists);
     }
 
+    // Owned inputs are moved into contiguous storage instead of deep-copied.
+    owned_table_.insert_or_assign(
+        type, [bridge = std::move(owned_bridge)](const dynamic_reduce_owned_values values)
+                  -> wh::core::result<dynamic_reduce_value> {
+          wh::core::small_vector<value_t, 8U> typed_values{};
+          auto taken = detail::take_typed_reduce_values<value_t>(values, typed_values);
+          if (taken.has_error()) {
+            return wh::core::result<dynamic_reduce_value>::failure(taken.error());
+          }
+          return detail::erase_reduce_result<value_t>(
+              bridge(std::span<const value_t>{typed_values.data(), typed_values.size()}));
+        });
+    return {};
+  }
+
+  /// Registers one ownership-taking typed reducer plus const and dynamic bridges.
+  ///
+  /// The owned paths hand inputs over by move; the const paths copy inputs
+  /// first because those callers still share them.
+  template <typename value_t, typename function_t>
+  auto register_owned_reducer(function_t &&function_value) -> wh::core::result<void> {
+    auto function = typed_owned_reduce_fn_t<value_t>{std::forward<function_t>(function_value)};
+    if (frozen_) {
+      return wh::core::result<void>::failure(wh::core::errc::contract_violation);
+    }
+    if (!static_cast<bool>(function)) {
+      return wh::core::result<void>::failure(wh::core::errc::invalid_argument);
+    }
+
+    const auto type = wh::core::any_type_key_v<value_t>;
+    if (dynamic_table_.contains(type) || typed_table_.contains(type)) {
+      return wh::core::result<void>::failure(wh::core::errc::already_exists);
+    }
+
+    typed_table_.emplace(
+        type, typed_reduce_fn_t<value_t>{
+                  [function](const std::span<const value_t> values) -> wh::core::result<value_t> {
+                    wh::core::small_vector<value_t, 8U> copied{};
+                    copied.reserve(
+                        static_cast<typename decltype(copied)::size_type>(values.size()));
+                    for (const auto &value : values) {
+                      copied.push_back(value);
+                    }
+                    return function(std::span<value_t>{copied.data(), copied.size()});
+                  }});
+    dynamic_table_.emplace(
+        type, [function](const dynamic_reduce_values values)
+                  -> wh::core::result<dynamic_reduce_value> {
+          wh::core::small_vector<value_t, 8U> copied{};
+          copied.reserve(static_cast<typename decltype(copied)::size_type>(values.size()));
+          for (const auto &value : values) {
+            const auto *typed = wh::core::any_cast<value_t>(&value);
+            if (typed == nullptr) {
+              return wh::core::result<dynamic_reduce_value>::failure(
+                  wh::core::errc::type_mismatch);
+            }
+            copied.push_back(*typed);
+          }
+          return detail::erase_reduce_result<value_t>(
+              function(std::span<value_t>{copied.data(), copied.size()}));
+        });
+    owned_table_.emplace(
+        type, [function](const dynamic_reduce_owned_values values)
+                  -> wh::core::result<dynamic_reduce_value> {
+          wh::core::small_vector<value_t, 8U> typed_values{};
+          auto taken = detail::take_typed_reduce_values<value_t>(values, typed_values);
+          if (taken.has_error()) {
+            return wh::core::result<dynamic_reduce_value>::failure(taken.error());
+          }
+          return detail::erase_reduce_result<value_t>(
+              function(std::span<value_t>{typed_values.data(), typed_values.size()}));
+        });
+    owned_typed_table_.emplace(type, std::move(function));
     return {};
   }
 
@@ -168,9 +416,89 @@ public:
       return wh::core::result<void>::failure(wh::core::errc::already_exists);
     }
 
+    // Pointer reducers never copy, so owned inputs reuse the const bridge.
+    owned_table_.insert_or_assign(
+        type, [bridge = dynamic_table_.at(type)](const dynamic_reduce_owned_values values)
+                  -> wh::core::result<dynamic_reduce_value> {
+          return bridge(dynamic_reduce_values{values.data(), values.size()});
+        });
     return {};
   }
 
+  /// Registers one incremental append step, plus optional finish step, for `value_t`.
+  ///
+  /// Accumulators are independent of reducers; types with only an
+  /// accumulator still reduce whole batches by folding them.
+  template <typename value_t, typename append_t, typename finish_t = std::nullptr_t>
+  auto register_accumulator(append_t &&append_value, finish_t &&finish_value = nullptr)
+      -> wh::core::result<void> {
+    using append_fn_t =
+        wh::core::function<wh::core::result<void>(value_t &, value_t &&) const>;
+    using finish_fn_t = wh::core::function<wh::core::result<void>(value_t &) const>;
+    auto append = append_fn_t{std::forward<append_t>(append_value)};
+    auto finish = finish_fn_t{std::forward<finish_t>(finish_value)};
+    if (frozen_) {
+      return wh::core::result<void>::failure(wh::core::errc::contract_violation);
+    }
+    if (!static_cast<bool>(append)) {
+      return wh::core::result<void>::failure(wh::core::errc::invalid_argument);
+    }
+
+    const auto type = wh::core::any_type_key_v<value_t>;
+    if (accumulate_table_.contains(type)) {
+      return wh::core::result<void>::failure(wh::core::errc::already_exists);
+    }
+
+    dynamic_accumulate_entry entry{
+        .append = [append = std::move(append)](
+                      dynamic_reduce_value &target,
+                      dynamic_reduce_value &&next) -> wh::core::result<void> {
+          auto *typed_target = wh::core::any_cast<value_t>(&target);
+          auto *typed_next = wh::core::any_cast<value_t>(&next);
+          if (typed_target == nullptr || typed_next == nullptr) {
+            return wh::core::result<void>::failure(wh::core::errc::type_mismatch);
+          }
+          return append(*typed_target, std::move(*typed_next));
+        }};
+    if (static_cast<bool>(finish)) {
+      entry.finish = [finish = std::move(finish)](
+                         dynamic_reduce_value &target) -> wh::core::result<void> {
+        auto *typed_target = wh::core::any_cast<value_t>(&target);
+        if (typed_target == nullptr) {
+          return wh::core::result<void>::failure(wh::core::errc::type_mismatch);
+        }
+        return finish(*typed_target);
+      };
+    }
+    accumulate_table_.emplace(type, std::move(entry));
+    return {};
+  }
+
+  /// Looks up one incremental accumulator by runtime type key.
+  [[nodiscard]] auto find_accumulator(const wh::core::any_type_key type) const noexcept
+      -> const dynamic_accumulate_entry * {
+    const auto iter = accumulate_table_.find(type);
+    if (iter == accumulate_table_.end()) {
+      return nullptr;
+    }
+    return &iter->second;
+  }
+
+  /// Begins one incremental fold for `type`.
+  ///
+  /// Uses the registered accumulator when present, otherwise buffers chunks
+  /// and runs the owned reducer once over all of them on `finish()`.
+  [[nodiscard]] auto begin(const wh::core::any_type_key type) const
+      -> wh::core::result<dynamic_reduce_accumulator> {
+    if (const auto *entry = find_accumulator(type); entry != nullptr) {
+      return dynamic_reduce_accumulator{type, entry};
+    }
+    if (const auto *function = find_owned(type); function != nullptr) {
+      return dynamic_reduce_accumulator{type, function};
+    }
+    return wh::core::result<dynamic_reduce_accumulator>::failure(wh::core::errc::not_supported);
+  }
+
   /// Looks up one dynamic reducer by runtime type key.
   [[nodiscard]] auto find_dynamic(const wh::core::any_type_key type) const noexcept
       -> const dynamic_reduce_function * {
@@ -193,6 +521,55 @@ public:
       return (*function)(values);
     }
 
+    if (const auto *entry = find_accumulator(type); entry != nullptr) {
+      dynamic_reduce_accumulator accumulator{type, entry};
+      for (const auto &value : values) {
+        auto appended = accumulator.append_copy(value);
+        if (appended.has_error()) {
+          return wh::core::result<dynamic_reduce_value>::failure(appended.error());
+        }
+      }
+      return accumulator.finish();
+    }
+
+    return wh::core::result<dynamic_reduce_value>::failure(wh::core::errc::not_supported);
+  }
+
+  /// Looks up one ownership-taking dynamic reducer by runtime type key.
+  [[nodiscard]] auto find_owned(const wh::core::any_type_key type) const noexcept
+      -> const dynamic_reduce_owned_function * {
+    const auto iter = owned_table_.find(type);
+    if (iter == owned_table_.end()) {
+      return nullptr;
+    }
+    return &iter->second;
+  }
+
+  /// Runs one dynamic reducer by runtime type key, moving out of `values`.
+  ///
+  /// Inputs are left in a valid but unspecified state on success.
+  [[nodiscard]] auto reduce_owned(const wh::core::any_type_key type,
+                                  const dynamic_reduce_owned_values values) const
+      -> wh::core::result<dynamic_reduce_value> {
+    if (values.empty()) {
+      return wh::core::result<dynamic_reduce_value>::failure(wh::core::errc::invalid_argument);
+    }
+
+    if (const auto *function = find_owned(type); function != nullptr) {
+      return (*function)(values);
+    }
+
+    if (const auto *entry = find_accumulator(type); entry != nullptr) {
+      dynamic_reduce_accumulator accumulator{type, entry};
+      for (auto &value : values) {
+        auto appended = accumulator.append(std::move(value));
+        if (appended.has_error()) {
+          return wh::core::result<dynamic_reduce_value>::failure(appended.error());
+        }
+      }
+      return accumulator.finish();
+    }
+
     return wh::core::result<dynamic_reduce_value>::failure(wh::core::errc::not_supported);
   }
 
@@ -207,14 +584,34 @@ public:
     return wh::core::any_cast<const typed_reduce_fn_t<value_t>>(&iter->second);
   }
 
+  /// Looks up one ownership-taking typed reducer for `value_t`.
+  template <typename value_t>
+  [[nodiscard]] auto find_typed_owned() const noexcept
+      -> const typed_owned_reduce_fn_t<value_t> * {
+    const auto iter = owned_typed_table_.find(wh::core::any_type_key_v<value_t>);
+    if (iter == owned_typed_table_.end()) {
+      return nullptr;
+    }
+
+    return wh::core::any_cast<const typed_owned_reduce_fn_t<value_t>>(&iter->second);
+  }
+
   /// Number of registered reducer handlers.
   [[nodiscard]] auto size() const noexcept -> std::size_t { return dynamic_table_.size(); }
 
 private:
   std::unordered_map<wh::core::any_type_key, dynamic_reduce_function, wh::core::any_type_key_hash>
       dynamic_table_{};
+  std::unordered_map<wh::core::any_type_key, dynamic_reduce_owned_function,
+                     wh::core::any_type_key_hash>
+      owned_table_{};
   std::unordered_map<wh::core::any_type_key, wh::core::any, wh::core::any_type_key_hash>
       typed_table_{};
+  std::unordered_map<wh::core::any_type_key, wh::core::any, wh::core::any_type_key_hash>
+      owned_typed_table_{};
+  std::unordered_map<wh::core::any_type_key, dynamic_accumulate_entry,
+                     wh::core::any_type_key_hash>
+      accumulate_table_{};
   bool frozen_{false};
 };
 
@@ -172,6 +172,29 @@ template <typename type_t>
   return output;
 }
 
+/// Serializes a typed value into arena-owned storage valid for the arena scope.
+template <typename type_t>
+[[nodiscard]] auto to_json(const type_t &input, wh::core::json_arena &arena)
+    -> wh::core::result<wh::core::json_value *> {
+  auto *output = arena.make_value();
+  auto encoded = to_json(input, *output, arena.allocator());
+  if (encoded.has_error()) {
+    return wh::core::result<wh::core::json_value *>::failure(encoded.error());
+  }
+  return output;
+}
+
+/// Serializes a typed value to compact JSON text held in an arena buffer.
+template <typename type_t>
+[[nodiscard]] auto to_json_string(const type_t &input, wh::core::json_arena &arena)
+    -> wh::core::result<std::string_view> {
+  auto encoded = to_json(input, arena);
+  if (encoded.has_error()) {
+    return wh::core::result<std::string_view>::failure(encoded.error());
+  }
+  return wh::core::json_to_string(arena, *encoded.value());
+}
+
 /// Generic serialization dispatcher with built-in codecs and container support.
 template <typename type_t>
 auto to_json(const type_t &input, wh::core::json_value &output, wh::core::json_allocator &allocator)
@@ -18,6 +18,7 @@
 #include "wh/core/component/concepts.hpp"
 #include "wh/core/component/types.hpp"
 #include "wh/core/error.hpp"
+#include "wh/core/metrics/hooks.hpp"
 #include "wh/core/result.hpp"
 #include "wh/core/run_context.hpp"
 #include "wh/core/stdexec/component_async_entry.hpp"
@@ -119,6 +120,15 @@ template <typename impl_t>
 inline auto finish_stream_event(const impl_t &impl, const chat_request &request,
                                 chat_model_callback_event &event) -> void;
 
+struct chat_model_callback_state {
+  wh::callbacks::run_info run_info{};
+  chat_model_callback_event event{};
+};
+
+[[nodiscard]] inline auto make_callback_state(const wh::core::component_descriptor &descriptor,
+                                              const chat_request &request, bool stream_path)
+    -> chat_model_callback_state;
+
 template <typename impl_t>
 [[nodiscard]] inline auto describe_impl(const impl_t &impl) -> wh::core::component_descriptor {
   if constexpr (requires {
@@ -258,31 +268,29 @@ template <wh::core::resume_mode Resume, typename impl_t, typename request_t, typ
   requires async_invoke_handler<impl_t>
 [[nodiscard]] inline auto
 invoke_sender(const impl_t &impl, const wh::core::component_descriptor &descriptor,
-              request_t &&request, callback_sink sink, scheduler_t scheduler) {
-  using callback_state_t = std::pair<wh::callbacks::run_info, chat_model_callback_event>;
+              const wh::core::component_call_metrics metrics, request_t &&request,
+              callback_sink sink, scheduler_t scheduler) {
   return wh::core::detail::component_async_entry<Resume>(
-      std::forward<request_t>(request), std::move(sink), std::move(scheduler),
+      std::forward<request_t>(request), std::move(sink), std::move(scheduler), metrics,
       [&impl](auto &&forwarded_request) {
         return make_invoke_sender(impl,
                                   std::forward<decltype(forwarded_request)>(forwarded_request));
       },
       [&descriptor](const chat_request &state_request) {
-        return callback_state_t{wh::callbacks::apply_component_run_info(make_run_info(descriptor),
-                                                                        state_request.options),
-                                make_callback_event(descriptor, state_request, false)};
+        return make_callback_state(descriptor, state_request, false);
       },
-      [](const callback_sink &start_sink, const callback_state_t &state) {
-        emit_callback(start_sink, wh::callbacks::stage::start, state.second, state.first);
+      [](const callback_sink &start_sink, const chat_model_callback_state &state) {
+        wh::callbacks::emit_bound(start_sink, wh::callbacks::stage::start, state);
       },
-      [](const callback_sink &success_sink, callback_state_t &state, chat_invoke_result &status) {
-        auto &[run_info, event] = state;
-        event.usage = status.value().meta.usage;
-        event.emitted_chunks = 1U;
-        emit_callback(success_sink, wh::callbacks::stage::end, event, run_info);
+      [](const callback_sink &success_sink, chat_model_callback_state &state,
+         chat_invoke_result &status) {
+        state.event.usage = status.value().meta.usage;
+        state.event.emitted_chunks = 1U;
+        wh::callbacks::emit_bound(success_sink, wh::callbacks::stage::end, state);
       },
-      [](const callback_sink &error_sink, callback_state_t &state, chat_invoke_result &) {
-        auto &[run_info, event] = state;
-        emit_callback(error_sink, wh::callbacks::stage::error, event, run_info);
+      [](const callback_sink &error_sink, chat_model_callback_state &state,
+         chat_invoke_result &) {
+        wh::callbacks::emit_bound(error_sink, wh::callbacks::stage::error, state);
       });
 }
 
@@ -290,35 +298,31 @@ template <wh::core::resume_mode Resume, typename impl_t, typename request_t, typ
   requires async_stream_handler<impl_t>
 [[nodiscard]] inline auto
 stream_sender(const impl_t &impl, const wh::core::component_descriptor &descriptor,
-              request_t &&request, callback_sink sink, scheduler_t scheduler) {
+              const wh::core::component_call_metrics metrics, request_t &&request,
+              callback_sink sink, scheduler_t scheduler) {
   sink = wh::callbacks::filter_callback_sink(std::move(sink), request.options);
-  auto state = std::optional<std::pair<wh::callbacks::run_info, chat_model_callback_event>>{};
-  if (sink.has_value()) {
-    state.emplace(
-        wh::callbacks::apply_component_run_info(make_run_info(descriptor), request.options),
-        make_callback_event(descriptor, request, true));
-  }
+  auto state = wh::callbacks::make_lazy_callback_state(
+      sink, [&] { return make_callback_state(descriptor, request, true); });
   return wh::core::detail::defer_result_sender<chat_message_stream_result>(
       [&impl, request = chat_request{std::forward<request_t>(request)}, sink = std::move(sink),
-       state = std::move(state), scheduler = std::move(scheduler)]() mutable {
-        if (state.has_value()) {
-          emit_callback(sink, wh::callbacks::stage::start, state->second, state->first);
-        }
+       state = std::move(state), scheduler = std::move(scheduler), metrics]() mutable {
+        emit_callback(sink, wh::callbacks::stage::start, state);
         auto child_sender =
             wh::core::detail::resume_if<Resume>(make_stream_sender(impl, request),
                                                 std::move(scheduler));
         auto inspector = [&impl, request = std::move(request), sink = std::move(sink),
-                          state = std::move(state)](chat_message_stream_result &status) mutable {
+                          state = std::move(state),
+                          metrics](chat_message_stream_result &status) mutable {
+          metrics.record(status.has_error());
           if (!state.has_value()) {
             return;
           }
-          auto &[run_info, event] = *state;
           if (status.has_error()) {
-            emit_callback(sink, wh::callbacks::stage::error, event, run_info);
+            emit_callback(sink, wh::callbacks::stage::error, state);
             return;
           }
-          finish_stream_event(impl, request, event);
-          emit_callback(sink, wh::callbacks::stage::end, event, run_info);
+          finish_stream_event(impl, request, state->event);
+          emit_callback(sink, wh::callbacks::stage::end, state);
         };
         return wh::core::detail::inspect_result_sender(std::move(child_sender),
                                                        std::move(inspector));
@@ -329,9 +333,10 @@ template <typename impl_t, typename request_t>
   requires async_invoke_handler<impl_t>
 [[nodiscard]] inline auto invoke_sender(const impl_t &impl,
                                         const wh::core::component_descriptor &descriptor,
+                                        const wh::core::component_call_metrics metrics,
                                         request_t &&request, callback_sink sink) {
   return invoke_sender<wh::core::resume_mode::unchanged>(
-      impl, descriptor, std::forward<request_t>(request), std::move(sink),
+      impl, descriptor, metrics, std::forward<request_t>(request), std::move(sink),
       wh::core::detail::resume_passthrough);
 }
 
@@ -339,9 +344,10 @@ template <typename impl_t, typename request_t>
   requires async_stream_handler<impl_t>
 [[nodiscard]] inline auto stream_sender(const impl_t &impl,
                                         const wh::core::component_descriptor &descriptor,
+                                        const wh::core::component_call_metrics metrics,
                                         request_t &&request, callback_sink sink) {
   return stream_sender<wh::core::resume_mode::unchanged>(
-      impl, descriptor, std::forward<request_t>(request), std::move(sink),
+      impl, descriptor, metrics, std::forward<request_t>(request), std::move(sink),
       wh::core::detail::resume_passthrough);
 }
 
@@ -388,6 +394,16 @@ inline auto finish_stream_event([[maybe_unused]] const impl_t &impl,
   return event;
 }
 
+[[nodiscard]] inline auto make_callback_state(const wh::core::component_descriptor &descriptor,
+                                              const chat_request &request, const bool stream_path)
+    -> chat_model_callback_state {
+  return chat_model_callback_state{
+      .run_info =
+          wh::callbacks::apply_component_run_info(make_run_info(descriptor), request.options),
+      .event = make_callback_event(descriptor, request, stream_path),
+  };
+}
+
 } // namespace detail
 
 /// Public interface for `chat_model`.
@@ -507,22 +523,23 @@ private:
              detail::sync_invoke_handler<impl_t>
   [[nodiscard]] auto invoke_sync_impl(request_t &&request, detail::callback_sink sink) const
       -> chat_invoke_result {
-    const auto descriptor = this->descriptor();
     sink = wh::callbacks::filter_callback_sink(std::move(sink), request.options);
-    const auto run_info =
-        wh::callbacks::apply_component_run_info(detail::make_run_info(descriptor), request.options);
-    auto event = detail::make_callback_event(descriptor, request, false);
-    detail::emit_callback(sink, wh::callbacks::stage::start, event, run_info);
+    auto state = wh::callbacks::make_lazy_callback_state(
+        sink, [&] { return detail::make_callback_state(this->descriptor(), request, false); });
+    detail::emit_callback(sink, wh::callbacks::stage::start, state);
 
     auto output = detail::run_sync_invoke_impl(impl_, std::forward<request_t>(request));
+    metrics_.record(output.has_error());
     if (output.has_error()) {
-      detail::emit_callback(sink, wh::callbacks::stage::error, event, run_info);
+      detail::emit_callback(sink, wh::callbacks::stage::error, state);
       return output;
     }
 
-    event.usage = output.value().meta.usage;
-    event.emitted_chunks = 1U;
-    detail::emit_callback(sink, wh::callbacks::stage::end, event, run_info);
+    if (state.has_value()) {
+      state->event.usage = output.value().meta.usage;
+      state->event.emitted_chunks = 1U;
+    }
+    detail::emit_callback(sink, wh::callbacks::stage::end, state);
     return output;
   }
 
@@ -531,21 +548,22 @@ private:
              detail::sync_stream_handler<impl_t>
   [[nodiscard]] auto stream_sync_impl(request_t &&request, detail::callback_sink sink) const
       -> chat_message_stream_result {
-    const auto descriptor = this->descriptor();
     sink = wh::callbacks::filter_callback_sink(std::move(sink), request.options);
-    const auto run_info =
-        wh::callbacks::apply_component_run_info(detail::make_run_info(descriptor), request.options);
-    auto event = detail::make_callback_event(descriptor, request, true);
-    detail::emit_callback(sink, wh::callbacks::stage::start, event, run_info);
+    auto state = wh::callbacks::make_lazy_callback_state(
+        sink, [&] { return detail::make_callback_state(this->descriptor(), request, true); });
+    detail::emit_callback(sink, wh::callbacks::stage::start, state);
 
     auto output = detail::run_sync_stream_impl(impl_, std::forward<request_t>(request));
+    metrics_.record(output.has_error());
     if (output.has_error()) {
-      detail::emit_callback(sink, wh::callbacks::stage::error, event, run_info);
+      detail::emit_callback(sink, wh::callbacks::stage::error, state);
       return output;
     }
 
-    detail::finish_stream_event(impl_, request, event);
-    detail::emit_callback(sink, wh::callbacks::stage::end, event, run_info);
+    if (state.has_value()) {
+      detail::finish_stream_event(impl_, request, state->event);
+    }
+    detail::emit_callback(sink, wh::callbacks::stage::end, state);
     return output;
   }
 
@@ -558,7 +576,7 @@ private:
     return wh::core::detail::defer_resume_sender<Resume>(
         [this, request = chat_request{std::forward<request_t>(request)}, sink = std::move(sink),
          descriptor](auto scheduler) mutable {
-          return detail::invoke_sender<Resume>(impl_, descriptor, std::move(request),
+          return detail::invoke_sender<Resume>(impl_, descriptor, metrics_, std::move(request),
                                                std::move(sink), std::move(scheduler));
         });
   }
@@ -572,12 +590,15 @@ private:
     return wh::core::detail::defer_resume_sender<Resume>(
         [this, request = chat_request{std::forward<request_t>(request)}, sink = std::move(sink),
          descriptor](auto scheduler) mutable {
-          return detail::stream_sender<Resume>(impl_, descriptor, std::move(request),
+          return detail::stream_sender<Resume>(impl_, descriptor, metrics_, std::move(request),
                                                std::move(sink), std::move(scheduler));
         });
   }
 
   wh_no_unique_address impl_t impl_{};
+  /// Call counters of `descriptor()`, resolved once per instance.
+  wh::core::component_call_metrics metrics_{
+      wh::core::component_call_metrics_for(detail::describe_impl(impl_))};
 };
 
 template <typename impl_t> chat_model(impl_t &&) -> chat_model<std::remove_cvref_t<impl_t>>;
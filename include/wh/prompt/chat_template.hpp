@@ -14,6 +14,7 @@
 #include "wh/core/compiler.hpp"
 #include "wh/core/component/concepts.hpp"
 #include "wh/core/component/types.hpp"
+#include "wh/core/metrics/hooks.hpp"
 #include "wh/core/result.hpp"
 #include "wh/core/run_context.hpp"
 #include "wh/core/stdexec/component_async_entry.hpp"
@@ -135,34 +136,49 @@ template <typename impl_t, typename request_t>
       });
 }
 
+template <typename impl_t>
+[[nodiscard]] inline auto describe_impl(const impl_t &impl) -> wh::core::component_descriptor {
+  if constexpr (requires {
+                  { impl.descriptor() } -> std::same_as<wh::core::component_descriptor>;
+                }) {
+    return impl.descriptor();
+  } else {
+    return wh::core::component_descriptor{"Prompt", wh::core::component_kind::prompt};
+  }
+}
+
 template <wh::core::resume_mode Resume, typename impl_t, typename request_t, typename scheduler_t>
   requires async_prompt_handler<impl_t>
-[[nodiscard]] inline auto render_sender(const impl_t &impl, request_t &&request, callback_sink sink,
+[[nodiscard]] inline auto render_sender(const impl_t &impl,
+                                        const wh::core::component_call_metrics metrics,
+                                        request_t &&request, callback_sink sink,
                                         scheduler_t scheduler) {
   return wh::core::detail::component_async_entry<Resume>(
-      std::forward<request_t>(request), std::move(sink), std::move(scheduler),
+      std::forward<request_t>(request), std::move(sink), std::move(scheduler), metrics,
       [&impl](auto &&forwarded_request) {
         return make_render_sender(impl,
                                   std::forward<decltype(forwarded_request)>(forwarded_request));
       },
       [](const prompt_render_request &state_request) { return make_callback_state(state_request); },
       [](const callback_sink &start_sink, const callback_state &state) {
-        emit_callback(start_sink, wh::callbacks::stage::start, state);
+        wh::callbacks::emit_bound(start_sink, wh::callbacks::stage::start, state);
       },
       [](const callback_sink &success_sink, callback_state &state, prompt_result &status) {
         state.event.rendered_message_count = status.value().size();
-        emit_callback(success_sink, wh::callbacks::stage::end, state);
+        wh::callbacks::emit_bound(success_sink, wh::callbacks::stage::end, state);
       },
       [](const callback_sink &error_sink, callback_state &state, prompt_result &) {
-        emit_callback(error_sink, wh::callbacks::stage::error, state);
+        wh::callbacks::emit_bound(error_sink, wh::callbacks::stage::error, state);
       });
 }
 
 template <typename impl_t, typename request_t>
   requires async_prompt_handler<impl_t>
-[[nodiscard]] inline auto render_sender(const impl_t &impl, request_t &&request,
-                                        callback_sink sink) {
-  return render_sender<wh::core::resume_mode::unchanged>(impl, std::forward<request_t>(request),
+[[nodiscard]] inline auto render_sender(const impl_t &impl,
+                                        const wh::core::component_call_metrics metrics,
+                                        request_t &&request, callback_sink sink) {
+  return render_sender<wh::core::resume_mode::unchanged>(impl, metrics,
+                                                         std::forward<request_t>(request),
                                                          std::move(sink),
                                                          wh::core::detail::resume_passthrough);
 }
@@ -187,7 +203,7 @@ public:
   ~chat_template() = default;
 
   [[nodiscard]] auto descriptor() const -> wh::core::component_descriptor {
-    return wh::core::component_descriptor{"Prompt", wh::core::component_kind::prompt};
+    return detail::describe_impl(impl_);
   }
 
   [[nodiscard]] auto render(const prompt_render_request &request,
@@ -228,15 +244,18 @@ private:
   [[nodiscard]] auto render_sync_impl(request_t &&request, detail::callback_sink sink) const
       -> detail::prompt_result {
     sink = wh::callbacks::filter_callback_sink(std::move(sink), request.options);
-    auto state = detail::make_callback_state(request);
+    auto state = wh::callbacks::make_lazy_callback_state(
+        sink, [&request] { return detail::make_callback_state(request); });
     detail::emit_callback(sink, wh::callbacks::stage::start, state);
-    auto output =
-        detail::run_sync_prompt_impl(impl_, std::forward<request_t>(request), state.event);
+    prompt_callback_event unobserved_event{};
+    auto &event = state.has_value() ? state->event : unobserved_event;
+    auto output = detail::run_sync_prompt_impl(impl_, std::forward<request_t>(request), event);
+    metrics_.record(output.has_error());
     if (output.has_error()) {
       detail::emit_callback(sink, wh::callbacks::stage::error, state);
       return output;
     }
-    state.event.rendered_message_count = output.value().size();
+    event.rendered_message_count = output.value().size();
     detail::emit_callback(sink, wh::callbacks::stage::end, state);
     return output;
   }
@@ -249,12 +268,15 @@ private:
     return wh::core::detail::defer_resume_sender<Resume>(
         [this, request = prompt_render_request{std::forward<request_t>(request)},
          sink = std::move(sink)](auto scheduler) mutable {
-          return detail::render_sender<Resume>(impl_, std::move(request), std::move(sink),
-                                               std::move(scheduler));
+          return detail::render_sender<Resume>(impl_, metrics_, std::move(request),
+                                               std::move(sink), std::move(scheduler));
         });
   }
 
   wh_no_unique_address impl_t impl_;
+  /// Call counters of `descriptor()`, resolved once per instance.
+  wh::core::component_call_metrics metrics_{
+      wh::core::component_call_metrics_for(detail::describe_impl(impl_))};
 };
 
 template <typename impl_t> chat_template(impl_t &&) -> chat_template<std::remove_cvref_t<impl_t>>;
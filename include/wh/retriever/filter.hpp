@@ -0,0 +1,789 @@
+// Defines the typed metadata filter language used by retrievers and compiles
+// filter expressions once per request into a flat postfix predicate program.
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "wh/core/error.hpp"
+#include "wh/core/result.hpp"
+#include "wh/core/small_vector.hpp"
+#include "wh/schema/document.hpp"
+
+namespace wh::retriever {
+
+/// Operation performed by one filter program instruction.
+enum class filter_opcode : std::uint8_t {
+  /// Pushes `true`; the whole program of an empty filter.
+  match_all = 0U,
+  /// Field equals the operand.
+  equal,
+  /// Field differs from the operand or is missing.
+  not_equal,
+  /// Field orders before the operand.
+  less,
+  /// Field orders before or equal to the operand.
+  less_equal,
+  /// Field orders after the operand.
+  greater,
+  /// Field orders after or equal to the operand.
+  greater_equal,
+  /// Field equals any operand.
+  in,
+  /// Field text starts with the operand.
+  prefix,
+  /// Field text contains the operand; produced by legacy bare-text filters.
+  contains,
+  /// Pops two results and pushes their conjunction.
+  logical_and,
+  /// Pops two results and pushes their disjunction.
+  logical_or,
+  /// Negates the top result.
+  logical_not,
+};
+
+/// Type of one filter literal.
+enum class filter_literal_kind : std::uint8_t {
+  null = 0U,
+  boolean,
+  integer,
+  number,
+  string,
+};
+
+/// One typed literal operand. `text` keeps the source spelling so string
+/// metadata compares against exactly what the caller wrote.
+struct filter_literal {
+  /// Parsed literal type.
+  filter_literal_kind kind{filter_literal_kind::string};
+  /// Value for boolean literals.
+  bool boolean{false};
+  /// Value for integer literals.
+  std::int64_t integer{0};
+  /// Value for integer and number literals.
+  double number{0.0};
+  /// Source spelling, or unescaped contents for quoted strings.
+  std::string text{};
+};
+
+/// One postfix instruction. Comparisons push one result; logical operations
+/// consume the results already on the stack.
+struct filter_instruction {
+  /// Operation to perform.
+  filter_opcode opcode{filter_opcode::match_all};
+  /// Metadata key, or `content` for document text. Aliases are normalized.
+  std::string field{};
+  /// One operand for comparisons, the candidate set for `in`.
+  std::vector<filter_literal> operands{};
+};
+
+namespace detail {
+
+/// Trims ASCII whitespace from both ends of the provided string view.
+[[nodiscard]] inline auto trim_ascii(const std::string_view value) -> std::string_view {
+  std::size_t begin = 0U;
+  while (begin < value.size() && std::isspace(static_cast<unsigned char>(value[begin])) != 0) {
+    ++begin;
+  }
+
+  std::size_t end = value.size();
+  while (end > begin && std::isspace(static_cast<unsigned char>(value[end - 1U])) != 0) {
+    --end;
+  }
+  return value.substr(begin, end - begin);
+}
+
+inline constexpr std::string_view filter_content_field = "content";
+
+/// Maps user-facing aliases onto reserved document metadata keys.
+[[nodiscard]] inline auto normalize_filter_field(const std::string_view field) -> std::string {
+  if (field == "sub_index") {
+    return std::string{wh::schema::document_metadata_keys::sub_index};
+  }
+  if (field == "dsl") {
+    return std::string{wh::schema::document_metadata_keys::dsl};
+  }
+  if (field == "extra_info") {
+    return std::string{wh::schema::document_metadata_keys::extra_info};
+  }
+  if (field == "score") {
+    return std::string{wh::schema::document_metadata_keys::score};
+  }
+  return std::string{field};
+}
+
+/// Reserved string fields read as empty text when absent, like their accessors.
+[[nodiscard]] inline auto is_reserved_text_field(const std::string_view field) noexcept -> bool {
+  return field == wh::schema::document_metadata_keys::sub_index ||
+         field == wh::schema::document_metadata_keys::dsl ||
+         field == wh::schema::document_metadata_keys::extra_info;
+}
+
+enum class filter_scalar_kind : std::uint8_t {
+  missing = 0U,
+  null,
+  boolean,
+  integer,
+  number,
+  string,
+  string_list,
+  other,
+};
+
+/// Borrowed view of one resolved document field.
+struct filter_scalar {
+  filter_scalar_kind kind{filter_scalar_kind::missing};
+  bool boolean{false};
+  std::int64_t integer{0};
+  double number{0.0};
+  std::string_view text{};
+  const std::vector<std::string> *list{nullptr};
+};
+
+[[nodiscard]] inline auto resolve_filter_field(const wh::schema::document &document,
+                                               const std::string &field) -> filter_scalar {
+  if (field == filter_content_field) {
+    return filter_scalar{.kind = filter_scalar_kind::string, .text = document.content()};
+  }
+  const auto *metadata = document.metadata();
+  const auto iter = metadata == nullptr ? wh::schema::document_metadata::const_iterator{}
+                                        : metadata->find(std::string_view{field});
+  if (metadata == nullptr || iter == metadata->end()) {
+    if (is_reserved_text_field(field)) {
+      return filter_scalar{.kind = filter_scalar_kind::string};
+    }
+    return {};
+  }
+  return std::visit(
+      [](const auto &value) -> filter_scalar {
+        using value_t = std::remove_cvref_t<decltype(value)>;
+        if constexpr (std::same_as<value_t, std::nullptr_t>) {
+          return filter_scalar{.kind = filter_scalar_kind::null};
+        } else if constexpr (std::same_as<value_t, bool>) {
+          return filter_scalar{.kind = filter_scalar_kind::boolean, .boolean = value};
+        } else if constexpr (std::same_as<value_t, std::int64_t>) {
+          return filter_scalar{.kind = filter_scalar_kind::integer,
+                               .integer = value,
+                               .number = static_cast<double>(value)};
+        } else if constexpr (std::same_as<value_t, double>) {
+          return filter_scalar{.kind = filter_scalar_kind::number, .number = value};
+        } else if constexpr (std::same_as<value_t, std::string>) {
+          return filter_scalar{.kind = filter_scalar_kind::string, .text = value};
+        } else if constexpr (std::same_as<value_t, std::vector<std::string>>) {
+          return filter_scalar{.kind = filter_scalar_kind::string_list, .list = &value};
+        } else {
+          return filter_scalar{.kind = filter_scalar_kind::other};
+        }
+      },
+      iter->second);
+}
+
+[[nodiscard]] inline auto is_numeric(const filter_scalar_kind kind) noexcept -> bool {
+  return kind == filter_scalar_kind::integer || kind == filter_scalar_kind::number;
+}
+
+[[nodiscard]] inline auto is_numeric(const filter_literal_kind kind) noexcept -> bool {
+  return kind == filter_literal_kind::integer || kind == filter_literal_kind::number;
+}
+
+/// Three-way compares one scalar with one literal. Returns false in `ordered`
+/// when the two types have no meaningful order.
+[[nodiscard]] inline auto compare_filter_scalar(const filter_scalar &scalar,
+                                                const filter_literal &literal, bool &ordered)
+    -> int {
+  ordered = true;
+  if (is_numeric(scalar.kind) && is_numeric(literal.kind)) {
+    if (scalar.kind == filter_scalar_kind::integer &&
+        literal.kind == filter_literal_kind::integer) {
+      return scalar.integer < literal.integer ? -1 : (scalar.integer > literal.integer ? 1 : 0);
+    }
+    return scalar.number < literal.number ? -1 : (scalar.number > literal.number ? 1 : 0);
+  }
+  if (scalar.kind == filter_scalar_kind::string) {
+    const auto order = scalar.text.compare(literal.text);
+    return order < 0 ? -1 : (order > 0 ? 1 : 0);
+  }
+  ordered = false;
+  return 0;
+}
+
+[[nodiscard]] inline auto filter_scalar_equals(const filter_scalar &scalar,
+                                               const filter_literal &literal) -> bool {
+  switch (scalar.kind) {
+  case filter_scalar_kind::null:
+    return literal.kind == filter_literal_kind::null;
+  case filter_scalar_kind::boolean:
+    return literal.kind == filter_literal_kind::boolean && scalar.boolean == literal.boolean;
+  case filter_scalar_kind::integer:
+  case filter_scalar_kind::number:
+  case filter_scalar_kind::string: {
+    bool ordered = false;
+    return compare_filter_scalar(scalar, literal, ordered) == 0 && ordered;
+  }
+  case filter_scalar_kind::string_list:
+    return std::ranges::find(*scalar.list, literal.text) != scalar.list->end();
+  case filter_scalar_kind::missing:
+  case filter_scalar_kind::other:
+    return false;
+  }
+  return false;
+}
+
+[[nodiscard]] inline auto filter_scalar_has_prefix(const filter_scalar &scalar,
+                                                   const filter_literal &literal) -> bool {
+  if (scalar.kind == filter_scalar_kind::string) {
+    return scalar.text.starts_with(literal.text);
+  }
+  if (scalar.kind == filter_scalar_kind::string_list) {
+    return std::ranges::any_of(*scalar.list, [&](const std::string &item) {
+      return item.starts_with(literal.text);
+    });
+  }
+  return false;
+}
+
+[[nodiscard]] inline auto evaluate_filter_comparison(const wh::schema::document &document,
+                                                     const filter_instruction &instruction)
+    -> bool {
+  const auto scalar = resolve_filter_field(document, instruction.field);
+  const auto &operand = instruction.operands.front();
+  bool ordered = false;
+  switch (instruction.opcode) {
+  case filter_opcode::equal:
+    return filter_scalar_equals(scalar, operand);
+  case filter_opcode::not_equal:
+    return !filter_scalar_equals(scalar, operand);
+  case filter_opcode::less:
+    return compare_filter_scalar(scalar, operand, ordered) < 0 && ordered;
+  case filter_opcode::less_equal:
+    return compare_filter_scalar(scalar, operand, ordered) <= 0 && ordered;
+  case filter_opcode::greater:
+    return compare_filter_scalar(scalar, operand, ordered) > 0 && ordered;
+  case filter_opcode::greater_equal:
+    return compare_filter_scalar(scalar, operand, ordered) >= 0 && ordered;
+  case filter_opcode::in:
+    return std::ranges::any_of(instruction.operands, [&](const filter_literal &candidate) {
+      return filter_scalar_equals(scalar, candidate);
+    });
+  case filter_opcode::prefix:
+    return filter_scalar_has_prefix(scalar, operand);
+  case filter_opcode::contains:
+    return scalar.kind == filter_scalar_kind::string &&
+           scalar.text.find(operand.text) != std::string_view::npos;
+  default:
+    return false;
+  }
+}
+
+} // namespace detail
+
+/// Compiled filter expression evaluated against retrieved documents.
+///
+/// A default-constructed program matches every document. Programs are
+/// immutable after compilation and safe to share across threads.
+class filter_program {
+public:
+  filter_program() = default;
+
+  /// Adopts postfix `code`; `max_depth` is the largest evaluation stack depth.
+  filter_program(std::vector<filter_instruction> code, const std::size_t max_depth)
+      : code_(std::move(code)), max_depth_(max_depth) {}
+
+  /// Returns true when the program accepts every document.
+  [[nodiscard]] auto empty() const noexcept -> bool {
+    return code_.empty() ||
+           (code_.size() == 1U && code_.front().opcode == filter_opcode::match_all);
+  }
+
+  /// Exposes the postfix instructions so index backends can translate them.
+  [[nodiscard]] auto instructions() const noexcept -> std::span<const filter_instruction> {
+    return {code_.data(), code_.size()};
+  }
+
+  /// Returns the largest evaluation stack depth reached by the program.
+  [[nodiscard]] auto max_depth() const noexcept -> std::size_t { return max_depth_; }
+
+  /// Evaluates the program against one document.
+  [[nodiscard]] auto matches(const wh::schema::document &document) const -> bool {
+    if (code_.empty()) {
+      return true;
+    }
+    wh::core::small_vector<bool, 16U> stack{};
+    for (const auto &instruction : code_) {
+      switch (instruction.opcode) {
+      case filter_opcode::match_all:
+        stack.push_back(true);
+        break;
+      case filter_opcode::logical_and: {
+        const auto right = stack.back();
+        stack.pop_back();
+        stack.back() = stack.back() && right;
+        break;
+      }
+      case filter_opcode::logical_or: {
+        const auto right = stack.back();
+        stack.pop_back();
+        stack.back() = stack.back() || right;
+        break;
+      }
+      case filter_opcode::logical_not:
+        stack.back() = !stack.back();
+        break;
+      default:
+        stack.push_back(detail::evaluate_filter_comparison(document, instruction));
+        break;
+      }
+    }
+    return stack.back();
+  }
+
+private:
+  /// Postfix instruction stream.
+  std::vector<filter_instruction> code_{};
+  /// Largest stack depth reached while evaluating `code_`.
+  std::size_t max_depth_{0U};
+};
+
+namespace detail {
+
+enum class filter_token_kind : std::uint8_t {
+  end = 0U,
+  word,
+  string,
+  left_paren,
+  right_paren,
+  comma,
+  equal,
+  not_equal,
+  less,
+  less_equal,
+  greater,
+  greater_equal,
+  prefix,
+  logical_and,
+  logical_or,
+  logical_not,
+};
+
+struct filter_token {
+  filter_token_kind kind{filter_token_kind::end};
+  std::string text{};
+};
+
+[[nodiscard]] inline auto iequals(const std::string_view left, const std::string_view right)
+    -> bool {
+  return left.size() == right.size() &&
+         std::ranges::equal(left, right, [](const char lhs, const char rhs) {
+           return std::tolower(static_cast<unsigned char>(lhs)) ==
+                  std::tolower(static_cast<unsigned char>(rhs));
+         });
+}
+
+[[nodiscard]] inline auto is_filter_word_char(const char value) noexcept -> bool {
+  const auto byte = static_cast<unsigned char>(value);
+  return std::isalnum(byte) != 0 || value == '_' || value == '.' || value == '-' ||
+         value == '+' || value == ':' || value == '/' || value == '@' || byte >= 0x80U;
+}
+
+/// Splits one filter expression into tokens; fails on unterminated strings
+/// and unknown punctuation.
+[[nodiscard]] inline auto tokenize_filter(const std::string_view source)
+    -> wh::core::result<std::vector<filter_token>> {
+  using result_t = wh::core::result<std::vector<filter_token>>;
+  std::vector<filter_token> tokens{};
+  std::size_t index = 0U;
+  auto push = [&](const filter_token_kind kind, const std::size_t width) -> void {
+    tokens.push_back(filter_token{.kind = kind});
+    index += width;
+  };
+  while (index < source.size()) {
+    const auto current = source[index];
+    const auto next = index + 1U < source.size() ? source[index + 1U] : '\0';
+    if (std::isspace(static_cast<unsigned char>(current)) != 0) {
+      ++index;
+      continue;
+    }
+    switch (current) {
+    case '(':
+      push(filter_token_kind::left_paren, 1U);
+      continue;
+    case ')':
+      push(filter_token_kind::right_paren, 1U);
+      continue;
+    case ',':
+      push(filter_token_kind::comma, 1U);
+      continue;
+    case '=':
+      push(filter_token_kind::equal, next == '=' ? 2U : 1U);
+      continue;
+    case '!':
+      if (next == '=') {
+        push(filter_token_kind::not_equal, 2U);
+      } else {
+        push(filter_token_kind::logical_not, 1U);
+      }
+      continue;
+    case '<':
+      push(next == '=' ? filter_token_kind::less_equal : filter_token_kind::less,
+           next == '=' ? 2U : 1U);
+      continue;
+    case '>':
+      push(next == '=' ? filter_token_kind::greater_equal : filter_token_kind::greater,
+           next == '=' ? 2U : 1U);
+      continue;
+    case '^':
+      if (next != '=') {
+        return result_t::failure(wh::core::errc::parse_error);
+      }
+      push(filter_token_kind::prefix, 2U);
+      continue;
+    case '&':
+      if (next != '&') {
+        return result_t::failure(wh::core::errc::parse_error);
+      }
+      push(filter_token_kind::logical_and, 2U);
+      continue;
+    case '|':
+      if (next != '|') {
+        return result_t::failure(wh::core::errc::parse_error);
+      }
+      push(filter_token_kind::logical_or, 2U);
+      continue;
+    case '"':
+    case '\'': {
+      filter_token token{.kind = filter_token_kind::string};
+      ++index;
+      bool closed = false;
+      while (index < source.size()) {
+        const auto value = source[index++];
+        if (value == current) {
+          closed = true;
+          break;
+        }
+        if (value == '\\' && index < source.size()) {
+          token.text.push_back(source[index++]);
+          continue;
+        }
+        token.text.push_back(value);
+      }
+      if (!closed) {
+        return result_t::failure(wh::core::errc::parse_error);
+      }
+      tokens.push_back(std::move(token));
+      continue;
+    }
+    default:
+      break;
+    }
+    if (!is_filter_word_char(current)) {
+      return result_t::failure(wh::core::errc::parse_error);
+    }
+    const auto begin = index;
+    while (index < source.size() && is_filter_word_char(source[index])) {
+      ++index;
+    }
+    const auto word = source.substr(begin, index - begin);
+    if (iequals(word, "and")) {
+      tokens.push_back(filter_token{.kind = filter_token_kind::logical_and});
+    } else if (iequals(word, "or")) {
+      tokens.push_back(filter_token{.kind = filter_token_kind::logical_or});
+    } else if (iequals(word, "not")) {
+      tokens.push_back(filter_token{.kind = filter_token_kind::logical_not});
+    } else if (iequals(word, "prefix")) {
+      tokens.push_back(filter_token{.kind = filter_token_kind::prefix});
+    } else {
+      tokens.push_back(filter_token{.kind = filter_token_kind::word, .text = std::string{word}});
+    }
+  }
+  tokens.push_back(filter_token{});
+  return tokens;
+}
+
+/// Types one bare word: integers, numbers, booleans and `null` are recognized,
+/// anything else stays a string.
+[[nodiscard]] inline auto make_filter_literal(std::string text, const bool quoted)
+    -> filter_literal {
+  filter_literal literal{.text = std::move(text)};
+  if (quoted) {
+    return literal;
+  }
+  const auto *begin = literal.text.data();
+  const auto *end = begin + literal.text.size();
+  if (auto [ptr, ec] = std::from_chars(begin, end, literal.integer);
+      ec == std::errc{} && ptr == end) {
+    literal.kind = filter_literal_kind::integer;
+    literal.number = static_cast<double>(literal.integer);
+    return literal;
+  }
+  if (auto [ptr, ec] = std::from_chars(begin, end, literal.number);
+      ec == std::errc{} && ptr == end) {
+    literal.kind = filter_literal_kind::number;
+    return literal;
+  }
+  literal.number = 0.0;
+  if (iequals(literal.text, "true") || iequals(literal.text, "false")) {
+    literal.kind = filter_literal_kind::boolean;
+    literal.boolean = iequals(literal.text, "true");
+  } else if (iequals(literal.text, "null")) {
+    literal.kind = filter_literal_kind::null;
+  }
+  return literal;
+}
+
+/// Recursive-descent parser emitting postfix code.
+///
+/// expr       := and_expr (OR and_expr)*
+/// and_expr   := unary (AND unary)*
+/// unary      := NOT unary | '(' expr ')' | comparison
+/// comparison := field op literal | field IN '(' literal (',' literal)* ')'
+class filter_parser {
+public:
+  explicit filter_parser(std::vector<filter_token> tokens) : tokens_(std::move(tokens)) {}
+
+  [[nodiscard]] auto parse() -> wh::core::result<filter_program> {
+    auto parsed = parse_or(0U);
+    if (parsed.has_error()) {
+      return wh::core::result<filter_program>::failure(parsed.error());
+    }
+    if (peek().kind != filter_token_kind::end) {
+      return wh::core::result<filter_program>::failure(wh::core::errc::parse_error);
+    }
+    return filter_program{std::move(code_), max_depth_};
+  }
+
+private:
+  static constexpr std::size_t max_nesting = 64U;
+
+  [[nodiscard]] auto peek() const -> const filter_token & { return tokens_[cursor_]; }
+
+  auto take() -> filter_token & { return tokens_[cursor_++]; }
+
+  auto emit(filter_instruction instruction) -> void {
+    switch (instruction.opcode) {
+    case filter_opcode::logical_and:
+    case filter_opcode::logical_or:
+      --depth_;
+      break;
+    case filter_opcode::logical_not:
+      break;
+    default:
+      max_depth_ = std::max(max_depth_, ++depth_);
+      break;
+    }
+    code_.push_back(std::move(instruction));
+  }
+
+  auto parse_or(const std::size_t nesting) -> wh::core::result<void> {
+    auto left = parse_and(nesting);
+    if (left.has_error()) {
+      return left;
+    }
+    while (peek().kind == filter_token_kind::logical_or) {
+      ++cursor_;
+      auto right = parse_and(nesting);
+      if (right.has_error()) {
+        return right;
+      }
+      emit(filter_instruction{.opcode = filter_opcode::logical_or});
+    }
+    return {};
+  }
+
+  auto parse_and(const std::size_t nesting) -> wh::core::result<void> {
+    auto left = parse_unary(nesting);
+    if (left.has_error()) {
+      return left;
+    }
+    while (peek().kind == filter_token_kind::logical_and) {
+      ++cursor_;
+      auto right = parse_unary(nesting);
+      if (right.has_error()) {
+        return right;
+      }
+      emit(filter_instruction{.opcode = filter_opcode::logical_and});
+    }
+    return {};
+  }
+
+  auto parse_unary(const std::size_t nesting) -> wh::core::result<void> {
+    if (nesting >= max_nesting) {
+      return wh::core::result<void>::failure(wh::core::errc::parse_error);
+    }
+    if (peek().kind == filter_token_kind::logical_not) {
+      ++cursor_;
+      auto operand = parse_unary(nesting + 1U);
+      if (operand.has_error()) {
+        return operand;
+      }
+      emit(filter_instruction{.opcode = filter_opcode::logical_not});
+      return {};
+    }
+    if (peek().kind == filter_token_kind::left_paren) {
+      ++cursor_;
+      auto inner = parse_or(nesting + 1U);
+      if (inner.has_error()) {
+        return inner;
+      }
+      if (take().kind != filter_token_kind::right_paren) {
+        return wh::core::result<void>::failure(wh::core::errc::parse_error);
+      }
+      return {};
+    }
+    return parse_comparison();
+  }
+
+  auto parse_literal() -> wh::core::result<filter_literal> {
+    auto &token = take();
+    if (token.kind != filter_token_kind::word && token.kind != filter_token_kind::string) {
+      return wh::core::result<filter_literal>::failure(wh::core::errc::parse_error);
+    }
+    return make_filter_literal(std::move(token.text), token.kind == filter_token_kind::string);
+  }
+
+  auto parse_comparison() -> wh::core::result<void> {
+    auto &field = take();
+    if (field.kind != filter_token_kind::word && field.kind != filter_token_kind::string) {
+      return wh::core::result<void>::failure(wh::core::errc::parse_error);
+    }
+    filter_instruction instruction{.field = normalize_filter_field(field.text)};
+    const auto &op = take();
+    switch (op.kind) {
+    case filter_token_kind::equal:
+      instruction.opcode = filter_opcode::equal;
+      break;
+    case filter_token_kind::not_equal:
+      instruction.opcode = filter_opcode::not_equal;
+      break;
+    case filter_token_kind::less:
+      instruction.opcode = filter_opcode::less;
+      break;
+    case filter_token_kind::less_equal:
+      instruction.opcode = filter_opcode::less_equal;
+      break;
+    case filter_token_kind::greater:
+      instruction.opcode = filter_opcode::greater;
+      break;
+    case filter_token_kind::greater_equal:
+      instruction.opcode = filter_opcode::greater_equal;
+      break;
+    case filter_token_kind::prefix:
+      instruction.opcode = filter_opcode::prefix;
+      break;
+    case filter_token_kind::word:
+      if (!iequals(op.text, "in")) {
+        return wh::core::result<void>::failure(wh::core::errc::parse_error);
+      }
+      instruction.opcode = filter_opcode::in;
+      return parse_in_list(std::move(instruction));
+    default:
+      return wh::core::result<void>::failure(wh::core::errc::parse_error);
+    }
+    auto literal = parse_literal();
+    if (literal.has_error()) {
+      return wh::core::result<void>::failure(literal.error());
+    }
+    instruction.operands.push_back(std::move(literal).value());
+    emit(std::move(instruction));
+    return {};
+  }
+
+  auto parse_in_list(filter_instruction instruction) -> wh::core::result<void> {
+    if (take().kind != filter_token_kind::left_paren) {
+      return wh::core::result<void>::failure(wh::core::errc::parse_error);
+    }
+    for (;;) {
+      auto literal = parse_literal();
+      if (literal.has_error()) {
+        return wh::core::result<void>::failure(literal.error());
+      }
+      instruction.operands.push_back(std::move(literal).value());
+      const auto separator = take().kind;
+      if (separator == filter_token_kind::right_paren) {
+        break;
+      }
+      if (separator != filter_token_kind::comma) {
+        return wh::core::result<void>::failure(wh::core::errc::parse_error);
+      }
+    }
+    emit(std::move(instruction));
+    return {};
+  }
+
+  std::vector<filter_token> tokens_{};
+  std::size_t cursor_{0U};
+  std::vector<filter_instruction> code_{};
+  std::size_t depth_{0U};
+  std::size_t max_depth_{0U};
+};
+
+/// Builds the program for the pre-language `key=value` / bare-text form.
+[[nodiscard]] inline auto compile_legacy_filter(const std::string_view trimmed)
+    -> filter_program {
+  const auto equals = trimmed.find('=');
+  if (equals == std::string_view::npos) {
+    return filter_program{{filter_instruction{
+                              .opcode = filter_opcode::contains,
+                              .field = std::string{filter_content_field},
+                              .operands = {filter_literal{.text = std::string{trimmed}}},
+                          }},
+                          1U};
+  }
+  const auto key = trim_ascii(trimmed.substr(0U, equals));
+  const auto value = trim_ascii(trimmed.substr(equals + 1U));
+  if (key.empty()) {
+    return filter_program{{filter_instruction{.opcode = filter_opcode::match_all},
+                           filter_instruction{.opcode = filter_opcode::logical_not}},
+                          1U};
+  }
+  return filter_program{{filter_instruction{
+                            .opcode = filter_opcode::equal,
+                            .field = normalize_filter_field(key),
+                            .operands = {make_filter_literal(std::string{value}, false)},
+                        }},
+                        1U};
+}
+
+} // namespace detail
+
+/// Parses one filter expression strictly.
+///
+/// Supports `=`/`==`, `!=`, `<`, `<=`, `>`, `>=`, `^=`/`prefix`, `in (...)`,
+/// `and`/`&&`, `or`/`||`, `not`/`!` and parentheses. Fields name metadata keys;
+/// `content` reads document text and `sub_index`, `dsl`, `extra_info` and
+/// `score` alias their reserved keys. Returns `parse_error` on malformed input.
+[[nodiscard]] inline auto parse_filter_expression(const std::string_view expression)
+    -> wh::core::result<filter_program> {
+  const auto trimmed = detail::trim_ascii(expression);
+  if (trimmed.empty()) {
+    return filter_program{};
+  }
+  auto tokens = detail::tokenize_filter(trimmed);
+  if (tokens.has_error()) {
+    return wh::core::result<filter_program>::failure(tokens.error());
+  }
+  return detail::filter_parser{std::move(tokens).value()}.parse();
+}
+
+/// Compiles one filter expression, falling back to the legacy single
+/// `key=value` or content-substring form when it does not parse strictly.
+[[nodiscard]] inline auto compile_filter(const std::string_view expression) -> filter_program {
+  auto parsed = parse_filter_expression(expression);
+  if (parsed.has_value()) {
+    return std::move(parsed).value();
+  }
+  return detail::compile_legacy_filter(detail::trim_ascii(expression));
+}
+
+} // namespace wh::retriever
@@ -3,8 +3,8 @@
 #pragma once
 
 #include <algorithm>
-#include <cctype>
 #include <concepts>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -18,12 +18,14 @@
 #include "wh/callbacks/callbacks.hpp"
 #include "wh/core/compiler.hpp"
 #include "wh/core/component/types.hpp"
+#include "wh/core/metrics/hooks.hpp"
 #include "wh/core/result.hpp"
 #include "wh/core/run_context.hpp"
 #include "wh/core/stdexec/component_async_entry.hpp"
 #include "wh/core/stdexec/request_result_sender.hpp"
 #include "wh/core/stdexec/resume_policy.hpp"
 #include "wh/retriever/callback_event.hpp"
+#include "wh/retriever/filter.hpp"
 #include "wh/retriever/options.hpp"
 #include "wh/schema/document.hpp"
 
@@ -45,70 +47,38 @@ struct retriever_request {
   std::vector<double> embedding{};
   /// Retrieval options including filtering/routing controls.
   retriever_options options{};
+  /// Optional precompiled form of the resolved options filter. Callers that
+  /// fan one request out to several retrievers may fill it once; when null it
+  /// is compiled on demand.
+  std::shared_ptr<const filter_program> compiled_filter{};
 };
 
-namespace detail {
-
-/// Trims ASCII whitespace from both ends of the provided string view.
-[[nodiscard]] inline auto trim_ascii(const std::string_view value) -> std::string_view {
-  std::size_t begin = 0U;
-  while (begin < value.size() && std::isspace(static_cast<unsigned char>(value[begin])) != 0) {
-    ++begin;
-  }
+/// Opt-in hook for retrievers that evaluate `request_filter(request)` inside
+/// their index before truncating to top-k. Implementations declare
+/// `static constexpr bool filter_pushdown = true;` and the component then skips
+/// its post-retrieval filter pass.
+template <typename impl_t>
+concept filter_pushdown_retriever = requires {
+  requires static_cast<bool>(impl_t::filter_pushdown);
+};
 
-  std::size_t end = value.size();
-  while (end > begin && std::isspace(static_cast<unsigned char>(value[end - 1U])) != 0) {
-    --end;
+/// Returns the compiled filter for `request`, compiling the resolved options
+/// filter when the request does not carry one.
+[[nodiscard]] inline auto request_filter(const retriever_request &request)
+    -> std::shared_ptr<const filter_program> {
+  if (request.compiled_filter != nullptr) {
+    return request.compiled_filter;
   }
-  return value.substr(begin, end - begin);
+  return std::make_shared<const filter_program>(
+      compile_filter(request.options.resolve_view().filter));
 }
 
+namespace detail {
+
 /// Evaluates whether document metadata satisfies the filter expression.
 [[nodiscard]] inline auto matches_filter_expression(const wh::schema::document &document,
                                                     const std::string_view expression) -> bool {
-  const auto trimmed = trim_ascii(expression);
-  if (trimmed.empty()) {
-    return true;
-  }
-
-  const auto equals = trimmed.find('=');
-  if (equals == std::string_view::npos) {
-    return document.content().find(trimmed) != std::string::npos;
-  }
-
-  const auto key = trim_ascii(trimmed.substr(0U, equals));
-  const auto value = trim_ascii(trimmed.substr(equals + 1U));
-  if (key.empty()) {
-    return false;
-  }
-
-  if (key == "content") {
-    return document.content() == value;
-  }
-  if (key == "sub_index" || key == "_sub_index") {
-    return document.sub_index() == value;
-  }
-  if (key == "dsl" || key == "_dsl") {
-    return document.dsl() == value;
-  }
-  if (key == "extra_info" || key == "_extra_info") {
-    return document.extra_info() == value;
-  }
-
-  if (const auto *typed = document.metadata_ptr<std::string>(key); typed != nullptr) {
-    return *typed == value;
-  }
-  if (const auto *typed = document.metadata_ptr<std::int64_t>(key); typed != nullptr) {
-    return std::to_string(*typed) == value;
-  }
-  if (const auto *typed = document.metadata_ptr<double>(key); typed != nullptr) {
-    return std::to_string(*typed) == value;
-  }
-  if (const auto *typed = document.metadata_ptr<bool>(key); typed != nullptr) {
-    return (*typed ? "true" : "false") == value;
-  }
-
-  return false;
+  return compile_filter(expression).matches(document);
 }
 
 using retriever_result = wh::core::result<std::vector<wh::schema::document>>;
@@ -116,6 +86,8 @@ using retriever_result = wh::core::result<std::vector<wh::schema::document>>;
 struct response_policy {
   retriever_common_options options{};
   std::string sub_index{};
+  /// Compiled filter; null when the retriever already applied it.
+  std::shared_ptr<const filter_program> filter{};
 };
 
 struct retriever_callback_state {
@@ -197,9 +169,17 @@ template <typename impl_t>
   return state;
 }
 
-[[nodiscard]] inline auto make_response_policy(const retriever_request &request)
+[[nodiscard]] inline auto make_response_policy(const retriever_request &request,
+                                               const bool filter_pushdown = false)
     -> response_policy {
-  return response_policy{request.options.resolve(), request.sub_index};
+  response_policy policy{request.options.resolve(), request.sub_index};
+  if (!filter_pushdown) {
+    policy.filter = request_filter(request);
+    if (policy.filter->empty()) {
+      policy.filter.reset();
+    }
+  }
+  return policy;
 }
 
 [[nodiscard]] inline auto apply_response_policy(retriever_result result,
@@ -232,13 +212,13 @@ template <typename impl_t>
         if (document.score() < options.score_threshold) {
           return true;
         }
-        if (!policy.sub_index.empty() && document.sub_index() != policy.sub_index) {
+        if (!policy.sub_index.empty() && document.sub_index_view() != policy.sub_index) {
           return true;
         }
-        if (!options.dsl.empty() && document.dsl() != options.dsl) {
+        if (!options.dsl.empty() && document.dsl_view() != options.dsl) {
           return true;
         }
-        return !matches_filter_expression(document, options.filter);
+        return policy.filter != nullptr && !policy.filter->matches(document);
       });
   merged.erase(filtered_begin.begin(), filtered_begin.end());
 
@@ -261,28 +241,47 @@ template <typename impl_t, typename request_t>
       });
 }
 
+template <typename impl_t>
+[[nodiscard]] inline auto describe_impl(const impl_t &impl) -> wh::core::component_descriptor {
+  if constexpr (requires {
+                  { impl.descriptor() } -> std::same_as<wh::core::component_descriptor>;
+                }) {
+    return impl.descriptor();
+  } else {
+    return wh::core::component_descriptor{"Retriever", wh::core::component_kind::retriever};
+  }
+}
+
 template <wh::core::resume_mode Resume, typename impl_t, typename request_t, typename scheduler_t>
-[[nodiscard]] inline auto make_async_sender(const impl_t &impl, request_t &&request,
-                                            callback_sink sink, scheduler_t scheduler) {
-  auto policy = make_response_policy(request);
+[[nodiscard]] inline auto make_async_sender(const impl_t &impl,
+                                            const wh::core::component_call_metrics metrics,
+                                            request_t &&request, callback_sink sink,
+                                            scheduler_t scheduler) {
+  auto policy = make_response_policy(request, filter_pushdown_retriever<impl_t>);
   return wh::core::detail::component_async_entry<Resume>(
-      std::forward<request_t>(request), std::move(sink), std::move(scheduler),
-      [&impl](auto &&forwarded_request) {
-        return make_impl_sender(impl, std::forward<decltype(forwarded_request)>(forwarded_request));
+      std::forward<request_t>(request), std::move(sink), std::move(scheduler), metrics,
+      // The response policy runs in the sender chain so it also applies when
+      // no callback state exists.
+      [&impl, policy = std::move(policy)](auto &&forwarded_request) mutable {
+        return stdexec::then(
+            make_impl_sender(impl, std::forward<decltype(forwarded_request)>(forwarded_request)),
+            [policy = std::move(policy)](retriever_result status) -> retriever_result {
+              return apply_response_policy(std::move(status), policy);
+            });
       },
       [](const retriever_request &state_request) { return make_callback_state(state_request); },
       [](const callback_sink &start_sink, const retriever_callback_state &state) {
-        emit_callback(start_sink, wh::callbacks::stage::start, state);
+        wh::callbacks::emit_bound(start_sink, wh::callbacks::stage::start, state);
       },
-      [policy = std::move(policy)](const callback_sink &success_sink,
-                                   retriever_callback_state &state,
-                                   retriever_result &status) mutable {
-        status = apply_response_policy(std::move(status), policy);
-        state.event.extra = std::to_string(status.value().size());
-        emit_callback(success_sink, wh::callbacks::stage::end, state);
+      [](const callback_sink &success_sink, retriever_callback_state &state,
+         retriever_result &status) {
+        if (success_sink.active(wh::callbacks::stage::end)) {
+          state.event.extra = std::to_string(status.value().size());
+        }
+        wh::callbacks::emit_bound(success_sink, wh::callbacks::stage::end, state);
       },
       [](const callback_sink &error_sink, retriever_callback_state &state, retriever_result &) {
-        emit_callback(error_sink, wh::callbacks::stage::error, state);
+        wh::callbacks::emit_bound(error_sink, wh::callbacks::stage::error, state);
       });
 }
 
@@ -312,7 +311,7 @@ public:
 
   /// Returns static descriptor metadata for this component.
   [[nodiscard]] auto descriptor() const -> wh::core::component_descriptor {
-    return wh::core::component_descriptor{"Retriever", wh::core::component_kind::retriever};
+    return detail::describe_impl(impl_);
   }
 
   /// Retrieves matching documents and emits callbacks through the run context.
@@ -355,18 +354,22 @@ private:
   [[nodiscard]] auto retrieve_sync_impl(request_t &&request, detail::callback_sink sink) const
       -> detail::retriever_result {
     sink = wh::callbacks::filter_callback_sink(std::move(sink), request.options);
-    auto policy = detail::make_response_policy(request);
-    auto callback_state = detail::make_callback_state(request);
+    auto policy = detail::make_response_policy(request, filter_pushdown_retriever<impl_t>);
+    auto callback_state = wh::callbacks::make_lazy_callback_state(
+        sink, [&request] { return detail::make_callback_state(request); });
     detail::emit_callback(sink, wh::callbacks::stage::start, callback_state);
 
     auto output = detail::run_sync_retriever_impl(impl_, std::forward<request_t>(request));
     output = detail::apply_response_policy(std::move(output), policy);
+    metrics_.record(output.has_error());
     if (output.has_error()) {
       detail::emit_callback(sink, wh::callbacks::stage::error, callback_state);
       return output;
     }
 
-    callback_state.event.extra = std::to_string(output.value().size());
+    if (callback_state.has_value() && sink.active(wh::callbacks::stage::end)) {
+      callback_state->event.extra = std::to_string(output.value().size());
+    }
     detail::emit_callback(sink, wh::callbacks::stage::end, callback_state);
     return output;
   }
@@ -379,13 +382,16 @@ private:
     return wh::core::detail::defer_resume_sender<Resume>(
         [this, request = retriever_request{std::forward<request_t>(request)},
          sink = std::move(sink)](auto scheduler) mutable {
-          return detail::make_async_sender<Resume>(impl_, std::move(request), std::move(sink),
-                                                   std::move(scheduler));
+          return detail::make_async_sender<Resume>(impl_, metrics_, std::move(request),
+                                                   std::move(sink), std::move(scheduler));
         });
   }
 
   /// Stored retriever implementation object.
   wh_no_unique_address impl_t impl_;
+  /// Call counters of `descriptor()`, resolved once per instance.
+  wh::core::component_call_metrics metrics_{
+      wh::core::component_call_metrics_for(detail::describe_impl(impl_))};
 };
 
 template <typename impl_t> retriever(impl_t &&) -> retriever<std::remove_cvref_t<impl_t>>;
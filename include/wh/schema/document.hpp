@@ -1,4 +1,5 @@
 // Defines the public document-schema facade.
 #pragma once
 
+#include "wh/schema/document/metadata.hpp"
 #include "wh/schema/document/types.hpp"
@@ -0,0 +1,317 @@
+// Defines document metadata value types and the compact flat metadata store
+// with interned reserved keys and inline user keys.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "wh/core/small_string/intern.hpp"
+#include "wh/core/type_traits.hpp"
+
+namespace wh::schema {
+
+/// One sparse-vector entry as `(dimension_index, weight)`.
+using sparse_vector_item = std::pair<std::uint32_t, double>;
+/// Dense embedding representation.
+using dense_vector = std::vector<double>;
+/// Sparse embedding representation.
+using sparse_vector = std::vector<sparse_vector_item>;
+
+/// Transparent hash alias for document metadata key lookup.
+using document_string_hash = wh::core::transparent_string_hash;
+
+/// Transparent equality alias for metadata key lookup.
+using document_string_equal = wh::core::transparent_string_equal;
+
+/// Supported metadata value variants for one document metadata key.
+using document_metadata_value =
+    std::variant<std::nullptr_t, bool, std::int64_t, double, std::string, dense_vector,
+                 sparse_vector, std::vector<std::string>>;
+/// Metadata map with heterogeneous key lookup support, used for interchange.
+using document_metadata_map = std::unordered_map<std::string, document_metadata_value,
+                                                 document_string_hash, document_string_equal>;
+
+/// Reserved metadata keys used by built-in retrieval/rerank flows.
+namespace document_metadata_keys {
+inline constexpr std::string_view score = "_score";
+inline constexpr std::string_view sub_index = "_sub_index";
+inline constexpr std::string_view dsl = "_dsl";
+inline constexpr std::string_view extra_info = "_extra_info";
+inline constexpr std::string_view dense_vector = "_dense_vector";
+inline constexpr std::string_view sparse_vector = "_sparse_vector";
+} // namespace document_metadata_keys
+
+/// Metadata key. Reserved keys and keys built by `make_document_metadata_key`
+/// hold one interned handle and compare by pointer; every other key owns its
+/// text inline, so arbitrary user keys never enter the process-wide pool.
+class document_metadata_key {
+public:
+  document_metadata_key() = default;
+
+  /// Wraps one interned handle.
+  explicit document_metadata_key(const wh::core::interned_string interned) noexcept
+      : interned_(interned) {}
+
+  /// Stores `text` inline.
+  explicit document_metadata_key(std::string text) noexcept : text_(std::move(text)) {}
+
+  /// Returns true when the key holds an interned handle.
+  [[nodiscard]] auto interned() const noexcept -> bool { return !interned_.empty(); }
+
+  [[nodiscard]] auto view() const noexcept -> std::string_view {
+    return interned() ? interned_.view() : std::string_view{text_};
+  }
+
+  [[nodiscard]] auto str() const noexcept -> const std::string & {
+    return interned() ? interned_.str() : text_;
+  }
+
+  [[nodiscard]] auto data() const noexcept -> const char * { return view().data(); }
+
+  operator std::string_view() const noexcept { return view(); } // NOLINT
+
+  [[nodiscard]] friend auto operator==(const document_metadata_key &left,
+                                       const document_metadata_key &right) noexcept -> bool {
+    if (left.interned() && right.interned()) {
+      return left.interned_.data() == right.interned_.data();
+    }
+    return left.view() == right.view();
+  }
+
+  [[nodiscard]] friend auto operator==(const document_metadata_key &left,
+                                       const std::string_view right) noexcept -> bool {
+    return left.view() == right;
+  }
+
+private:
+  /// Pooled handle for reserved and explicitly pre-interned keys.
+  wh::core::interned_string interned_{};
+  /// Inline text for all other keys.
+  std::string text_{};
+};
+
+/// Interns one metadata key for repeated lookups on hot paths. The pool is
+/// never trimmed, so use this only for a fixed set of keys known in code.
+[[nodiscard]] inline auto make_document_metadata_key(const std::string_view name)
+    -> document_metadata_key {
+  return document_metadata_key{wh::core::intern(name)};
+}
+
+/// Position of each reserved key among the leading metadata slots.
+enum class reserved_metadata_slot : std::uint8_t {
+  score = 0U,
+  sub_index,
+  dsl,
+  extra_info,
+  dense_vector_slot,
+  sparse_vector_slot,
+};
+
+namespace detail {
+
+inline constexpr std::size_t reserved_metadata_slot_count = 6U;
+
+/// Interned handles of the reserved keys, in slot order.
+[[nodiscard]] inline auto reserved_metadata_keys()
+    -> const std::array<document_metadata_key, reserved_metadata_slot_count> & {
+  static const std::array<document_metadata_key, reserved_metadata_slot_count> keys{
+      make_document_metadata_key(document_metadata_keys::score),
+      make_document_metadata_key(document_metadata_keys::sub_index),
+      make_document_metadata_key(document_metadata_keys::dsl),
+      make_document_metadata_key(document_metadata_keys::extra_info),
+      make_document_metadata_key(document_metadata_keys::dense_vector),
+      make_document_metadata_key(document_metadata_keys::sparse_vector),
+  };
+  return keys;
+}
+
+/// Returns the reserved slot of `key`, or the slot count for user keys.
+[[nodiscard]] inline auto reserved_rank(const document_metadata_key &key) -> std::size_t {
+  if (!key.interned()) {
+    return reserved_metadata_slot_count;
+  }
+  const auto &reserved = reserved_metadata_keys();
+  const auto *data = key.data();
+  for (std::size_t index = 0U; index < reserved.size(); ++index) {
+    if (reserved[index].data() == data) {
+      return index;
+    }
+  }
+  return reserved_metadata_slot_count;
+}
+
+/// Returns the reserved slot named by `text`, or the slot count for user keys.
+[[nodiscard]] inline auto reserved_rank(const std::string_view text) -> std::size_t {
+  if (text.empty() || text.front() != '_') {
+    return reserved_metadata_slot_count;
+  }
+  const auto &reserved = reserved_metadata_keys();
+  for (std::size_t index = 0U; index < reserved.size(); ++index) {
+    if (reserved[index].view() == text) {
+      return index;
+    }
+  }
+  return reserved_metadata_slot_count;
+}
+
+} // namespace detail
+
+/// Flat metadata store for one document.
+///
+/// Entries live in one contiguous vector ordered with reserved keys first (in
+/// `reserved_metadata_slot` order) followed by user keys ordered by text.
+/// Reserved accessors scan at most the leading slots and never hash or compare
+/// strings; other lookups scan small stores and binary search larger ones.
+/// User keys are stored inline, so no lookup touches the global intern pool.
+class document_metadata {
+public:
+  using value_type = std::pair<document_metadata_key, document_metadata_value>;
+  using const_iterator = std::vector<value_type>::const_iterator;
+
+  /// Returns the first entry.
+  [[nodiscard]] auto begin() const noexcept -> const_iterator { return entries_.begin(); }
+
+  /// Returns the past-the-end entry.
+  [[nodiscard]] auto end() const noexcept -> const_iterator { return entries_.end(); }
+
+  /// Returns the number of stored keys.
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return entries_.size(); }
+
+  /// Returns true when no key is stored.
+  [[nodiscard]] auto empty() const noexcept -> bool { return entries_.empty(); }
+
+  /// Reserves storage for `count` entries.
+  auto reserve(const std::size_t count) -> void { entries_.reserve(count); }
+
+  /// Finds one entry by key handle.
+  [[nodiscard]] auto find(const document_metadata_key &key) const -> const_iterator {
+    const auto rank = detail::reserved_rank(key);
+    if (rank < detail::reserved_metadata_slot_count) {
+      return find(static_cast<reserved_metadata_slot>(rank));
+    }
+    const auto position = lower_bound(rank, key.view());
+    if (position != entries_.end() && position->first == key) {
+      return position;
+    }
+    return entries_.end();
+  }
+
+  /// Finds one entry by key text.
+  [[nodiscard]] auto find(const std::string_view key) const -> const_iterator {
+    if (const auto rank = detail::reserved_rank(key); rank < detail::reserved_metadata_slot_count) {
+      return find(static_cast<reserved_metadata_slot>(rank));
+    }
+    if (entries_.size() <= linear_scan_limit) {
+      return std::ranges::find_if(entries_,
+                                  [key](const value_type &entry) { return entry.first == key; });
+    }
+    const auto position = lower_bound(detail::reserved_metadata_slot_count, key);
+    if (position != entries_.end() && position->first == key) {
+      return position;
+    }
+    return entries_.end();
+  }
+
+  /// Finds one reserved entry without hashing or string comparison.
+  [[nodiscard]] auto find(const reserved_metadata_slot slot) const -> const_iterator {
+    const auto index = static_cast<std::size_t>(slot);
+    const auto *data = detail::reserved_metadata_keys()[index].data();
+    const auto limit = std::min(entries_.size(), index + 1U);
+    for (std::size_t position = 0U; position < limit; ++position) {
+      if (entries_[position].first.data() == data) {
+        return entries_.begin() + static_cast<std::ptrdiff_t>(position);
+      }
+    }
+    return entries_.end();
+  }
+
+  /// Returns true when `key` is stored.
+  template <typename key_t> [[nodiscard]] auto contains(const key_t &key) const -> bool {
+    return find(key) != entries_.end();
+  }
+
+  /// Inserts or replaces the value stored under `key`.
+  auto insert_or_assign(const document_metadata_key &key, document_metadata_value value)
+      -> value_type & {
+    const auto rank = detail::reserved_rank(key);
+    return assign(rank, key.view(), [&key] { return key; }, std::move(value));
+  }
+
+  /// Inserts or replaces the value stored under `key`. Reserved names reuse
+  /// their interned handle; any other name is stored inline.
+  auto insert_or_assign(const std::string_view key, document_metadata_value value)
+      -> value_type & {
+    const auto rank = detail::reserved_rank(key);
+    if (rank < detail::reserved_metadata_slot_count) {
+      return insert_or_assign(detail::reserved_metadata_keys()[rank], std::move(value));
+    }
+    return assign(
+        rank, key, [key] { return document_metadata_key{std::string{key}}; }, std::move(value));
+  }
+
+  /// Removes `key`; returns the number of removed entries.
+  template <typename key_t> auto erase(const key_t &key) -> std::size_t {
+    const auto position = find(key);
+    if (position == entries_.end()) {
+      return 0U;
+    }
+    entries_.erase(position);
+    return 1U;
+  }
+
+  /// Copies all entries into a hash map for interchange.
+  [[nodiscard]] auto to_map() const -> document_metadata_map {
+    document_metadata_map map{};
+    map.reserve(entries_.size());
+    for (const auto &[key, value] : entries_) {
+      map.insert_or_assign(key.str(), value);
+    }
+    return map;
+  }
+
+private:
+  static constexpr std::size_t linear_scan_limit = 8U;
+
+  template <typename make_key_t>
+  auto assign(const std::size_t rank, const std::string_view text, make_key_t &&make_key,
+              document_metadata_value value) -> value_type & {
+    auto position = entries_.begin() + (lower_bound(rank, text) - entries_.cbegin());
+    if (position != entries_.end() && detail::reserved_rank(position->first) == rank &&
+        position->first == text) {
+      position->second = std::move(value);
+      return *position;
+    }
+    return *entries_.emplace(position, make_key(), std::move(value));
+  }
+
+  [[nodiscard]] auto lower_bound(const std::size_t rank, const std::string_view text) const
+      -> const_iterator {
+    // Reserved keys occupy the leading slots, so their search range is tiny.
+    if (rank < detail::reserved_metadata_slot_count) {
+      const auto limit = std::min(entries_.size(), rank + 1U);
+      std::size_t position = 0U;
+      while (position < limit && detail::reserved_rank(entries_[position].first) < rank) {
+        ++position;
+      }
+      return entries_.begin() + static_cast<std::ptrdiff_t>(position);
+    }
+    return std::partition_point(entries_.begin(), entries_.end(), [&](const value_type &entry) {
+      const auto entry_rank = detail::reserved_rank(entry.first);
+      return entry_rank != rank ? entry_rank < rank : entry.first.view() < text;
+    });
+  }
+
+  /// Entries ordered by (reserved slot, key text).
+  std::vector<value_type> entries_{};
+};
+
+} // namespace wh::schema
@@ -0,0 +1,323 @@
+// Defines immutable, refcounted, content-hashed binary blobs carried by
+// multimodal message parts, plus the interning store and serialization table
+// that deduplicate them by content.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "wh/core/error.hpp"
+#include "wh/core/result.hpp"
+#include "wh/core/type_traits.hpp"
+#include "wh/internal/type_name.hpp"
+
+namespace wh::schema {
+
+namespace detail {
+
+inline constexpr std::string_view base64_alphabet =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+inline constexpr std::uint8_t base64_invalid = 0xFFU;
+
+/// Reverse lookup table for the standard base64 alphabet.
+inline constexpr auto base64_decode_table = [] {
+  std::array<std::uint8_t, 256U> table{};
+  table.fill(base64_invalid);
+  for (std::size_t index = 0U; index < base64_alphabet.size(); ++index) {
+    table[static_cast<unsigned char>(base64_alphabet[index])] = static_cast<std::uint8_t>(index);
+  }
+  return table;
+}();
+
+} // namespace detail
+
+/// Encodes raw bytes with the standard padded base64 alphabet.
+[[nodiscard]] inline auto encode_base64(const std::string_view bytes) -> std::string {
+  const auto byte_at = [bytes](const std::size_t index) -> std::uint32_t {
+    return index < bytes.size() ? static_cast<unsigned char>(bytes[index]) : 0U;
+  };
+  std::string encoded{};
+  encoded.reserve((bytes.size() + 2U) / 3U * 4U);
+  for (std::size_t index = 0U; index < bytes.size(); index += 3U) {
+    const auto chunk = (byte_at(index) << 16U) | (byte_at(index + 1U) << 8U) | byte_at(index + 2U);
+    const auto remaining = bytes.size() - index;
+    encoded.push_back(detail::base64_alphabet[(chunk >> 18U) & 0x3FU]);
+    encoded.push_back(detail::base64_alphabet[(chunk >> 12U) & 0x3FU]);
+    encoded.push_back(remaining > 1U ? detail::base64_alphabet[(chunk >> 6U) & 0x3FU] : '=');
+    encoded.push_back(remaining > 2U ? detail::base64_alphabet[chunk & 0x3FU] : '=');
+  }
+  return encoded;
+}
+
+/// Decodes padded or unpadded standard base64 into raw bytes.
+[[nodiscard]] inline auto decode_base64(std::string_view encoded)
+    -> wh::core::result<std::string> {
+  while (!encoded.empty() && encoded.back() == '=') {
+    encoded.remove_suffix(1U);
+  }
+  if (encoded.size() % 4U == 1U) {
+    return wh::core::result<std::string>::failure(wh::core::errc::invalid_argument);
+  }
+
+  std::string bytes{};
+  bytes.reserve(encoded.size() / 4U * 3U + 2U);
+  std::uint32_t buffer = 0U;
+  std::uint32_t bits = 0U;
+  for (const char value : encoded) {
+    const auto sextet = detail::base64_decode_table[static_cast<unsigned char>(value)];
+    if (sextet == detail::base64_invalid) {
+      return wh::core::result<std::string>::failure(wh::core::errc::invalid_argument);
+    }
+    buffer = (buffer << 6U) | sextet;
+    bits += 6U;
+    if (bits >= 8U) {
+      bits -= 8U;
+      bytes.push_back(static_cast<char>((buffer >> bits) & 0xFFU));
+    }
+  }
+  return bytes;
+}
+
+/// Immutable, refcounted binary payload identified by its content hash.
+///
+/// Copies share one byte buffer, so history copies, checkpoints, and agent
+/// handoffs never duplicate inline media.
+class media_blob {
+  struct storage {
+    /// Raw decoded bytes.
+    std::string bytes{};
+    /// Stable 64-bit content hash of `bytes`.
+    std::uint64_t hash{0U};
+  };
+
+public:
+  media_blob() = default;
+
+  /// Builds one blob that takes ownership of raw bytes.
+  [[nodiscard]] static auto from_bytes(std::string bytes) -> media_blob {
+    media_blob blob{};
+    const auto hash = wh::internal::stable_name_hash(bytes);
+    blob.storage_ = std::make_shared<const storage>(storage{
+        .bytes = std::move(bytes),
+        .hash = hash,
+    });
+    return blob;
+  }
+
+  /// Builds one blob by decoding base64 text once.
+  [[nodiscard]] static auto from_base64(const std::string_view encoded)
+      -> wh::core::result<media_blob> {
+    auto bytes = decode_base64(encoded);
+    if (bytes.has_error()) {
+      return wh::core::result<media_blob>::failure(bytes.error());
+    }
+    return from_bytes(std::move(bytes).value());
+  }
+
+  /// Returns true when this blob carries no payload.
+  [[nodiscard]] auto empty() const noexcept -> bool { return storage_ == nullptr; }
+
+  /// Returns the raw payload bytes.
+  [[nodiscard]] auto bytes() const noexcept -> std::string_view {
+    return storage_ == nullptr ? std::string_view{} : std::string_view{storage_->bytes};
+  }
+
+  /// Returns the raw payload size in bytes.
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return bytes().size(); }
+
+  /// Returns the stable content hash; zero for an empty blob.
+  [[nodiscard]] auto hash() const noexcept -> std::uint64_t {
+    return storage_ == nullptr ? 0U : storage_->hash;
+  }
+
+  /// Returns the number of handles sharing this payload.
+  [[nodiscard]] auto use_count() const noexcept -> long { return storage_.use_count(); }
+
+  /// Returns true when both handles share one payload buffer.
+  [[nodiscard]] auto same_storage(const media_blob &other) const noexcept -> bool {
+    return storage_ == other.storage_;
+  }
+
+  /// Re-encodes the payload as padded base64 for provider wire formats.
+  [[nodiscard]] auto to_base64() const -> std::string { return encode_base64(bytes()); }
+
+  /// Equality compares shared storage first, then hash and bytes.
+  [[nodiscard]] friend auto operator==(const media_blob &lhs, const media_blob &rhs) noexcept
+      -> bool {
+    return lhs.storage_ == rhs.storage_ || (lhs.hash() == rhs.hash() && lhs.bytes() == rhs.bytes());
+  }
+
+private:
+  friend class media_blob_store;
+
+  /// Shared immutable payload, or null when empty.
+  std::shared_ptr<const storage> storage_{};
+};
+
+/// Thread-safe interning store that deduplicates live blobs by content.
+///
+/// Entries are weak, so the store never extends blob lifetime; expired entries
+/// are reclaimed on collision and by `purge_expired`.
+class media_blob_store {
+public:
+  /// Returns the live blob with equal content, or adopts `blob`.
+  [[nodiscard]] auto intern(const media_blob &blob) -> media_blob {
+    if (blob.empty()) {
+      return blob;
+    }
+    std::lock_guard lock{lock_};
+    auto &bucket = entries_[blob.hash()];
+    for (auto iter = bucket.begin(); iter != bucket.end();) {
+      auto live = iter->lock();
+      if (live == nullptr) {
+        iter = bucket.erase(iter);
+        continue;
+      }
+      if (live->bytes == blob.bytes()) {
+        media_blob shared{};
+        shared.storage_ = std::move(live);
+        return shared;
+      }
+      ++iter;
+    }
+    bucket.push_back(blob.storage_);
+    return blob;
+  }
+
+  /// Interns raw bytes, reusing a live blob with equal content.
+  [[nodiscard]] auto intern_bytes(std::string bytes) -> media_blob {
+    return intern(media_blob::from_bytes(std::move(bytes)));
+  }
+
+  /// Decodes base64 once and interns the resulting bytes.
+  [[nodiscard]] auto intern_base64(const std::string_view encoded)
+      -> wh::core::result<media_blob> {
+    auto blob = media_blob::from_base64(encoded);
+    if (blob.has_error()) {
+      return blob;
+    }
+    return intern(blob.value());
+  }
+
+  /// Drops entries whose blobs are no longer referenced.
+  auto purge_expired() -> void {
+    std::lock_guard lock{lock_};
+    for (auto iter = entries_.begin(); iter != entries_.end();) {
+      std::erase_if(iter->second, [](const auto &entry) { return entry.expired(); });
+      iter = iter->second.empty() ? entries_.erase(iter) : std::next(iter);
+    }
+  }
+
+  /// Returns the number of live interned blobs.
+  [[nodiscard]] auto size() const -> std::size_t {
+    std::lock_guard lock{lock_};
+    std::size_t live = 0U;
+    for (const auto &[hash, bucket] : entries_) {
+      for (const auto &entry : bucket) {
+        live += entry.expired() ? 0U : 1U;
+      }
+    }
+    return live;
+  }
+
+private:
+  /// Guards `entries_`.
+  mutable std::mutex lock_{};
+  /// Weak blob storage grouped by content hash.
+  std::unordered_map<std::uint64_t, std::vector<std::weak_ptr<const media_blob::storage>>>
+      entries_{};
+};
+
+/// Per-checkpoint blob table that writes each distinct blob once and lets
+/// every occurrence refer to it by id.
+class media_blob_table {
+public:
+  /// Returns the stable id of `blob`, adding it on first reference.
+  [[nodiscard]] auto reference(const media_blob &blob) -> std::string {
+    auto id = make_id(blob.hash(), 0U);
+    for (std::size_t salt = 1U;; ++salt) {
+      const auto iter = blobs_.find(id);
+      if (iter == blobs_.end()) {
+        order_.push_back(id);
+        blobs_.emplace(id, blob);
+        return id;
+      }
+      if (iter->second == blob) {
+        return id;
+      }
+      id = make_id(blob.hash(), salt);
+    }
+  }
+
+  /// Adds one decoded table entry under an id written by `reference`.
+  auto insert(std::string id, media_blob blob) -> wh::core::result<void> {
+    if (id.empty() || blobs_.contains(id)) {
+      return wh::core::result<void>::failure(wh::core::errc::already_exists);
+    }
+    order_.push_back(id);
+    blobs_.emplace(std::move(id), std::move(blob));
+    return {};
+  }
+
+  /// Resolves one id back to its shared blob.
+  [[nodiscard]] auto resolve(const std::string_view id) const -> wh::core::result<media_blob> {
+    const auto iter = blobs_.find(id);
+    if (iter == blobs_.end()) {
+      return wh::core::result<media_blob>::failure(wh::core::errc::not_found);
+    }
+    return iter->second;
+  }
+
+  /// Visits entries in first-reference order.
+  template <typename visitor_t> auto for_each(visitor_t &&visitor) const -> void {
+    for (const auto &id : order_) {
+      visitor(std::string_view{id}, blobs_.find(id)->second);
+    }
+  }
+
+  /// Returns the number of distinct blobs.
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return order_.size(); }
+
+  /// Returns the summed raw size of distinct blobs.
+  [[nodiscard]] auto payload_bytes() const noexcept -> std::size_t {
+    std::size_t total = 0U;
+    for (const auto &[id, blob] : blobs_) {
+      total += blob.size();
+    }
+    return total;
+  }
+
+private:
+  [[nodiscard]] static auto make_id(const std::uint64_t hash, const std::size_t salt)
+      -> std::string {
+    constexpr std::string_view digits = "0123456789abcdef";
+    std::string id(16U, '0');
+    for (std::size_t index = 0U; index < 16U; ++index) {
+      id[15U - index] = digits[(hash >> (index * 4U)) & 0xFU];
+    }
+    if (salt != 0U) {
+      id.push_back('-');
+      id.append(std::to_string(salt));
+    }
+    return id;
+  }
+
+  /// Ids in first-reference order, so encoded tables are deterministic.
+  std::vector<std::string> order_{};
+  /// Distinct blobs keyed by id.
+  std::unordered_map<std::string, media_blob, wh::core::transparent_string_hash,
+                     wh::core::transparent_string_equal>
+      blobs_{};
+};
+
+} // namespace wh::schema
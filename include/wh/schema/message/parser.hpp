@@ -110,7 +110,7 @@ namespace detail {
   if (const auto id_member = input.FindMember("id");
       id_member != input.MemberEnd() && id_member->value.IsString()) {
     parsed.message_id =
-        std::string{id_member->value.GetString(), id_member->value.GetStringLength()};
+        std::string_view{id_member->value.GetString(), id_member->value.GetStringLength()};
   }
 
   if (const auto content_member = input.FindMember("content");
@@ -131,18 +131,19 @@ namespace detail {
 
       if (const auto member = tool_call.FindMember("id");
           member != tool_call.MemberEnd() && member->value.IsString()) {
-        call.id = std::string{member->value.GetString(), member->value.GetStringLength()};
+        call.id = std::string_view{member->value.GetString(), member->value.GetStringLength()};
       }
       if (const auto member = tool_call.FindMember("type");
           member != tool_call.MemberEnd() && member->value.IsString()) {
-        call.type = std::string{member->value.GetString(), member->value.GetStringLength()};
+        call.type = std::string_view{member->value.GetString(), member->value.GetStringLength()};
       }
 
       if (const auto fn = tool_call.FindMember("function");
           fn != tool_call.MemberEnd() && fn->value.IsObject()) {
         if (const auto member = fn->value.FindMember("name");
             member != fn->value.MemberEnd() && member->value.IsString()) {
-          call.name = std::string{member->value.GetString(), member->value.GetStringLength()};
+          call.name =
+              std::string_view{member->value.GetString(), member->value.GetStringLength()};
         }
         if (const auto member = fn->value.FindMember("arguments");
             member != fn->value.MemberEnd() && member->value.IsString()) {
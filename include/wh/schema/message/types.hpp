@@ -6,9 +6,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <optional>
 #include <ranges>
 #include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <variant>
@@ -16,7 +19,9 @@
 
 #include "wh/core/error.hpp"
 #include "wh/core/result.hpp"
+#include "wh/core/small_string.hpp"
 #include "wh/core/type_traits.hpp"
+#include "wh/schema/message/blob.hpp"
 
 namespace wh::schema {
 
@@ -33,20 +38,30 @@ struct text_part {
 struct image_part {
   /// URI or provider-specific image locator.
   std::string uri{};
+  /// MIME type; taken from the `data:` header when the URI is interned.
+  std::string mime_type{};
+  /// Shared inline image bytes; set instead of a `data:` URI once interned.
+  media_blob data{};
 };
 
-/// Audio content part (inline base64 or URI).
+/// Audio content part (inline base64, shared bytes, or URI).
 struct audio_part {
   /// Inline base64 audio payload when streaming inline blobs.
   std::string base64{};
   /// URI for externally hosted audio.
   std::string uri{};
+  /// Shared decoded audio bytes; set instead of `base64` once interned.
+  media_blob data{};
 };
 
 /// Video reference content part.
 struct video_part {
   /// URI for externally hosted video.
   std::string uri{};
+  /// MIME type; taken from the `data:` header when the URI is interned.
+  std::string mime_type{};
+  /// Shared inline video bytes; set instead of a `data:` URI once interned.
+  media_blob data{};
 };
 
 /// Generic file content part.
@@ -55,6 +70,8 @@ struct file_part {
   std::string uri{};
   /// MIME type used by adapter/model-side routing.
   std::string mime_type{};
+  /// Shared inline file bytes; set instead of a `data:` URI once interned.
+  media_blob data{};
 };
 
 /// Tool call delta/final payload part.
@@ -62,11 +79,11 @@ struct tool_call_part {
   /// Tool call position used to reassemble deltas deterministically.
   std::size_t index{0U};
   /// Stable call id returned by provider.
-  std::string id{};
+  wh::core::small_string<> id{};
   /// Tool call kind, normally `function`.
-  std::string type{"function"};
+  wh::core::small_string<> type{"function"};
   /// Tool/function name.
-  std::string name{};
+  wh::core::small_string<> name{};
   /// Tool arguments payload (often JSON string).
   std::string arguments{};
   /// Whether this call is fully emitted.
@@ -108,15 +125,15 @@ struct response_meta {
 /// Canonical multi-part message representation.
 struct message {
   /// Provider-level message id when available.
-  std::string message_id{};
+  wh::core::small_string<> message_id{};
   /// Sender role in conversation.
   message_role role{message_role::user};
   /// Optional participant name.
   std::string name{};
   /// Tool-call correlation id for tool role messages.
-  std::string tool_call_id{};
+  wh::core::small_string<> tool_call_id{};
   /// Tool name for tool role messages.
-  std::string tool_name{};
+  wh::core::small_string<> tool_name{};
   /// Ordered multimodal/tool parts.
   std::vector<message_part> parts{};
   /// Response-level metadata.
@@ -206,8 +223,8 @@ inline auto merge_usage(token_usage &target, const token_usage &next) noexcept -
     return false;
   }
 
-  return left_audio->uri.empty() && right_audio->uri.empty() && !left_audio->base64.empty() &&
-         !right_audio->base64.empty();
+  return left_audio->uri.empty() && right_audio->uri.empty() && left_audio->data.empty() &&
+         right_audio->data.empty() && !left_audio->base64.empty() && !right_audio->base64.empty();
 }
 
 /// In-place merge for adjacent mergeable parts.
@@ -475,6 +492,191 @@ inline auto merge_adjacent_into(message_part &target, const message_part &source
   return merged;
 }
 
+/// Folds one later message chunk into `merged` as it arrives.
+///
+/// Text/audio deltas append to the last content part in place and tool-call
+/// deltas merge into the earlier part with the same index, so a running
+/// message stays bounded by its content size. `finish_message_chunks` applies the final
+/// ordering; together they match `merge_message_chunks` over the same chunks.
+inline auto append_message_chunk(message &merged, message &&chunk) -> wh::core::result<void> {
+  if (merged.parts.empty() || chunk.parts.empty()) {
+    return wh::core::result<void>::failure(wh::core::errc::protocol_error);
+  }
+  if (!detail::is_identity_compatible(merged, chunk)) {
+    return wh::core::result<void>::failure(wh::core::errc::contract_violation);
+  }
+
+  if (merged.name.empty()) {
+    merged.name = std::move(chunk.name);
+  }
+  if (merged.tool_call_id.empty()) {
+    merged.tool_call_id = std::move(chunk.tool_call_id);
+  }
+  if (merged.tool_name.empty()) {
+    merged.tool_name = std::move(chunk.tool_name);
+  }
+  if (!chunk.meta.finish_reason.empty()) {
+    merged.meta.finish_reason = std::move(chunk.meta.finish_reason);
+  }
+  detail::merge_usage(merged.meta.usage, chunk.meta.usage);
+  merged.meta.logprobs.insert(merged.meta.logprobs.end(),
+                              std::make_move_iterator(chunk.meta.logprobs.begin()),
+                              std::make_move_iterator(chunk.meta.logprobs.end()));
+
+  for (auto &part : chunk.parts) {
+    if (auto *tool_call = std::get_if<tool_call_part>(&part); tool_call != nullptr) {
+      const auto existing_iter = std::ranges::find_if(merged.parts, [&](const message_part &entry) {
+        const auto *existing = std::get_if<tool_call_part>(&entry);
+        return existing != nullptr && existing->index == tool_call->index;
+      });
+      if (existing_iter == merged.parts.end()) {
+        merged.parts.push_back(std::move(part));
+        continue;
+      }
+
+      auto &existing = std::get<tool_call_part>(*existing_iter);
+      if ((!existing.id.empty() && !tool_call->id.empty() && existing.id != tool_call->id) ||
+          (!existing.type.empty() && !tool_call->type.empty() &&
+           existing.type != tool_call->type) ||
+          (!existing.name.empty() && !tool_call->name.empty() &&
+           existing.name != tool_call->name)) {
+        return wh::core::result<void>::failure(wh::core::errc::contract_violation);
+      }
+      if (existing.id.empty()) {
+        existing.id = std::move(tool_call->id);
+      }
+      if (existing.type.empty()) {
+        existing.type = std::move(tool_call->type);
+      }
+      if (existing.name.empty()) {
+        existing.name = std::move(tool_call->name);
+      }
+      existing.arguments.append(tool_call->arguments);
+      existing.complete = existing.complete && tool_call->complete;
+      continue;
+    }
+
+    // Normalization moves tool calls last, so merge past any trailing ones.
+    const auto last_content = std::ranges::find_if(
+        merged.parts.rbegin(), merged.parts.rend(), [](const message_part &entry) {
+          return !std::holds_alternative<tool_call_part>(entry);
+        });
+    if (last_content != merged.parts.rend() &&
+        detail::can_merge_adjacent_parts(*last_content, part)) {
+      detail::merge_adjacent_into(*last_content, part);
+      continue;
+    }
+    merged.parts.push_back(std::move(part));
+  }
+  return {};
+}
+
+/// Applies final part normalization to a message folded by `append_message_chunk`.
+inline auto finish_message_chunks(message &merged) -> wh::core::result<void> {
+  auto normalized = detail::normalize_message_parts(std::move(merged.parts));
+  if (normalized.has_error()) {
+    return wh::core::result<void>::failure(normalized.error());
+  }
+  merged.parts = std::move(normalized).value();
+  return {};
+}
+
+namespace detail {
+
+/// Splits one `data:<mime>;base64,<payload>` URI into mime type and payload.
+[[nodiscard]] inline auto split_base64_data_uri(const std::string_view uri)
+    -> std::optional<std::pair<std::string_view, std::string_view>> {
+  constexpr std::string_view scheme = "data:";
+  constexpr std::string_view marker = ";base64,";
+  if (!uri.starts_with(scheme)) {
+    return std::nullopt;
+  }
+  const auto marker_pos = uri.find(marker, scheme.size());
+  if (marker_pos == std::string_view::npos) {
+    return std::nullopt;
+  }
+  return std::pair{uri.substr(scheme.size(), marker_pos - scheme.size()),
+                   uri.substr(marker_pos + marker.size())};
+}
+
+/// Moves one base64 `data:` URI into a shared blob; leaves other URIs intact.
+template <typename part_t>
+[[nodiscard]] inline auto intern_data_uri(part_t &part, media_blob_store &store)
+    -> wh::core::result<bool> {
+  const auto split = split_base64_data_uri(part.uri);
+  if (!split.has_value() || !part.data.empty()) {
+    return false;
+  }
+  auto blob = store.intern_base64(split->second);
+  if (blob.has_error()) {
+    return wh::core::result<bool>::failure(blob.error());
+  }
+  if (part.mime_type.empty()) {
+    part.mime_type = std::string{split->first};
+  }
+  part.data = std::move(blob).value();
+  part.uri.clear();
+  part.uri.shrink_to_fit();
+  return true;
+}
+
+} // namespace detail
+
+/// Returns the part URI, rebuilding `data:<mime>;base64,<payload>` when the
+/// inline bytes were moved into `data` by `intern_message_media`.
+template <typename part_t>
+  requires std::same_as<part_t, image_part> || std::same_as<part_t, video_part> ||
+           std::same_as<part_t, file_part>
+[[nodiscard]] inline auto media_data_uri(const part_t &part) -> std::string {
+  if (!part.uri.empty() || part.data.empty()) {
+    return part.uri;
+  }
+  std::string uri{"data:"};
+  uri.append(part.mime_type).append(";base64,").append(part.data.to_base64());
+  return uri;
+}
+
+/// Decodes inline media once into shared blobs deduplicated by `store`.
+///
+/// Audio `base64` payloads and base64 `data:` URIs on image, video, and file
+/// parts are replaced by `data`; external URIs are left unchanged. Returns the
+/// number of parts converted.
+inline auto intern_message_media(message &value, media_blob_store &store)
+    -> wh::core::result<std::size_t> {
+  std::size_t converted = 0U;
+  for (auto &part : value.parts) {
+    auto interned = std::visit(
+        [&store](auto &typed) -> wh::core::result<bool> {
+          using part_t = std::remove_cvref_t<decltype(typed)>;
+          if constexpr (std::same_as<part_t, audio_part>) {
+            if (typed.base64.empty() || !typed.data.empty()) {
+              return false;
+            }
+            auto blob = store.intern_base64(typed.base64);
+            if (blob.has_error()) {
+              return wh::core::result<bool>::failure(blob.error());
+            }
+            typed.data = std::move(blob).value();
+            typed.base64.clear();
+            typed.base64.shrink_to_fit();
+            return true;
+          } else if constexpr (std::same_as<part_t, image_part> ||
+                               std::same_as<part_t, video_part> ||
+                               std::same_as<part_t, file_part>) {
+            return detail::intern_data_uri(typed, store);
+          } else {
+            return false;
+          }
+        },
+        part);
+    if (interned.has_error()) {
+      return wh::core::result<std::size_t>::failure(interned.error());
+    }
+    converted += interned.value() ? 1U : 0U;
+  }
+  return converted;
+}
+
 /// Applies one message delta with optional audit log (linear scan path).
 template <typename MessageType>
   requires std::same_as<wh::core::remove_cvref_t<MessageType>, message>
@@ -0,0 +1,152 @@
+// Defines JSON codecs for shared media blobs, writing each distinct blob once
+// per serialized payload through a thread-scoped blob table.
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "wh/core/error.hpp"
+#include "wh/core/json.hpp"
+#include "wh/core/result.hpp"
+#include "wh/schema/message/blob.hpp"
+
+namespace wh::schema {
+
+namespace detail {
+
+/// Member name marking one blob reference inside an encoded payload.
+inline constexpr std::string_view media_blob_ref_key = "$blob";
+
+/// Blob table receiving references on this thread, or null for inline base64.
+inline thread_local media_blob_table *active_media_blob_table = nullptr;
+
+inline auto set_json_string(wh::core::json_value &output, const std::string_view value,
+                            wh::core::json_allocator &allocator) -> void {
+  output.SetString(value.data(), static_cast<wh::core::json_size_type>(value.size()), allocator);
+}
+
+} // namespace detail
+
+/// Routes blob encode/decode on the current thread through one table.
+///
+/// While a scope is active, every blob encodes as `{"$blob": id}` and its bytes
+/// land in the table once; decoding resolves those ids back to shared blobs.
+/// Without a scope, blobs encode as inline base64 strings.
+class media_blob_table_scope {
+public:
+  explicit media_blob_table_scope(media_blob_table &table) noexcept
+      : previous_(detail::active_media_blob_table) {
+    detail::active_media_blob_table = &table;
+  }
+
+  media_blob_table_scope(const media_blob_table_scope &) = delete;
+  auto operator=(const media_blob_table_scope &) -> media_blob_table_scope & = delete;
+
+  ~media_blob_table_scope() { detail::active_media_blob_table = previous_; }
+
+private:
+  /// Table restored when this scope ends, so scopes nest.
+  media_blob_table *previous_{nullptr};
+};
+
+/// Encodes one blob as a table reference, inline base64, or null when empty.
+inline auto wh_to_json(const media_blob &input, wh::core::json_value &output,
+                       wh::core::json_allocator &allocator) -> wh::core::result<void> {
+  if (input.empty()) {
+    output.SetNull();
+    return {};
+  }
+  auto *table = detail::active_media_blob_table;
+  if (table == nullptr) {
+    detail::set_json_string(output, input.to_base64(), allocator);
+    return {};
+  }
+  wh::core::json_value key{};
+  wh::core::json_value id{};
+  detail::set_json_string(key, detail::media_blob_ref_key, allocator);
+  detail::set_json_string(id, table->reference(input), allocator);
+  output.SetObject();
+  output.AddMember(key.Move(), id.Move(), allocator);
+  return {};
+}
+
+/// Decodes one blob from a table reference, inline base64, or null.
+inline auto wh_from_json(const wh::core::json_value &input, media_blob &output)
+    -> wh::core::result<void> {
+  if (input.IsNull()) {
+    output = media_blob{};
+    return {};
+  }
+  if (input.IsString()) {
+    auto blob = media_blob::from_base64(
+        std::string_view{input.GetString(), static_cast<std::size_t>(input.GetStringLength())});
+    if (blob.has_error()) {
+      return wh::core::result<void>::failure(blob.error());
+    }
+    output = std::move(blob).value();
+    return {};
+  }
+  auto id = wh::core::json_find_member(input, detail::media_blob_ref_key);
+  if (id.has_error()) {
+    return wh::core::result<void>::failure(id.error());
+  }
+  if (!id.value()->IsString()) {
+    return wh::core::result<void>::failure(wh::core::errc::type_mismatch);
+  }
+  const auto *table = detail::active_media_blob_table;
+  if (table == nullptr) {
+    return wh::core::result<void>::failure(wh::core::errc::not_found);
+  }
+  auto blob = table->resolve(std::string_view{
+      id.value()->GetString(), static_cast<std::size_t>(id.value()->GetStringLength())});
+  if (blob.has_error()) {
+    return wh::core::result<void>::failure(blob.error());
+  }
+  output = std::move(blob).value();
+  return {};
+}
+
+/// Encodes one blob table as an object of id to base64 in first-reference order.
+inline auto wh_to_json(const media_blob_table &input, wh::core::json_value &output,
+                       wh::core::json_allocator &allocator) -> wh::core::result<void> {
+  output.SetObject();
+  input.for_each([&](const std::string_view id, const media_blob &blob) {
+    wh::core::json_value key{};
+    wh::core::json_value encoded{};
+    detail::set_json_string(key, id, allocator);
+    detail::set_json_string(encoded, blob.to_base64(), allocator);
+    output.AddMember(key.Move(), encoded.Move(), allocator);
+  });
+  return {};
+}
+
+/// Decodes one blob table, decoding every distinct blob exactly once.
+inline auto wh_from_json(const wh::core::json_value &input, media_blob_table &output)
+    -> wh::core::result<void> {
+  if (!input.IsObject()) {
+    return wh::core::result<void>::failure(wh::core::errc::type_mismatch);
+  }
+  media_blob_table decoded{};
+  for (auto member = input.MemberBegin(); member != input.MemberEnd(); ++member) {
+    if (!member->value.IsString()) {
+      return wh::core::result<void>::failure(wh::core::errc::type_mismatch);
+    }
+    auto blob = media_blob::from_base64(std::string_view{
+        member->value.GetString(), static_cast<std::size_t>(member->value.GetStringLength())});
+    if (blob.has_error()) {
+      return wh::core::result<void>::failure(blob.error());
+    }
+    auto inserted = decoded.insert(
+        std::string{member->name.GetString(), member->name.GetStringLength()},
+        std::move(blob).value());
+    if (inserted.has_error()) {
+      return inserted;
+    }
+  }
+  output = std::move(decoded);
+  return {};
+}
+
+} // namespace wh::schema
@@ -2,5 +2,6 @@
 #pragma once
 
 #include "wh/schema/stream/adapter/filter_map_stream_reader.hpp"
+#include "wh/schema/stream/adapter/fused_stream_reader.hpp"
 #include "wh/schema/stream/adapter/to_stream_reader.hpp"
 #include "wh/schema/stream/adapter/transform_stream_reader.hpp"
@@ -0,0 +1,195 @@
+// Defines fused transform/filter-map adapter chains and a compile-time
+// pipeline builder that type-erases a whole chain once at its boundary.
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "wh/core/result.hpp"
+#include "wh/schema/stream/adapter/detail/adapter_support.hpp"
+#include "wh/schema/stream/adapter/filter_map_stream_reader.hpp"
+#include "wh/schema/stream/adapter/transform_stream_reader.hpp"
+#include "wh/schema/stream/core/any_stream.hpp"
+#include "wh/schema/stream/core/concepts.hpp"
+
+namespace wh::schema::stream {
+
+namespace detail {
+
+/// One transform stage inside a fused adapter chain.
+template <typename callback_t> struct fused_transform_stage {
+  /// Callback returning `wh::core::result<U>`.
+  callback_t callback;
+};
+
+/// One filter-map stage inside a fused adapter chain.
+template <typename callback_t> struct fused_filter_map_stage {
+  /// Callback returning `wh::core::result<filter_map_step<U>>`.
+  callback_t callback;
+};
+
+template <typename stage_t, typename input_t> struct fused_stage_output;
+
+template <typename callback_t, typename input_t>
+struct fused_stage_output<fused_transform_stage<callback_t>, input_t> {
+  using type = typename decltype(select_adapter_result<callback_t, input_t>(0))::value_type;
+};
+
+template <typename callback_t, typename input_t>
+struct fused_stage_output<fused_filter_map_stage<callback_t>, input_t> {
+  using result_t = decltype(select_adapter_result<callback_t, input_t>(0));
+  using type = typename filter_map_result_traits<result_t>::value_type;
+};
+
+template <typename input_t, typename... stage_ts> struct fused_chain_output {
+  using type = input_t;
+};
+
+template <typename input_t, typename stage_t, typename... rest_ts>
+struct fused_chain_output<input_t, stage_t, rest_ts...> {
+  using type = typename fused_chain_output<typename fused_stage_output<stage_t, input_t>::type,
+                                           rest_ts...>::type;
+};
+
+template <typename stage_t> inline constexpr bool is_fused_transform_stage_v = false;
+
+template <typename callback_t>
+inline constexpr bool is_fused_transform_stage_v<fused_transform_stage<callback_t>> = true;
+
+} // namespace detail
+
+/// Callback that runs a whole transform/filter-map stage chain on one value.
+///
+/// Plugged into a single `transform_stream_reader` (transform-only chains) or
+/// `filter_map_stream_reader` (any skipping stage), so every chunk crosses one
+/// chunk envelope, one shared adapter state, and at most one erased call.
+template <typename input_t, typename... stage_ts> class fused_adapter_chain {
+public:
+  /// Value type produced by the last stage.
+  using output_type = typename detail::fused_chain_output<input_t, stage_ts...>::type;
+  /// True when at least one stage may drop a chunk.
+  static constexpr bool can_skip = !(detail::is_fused_transform_stage_v<stage_ts> && ...);
+  /// Adapter callback result for the selected host reader.
+  using result_type = wh::core::result<
+      std::conditional_t<can_skip, filter_map_step<output_type>, output_type>>;
+
+  explicit fused_adapter_chain(std::tuple<stage_ts...> stages) : stages_(std::move(stages)) {}
+
+  /// Runs all stages in order, stopping at the first failure or skip.
+  auto operator()(input_t &&value) -> result_type { return apply<0U>(std::move(value)); }
+
+private:
+  template <std::size_t index, typename value_t> auto apply(value_t &&value) -> result_type {
+    if constexpr (index == sizeof...(stage_ts)) {
+      if constexpr (can_skip) {
+        return filter_map_step<output_type>{std::in_place_index<0U>,
+                                            std::forward<value_t>(value)};
+      } else {
+        return output_type{std::forward<value_t>(value)};
+      }
+    } else {
+      using stage_t = std::tuple_element_t<index, std::tuple<stage_ts...>>;
+      auto produced = detail::invoke_adapter_callback(std::get<index>(stages_).callback,
+                                                      std::forward<value_t>(value));
+      if (produced.has_error()) {
+        return result_type::failure(produced.error());
+      }
+      if constexpr (detail::is_fused_transform_stage_v<stage_t>) {
+        return apply<index + 1U>(std::move(produced).value());
+      } else {
+        using stage_output_t =
+            typename detail::fused_stage_output<stage_t, std::remove_cvref_t<value_t>>::type;
+        auto step = std::move(produced).value();
+        if (std::holds_alternative<skip_t>(step)) {
+          return filter_map_step<output_type>{skip};
+        }
+        return apply<index + 1U>(std::get<stage_output_t>(std::move(step)));
+      }
+    }
+  }
+
+  std::tuple<stage_ts...> stages_;
+};
+
+/// Compile-time adapter pipeline over one concrete source reader.
+///
+/// Stages accumulate in the type; `build` fuses them into one concrete reader
+/// and `erase` wraps that reader in a single `any_stream_reader`, instead of
+/// erasing and heap-allocating every adapter layer separately.
+template <stream_reader reader_t, typename... stage_ts> class stream_pipeline {
+public:
+  using input_type = typename reader_t::value_type;
+  using value_type = typename detail::fused_chain_output<input_type, stage_ts...>::type;
+
+  explicit stream_pipeline(reader_t reader, std::tuple<stage_ts...> stages = {})
+      : reader_(std::move(reader)), stages_(std::move(stages)) {}
+
+  /// Appends one `value -> result<U>` stage.
+  template <typename callback_t>
+  [[nodiscard]] auto transform(callback_t &&callback) &&
+      -> stream_pipeline<reader_t, stage_ts...,
+                         detail::fused_transform_stage<std::remove_cvref_t<callback_t>>> {
+    static_assert(detail::adapter_callback<std::remove_cvref_t<callback_t>, value_type>,
+                  "transform callback must accept const T& or T&& and return wh::core::result<U>");
+    using stage_t = detail::fused_transform_stage<std::remove_cvref_t<callback_t>>;
+    return stream_pipeline<reader_t, stage_ts..., stage_t>{
+        std::move(reader_),
+        std::tuple_cat(std::move(stages_),
+                       std::tuple<stage_t>{stage_t{std::forward<callback_t>(callback)}})};
+  }
+
+  /// Appends one `value -> result<filter_map_step<U>>` stage.
+  template <typename callback_t>
+  [[nodiscard]] auto filter_map(callback_t &&callback) &&
+      -> stream_pipeline<reader_t, stage_ts...,
+                         detail::fused_filter_map_stage<std::remove_cvref_t<callback_t>>> {
+    static_assert(detail::adapter_callback<std::remove_cvref_t<callback_t>, value_type>,
+                  "filter_map callback must accept const T& or T&& and return "
+                  "wh::core::result<filter_map_step<U>>");
+    using stage_t = detail::fused_filter_map_stage<std::remove_cvref_t<callback_t>>;
+    return stream_pipeline<reader_t, stage_ts..., stage_t>{
+        std::move(reader_),
+        std::tuple_cat(std::move(stages_),
+                       std::tuple<stage_t>{stage_t{std::forward<callback_t>(callback)}})};
+  }
+
+  /// Returns the fused concrete reader, or the source when no stage was added.
+  [[nodiscard]] auto build() && {
+    if constexpr (sizeof...(stage_ts) == 0U) {
+      return std::move(reader_);
+    } else {
+      using chain_t = fused_adapter_chain<input_type, stage_ts...>;
+      if constexpr (chain_t::can_skip) {
+        return filter_map_stream_reader<reader_t, chain_t>{std::move(reader_),
+                                                           chain_t{std::move(stages_)}};
+      } else {
+        return transform_stream_reader<reader_t, chain_t>{std::move(reader_),
+                                                          chain_t{std::move(stages_)}};
+      }
+    }
+  }
+
+  /// Fuses the chain and type-erases it once at the pipeline boundary.
+  template <std::size_t storage_size = 128U>
+  [[nodiscard]] auto erase() && -> any_stream_reader<value_type, storage_size> {
+    return any_stream_reader<value_type, storage_size>{std::move(*this).build()};
+  }
+
+private:
+  reader_t reader_;
+  std::tuple<stage_ts...> stages_{};
+};
+
+/// Starts one compile-time adapter pipeline over `reader`.
+template <typename reader_t>
+  requires stream_reader<std::remove_cvref_t<reader_t>>
+[[nodiscard]] inline auto make_stream_pipeline(reader_t &&reader)
+    -> stream_pipeline<std::remove_cvref_t<reader_t>> {
+  return stream_pipeline<std::remove_cvref_t<reader_t>>{
+      std::remove_cvref_t<reader_t>{std::forward<reader_t>(reader)}};
+}
+
+} // namespace wh::schema::stream
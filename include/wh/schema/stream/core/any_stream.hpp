@@ -3,15 +3,20 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <exception>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <optional>
+#include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <stdexec/execution.hpp>
 
@@ -21,6 +26,7 @@
 #include "wh/core/result.hpp"
 #include "wh/core/stdexec/erased_receiver_ref.hpp"
 #include "wh/core/stdexec/detail/receiver_stop_bridge.hpp"
+#include "wh/internal/type_name.hpp"
 #include "wh/schema/stream/core/concepts.hpp"
 #include "wh/schema/stream/core/status.hpp"
 #include "wh/schema/stream/core/stream_base.hpp"
@@ -47,6 +53,53 @@ inline constexpr bool fits_erased_storage_v =
                                            wh::core::default_inline_storage_alignment) &&
     std::is_nothrow_move_constructible_v<model_t>;
 
+/// Process-wide counters for reader backends erased with heap storage.
+class stream_spill_registry {
+public:
+  struct entry {
+    std::string_view type_name{};
+    std::size_t model_size{0U};
+    std::size_t storage_size{0U};
+    std::atomic<std::uint64_t> count{0U};
+  };
+
+  [[nodiscard]] static auto instance() -> stream_spill_registry & {
+    static stream_spill_registry registry{};
+    return registry;
+  }
+
+  /// Registers one backend type; the returned counter stays valid forever.
+  [[nodiscard]] auto enroll(const std::string_view type_name, const std::size_t model_size,
+                            const std::size_t storage_size) -> std::atomic<std::uint64_t> & {
+    std::lock_guard lock{lock_};
+    auto &registered = entries_.emplace_back();
+    registered.type_name = type_name;
+    registered.model_size = model_size;
+    registered.storage_size = storage_size;
+    return registered.count;
+  }
+
+  template <typename visitor_t> auto for_each(visitor_t &&visitor) -> void {
+    std::lock_guard lock{lock_};
+    for (auto &registered : entries_) {
+      visitor(registered);
+    }
+  }
+
+private:
+  /// Guards `entries_`; counters themselves are updated lock-free.
+  std::mutex lock_{};
+  /// Stable-address entries, one per spilled backend type and storage size.
+  std::deque<entry> entries_{};
+};
+
+/// Counts one heap-stored reader backend of `model_t`.
+template <typename model_t, std::size_t storage_size> auto record_stream_spill() -> void {
+  static auto &count = stream_spill_registry::instance().enroll(
+      wh::internal::diagnostic_type_alias<model_t>(), sizeof(model_t), storage_size);
+  count.fetch_add(1U, std::memory_order_relaxed);
+}
+
 template <typename model_t, std::size_t storage_size>
 [[nodiscard]] inline auto storage_ptr(erased_storage<storage_size> &storage) noexcept -> model_t * {
   return std::launder(reinterpret_cast<model_t *>(storage.data.data()));
@@ -420,6 +473,46 @@ template <typename value_t>
 
 } // namespace detail
 
+/// True when `reader_t` is stored inline by `any_stream_reader<T, storage_size>`.
+template <typename reader_t, std::size_t storage_size = 128U>
+inline constexpr bool stream_reader_stores_inline_v =
+    detail::fits_erased_storage_v<reader_t, storage_size>;
+
+/// One reader backend type that `any_stream_reader` had to heap-allocate.
+struct stream_spill_record {
+  /// Diagnostic name of the backend type.
+  std::string_view type_name{};
+  /// Backend size in bytes.
+  std::size_t model_size{0U};
+  /// Inline storage size the backend did not fit.
+  std::size_t storage_size{0U};
+  /// Readers of this type erased with heap storage since the last reset.
+  std::uint64_t count{0U};
+};
+
+/// Returns every reader backend type that spilled to the heap, and how often.
+[[nodiscard]] inline auto stream_reader_spill_report() -> std::vector<stream_spill_record> {
+  std::vector<stream_spill_record> report{};
+  detail::stream_spill_registry::instance().for_each(
+      [&report](const detail::stream_spill_registry::entry &registered) {
+        report.push_back(stream_spill_record{
+            .type_name = registered.type_name,
+            .model_size = registered.model_size,
+            .storage_size = registered.storage_size,
+            .count = registered.count.load(std::memory_order_relaxed),
+        });
+      });
+  return report;
+}
+
+/// Zeroes spill counters while keeping the known backend types.
+inline auto reset_stream_reader_spill_report() -> void {
+  detail::stream_spill_registry::instance().for_each(
+      [](detail::stream_spill_registry::entry &registered) {
+        registered.count.store(0U, std::memory_order_relaxed);
+      });
+}
+
 /// Type-erased stream reader handle used to unify pipe/copy/merge readers.
 template <typename value_t, std::size_t storage_size>
 class any_stream_reader final
@@ -540,6 +633,7 @@ private:
     } else {
       ::new (storage_.data.data())
           storage_model_t(std::make_unique<model_t>(std::forward<arg_ts>(args)...));
+      detail::record_stream_spill<model_t, storage_size>();
     }
     vtable_ = &detail::any_stream_reader_model<value_t, storage_size, model_t>::vtable;
   }
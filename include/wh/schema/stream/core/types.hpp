@@ -10,6 +10,7 @@
 #include <utility>
 
 #include "wh/core/error.hpp"
+#include "wh/core/small_string.hpp"
 
 namespace wh::schema::stream {
 
@@ -32,7 +33,7 @@ template <typename value_t> struct stream_chunk {
   /// True marks stream EOF.
   bool eof{false};
   /// Optional source label for merge/select outputs.
-  std::string source{};
+  wh::core::small_string<> source{};
 
   template <typename value_u>
     requires std::constructible_from<value_t, value_u &&>
@@ -51,7 +52,7 @@ template <typename value_t> struct stream_chunk {
   }
 
   template <typename source_name_t>
-    requires std::constructible_from<std::string, source_name_t &&>
+    requires std::constructible_from<wh::core::small_string<>, source_name_t &&>
   /// Creates source-tagged EOF chunk.
   [[nodiscard]] static auto make_source_eof(source_name_t &&source_name) -> stream_chunk {
     stream_chunk chunk{};
@@ -14,6 +14,7 @@
 #include "wh/core/bounded_queue.hpp"
 #include "wh/core/compiler.hpp"
 #include "wh/core/error.hpp"
+#include "wh/core/metrics/instruments.hpp"
 #include "wh/core/result.hpp"
 #include "wh/schema/stream/core/status.hpp"
 #include "wh/schema/stream/core/types.hpp"
@@ -147,7 +148,8 @@ normalize_pipe_write_sender(sender_t &&sender, std::shared_ptr<state_t> state,
 template <typename value_t, typename state_t, stdexec::sender sender_t>
 [[nodiscard]] inline auto
 normalize_pipe_read_sender(sender_t &&sender, std::shared_ptr<state_t> state,
-                           const bool state_missing, const bool reader_closed) {
+                           const bool state_missing, const bool reader_closed,
+                           wh::core::metric_counter *chunks = nullptr) {
   using chunk_type = stream_chunk<value_t>;
   using result_t = stream_result<chunk_type>;
   auto success_state = state;
@@ -155,8 +157,8 @@ normalize_pipe_read_sender(sender_t &&sender, std::shared_ptr<state_t> state,
 
   return stdexec::upon_error(
       stdexec::then(std::forward<sender_t>(sender),
-                    [state = std::move(success_state), state_missing,
-                     reader_closed](value_t value) mutable -> result_t {
+                    [state = std::move(success_state), state_missing, reader_closed,
+                     chunks](value_t value) mutable -> result_t {
                       keep_pipe_state_alive(state);
                       if (state_missing) {
                         return result_t::failure(wh::core::errc::not_found);
@@ -164,6 +166,9 @@ normalize_pipe_read_sender(sender_t &&sender, std::shared_ptr<state_t> state,
                       if (reader_closed) {
                         return result_t{chunk_type::make_eof()};
                       }
+                      if (chunks != nullptr) {
+                        chunks->add();
+                      }
                       return result_t{chunk_type::make_value(std::move(value))};
                     }),
       [state = std::move(error_state), state_missing,
@@ -185,6 +190,7 @@ normalize_pipe_read_sender(sender_t &&sender, std::shared_ptr<state_t> state,
 
 template <typename value_t> struct pipe_stream_state {
   explicit pipe_stream_state(const std::size_t capacity) : queue(capacity == 0U ? 1U : capacity) {}
+  explicit pipe_stream_state(const wh::core::ring_capacity_policy capacity) : queue(capacity) {}
 
   wh::core::bounded_queue<value_t> queue;
   std::atomic<bool> reader_closed{false};
@@ -18,4 +18,12 @@ template <typename value_t>
   return {pipe_stream_writer<value_t>{state}, pipe_stream_reader<value_t>{state}};
 }
 
+/// Creates a pipe whose ring allocates on first write and adapts within `capacity`.
+template <typename value_t>
+[[nodiscard]] inline auto make_pipe_stream(const wh::core::ring_capacity_policy capacity)
+    -> std::pair<pipe_stream_writer<value_t>, pipe_stream_reader<value_t>> {
+  auto state = std::make_shared<detail::pipe_stream_state<value_t>>(capacity);
+  return {pipe_stream_writer<value_t>{state}, pipe_stream_reader<value_t>{state}};
+}
+
 } // namespace wh::schema::stream
@@ -1,12 +1,14 @@
 // Defines the reader endpoint of the pipe stream family.
 #pragma once
 
+#include <chrono>
 #include <concepts>
 #include <memory>
 #include <optional>
 #include <utility>
 
 #include "wh/core/error.hpp"
+#include "wh/core/metrics/hooks.hpp"
 #include "wh/core/result.hpp"
 #include "wh/schema/stream/core/status.hpp"
 #include "wh/schema/stream/core/stream_base.hpp"
@@ -36,7 +38,13 @@ public:
       return stream_result<chunk_type>{chunk_type::make_eof()};
     }
 
-    return map_blocking_pop_to_chunk(state_->queue.pop(), state_);
+    if (metrics_.stall == nullptr) {
+      return map_blocking_pop_to_chunk(state_->queue.pop(), state_, metrics_.chunks);
+    }
+    const auto started = std::chrono::steady_clock::now();
+    auto popped = state_->queue.pop();
+    wh::core::record_elapsed(metrics_.stall, started);
+    return map_blocking_pop_to_chunk(std::move(popped), state_, metrics_.chunks);
   }
 
   [[nodiscard]] auto try_read_impl() -> stream_try_result<chunk_type> {
@@ -48,7 +56,8 @@ public:
     }
 
     return map_pop_result_to_chunk(
-        detail::retry_busy_result([this]() { return state_->queue.try_pop(); }), state_);
+        detail::retry_busy_result([this]() { return state_->queue.try_pop(); }), state_,
+        metrics_.chunks);
   }
 
   [[nodiscard]] auto read_async() const {
@@ -59,8 +68,9 @@ public:
     auto state = std::move(async_state.state);
     auto sender = state->queue.async_pop();
 
-    return detail::normalize_pipe_read_sender<value_t>(
-        std::move(sender), std::move(state), async_state.state_missing, async_state.reader_closed);
+    return detail::normalize_pipe_read_sender<value_t>(std::move(sender), std::move(state),
+                                                       async_state.state_missing,
+                                                       async_state.reader_closed, metrics_.chunks);
   }
 
   auto close_impl() -> wh::core::result<void> {
@@ -82,11 +92,30 @@ public:
 
   auto set_automatic_close(const auto_close_options &options) noexcept -> void { (void)options; }
 
+  /// Returns ring allocation and high-water counters of the shared pipe.
+  [[nodiscard]] auto capacity_stats() const noexcept -> wh::core::ring_capacity_stats {
+    return state_ ? state_->queue.capacity_stats() : wh::core::ring_capacity_stats{};
+  }
+
+  /// Records delivered chunks, blocking-read stall time and the pipe backlog
+  /// into `metrics`, whose instruments must outlive the pipe. Async reads
+  /// count chunks but not stall time.
+  auto attach_metrics(const wh::core::stream_read_metrics &metrics) noexcept -> void {
+    metrics_ = metrics;
+    if (state_) {
+      state_->queue.attach_depth_gauge(metrics.depth);
+    }
+  }
+
 private:
   [[nodiscard]] static auto map_blocking_pop_to_chunk(std::optional<value_t> popped,
-                                                      const std::shared_ptr<state_t> &)
+                                                      const std::shared_ptr<state_t> &,
+                                                      wh::core::metric_counter *chunks)
       -> stream_result<chunk_type> {
     if (popped.has_value()) {
+      if (chunks != nullptr) {
+        chunks->add();
+      }
       return stream_result<chunk_type>{chunk_type::make_value(std::move(*popped))};
     }
     return stream_result<chunk_type>{chunk_type::make_eof()};
@@ -94,8 +123,12 @@ private:
 
   [[nodiscard]] static auto
   map_pop_result_to_chunk(typename wh::core::bounded_queue<value_t>::try_pop_result popped,
-                          const std::shared_ptr<state_t> &) -> stream_try_result<chunk_type> {
+                          const std::shared_ptr<state_t> &, wh::core::metric_counter *chunks)
+      -> stream_try_result<chunk_type> {
     if (popped.has_value()) {
+      if (chunks != nullptr) {
+        chunks->add();
+      }
       return stream_result<chunk_type>{chunk_type::make_value(std::move(popped).value())};
     }
 
@@ -112,6 +145,7 @@ private:
     return stream_result<chunk_type>::failure(detail::map_pipe_queue_status(popped.error()));
   }
   std::shared_ptr<state_t> state_{};
+  wh::core::stream_read_metrics metrics_{};
 };
 
 } // namespace wh::schema::stream
@@ -95,6 +95,11 @@ public:
     return !state_ || state_->queue.is_closed();
   }
 
+  /// Returns ring allocation and high-water counters of the shared pipe.
+  [[nodiscard]] auto capacity_stats() const noexcept -> wh::core::ring_capacity_stats {
+    return state_ ? state_->queue.capacity_stats() : wh::core::ring_capacity_stats{};
+  }
+
 private:
   [[nodiscard]] auto validate_write_state() const -> wh::core::result<void> {
     if (!state_) {
@@ -2,3 +2,4 @@
 #pragma once
 
 #include "wh/schema/tool/types.hpp"
+#include "wh/schema/tool/validator.hpp"
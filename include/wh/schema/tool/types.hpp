@@ -1,8 +1,12 @@
 // Defines tool schema structures, parameter descriptors, and tool-choice
-// controls used by model/tool integration.
+// controls used by model/tool integration, plus a precompiled schema form that
+// caches canonical JSON for repeated request binding.
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <ranges>
 #include <span>
 #include <string>
@@ -12,7 +16,9 @@
 
 #include "wh/core/error.hpp"
 #include "wh/core/json.hpp"
+#include "wh/core/json/escape.hpp"
 #include "wh/core/result.hpp"
+#include "wh/internal/type_name.hpp"
 
 namespace wh::schema {
 
@@ -316,4 +322,322 @@ build_parameters_json_schema(const std::span<const tool_parameter_schema> parame
   return output;
 }
 
+/// Offset/size range into one compiled tool schema table.
+struct compiled_tool_range {
+  /// First element index or byte offset.
+  std::uint32_t offset{0U};
+  /// Element or byte count.
+  std::uint32_t size{0U};
+};
+
+/// One parameter node of a compiled tool schema.
+///
+/// Nodes live in one flat pre-order array. Each child group is one contiguous
+/// node range, and strings are byte ranges into the schema's text pool.
+struct compiled_tool_parameter_node {
+  /// JSON-schema type for this node.
+  tool_parameter_type type{tool_parameter_type::string};
+  /// True means the parent object lists this property as required.
+  bool required{false};
+  /// Property name bytes.
+  compiled_tool_range name{};
+  /// Description bytes.
+  compiled_tool_range description{};
+  /// Range into the enum literal table.
+  compiled_tool_range enum_values{};
+  /// Object properties, sorted by name.
+  compiled_tool_range properties{};
+  /// One-of alternatives in declaration order.
+  compiled_tool_range one_of{};
+  /// Array item types in declaration order.
+  compiled_tool_range item_types{};
+};
+
+/// Tool schema compiled once into a flat node array with cached canonical JSON.
+///
+/// The cached bytes equal the compact serialization of
+/// `build_default_tool_json_schema`, so binding a compiled tool to a request
+/// is a byte copy and the hash can key provider-side caches.
+class compiled_tool_json_schema {
+public:
+  /// Compiles one definition; raw parameter schemas are parsed and re-emitted
+  /// compactly, structured ones are sorted and flattened.
+  [[nodiscard]] static auto compile(const tool_schema_definition &definition)
+      -> wh::core::result<compiled_tool_json_schema> {
+    if (definition.name.empty()) {
+      return wh::core::result<compiled_tool_json_schema>::failure(
+          wh::core::errc::invalid_argument);
+    }
+
+    compiled_tool_json_schema compiled{};
+    compiled.name_ = compiled.intern(definition.name);
+    compiled.description_ = compiled.intern(definition.description);
+
+    std::string parameters{};
+    if (!definition.raw_parameters_json_schema.empty()) {
+      auto raw = wh::core::parse_json(definition.raw_parameters_json_schema);
+      if (raw.has_error()) {
+        return wh::core::result<compiled_tool_json_schema>::failure(wh::core::errc::parse_error);
+      }
+      auto text = wh::core::json_to_string(raw.value());
+      if (text.has_error()) {
+        return wh::core::result<compiled_tool_json_schema>::failure(text.error());
+      }
+      parameters = std::move(text).value();
+    } else {
+      compiled.nodes_.resize(1U);
+      compiled.nodes_.front().type = tool_parameter_type::object;
+      compiled.fill_properties(0U, definition.parameters);
+      compiled.emit_node(0U, parameters);
+    }
+    if (compiled.text_.size() > std::numeric_limits<std::uint32_t>::max() ||
+        compiled.nodes_.size() > std::numeric_limits<std::uint32_t>::max()) {
+      return wh::core::result<compiled_tool_json_schema>::failure(
+          wh::core::errc::resource_exhausted);
+    }
+
+    auto &json = compiled.json_;
+    json.reserve(64U + definition.name.size() + definition.description.size() +
+                 parameters.size());
+    json.append(R"({"type":"function","function":{"name":)");
+    wh::core::append_json_string(json, definition.name);
+    json.append(R"(,"description":)");
+    wh::core::append_json_string(json, definition.description);
+    json.append(R"(,"parameters":)");
+    compiled.parameters_offset_ = json.size();
+    json.append(parameters);
+    json.append("}}");
+    compiled.hash_ = wh::internal::stable_name_hash(json);
+    return compiled;
+  }
+
+  /// Returns the tool name.
+  [[nodiscard]] auto name() const noexcept -> std::string_view { return text(name_); }
+
+  /// Returns the tool description.
+  [[nodiscard]] auto description() const noexcept -> std::string_view {
+    return text(description_);
+  }
+
+  /// Returns the flat parameter nodes; node 0 is the root object, and the span
+  /// is empty when the definition used a raw parameter schema.
+  [[nodiscard]] auto nodes() const noexcept -> std::span<const compiled_tool_parameter_node> {
+    return nodes_;
+  }
+
+  /// Returns enum literal ranges referenced by `node.enum_values`.
+  [[nodiscard]] auto enum_literals() const noexcept -> std::span<const compiled_tool_range> {
+    return enum_literals_;
+  }
+
+  /// Resolves one byte range in the text pool.
+  [[nodiscard]] auto text(const compiled_tool_range range) const noexcept -> std::string_view {
+    return std::string_view{text_}.substr(range.offset, range.size);
+  }
+
+  /// Returns the canonical function-style tool JSON.
+  [[nodiscard]] auto json() const noexcept -> std::string_view { return json_; }
+
+  /// Returns the canonical parameters JSON inside `json()`.
+  [[nodiscard]] auto parameters_json() const noexcept -> std::string_view {
+    return std::string_view{json_}.substr(parameters_offset_, json_.size() - parameters_offset_ -
+                                                                  2U);
+  }
+
+  /// Returns the stable hash of `json()`.
+  [[nodiscard]] auto hash() const noexcept -> std::uint64_t { return hash_; }
+
+  /// Appends the cached JSON bytes to one request buffer.
+  auto append_json(std::string &output) const -> void { output.append(json_); }
+
+private:
+  [[nodiscard]] auto intern(const std::string_view value) -> compiled_tool_range {
+    const compiled_tool_range range{
+        .offset = static_cast<std::uint32_t>(text_.size()),
+        .size = static_cast<std::uint32_t>(value.size()),
+    };
+    text_.append(value);
+    return range;
+  }
+
+  [[nodiscard]] auto reserve_nodes(const std::size_t count) -> compiled_tool_range {
+    const compiled_tool_range range{
+        .offset = static_cast<std::uint32_t>(nodes_.size()),
+        .size = static_cast<std::uint32_t>(count),
+    };
+    nodes_.resize(nodes_.size() + count);
+    return range;
+  }
+
+  // Node references are re-taken by index because child groups grow `nodes_`.
+  auto fill_node(const std::size_t index, const tool_parameter_schema &parameter) -> void {
+    nodes_[index].type = parameter.type;
+    nodes_[index].required = parameter.required;
+    nodes_[index].name = intern(parameter.name);
+    nodes_[index].description = intern(parameter.description);
+    nodes_[index].enum_values = compiled_tool_range{
+        .offset = static_cast<std::uint32_t>(enum_literals_.size()),
+        .size = static_cast<std::uint32_t>(parameter.enum_values.size()),
+    };
+    for (const auto &value : parameter.enum_values) {
+      enum_literals_.push_back(intern(value));
+    }
+    if (parameter.type == tool_parameter_type::object) {
+      fill_properties(index, parameter.properties);
+    }
+    nodes_[index].one_of = fill_group(parameter.one_of);
+    if (parameter.type == tool_parameter_type::array) {
+      nodes_[index].item_types = fill_group(parameter.item_types);
+    }
+  }
+
+  auto fill_properties(const std::size_t index, const std::span<const tool_parameter_schema> items)
+      -> void {
+    std::vector<const tool_parameter_schema *> sorted{};
+    sorted.reserve(items.size());
+    for (const auto &item : items) {
+      sorted.push_back(&item);
+    }
+    std::ranges::stable_sort(
+        sorted, [](const tool_parameter_schema *left, const tool_parameter_schema *right) {
+          return left->name < right->name;
+        });
+    const auto group = reserve_nodes(sorted.size());
+    nodes_[index].properties = group;
+    for (std::size_t offset = 0U; offset < sorted.size(); ++offset) {
+      fill_node(group.offset + offset, *sorted[offset]);
+    }
+  }
+
+  [[nodiscard]] auto fill_group(const std::span<const tool_parameter_schema> items)
+      -> compiled_tool_range {
+    const auto group = reserve_nodes(items.size());
+    for (std::size_t offset = 0U; offset < items.size(); ++offset) {
+      fill_node(group.offset + offset, items[offset]);
+    }
+    return group;
+  }
+
+  auto emit_group(const compiled_tool_range group, std::string &output) const -> void {
+    output.push_back('[');
+    for (std::uint32_t offset = 0U; offset < group.size; ++offset) {
+      if (offset != 0U) {
+        output.push_back(',');
+      }
+      emit_node(group.offset + offset, output);
+    }
+    output.push_back(']');
+  }
+
+  // Mirrors `detail::build_parameter_schema` member order.
+  auto emit_node(const std::size_t index, std::string &output) const -> void {
+    const auto &node = nodes_[index];
+    output.append(R"({"type":)");
+    wh::core::append_json_string(output, detail::parameter_type_name(node.type));
+    if (node.description.size != 0U) {
+      output.append(R"(,"description":)");
+      wh::core::append_json_string(output, text(node.description));
+    }
+    if (node.enum_values.size != 0U) {
+      output.append(R"(,"enum":[)");
+      for (std::uint32_t offset = 0U; offset < node.enum_values.size; ++offset) {
+        if (offset != 0U) {
+          output.push_back(',');
+        }
+        wh::core::append_json_string(output,
+                                     text(enum_literals_[node.enum_values.offset + offset]));
+      }
+      output.push_back(']');
+    }
+    if (node.one_of.size != 0U) {
+      output.append(R"(,"oneOf":)");
+      emit_group(node.one_of, output);
+    }
+    if (node.type == tool_parameter_type::object) {
+      output.append(R"(,"properties":{)");
+      for (std::uint32_t offset = 0U; offset < node.properties.size; ++offset) {
+        const auto child = node.properties.offset + offset;
+        if (offset != 0U) {
+          output.push_back(',');
+        }
+        wh::core::append_json_string(output, text(nodes_[child].name));
+        output.push_back(':');
+        emit_node(child, output);
+      }
+      output.append(R"(},"required":[)");
+      bool first = true;
+      for (std::uint32_t offset = 0U; offset < node.properties.size; ++offset) {
+        const auto &child = nodes_[node.properties.offset + offset];
+        if (child.required) {
+          if (!first) {
+            output.push_back(',');
+          }
+          first = false;
+          wh::core::append_json_string(output, text(child.name));
+        }
+      }
+      output.push_back(']');
+    }
+    if (node.type == tool_parameter_type::array) {
+      if (node.item_types.size == 1U) {
+        output.append(R"(,"items":)");
+        emit_node(node.item_types.offset, output);
+      } else if (node.item_types.size > 1U) {
+        output.append(R"(,"items":{"anyOf":)");
+        emit_group(node.item_types, output);
+        output.push_back('}');
+      } else {
+        output.append(R"(,"items":{"type":"string"})");
+      }
+    }
+    output.push_back('}');
+  }
+
+  /// Owned bytes for every name, description, and enum literal.
+  std::string text_{};
+  /// Flat pre-order parameter nodes.
+  std::vector<compiled_tool_parameter_node> nodes_{};
+  /// Enum literal byte ranges.
+  std::vector<compiled_tool_range> enum_literals_{};
+  /// Tool name bytes.
+  compiled_tool_range name_{};
+  /// Tool description bytes.
+  compiled_tool_range description_{};
+  /// Cached canonical function-style JSON.
+  std::string json_{};
+  /// Byte offset of the parameters object in `json_`.
+  std::size_t parameters_offset_{0U};
+  /// Stable hash of `json_`.
+  std::uint64_t hash_{0U};
+};
+
+/// Appends compiled tools as one JSON array, copying each cached byte string.
+inline auto append_tool_schemas_json(const std::span<const compiled_tool_json_schema> tools,
+                                     std::string &output) -> void {
+  std::size_t total = 2U + (tools.empty() ? 0U : tools.size() - 1U);
+  for (const auto &tool : tools) {
+    total += tool.json().size();
+  }
+  output.reserve(output.size() + total);
+  output.push_back('[');
+  for (std::size_t index = 0U; index < tools.size(); ++index) {
+    if (index != 0U) {
+      output.push_back(',');
+    }
+    tools[index].append_json(output);
+  }
+  output.push_back(']');
+}
+
+/// Returns one stable order-sensitive hash over a bound tool list.
+[[nodiscard]] inline auto tool_schemas_hash(const std::span<const compiled_tool_json_schema> tools)
+    -> std::uint64_t {
+  std::uint64_t hash = wh::internal::stable_name_hash("");
+  for (const auto &tool : tools) {
+    hash ^= tool.hash();
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
 } // namespace wh::schema
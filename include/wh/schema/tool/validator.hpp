@@ -0,0 +1,486 @@
+// Defines compiled tool-argument validators that flatten one recursive
+// `tool_parameter_schema` tree into a single-pass validation program.
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "wh/core/error.hpp"
+#include "wh/core/json.hpp"
+#include "wh/core/result.hpp"
+#include "wh/core/small_vector.hpp"
+#include "wh/schema/tool/types.hpp"
+
+namespace wh::schema {
+
+/// One argument-validation failure reported by `compiled_tool_schema`.
+struct tool_schema_violation {
+  /// JSON path of the failing value, rooted at `$`.
+  std::string path{};
+  /// Failure category; `type_mismatch` only for a non-object root.
+  wh::core::errc code{wh::core::errc::invalid_argument};
+};
+
+namespace detail {
+
+inline constexpr std::uint32_t schema_npos = std::numeric_limits<std::uint32_t>::max();
+
+/// Hashes one property name with 64-bit FNV-1a.
+[[nodiscard]] constexpr auto hash_property_name(const std::string_view name) noexcept
+    -> std::uint64_t {
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (const auto value : name) {
+    hash ^= static_cast<unsigned char>(value);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/// Mixes one name hash with a table seed and returns its slot.
+[[nodiscard]] constexpr auto property_slot(std::uint64_t hash, const std::uint64_t seed,
+                                           const std::uint32_t mask) noexcept -> std::uint32_t {
+  hash ^= seed;
+  hash ^= hash >> 30U;
+  hash *= 0xbf58476d1ce4e5b9ULL;
+  hash ^= hash >> 27U;
+  hash *= 0x94d049bb133111ebULL;
+  hash ^= hash >> 31U;
+  return static_cast<std::uint32_t>(hash) & mask;
+}
+
+/// One flattened schema node; every range indexes a shared program table.
+struct compiled_schema_node {
+  tool_parameter_type type{tool_parameter_type::string};
+  std::uint32_t enum_first{0U};
+  std::uint32_t enum_count{0U};
+  std::uint32_t one_of_first{0U};
+  std::uint32_t one_of_count{0U};
+  std::uint32_t item_first{0U};
+  std::uint32_t item_count{0U};
+  std::uint32_t property_first{0U};
+  std::uint32_t property_count{0U};
+  std::uint32_t slot_first{0U};
+  std::uint32_t slot_mask{0U};
+  std::uint64_t slot_seed{0U};
+  std::uint32_t required_first{0U};
+  std::uint32_t required_words{0U};
+};
+
+/// One object property entry; `next` chains duplicate names or hash collisions.
+struct compiled_schema_property {
+  std::string name{};
+  std::uint32_t node{schema_npos};
+  std::uint32_t next{schema_npos};
+};
+
+/// One lazily materialized path step used only while collecting violations.
+struct schema_path_frame {
+  std::string_view name{};
+  std::size_t index{0U};
+  bool is_index{false};
+  std::uint32_t order{0U};
+};
+
+/// Violation plus schema-order sort key, so reports ignore JSON member order.
+struct pending_schema_violation {
+  wh::core::small_vector<std::uint32_t, 8U> order{};
+  tool_schema_violation violation{};
+};
+
+struct schema_collect_context {
+  wh::core::small_vector<schema_path_frame, 16U> frames{};
+  std::vector<pending_schema_violation> violations{};
+};
+
+} // namespace detail
+
+/// Flat, immutable validation program for one tool's parameter list.
+///
+/// Compilation happens once per tool; validation then walks the argument DOM
+/// once, resolving object members through a per-object perfect hash and
+/// checking required keys with bitsets instead of per-property `FindMember`.
+class compiled_tool_schema {
+public:
+  compiled_tool_schema() = default;
+
+  /// Compiles top-level `parameters` as the properties of an implicit root object.
+  explicit compiled_tool_schema(const std::span<const tool_parameter_schema> parameters) {
+    if (parameters.empty()) {
+      return;
+    }
+    nodes_.emplace_back();
+    nodes_.front().type = tool_parameter_type::object;
+    compile_properties(0U, parameters);
+  }
+
+  /// Returns true when no parameters are declared and any input is accepted.
+  [[nodiscard]] auto empty() const noexcept -> bool { return nodes_.empty(); }
+
+  /// Returns the number of flattened schema nodes.
+  [[nodiscard]] auto node_count() const noexcept -> std::size_t { return nodes_.size(); }
+
+  /// Returns true when `value` satisfies the schema; never allocates.
+  [[nodiscard]] auto matches(const wh::core::json_value &value) const -> bool {
+    if (empty()) {
+      return true;
+    }
+    return run<false>(0U, value, nullptr);
+  }
+
+  /// Appends every violation in schema order and returns true when none were found.
+  auto collect(const wh::core::json_value &value,
+               std::vector<tool_schema_violation> &violations) const -> bool {
+    if (empty() || matches(value)) {
+      return true;
+    }
+    detail::schema_collect_context context{};
+    static_cast<void>(run<true>(0U, value, &context));
+    std::ranges::stable_sort(context.violations, [](const auto &left, const auto &right) {
+      return std::ranges::lexicographical_compare(left.order, right.order);
+    });
+    for (auto &pending : context.violations) {
+      violations.push_back(std::move(pending.violation));
+    }
+    return false;
+  }
+
+  /// Parses `input` and validates it, writing the first violation path to `error_path`.
+  [[nodiscard]] auto validate(const std::string_view input, std::string &error_path) const
+      -> wh::core::result<void> {
+    if (empty()) {
+      return {};
+    }
+    wh::core::json_arena_scope arena_scope{};
+    auto parsed = wh::core::parse_json_into(arena_scope.arena(), input);
+    if (parsed.has_error()) {
+      error_path = "$";
+      return wh::core::result<void>::failure(parsed.error());
+    }
+    std::vector<tool_schema_violation> violations{};
+    if (collect(*parsed.value(), violations)) {
+      return {};
+    }
+    error_path = std::move(violations.front().path);
+    return wh::core::result<void>::failure(violations.front().code);
+  }
+
+  /// Parses `input` and returns every violation; an empty list means valid.
+  [[nodiscard]] auto validate_all(const std::string_view input) const
+      -> wh::core::result<std::vector<tool_schema_violation>> {
+    std::vector<tool_schema_violation> violations{};
+    if (empty()) {
+      return violations;
+    }
+    wh::core::json_arena_scope arena_scope{};
+    auto parsed = wh::core::parse_json_into(arena_scope.arena(), input);
+    if (parsed.has_error()) {
+      return wh::core::result<std::vector<tool_schema_violation>>::failure(parsed.error());
+    }
+    static_cast<void>(collect(*parsed.value(), violations));
+    return violations;
+  }
+
+private:
+  static constexpr std::uint32_t max_seed_attempts = 64U;
+  static constexpr std::size_t inline_required_words = 4U;
+
+  [[nodiscard]] auto compile_node(const tool_parameter_schema &schema) -> std::uint32_t {
+    const auto index = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+    nodes_[index].type = schema.type;
+
+    nodes_[index].enum_first = static_cast<std::uint32_t>(enum_values_.size());
+    nodes_[index].enum_count = static_cast<std::uint32_t>(schema.enum_values.size());
+    enum_values_.insert(enum_values_.end(), schema.enum_values.begin(), schema.enum_values.end());
+
+    const auto one_of = compile_children(schema.one_of);
+    nodes_[index].one_of_first = static_cast<std::uint32_t>(child_nodes_.size());
+    nodes_[index].one_of_count = static_cast<std::uint32_t>(one_of.size());
+    child_nodes_.insert(child_nodes_.end(), one_of.begin(), one_of.end());
+
+    if (schema.type == tool_parameter_type::array) {
+      const auto items = compile_children(schema.item_types);
+      nodes_[index].item_first = static_cast<std::uint32_t>(child_nodes_.size());
+      nodes_[index].item_count = static_cast<std::uint32_t>(items.size());
+      child_nodes_.insert(child_nodes_.end(), items.begin(), items.end());
+    }
+    if (schema.type == tool_parameter_type::object) {
+      compile_properties(index, schema.properties);
+    }
+    return index;
+  }
+
+  [[nodiscard]] auto compile_children(const std::span<const tool_parameter_schema> schemas)
+      -> std::vector<std::uint32_t> {
+    std::vector<std::uint32_t> children{};
+    children.reserve(schemas.size());
+    for (const auto &schema : schemas) {
+      children.push_back(compile_node(schema));
+    }
+    return children;
+  }
+
+  auto compile_properties(const std::uint32_t index,
+                          const std::span<const tool_parameter_schema> properties) -> void {
+    if (properties.empty()) {
+      return;
+    }
+    std::vector<std::uint32_t> child_nodes{};
+    child_nodes.reserve(properties.size());
+    for (const auto &property : properties) {
+      child_nodes.push_back(compile_node(property));
+    }
+
+    const auto first = static_cast<std::uint32_t>(properties_.size());
+    const auto count = static_cast<std::uint32_t>(properties.size());
+    const auto words = (count + 63U) / 64U;
+    const auto required_first = static_cast<std::uint32_t>(required_words_.size());
+    required_words_.resize(required_words_.size() + words, 0U);
+    for (std::uint32_t ordinal = 0U; ordinal < count; ++ordinal) {
+      properties_.push_back(detail::compiled_schema_property{
+          .name = properties[ordinal].name, .node = child_nodes[ordinal]});
+      if (properties[ordinal].required) {
+        required_words_[required_first + ordinal / 64U] |= std::uint64_t{1U} << (ordinal % 64U);
+      }
+    }
+
+    auto &node = nodes_[index];
+    node.property_first = first;
+    node.property_count = count;
+    node.required_first = required_first;
+    node.required_words = words;
+    build_property_table(node);
+  }
+
+  /// Searches a seed that maps every distinct name to its own slot; names that
+  /// still collide after the search (or repeat) are chained through `next`.
+  auto build_property_table(detail::compiled_schema_node &node) -> void {
+    std::vector<std::uint64_t> hashes{};
+    hashes.reserve(node.property_count);
+    for (std::uint32_t ordinal = 0U; ordinal < node.property_count; ++ordinal) {
+      hashes.push_back(detail::hash_property_name(properties_[node.property_first + ordinal].name));
+    }
+
+    const auto base_size = std::bit_ceil(std::max<std::size_t>(node.property_count * 2U, 2U));
+    std::vector<std::uint32_t> table{};
+    std::uint64_t seed = 0U;
+    std::size_t size = base_size;
+    bool perfect = false;
+    for (std::size_t attempt_size = base_size; attempt_size <= base_size * 4U && !perfect;
+         attempt_size *= 2U) {
+      for (std::uint64_t candidate = 0U; candidate < max_seed_attempts; ++candidate) {
+        size = attempt_size;
+        seed = candidate * 0x9e3779b97f4a7c15ULL;
+        if (fill_property_table(node, hashes, seed, size, table)) {
+          perfect = true;
+          break;
+        }
+      }
+    }
+
+    node.slot_first = static_cast<std::uint32_t>(slots_.size());
+    node.slot_mask = static_cast<std::uint32_t>(size - 1U);
+    node.slot_seed = seed;
+    slots_.insert(slots_.end(), table.begin(), table.end());
+  }
+
+  [[nodiscard]] auto fill_property_table(const detail::compiled_schema_node &node,
+                                         const std::vector<std::uint64_t> &hashes,
+                                         const std::uint64_t seed, const std::size_t size,
+                                         std::vector<std::uint32_t> &table) -> bool {
+    table.assign(size, detail::schema_npos);
+    bool perfect = true;
+    const auto mask = static_cast<std::uint32_t>(size - 1U);
+    for (std::uint32_t ordinal = node.property_count; ordinal-- > 0U;) {
+      auto &property = properties_[node.property_first + ordinal];
+      auto &head = table[detail::property_slot(hashes[ordinal], seed, mask)];
+      if (head != detail::schema_npos &&
+          properties_[node.property_first + head].name != property.name) {
+        perfect = false;
+      }
+      property.next = head;
+      head = ordinal;
+    }
+    return perfect;
+  }
+
+  template <bool collect_v>
+  [[nodiscard]] auto run(const std::uint32_t index, const wh::core::json_value &value,
+                         detail::schema_collect_context *context) const -> bool {
+    const auto &node = nodes_[index];
+    if (!type_matches(node.type, value)) {
+      return fail<collect_v>(context, index == 0U ? wh::core::errc::type_mismatch
+                                                  : wh::core::errc::invalid_argument);
+    }
+
+    if (node.enum_count != 0U && node.type == tool_parameter_type::string) {
+      const std::string_view current{value.GetString(),
+                                     static_cast<std::size_t>(value.GetStringLength())};
+      const auto first = enum_values_.begin() + node.enum_first;
+      if (std::find(first, first + node.enum_count, current) == first + node.enum_count) {
+        return fail<collect_v>(context, wh::core::errc::invalid_argument);
+      }
+    }
+
+    if (node.one_of_count != 0U && !matches_any(node.one_of_first, node.one_of_count, value)) {
+      return fail<collect_v>(context, wh::core::errc::invalid_argument);
+    }
+
+    if (node.type == tool_parameter_type::object && node.property_count != 0U) {
+      return run_object<collect_v>(node, value, context);
+    }
+    if (node.type == tool_parameter_type::array && node.item_count != 0U) {
+      return run_array<collect_v>(node, value, context);
+    }
+    return true;
+  }
+
+  template <bool collect_v>
+  [[nodiscard]] auto run_object(const detail::compiled_schema_node &node,
+                                const wh::core::json_value &value,
+                                detail::schema_collect_context *context) const -> bool {
+    wh::core::small_vector<std::uint64_t, inline_required_words> seen(node.required_words, 0U);
+    bool ok = true;
+    for (auto member = value.MemberBegin(); member != value.MemberEnd(); ++member) {
+      const std::string_view name{member->name.GetString(),
+                                  static_cast<std::size_t>(member->name.GetStringLength())};
+      auto ordinal =
+          slots_[node.slot_first + detail::property_slot(detail::hash_property_name(name),
+                                                         node.slot_seed, node.slot_mask)];
+      for (; ordinal != detail::schema_npos;
+           ordinal = properties_[node.property_first + ordinal].next) {
+        const auto &property = properties_[node.property_first + ordinal];
+        if (property.name != name) {
+          continue;
+        }
+        seen[ordinal / 64U] |= std::uint64_t{1U} << (ordinal % 64U);
+        if constexpr (collect_v) {
+          context->frames.push_back(detail::schema_path_frame{.name = property.name,
+                                                              .order = ordinal});
+          ok = run<true>(property.node, member->value, context) && ok;
+          context->frames.pop_back();
+        } else if (!run<false>(property.node, member->value, nullptr)) {
+          return false;
+        }
+      }
+    }
+
+    for (std::uint32_t word = 0U; word < node.required_words; ++word) {
+      auto missing = required_words_[node.required_first + word] & ~seen[word];
+      if (missing == 0U) {
+        continue;
+      }
+      if constexpr (!collect_v) {
+        return false;
+      } else {
+        ok = false;
+        while (missing != 0U) {
+          const auto ordinal =
+              word * 64U + static_cast<std::uint32_t>(std::countr_zero(missing));
+          missing &= missing - 1U;
+          context->frames.push_back(detail::schema_path_frame{
+              .name = properties_[node.property_first + ordinal].name, .order = ordinal});
+          static_cast<void>(fail<true>(context, wh::core::errc::invalid_argument));
+          context->frames.pop_back();
+        }
+      }
+    }
+    return ok;
+  }
+
+  template <bool collect_v>
+  [[nodiscard]] auto run_array(const detail::compiled_schema_node &node,
+                               const wh::core::json_value &value,
+                               detail::schema_collect_context *context) const -> bool {
+    bool ok = true;
+    const auto size = static_cast<std::size_t>(value.Size());
+    for (std::size_t index = 0U; index < size; ++index) {
+      const auto &item = value[static_cast<wh::core::json_size_type>(index)];
+      if constexpr (collect_v) {
+        context->frames.push_back(detail::schema_path_frame{
+            .index = index, .is_index = true, .order = static_cast<std::uint32_t>(index)});
+      }
+      bool item_ok = true;
+      if (node.item_count == 1U) {
+        item_ok = run<collect_v>(child_nodes_[node.item_first], item, context);
+      } else if (!matches_any(node.item_first, node.item_count, item)) {
+        item_ok = fail<collect_v>(context, wh::core::errc::invalid_argument);
+      }
+      if constexpr (collect_v) {
+        context->frames.pop_back();
+        ok = item_ok && ok;
+      } else if (!item_ok) {
+        return false;
+      }
+    }
+    return ok;
+  }
+
+  [[nodiscard]] auto matches_any(const std::uint32_t first, const std::uint32_t count,
+                                 const wh::core::json_value &value) const -> bool {
+    for (std::uint32_t offset = 0U; offset < count; ++offset) {
+      if (run<false>(child_nodes_[first + offset], value, nullptr)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  template <bool collect_v>
+  [[nodiscard]] static auto fail(detail::schema_collect_context *context,
+                                 const wh::core::errc code) -> bool {
+    if constexpr (collect_v) {
+      auto &pending = context->violations.emplace_back();
+      pending.violation.code = code;
+      pending.violation.path = "$";
+      for (const auto &frame : context->frames) {
+        pending.order.push_back(frame.order);
+        if (frame.is_index) {
+          pending.violation.path.push_back('[');
+          pending.violation.path.append(std::to_string(frame.index));
+          pending.violation.path.push_back(']');
+        } else {
+          pending.violation.path.push_back('.');
+          pending.violation.path.append(frame.name);
+        }
+      }
+    }
+    return false;
+  }
+
+  [[nodiscard]] static auto type_matches(const tool_parameter_type type,
+                                         const wh::core::json_value &value) noexcept -> bool {
+    switch (type) {
+    case tool_parameter_type::string:
+      return value.IsString();
+    case tool_parameter_type::integer:
+      return value.IsInt64() || value.IsUint64();
+    case tool_parameter_type::number:
+      return value.IsNumber();
+    case tool_parameter_type::boolean:
+      return value.IsBool();
+    case tool_parameter_type::object:
+      return value.IsObject();
+    case tool_parameter_type::array:
+      return value.IsArray();
+    }
+    return false;
+  }
+
+  std::vector<detail::compiled_schema_node> nodes_{};
+  std::vector<detail::compiled_schema_property> properties_{};
+  std::vector<std::uint32_t> slots_{};
+  std::vector<std::uint32_t> child_nodes_{};
+  std::vector<std::uint64_t> required_words_{};
+  std::vector<std::string> enum_values_{};
+};
+
+} // namespace wh::schema
@@ -18,41 +18,10 @@
 #include "wh/core/stdexec/resume_scheduler.hpp"
 #include "wh/core/stdexec/scheduler_handoff.hpp"
 #include "wh/core/stdexec/try_schedule.hpp"
+#include "wh/sync/detail/waiter_operation.hpp"
 
 namespace wh::sync {
 
-namespace detail {
-
-class completion_bits {
-public:
-  static constexpr std::uint8_t claimed_bit_ = 0x1U;
-  static constexpr std::uint8_t completion_started_bit_ = 0x2U;
-  static constexpr std::uint8_t payload_ready_bit_ = 0x4U;
-  static constexpr std::uint8_t ready_and_claimed_bits_ = payload_ready_bit_ | claimed_bit_;
-
-  [[nodiscard]] auto has_claimed() const noexcept -> bool {
-    return (state_bits_.load(std::memory_order_acquire) & claimed_bit_) != 0U;
-  }
-
-  [[nodiscard]] auto start_completion() noexcept -> bool {
-    return (state_bits_.fetch_or(completion_started_bit_, std::memory_order_acq_rel) &
-            completion_started_bit_) == 0U;
-  }
-
-  [[nodiscard]] auto mark_ready() noexcept -> std::uint8_t {
-    return state_bits_.fetch_or(ready_and_claimed_bits_, std::memory_order_acq_rel);
-  }
-
-  [[nodiscard]] static auto is_claimed(const std::uint8_t state_bits) noexcept -> bool {
-    return (state_bits & claimed_bit_) != 0U;
-  }
-
-private:
-  std::atomic<std::uint8_t> state_bits_{0U};
-};
-
-} // namespace detail
-
 class async_mutex {
 public:
   class lock_guard;
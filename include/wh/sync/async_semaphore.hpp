@@ -0,0 +1,181 @@
+// Defines `async_semaphore`, a counted sender-based semaphore whose waiters
+// are granted in FIFO order.
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "wh/sync/detail/waiter_operation.hpp"
+
+namespace wh::sync {
+
+/// Counted semaphore. `acquire(n)` completes once `n` units are available
+/// and no earlier waiter is still pending, so large requests are never
+/// starved by a stream of small ones.
+class async_semaphore {
+public:
+  class permit;
+  using acquire_sender = detail::waiter_sender<async_semaphore, permit>;
+
+  explicit async_semaphore(const std::size_t initial_units) noexcept
+      : available_(initial_units) {}
+  ~async_semaphore() = default;
+
+  async_semaphore(const async_semaphore &) = delete;
+  auto operator=(const async_semaphore &) -> async_semaphore & = delete;
+  async_semaphore(async_semaphore &&) = delete;
+  auto operator=(async_semaphore &&) -> async_semaphore & = delete;
+
+  /// Returns a sender completing with a permit for `units` units, or with
+  /// stopped when the receiver's stop token fires first.
+  [[nodiscard]] auto acquire(std::size_t units = 1U) noexcept -> acquire_sender;
+  /// Takes `units` units without waiting, or returns `nullopt`.
+  [[nodiscard]] auto try_acquire(std::size_t units = 1U) noexcept -> std::optional<permit>;
+
+  /// Returns `units` units and grants every waiter they now satisfy. Used by
+  /// permits, and directly by producers signalling new work.
+  auto release(const std::size_t units = 1U) noexcept -> void {
+    detail::waiter_list granted{};
+    {
+      std::lock_guard lock{state_mutex_};
+      available_ += units;
+      grant_locked(granted);
+    }
+    detail::complete_waiters(granted);
+  }
+
+  /// Returns the units currently free.
+  [[nodiscard]] auto available() const noexcept -> std::size_t {
+    std::lock_guard lock{state_mutex_};
+    return available_;
+  }
+
+private:
+  template <typename, typename, typename> friend struct detail::waiter_operation;
+
+  [[nodiscard]] auto can_grant_locked(const detail::waiter_request &request) const noexcept
+      -> bool {
+    return request.units == 0U || (waiters_.empty() && request.units <= available_);
+  }
+
+  auto grant_locked(detail::waiter_list &granted) noexcept -> void {
+    while (!waiters_.empty() && waiters_.front()->request.units <= available_) {
+      auto *waiter = waiters_.pop_front();
+      available_ -= waiter->request.units;
+      waiter->queued = false;
+      waiter->acquired = true;
+      granted.push_back(*waiter);
+    }
+  }
+
+  [[nodiscard]] auto try_acquire_waiter(detail::waiter_node &waiter) noexcept -> bool {
+    std::lock_guard lock{state_mutex_};
+    if (!can_grant_locked(waiter.request)) {
+      return false;
+    }
+    available_ -= waiter.request.units;
+    waiter.acquired = true;
+    return true;
+  }
+
+  [[nodiscard]] auto acquire_or_enqueue(detail::waiter_node &waiter) noexcept -> bool {
+    std::lock_guard lock{state_mutex_};
+    if (can_grant_locked(waiter.request)) {
+      available_ -= waiter.request.units;
+      waiter.acquired = true;
+      return false;
+    }
+    waiters_.push_back(waiter);
+    waiter.queued = true;
+    return true;
+  }
+
+  [[nodiscard]] auto cancel_waiter(detail::waiter_node &waiter) noexcept -> bool {
+    detail::waiter_list granted{};
+    {
+      std::lock_guard lock{state_mutex_};
+      if (!waiter.queued) {
+        return false;
+      }
+      waiters_.erase(waiter);
+      waiter.queued = false;
+      // A cancelled head may have been blocking smaller requests behind it.
+      grant_locked(granted);
+    }
+    detail::complete_waiters(granted);
+    return true;
+  }
+
+  auto release_waiter(const detail::waiter_node &waiter) noexcept -> void {
+    release(waiter.request.units);
+  }
+
+  mutable std::mutex state_mutex_{};
+  std::size_t available_{0U};
+  detail::waiter_list waiters_{};
+};
+
+/// Owns acquired units and returns them on destruction.
+class async_semaphore::permit {
+  async_semaphore *semaphore_{nullptr};
+  std::size_t units_{0U};
+
+  friend class async_semaphore;
+  template <typename, typename, typename> friend struct detail::waiter_operation;
+
+  permit(async_semaphore *semaphore, const detail::waiter_request &request) noexcept
+      : semaphore_(semaphore), units_(request.units) {}
+
+public:
+  permit() = default;
+
+  ~permit() { release(); }
+
+  permit(const permit &) = delete;
+  auto operator=(const permit &) -> permit & = delete;
+
+  permit(permit &&other) noexcept
+      : semaphore_(std::exchange(other.semaphore_, nullptr)),
+        units_(std::exchange(other.units_, 0U)) {}
+
+  auto operator=(permit &&other) noexcept -> permit & {
+    if (this != &other) {
+      release();
+      semaphore_ = std::exchange(other.semaphore_, nullptr);
+      units_ = std::exchange(other.units_, 0U);
+    }
+    return *this;
+  }
+
+  /// Returns the held units early.
+  void release() noexcept {
+    if (semaphore_ != nullptr) {
+      semaphore_->release(units_);
+      semaphore_ = nullptr;
+      units_ = 0U;
+    }
+  }
+
+  /// Returns the number of units held.
+  [[nodiscard]] auto units() const noexcept -> std::size_t { return units_; }
+
+  [[nodiscard]] explicit operator bool() const noexcept { return semaphore_ != nullptr; }
+};
+
+inline auto async_semaphore::acquire(const std::size_t units) noexcept -> acquire_sender {
+  return acquire_sender{this, detail::waiter_request{.units = units}};
+}
+
+inline auto async_semaphore::try_acquire(const std::size_t units) noexcept
+    -> std::optional<permit> {
+  detail::waiter_node waiter{};
+  waiter.request.units = units;
+  if (try_acquire_waiter(waiter)) {
+    return permit{this, waiter.request};
+  }
+  return std::nullopt;
+}
+
+} // namespace wh::sync
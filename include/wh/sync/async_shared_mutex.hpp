@@ -0,0 +1,262 @@
+// Defines `async_shared_mutex`, a writer-preferring sender-based
+// reader-writer lock that admits queued readers in batches.
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "wh/sync/detail/waiter_operation.hpp"
+
+namespace wh::sync {
+
+/// Reader-writer lock for read-mostly shared state.
+///
+/// A queued writer blocks new readers, so writers cannot starve. When a
+/// writer unlocks, every reader queued behind it is admitted as one batch
+/// before the next writer, so readers cannot starve either.
+class async_shared_mutex {
+public:
+  class lock_guard;
+  class shared_lock_guard;
+  using lock_sender = detail::waiter_sender<async_shared_mutex, lock_guard>;
+  using shared_lock_sender = detail::waiter_sender<async_shared_mutex, shared_lock_guard>;
+
+  async_shared_mutex() = default;
+  ~async_shared_mutex() = default;
+
+  async_shared_mutex(const async_shared_mutex &) = delete;
+  auto operator=(const async_shared_mutex &) -> async_shared_mutex & = delete;
+  async_shared_mutex(async_shared_mutex &&) = delete;
+  auto operator=(async_shared_mutex &&) -> async_shared_mutex & = delete;
+
+  /// Returns a sender completing with exclusive ownership.
+  [[nodiscard]] auto lock() noexcept -> lock_sender;
+  /// Returns a sender completing with shared ownership.
+  [[nodiscard]] auto lock_shared() noexcept -> shared_lock_sender;
+  /// Takes exclusive ownership without waiting, or returns `nullopt`.
+  [[nodiscard]] auto try_lock() noexcept -> std::optional<lock_guard>;
+  /// Takes shared ownership without waiting, or returns `nullopt`.
+  [[nodiscard]] auto try_lock_shared() noexcept -> std::optional<shared_lock_guard>;
+
+private:
+  template <typename, typename, typename> friend struct detail::waiter_operation;
+
+  [[nodiscard]] auto can_grant_locked(const detail::waiter_request &request) const noexcept
+      -> bool {
+    if (writer_ || !writers_waiting_.empty()) {
+      return false;
+    }
+    return !request.exclusive || (readers_ == 0U && readers_waiting_.empty());
+  }
+
+  auto take_locked(const detail::waiter_request &request) noexcept -> void {
+    if (request.exclusive) {
+      writer_ = true;
+    } else {
+      ++readers_;
+    }
+  }
+
+  auto grant_locked(detail::waiter_node &waiter, detail::waiter_list &granted) noexcept -> void {
+    take_locked(waiter.request);
+    waiter.queued = false;
+    waiter.acquired = true;
+    granted.push_back(waiter);
+  }
+
+  auto grant_readers_locked(detail::waiter_list &granted) noexcept -> void {
+    while (auto *reader = readers_waiting_.pop_front()) {
+      grant_locked(*reader, granted);
+    }
+  }
+
+  auto grant_writer_locked(detail::waiter_list &granted) noexcept -> void {
+    if (auto *writer = writers_waiting_.pop_front()) {
+      grant_locked(*writer, granted);
+    }
+  }
+
+  auto unlock() noexcept -> void {
+    detail::waiter_list granted{};
+    {
+      std::lock_guard lock{state_mutex_};
+      writer_ = false;
+      if (!readers_waiting_.empty()) {
+        grant_readers_locked(granted);
+      } else {
+        grant_writer_locked(granted);
+      }
+    }
+    detail::complete_waiters(granted);
+  }
+
+  auto unlock_shared() noexcept -> void {
+    detail::waiter_list granted{};
+    {
+      std::lock_guard lock{state_mutex_};
+      if (--readers_ == 0U) {
+        grant_writer_locked(granted);
+      }
+    }
+    detail::complete_waiters(granted);
+  }
+
+  [[nodiscard]] auto try_acquire_waiter(detail::waiter_node &waiter) noexcept -> bool {
+    std::lock_guard lock{state_mutex_};
+    if (!can_grant_locked(waiter.request)) {
+      return false;
+    }
+    take_locked(waiter.request);
+    waiter.acquired = true;
+    return true;
+  }
+
+  [[nodiscard]] auto acquire_or_enqueue(detail::waiter_node &waiter) noexcept -> bool {
+    std::lock_guard lock{state_mutex_};
+    if (can_grant_locked(waiter.request)) {
+      take_locked(waiter.request);
+      waiter.acquired = true;
+      return false;
+    }
+    (waiter.request.exclusive ? writers_waiting_ : readers_waiting_).push_back(waiter);
+    waiter.queued = true;
+    return true;
+  }
+
+  [[nodiscard]] auto cancel_waiter(detail::waiter_node &waiter) noexcept -> bool {
+    detail::waiter_list granted{};
+    {
+      std::lock_guard lock{state_mutex_};
+      if (!waiter.queued) {
+        return false;
+      }
+      (waiter.request.exclusive ? writers_waiting_ : readers_waiting_).erase(waiter);
+      waiter.queued = false;
+      // Readers held back only by the cancelled writer may proceed now.
+      if (!writer_ && writers_waiting_.empty()) {
+        grant_readers_locked(granted);
+      }
+    }
+    detail::complete_waiters(granted);
+    return true;
+  }
+
+  auto release_waiter(const detail::waiter_node &waiter) noexcept -> void {
+    if (waiter.request.exclusive) {
+      unlock();
+    } else {
+      unlock_shared();
+    }
+  }
+
+  mutable std::mutex state_mutex_{};
+  std::size_t readers_{0U};
+  bool writer_{false};
+  detail::waiter_list readers_waiting_{};
+  detail::waiter_list writers_waiting_{};
+};
+
+/// Exclusive ownership of an `async_shared_mutex`.
+class async_shared_mutex::lock_guard {
+  async_shared_mutex *mutex_{nullptr};
+
+  friend class async_shared_mutex;
+  template <typename, typename, typename> friend struct detail::waiter_operation;
+
+  lock_guard(async_shared_mutex *m, const detail::waiter_request &) noexcept : mutex_(m) {}
+
+public:
+  lock_guard() = default;
+
+  ~lock_guard() { unlock(); }
+
+  lock_guard(const lock_guard &) = delete;
+  auto operator=(const lock_guard &) -> lock_guard & = delete;
+
+  lock_guard(lock_guard &&other) noexcept : mutex_(std::exchange(other.mutex_, nullptr)) {}
+
+  auto operator=(lock_guard &&other) noexcept -> lock_guard & {
+    if (this != &other) {
+      unlock();
+      mutex_ = std::exchange(other.mutex_, nullptr);
+    }
+    return *this;
+  }
+
+  void unlock() noexcept {
+    if (mutex_) {
+      mutex_->unlock();
+      mutex_ = nullptr;
+    }
+  }
+
+  [[nodiscard]] explicit operator bool() const noexcept { return mutex_ != nullptr; }
+};
+
+/// Shared ownership of an `async_shared_mutex`.
+class async_shared_mutex::shared_lock_guard {
+  async_shared_mutex *mutex_{nullptr};
+
+  friend class async_shared_mutex;
+  template <typename, typename, typename> friend struct detail::waiter_operation;
+
+  shared_lock_guard(async_shared_mutex *m, const detail::waiter_request &) noexcept
+      : mutex_(m) {}
+
+public:
+  shared_lock_guard() = default;
+
+  ~shared_lock_guard() { unlock(); }
+
+  shared_lock_guard(const shared_lock_guard &) = delete;
+  auto operator=(const shared_lock_guard &) -> shared_lock_guard & = delete;
+
+  shared_lock_guard(shared_lock_guard &&other) noexcept
+      : mutex_(std::exchange(other.mutex_, nullptr)) {}
+
+  auto operator=(shared_lock_guard &&other) noexcept -> shared_lock_guard & {
+    if (this != &other) {
+      unlock();
+      mutex_ = std::exchange(other.mutex_, nullptr);
+    }
+    return *this;
+  }
+
+  void unlock() noexcept {
+    if (mutex_) {
+      mutex_->unlock_shared();
+      mutex_ = nullptr;
+    }
+  }
+
+  [[nodiscard]] explicit operator bool() const noexcept { return mutex_ != nullptr; }
+};
+
+inline auto async_shared_mutex::lock() noexcept -> lock_sender {
+  return lock_sender{this, detail::waiter_request{.units = 1U, .exclusive = true}};
+}
+
+inline auto async_shared_mutex::lock_shared() noexcept -> shared_lock_sender {
+  return shared_lock_sender{this, detail::waiter_request{.units = 1U, .exclusive = false}};
+}
+
+inline auto async_shared_mutex::try_lock() noexcept -> std::optional<lock_guard> {
+  detail::waiter_node waiter{};
+  waiter.request.exclusive = true;
+  if (try_acquire_waiter(waiter)) {
+    return lock_guard{this, waiter.request};
+  }
+  return std::nullopt;
+}
+
+inline auto async_shared_mutex::try_lock_shared() noexcept -> std::optional<shared_lock_guard> {
+  detail::waiter_node waiter{};
+  if (try_acquire_waiter(waiter)) {
+    return shared_lock_guard{this, waiter.request};
+  }
+  return std::nullopt;
+}
+
+} // namespace wh::sync
@@ -0,0 +1,436 @@
+// Defines the queued-waiter operation shared by the counted async sync
+// primitives: stop-token cancellation, scheduler handoff and guard delivery.
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <stdexec/execution.hpp>
+
+#include "wh/core/compiler.hpp"
+#include "wh/core/stdexec/manual_lifetime.hpp"
+#include "wh/core/stdexec/resume_scheduler.hpp"
+#include "wh/core/stdexec/scheduler_handoff.hpp"
+#include "wh/core/stdexec/try_schedule.hpp"
+
+namespace wh::sync::detail {
+
+class completion_bits {
+public:
+  static constexpr std::uint8_t claimed_bit_ = 0x1U;
+  static constexpr std::uint8_t completion_started_bit_ = 0x2U;
+  static constexpr std::uint8_t payload_ready_bit_ = 0x4U;
+  static constexpr std::uint8_t ready_and_claimed_bits_ = payload_ready_bit_ | claimed_bit_;
+
+  [[nodiscard]] auto has_claimed() const noexcept -> bool {
+    return (state_bits_.load(std::memory_order_acquire) & claimed_bit_) != 0U;
+  }
+
+  [[nodiscard]] auto start_completion() noexcept -> bool {
+    return (state_bits_.fetch_or(completion_started_bit_, std::memory_order_acq_rel) &
+            completion_started_bit_) == 0U;
+  }
+
+  [[nodiscard]] auto mark_ready() noexcept -> std::uint8_t {
+    return state_bits_.fetch_or(ready_and_claimed_bits_, std::memory_order_acq_rel);
+  }
+
+  [[nodiscard]] static auto is_claimed(const std::uint8_t state_bits) noexcept -> bool {
+    return (state_bits & claimed_bit_) != 0U;
+  }
+
+private:
+  std::atomic<std::uint8_t> state_bits_{0U};
+};
+
+/// What one waiter asks a primitive for.
+struct waiter_request {
+  /// Units requested from a counted primitive.
+  std::size_t units{1U};
+  /// True for exclusive ownership of a reader-writer primitive.
+  bool exclusive{false};
+};
+
+/// Intrusive queue node. `queued` and `acquired` are only written under the
+/// owning primitive's state lock until the waiter is handed to `complete_fn`.
+struct waiter_node {
+  waiter_node *next{nullptr};
+  waiter_node *prev{nullptr};
+  void (*complete_fn)(waiter_node *) noexcept {nullptr};
+  waiter_request request{};
+  bool queued{false};
+  bool acquired{false};
+};
+
+/// FIFO of waiters that supports O(1) removal of a cancelled waiter.
+class waiter_list {
+public:
+  [[nodiscard]] auto empty() const noexcept -> bool { return head_ == nullptr; }
+
+  [[nodiscard]] auto front() const noexcept -> waiter_node * { return head_; }
+
+  auto push_back(waiter_node &node) noexcept -> void {
+    node.next = nullptr;
+    node.prev = tail_;
+    if (tail_ != nullptr) {
+      tail_->next = &node;
+    } else {
+      head_ = &node;
+    }
+    tail_ = &node;
+  }
+
+  auto erase(waiter_node &node) noexcept -> void {
+    if (node.prev != nullptr) {
+      node.prev->next = node.next;
+    } else {
+      head_ = node.next;
+    }
+    if (node.next != nullptr) {
+      node.next->prev = node.prev;
+    } else {
+      tail_ = node.prev;
+    }
+    node.next = nullptr;
+    node.prev = nullptr;
+  }
+
+  [[nodiscard]] auto pop_front() noexcept -> waiter_node * {
+    auto *node = head_;
+    if (node != nullptr) {
+      erase(*node);
+    }
+    return node;
+  }
+
+private:
+  waiter_node *head_{nullptr};
+  waiter_node *tail_{nullptr};
+};
+
+/// Completes every waiter in `granted`. Callers collect grants under their
+/// state lock and call this after releasing it, because a completion may
+/// re-enter the primitive.
+inline auto complete_waiters(waiter_list &granted) noexcept -> void {
+  while (auto *node = granted.pop_front()) {
+    node->complete_fn(node);
+  }
+}
+
+/// Queued acquisition of `primitive_t`, completing with `guard_t` on the
+/// receiver's resume scheduler or with stopped on cancellation.
+///
+/// `primitive_t` provides, all noexcept:
+///   `try_acquire_waiter(waiter_node &) -> bool` grants without queueing;
+///   `acquire_or_enqueue(waiter_node &) -> bool` grants or queues, returning
+///     true when the waiter was queued;
+///   `cancel_waiter(waiter_node &) -> bool` unlinks a still-queued waiter;
+///   `release_waiter(const waiter_node &)` returns a granted request.
+/// `guard_t` is constructible from `(primitive_t *, const waiter_request &)`.
+template <typename primitive_t, typename guard_t, typename receiver_t>
+struct waiter_operation final : waiter_node {
+  using operation_state_concept = stdexec::operation_state_t;
+
+  using stop_token_t = stdexec::stop_token_of_t<stdexec::env_of_t<receiver_t>>;
+  using scheduler_t = wh::core::detail::resume_scheduler_t<stdexec::env_of_t<receiver_t>>;
+
+  struct stop_callback;
+  struct handoff_receiver;
+  struct handoff_value_tag {};
+  struct handoff_stopped_tag {};
+
+  using handoff_op_t =
+      stdexec::connect_result_t<stdexec::schedule_result_t<scheduler_t>, handoff_receiver>;
+  using handoff_storage_t = wh::core::detail::manual_storage<sizeof(handoff_op_t),
+                                                             alignof(handoff_op_t)>;
+  using stop_callback_t = stdexec::stop_callback_for_t<stop_token_t, stop_callback>;
+  using handoff_completion_t = std::variant<handoff_value_tag, handoff_stopped_tag>;
+
+  primitive_t *primitive{nullptr};
+  receiver_t receiver;
+  scheduler_t scheduler;
+  completion_bits completion_bits_{};
+  std::optional<stop_callback_t> stop_callback_{};
+  // Lazy handoff_op: only constructed when scheduler handoff is needed.
+  handoff_storage_t handoff_storage_{};
+  bool handoff_constructed_{false};
+  std::optional<handoff_completion_t> handoff_completion_{};
+  std::atomic<bool> handoff_completion_ready_{false};
+  std::atomic<bool> handoff_start_returned_{true};
+
+  auto *handoff_ptr() noexcept {
+    return std::addressof(handoff_storage_.template get<handoff_op_t>());
+  }
+
+  auto reset_handoff() noexcept -> void {
+    if (!handoff_constructed_) {
+      return;
+    }
+    handoff_storage_.template destruct<handoff_op_t>();
+    handoff_constructed_ = false;
+  }
+
+  void construct_handoff() {
+    handoff_storage_.template construct_with<handoff_op_t>([this]() {
+      return stdexec::connect(stdexec::schedule(scheduler), handoff_receiver{this});
+    });
+    handoff_constructed_ = true;
+  }
+
+  [[nodiscard]] auto ensure_handoff() noexcept -> bool {
+    if (is_same_scheduler() || handoff_constructed_) {
+      return true;
+    }
+    try {
+      construct_handoff();
+      return true;
+    } catch (...) {
+      return false;
+    }
+  }
+
+  struct stop_callback {
+    waiter_operation *self{nullptr};
+    auto operator()() const noexcept -> void { self->cancel_wait(); }
+  };
+
+  struct handoff_receiver {
+    using receiver_concept = stdexec::receiver_t;
+
+    waiter_operation *self{nullptr};
+
+    auto set_value() noexcept -> void {
+      self->publish_handoff_completion(handoff_completion_t{handoff_value_tag{}});
+    }
+
+    template <typename error_t> auto set_error(error_t &&) noexcept -> void {
+      self->publish_handoff_completion(handoff_completion_t{handoff_stopped_tag{}});
+    }
+
+    auto set_stopped() noexcept -> void {
+      self->publish_handoff_completion(handoff_completion_t{handoff_stopped_tag{}});
+    }
+
+    [[nodiscard]] auto get_env() const noexcept -> stdexec::env<> { return {}; }
+  };
+
+  template <typename receiver_value_t>
+    requires std::constructible_from<receiver_t, receiver_value_t &&>
+  waiter_operation(primitive_t *primitive_ptr, const waiter_request request_value,
+                   receiver_value_t &&receiver_value)
+      : primitive(primitive_ptr), receiver(std::forward<receiver_value_t>(receiver_value)),
+        scheduler(wh::core::detail::select_resume_scheduler<stdexec::set_value_t>(
+            stdexec::get_env(receiver))) {
+    this->request = request_value;
+    this->complete_fn = [](waiter_node *base) noexcept {
+      static_cast<waiter_operation *>(base)->complete_ready();
+    };
+  }
+
+  ~waiter_operation() { reset_handoff(); }
+
+  waiter_operation(const waiter_operation &) = delete;
+  auto operator=(const waiter_operation &) -> waiter_operation & = delete;
+  waiter_operation(waiter_operation &&) = delete;
+  auto operator=(waiter_operation &&) -> waiter_operation & = delete;
+
+  [[nodiscard]] auto has_claimed() const noexcept -> bool { return completion_bits_.has_claimed(); }
+
+  [[nodiscard]] auto is_same_scheduler() const noexcept -> bool {
+    return wh::core::detail::scheduler_handoff::same_scheduler(scheduler);
+  }
+
+  auto release_acquired() noexcept -> void {
+    if (!this->acquired || primitive == nullptr) {
+      return;
+    }
+    primitive->release_waiter(*this);
+    this->acquired = false;
+  }
+
+  auto publish_handoff_completion(handoff_completion_t completion) noexcept -> void {
+    wh_invariant(!handoff_completion_ready_.load(std::memory_order_acquire));
+    handoff_completion_.emplace(std::move(completion));
+    handoff_completion_ready_.store(true, std::memory_order_release);
+    if (handoff_start_returned_.load(std::memory_order_acquire)) {
+      drain_handoff_completion();
+    }
+  }
+
+  auto drain_handoff_completion() noexcept -> void {
+    if (!handoff_completion_ready_.exchange(false, std::memory_order_acq_rel)) {
+      return;
+    }
+    auto completion = std::move(*handoff_completion_);
+    handoff_completion_.reset();
+    reset_handoff();
+    if (std::holds_alternative<handoff_stopped_tag>(completion)) {
+      release_acquired();
+    }
+    complete();
+  }
+
+  auto complete_ready() noexcept -> void {
+    const auto state_bits = completion_bits_.mark_ready();
+    if (completion_bits::is_claimed(state_bits)) {
+      return;
+    }
+    if (is_same_scheduler()) {
+      complete();
+      return;
+    }
+    wh_invariant(handoff_constructed_);
+    try {
+      handoff_start_returned_.store(false, std::memory_order_release);
+      stdexec::start(*handoff_ptr());
+      handoff_start_returned_.store(true, std::memory_order_release);
+      if (handoff_completion_ready_.load(std::memory_order_acquire)) {
+        drain_handoff_completion();
+      }
+    } catch (...) {
+      handoff_start_returned_.store(true, std::memory_order_release);
+      reset_handoff();
+      release_acquired();
+      complete();
+    }
+  }
+
+  auto complete() noexcept -> void {
+    if (!completion_bits_.start_completion()) {
+      return;
+    }
+    if (this->acquired) {
+      stdexec::set_value(std::move(receiver), guard_t{primitive, this->request});
+    } else {
+      stdexec::set_stopped(std::move(receiver));
+    }
+  }
+
+  // Fast path: granted before publication, so no cancel race is possible.
+  auto complete_sync() noexcept -> void {
+    this->acquired = true;
+    if (is_same_scheduler()) {
+      stdexec::set_value(std::move(receiver), guard_t{primitive, this->request});
+      return;
+    }
+    if (!ensure_handoff()) {
+      release_acquired();
+      stdexec::set_stopped(std::move(receiver));
+      return;
+    }
+    complete_ready();
+  }
+
+  auto cancel_wait() noexcept -> void {
+    if (primitive == nullptr || has_claimed()) {
+      return;
+    }
+    // Race with a grant: the primitive's state lock decides which one wins.
+    if (!primitive->cancel_waiter(*this)) {
+      return;
+    }
+    this->acquired = false;
+    complete_ready();
+  }
+
+  auto prepare_wait(const stop_token_t &stop_token) noexcept -> bool {
+    if (!ensure_handoff()) {
+      stdexec::set_stopped(std::move(receiver));
+      return false;
+    }
+    if constexpr (!stdexec::unstoppable_token<stop_token_t>) {
+      if (!stop_callback_.has_value()) {
+        try {
+          stop_callback_.emplace(stop_token, stop_callback{this});
+        } catch (...) {
+          this->acquired = false;
+          complete_ready();
+          return false;
+        }
+      }
+      if (stop_token.stop_requested()) {
+        this->acquired = false;
+        complete_ready();
+        return false;
+      }
+    }
+    return true;
+  }
+
+  auto start() noexcept -> void {
+    auto stop_token = stdexec::get_stop_token(stdexec::get_env(receiver));
+    if (stop_token.stop_requested()) {
+      if (!is_same_scheduler() && !ensure_handoff()) {
+        stdexec::set_stopped(std::move(receiver));
+        return;
+      }
+      this->acquired = false;
+      complete_ready();
+      return;
+    }
+
+    if (primitive->try_acquire_waiter(*this)) {
+      complete_sync();
+      return;
+    }
+
+    if (!prepare_wait(stop_token)) {
+      return;
+    }
+
+    if (!primitive->acquire_or_enqueue(*this)) {
+      stop_callback_.reset();
+      complete_sync();
+      return;
+    }
+
+    if constexpr (!stdexec::unstoppable_token<stop_token_t>) {
+      if (stop_token.stop_requested()) {
+        cancel_wait();
+      }
+    }
+  }
+};
+
+/// Sender returned by the acquire entry points of queued primitives.
+template <typename primitive_t, typename guard_t> class waiter_sender {
+public:
+  using sender_concept = stdexec::sender_t;
+  using completion_signatures =
+      stdexec::completion_signatures<stdexec::set_value_t(guard_t), stdexec::set_stopped_t()>;
+
+  waiter_sender(primitive_t *primitive, const waiter_request request) noexcept
+      : primitive_(primitive), request_(request) {}
+
+  template <stdexec::receiver_of<completion_signatures> receiver_t>
+    requires wh::core::detail::receiver_with_resume_scheduler<receiver_t>
+  [[nodiscard]] auto connect(receiver_t receiver) const
+      -> waiter_operation<primitive_t, guard_t, std::remove_cvref_t<receiver_t>> {
+    return waiter_operation<primitive_t, guard_t, std::remove_cvref_t<receiver_t>>{
+        primitive_, request_, std::move(receiver)};
+  }
+
+  template <typename promise_t>
+    requires wh::core::detail::promise_with_resume_scheduler<promise_t>
+  [[nodiscard]] auto as_awaitable(promise_t &promise) const -> decltype(auto) {
+    return stdexec::as_awaitable(
+        stdexec::then(*this, [](guard_t guard) noexcept -> guard_t { return guard; }), promise);
+  }
+
+  [[nodiscard]] auto get_env() const noexcept -> wh::core::detail::async_completion_env {
+    return {};
+  }
+
+private:
+  primitive_t *primitive_{nullptr};
+  waiter_request request_{};
+};
+
+} // namespace wh::sync::detail
@@ -33,6 +33,7 @@
 #include "wh/schema/stream/core/any_stream.hpp"
 #include "wh/schema/stream/reader/values_stream_reader.hpp"
 #include "wh/schema/tool/types.hpp"
+#include "wh/schema/tool/validator.hpp"
 #include "wh/tool/callback_event.hpp"
 #include "wh/tool/options.hpp"
 #include "wh/tool/utils/common.hpp"
@@ -72,112 +73,7 @@ namespace detail {
   return next;
 }
 
-[[nodiscard]] inline auto validate_value_against_schema(
-    const wh::core::json_value &value, const wh::schema::tool_parameter_schema &schema,
-    const std::string &path, std::string &error_path, const bool capture_error = true) -> bool {
-  const auto fail = [&]() -> bool {
-    if (capture_error) {
-      error_path = path;
-    }
-    return false;
-  };
-
-  const auto type_ok = [&]() -> bool {
-    switch (schema.type) {
-    case wh::schema::tool_parameter_type::string:
-      return value.IsString();
-    case wh::schema::tool_parameter_type::integer:
-      return value.IsInt64() || value.IsUint64();
-    case wh::schema::tool_parameter_type::number:
-      return value.IsNumber();
-    case wh::schema::tool_parameter_type::boolean:
-      return value.IsBool();
-    case wh::schema::tool_parameter_type::object:
-      return value.IsObject();
-    case wh::schema::tool_parameter_type::array:
-      return value.IsArray();
-    }
-    return false;
-  };
-
-  if (!type_ok()) {
-    return fail();
-  }
-
-  if (schema.type == wh::schema::tool_parameter_type::string && !schema.enum_values.empty()) {
-    const std::string_view current{value.GetString(),
-                                   static_cast<std::size_t>(value.GetStringLength())};
-    if (std::ranges::find(schema.enum_values, current) == schema.enum_values.end()) {
-      return fail();
-    }
-  }
-
-  if (!schema.one_of.empty()) {
-    bool matched = false;
-    for (const auto &candidate : schema.one_of) {
-      std::string candidate_error{};
-      if (validate_value_against_schema(value, candidate, path, candidate_error, false)) {
-        matched = true;
-        break;
-      }
-    }
-    if (!matched) {
-      return fail();
-    }
-  }
-
-  if (schema.type == wh::schema::tool_parameter_type::object) {
-    for (const auto &property : schema.properties) {
-      const auto child_path = append_path_segment(path, property.name);
-      const auto member = value.FindMember(rapidjson::StringRef(
-          property.name.data(), static_cast<rapidjson::SizeType>(property.name.size())));
-      if (member == value.MemberEnd()) {
-        if (property.required) {
-          if (capture_error) {
-            error_path = child_path;
-          }
-          return false;
-        }
-        continue;
-      }
-      if (!validate_value_against_schema(member->value, property, child_path, error_path,
-                                         capture_error)) {
-        return false;
-      }
-    }
-  }
-
-  if (schema.type == wh::schema::tool_parameter_type::array && !schema.item_types.empty()) {
-    for (std::size_t index = 0U; index < value.Size(); ++index) {
-      const auto &item = value[static_cast<wh::core::json_size_type>(index)];
-      const auto item_path = append_path_index(path, index);
-      if (schema.item_types.size() == 1U) {
-        if (!validate_value_against_schema(item, schema.item_types.front(), item_path, error_path,
-                                           capture_error)) {
-          return false;
-        }
-        continue;
-      }
-      bool matched = false;
-      for (const auto &candidate : schema.item_types) {
-        std::string candidate_error{};
-        if (validate_value_against_schema(item, candidate, item_path, candidate_error, false)) {
-          matched = true;
-          break;
-        }
-      }
-      if (!matched) {
-        if (capture_error) {
-          error_path = item_path;
-        }
-        return false;
-      }
-    }
-  }
-
-  return true;
-}
-
+/// Validates `input` against `parameters` with a one-shot compiled program.
 [[nodiscard]] inline auto
 validate_tool_input_schema(const std::string_view input,
                            const std::span<const wh::schema::tool_parameter_schema> parameters,
@@ -185,35 +81,7 @@ validate_tool_input_schema(const std::string_view input,
   if (parameters.empty()) {
     return {};
   }
-
-  auto parsed = wh::core::parse_json(input);
-  if (parsed.has_error()) {
-    error_path = "$";
-    return wh::core::result<void>::failure(parsed.error());
-  }
-  if (!parsed.value().IsObject()) {
-    error_path = "$";
-    return wh::core::result<void>::failure(wh::core::errc::type_mismatch);
-  }
-
-  for (const auto &parameter : parameters) {
-    const auto param_path = append_path_segment("$", parameter.name);
-    const auto member = parsed.value().FindMember(rapidjson::StringRef(
-        parameter.name.data(), static_cast<rapidjson::SizeType>(parameter.name.size())));
-    if (member == parsed.value().MemberEnd()) {
-      if (parameter.required) {
-        error_path = param_path;
-        return wh::core::result<void>::failure(wh::core::errc::invalid_argument);
-      }
-      continue;
-    }
-
-    if (!validate_value_against_schema(member->value, parameter, param_path, error_path)) {
-      return wh::core::result<void>::failure(wh::core::errc::invalid_argument);
-    }
-  }
-
-  return {};
+  return wh::schema::compiled_tool_schema{parameters}.validate(input, error_path);
 }
 
 struct callback_state {
@@ -225,8 +93,10 @@ using callback_sink = wh::callbacks::callback_sink;
 using wh::callbacks::borrow_callback_sink;
 using wh::callbacks::make_callback_sink;
 
+/// Tool callback state is bound once in `prepare_tool_run`, so emission
+/// borrows its run-info.
 template <typename... args_t> inline auto emit_callback(args_t &&...args) -> void {
-  wh::callbacks::emit(std::forward<args_t>(args)...);
+  wh::callbacks::emit_bound(std::forward<args_t>(args)...);
 }
 
 [[nodiscard]] inline auto make_callback_state(const std::string_view tool_name,
@@ -458,8 +328,14 @@ template <typename result_t> struct tool_run_state {
 template <typename result_t>
 [[nodiscard]] inline auto prepare_tool_run(tool_request request, callback_sink sink,
                                            const wh::schema::tool_schema_definition &schema,
+                                           const wh::schema::compiled_tool_schema *validator,
                                            const tool_options &default_options)
     -> wh::core::result<tool_run_state<result_t>> {
+  // A moved-from tool no longer owns its compiled validator.
+  if (validator == nullptr) {
+    return wh::core::result<tool_run_state<result_t>>::failure(
+        wh::core::errc::contract_violation);
+  }
   auto effective_request =
       tool_request{std::move(request.input_json), merge_options(default_options, request.options)};
   sink = wh::callbacks::filter_callback_sink(std::move(sink), effective_request.options);
@@ -471,7 +347,11 @@ template <typename result_t>
       .resolved_options = std::move(resolved_options),
       .last_error = wh::core::make_error(wh::core::errc::ok),
   };
-  state.callback = make_callback_state(schema.name, state.request);
+  if (state.sink.active_any(wh::callbacks::component_call_stages)) {
+    state.callback = make_callback_state(schema.name, state.request);
+    state.callback.run_info =
+        wh::callbacks::bind_run_info(state.sink, std::move(state.callback.run_info));
+  }
   state.max_attempts = state.resolved_options.failure_policy == tool_failure_policy::retry
                            ? state.resolved_options.max_retries + 1U
                            : 1U;
@@ -479,10 +359,11 @@ template <typename result_t>
   emit_callback(state.sink, wh::callbacks::stage::start, state.callback);
 
   std::string validation_path{};
-  auto validated =
-      validate_tool_input_schema(state.request.input_json, schema.parameters, validation_path);
+  auto validated = validator->validate(state.request.input_json, validation_path);
   if (validated.has_error()) {
-    state.callback.event.error_context = std::move(validation_path);
+    if (state.sink.active_any(wh::callbacks::component_call_stages)) {
+      state.callback.event.error_context = std::move(validation_path);
+    }
     emit_callback(state.sink, wh::callbacks::stage::error, state.callback);
     return wh::core::result<tool_run_state<result_t>>::failure(validated.error());
   }
@@ -493,7 +374,9 @@ template <typename result_t>
 [[nodiscard]] inline auto consume_tool_attempt_result(tool_run_state<result_t> &state,
                                                       result_t status) -> bool {
   if (status.has_value()) {
-    tool_result_traits<result_t>::record_success(state.callback, status);
+    if (state.sink.active_any(wh::callbacks::component_call_stages)) {
+      tool_result_traits<result_t>::record_success(state.callback, status);
+    }
     state.success.emplace(std::move(status));
     return true;
   }
@@ -967,7 +850,7 @@ private:
       -> tool_invoke_result {
     auto prepared = detail::prepare_tool_run<tool_invoke_result>(
         tool_request{request.input_json, request.options}, std::move(sink), schema_,
-        default_options_);
+        validator_.get(), default_options_);
     if (prepared.has_error()) {
       return tool_invoke_result::failure(prepared.error());
     }
@@ -984,7 +867,7 @@ private:
       -> tool_output_stream_result {
     auto prepared = detail::prepare_tool_run<tool_output_stream_result>(
         tool_request{request.input_json, request.options}, std::move(sink), schema_,
-        default_options_);
+        validator_.get(), default_options_);
     if (prepared.has_error()) {
       return tool_output_stream_result::failure(prepared.error());
     }
@@ -1003,7 +886,7 @@ private:
         [this, request = tool_request{request.input_json, request.options},
          sink = std::move(sink)](auto scheduler) mutable {
           auto prepared = detail::prepare_tool_run<tool_invoke_result>(
-              std::move(request), std::move(sink), schema_, default_options_);
+              std::move(request), std::move(sink), schema_, validator_.get(), default_options_);
           return detail::make_tool_attempt_loop_sender<tool_invoke_result>(
               std::move(prepared),
               [this, scheduler = std::move(scheduler)](auto &loop_state) mutable {
@@ -1022,7 +905,7 @@ private:
         [this, request = tool_request{request.input_json, request.options},
          sink = std::move(sink)](auto scheduler) mutable {
           auto prepared = detail::prepare_tool_run<tool_output_stream_result>(
-              std::move(request), std::move(sink), schema_, default_options_);
+              std::move(request), std::move(sink), schema_, validator_.get(), default_options_);
           return detail::make_tool_attempt_loop_sender<tool_output_stream_result>(
               std::move(prepared),
               [this, scheduler = std::move(scheduler)](auto &loop_state) mutable {
@@ -1035,6 +918,10 @@ private:
   wh::schema::tool_schema_definition schema_{};
   wh_no_unique_address impl_t impl_{};
   tool_options default_options_{};
+  /// Argument validator compiled once from `schema_.parameters`; shared by
+  /// copies and null once moved from.
+  std::shared_ptr<const wh::schema::compiled_tool_schema> validator_{
+      std::make_shared<const wh::schema::compiled_tool_schema>(schema_.parameters)};
 };
 
 template <typename schema_t, typename impl_t>
@@ -37,12 +37,12 @@ template <typename value_t>
   } else if constexpr (std::convertible_to<normalized_t, std::string_view>) {
     return std::string{std::string_view{std::forward<value_t>(value)}};
   } else {
-    wh::core::json_document document;
-    auto encoded = wh::internal::to_json(value, document, document.GetAllocator());
+    wh::core::json_arena_scope arena_scope{};
+    auto encoded = wh::internal::to_json_string(value, arena_scope.arena());
     if (encoded.has_error()) {
       return wh::core::result<std::string>::failure(encoded.error());
     }
-    return wh::core::json_to_string(document);
+    return std::string{encoded.value()};
   }
 }
 
@@ -88,13 +88,14 @@ decode_tool_input(const std::string_view input,
     return decoded;
   }
 
-  auto parsed = wh::core::parse_json(input);
+  wh::core::json_arena_scope arena_scope{};
+  auto parsed = wh::core::parse_json_into(arena_scope.arena(), input);
   if (parsed.has_error()) {
     return wh::core::result<params_t>::failure(parsed.error());
   }
 
   params_t output{};
-  auto decoded = wh::internal::from_json(parsed.value(), output);
+  auto decoded = wh::internal::from_json(*parsed.value(), output);
   if (decoded.has_error()) {
     return wh::core::result<params_t>::failure(decoded.error());
   }
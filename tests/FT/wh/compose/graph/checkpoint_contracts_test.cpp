@@ -11,6 +11,7 @@
 #include "helper/compose_graph_runtime_support.hpp"
 #include "helper/compose_graph_test_utils.hpp"
 #include "wh/compose/runtime/checkpoint.hpp"
+#include "wh/compose/runtime/checkpoint_parking.hpp"
 #include "wh/compose/runtime/interrupt.hpp"
 #include "wh/compose/runtime/state.hpp"
 #include "wh/core/any.hpp"
@@ -414,6 +415,88 @@ TEST_CASE("compose graph runtime supports pluggable checkpoint backend callbacks
   REQUIRE(saved_start_input.value() == 5);
 }
 
+TEST_CASE("compose graph parking backend resumes live state and persists only on flush",
+          "[core][compose][checkpoint][condition]") {
+  wh::compose::graph graph{};
+  REQUIRE(graph.add_lambda(make_int_add_node("worker", 1)).has_value());
+  REQUIRE(graph.add_entry_edge("worker").has_value());
+  REQUIRE(graph.add_exit_edge("worker").has_value());
+  REQUIRE(graph.compile().has_value());
+
+  std::size_t encode_calls = 0U;
+  const wh::compose::checkpoint_serializer serializer{
+      .encode =
+          wh::compose::checkpoint_serializer_encode{
+              [&encode_calls](wh::compose::checkpoint_state &&state, wh::core::run_context &)
+                  -> wh::core::result<wh::compose::graph_value> {
+                ++encode_calls;
+                return wh::core::any(std::move(state));
+              }},
+      .decode =
+          wh::compose::checkpoint_serializer_decode{
+              [](wh::compose::graph_value &&payload,
+                 wh::core::run_context &) -> wh::core::result<wh::compose::checkpoint_state> {
+                return read_any<wh::compose::checkpoint_state>(std::move(payload));
+              }},
+  };
+  std::optional<wh::compose::graph_value> stored_payload{};
+  const wh::compose::checkpoint_payload_sink payload_sink{
+      .save =
+          wh::compose::checkpoint_payload_save{
+              [&stored_payload](wh::compose::graph_value &&payload,
+                                wh::compose::checkpoint_save_options &&,
+                                wh::core::run_context &) -> wh::core::result<void> {
+                stored_payload = std::move(payload);
+                return {};
+              }},
+  };
+  wh::compose::checkpoint_parking_lot parking{wh::compose::checkpoint_parking_options{
+      .durable_payload_sink = std::addressof(payload_sink),
+      .serializer = std::addressof(serializer),
+  }};
+
+  wh::compose::graph_runtime_services services{};
+  services.checkpoint.backend = parking.backend();
+  services.checkpoint.serializer = std::addressof(serializer);
+  wh::compose::graph_invoke_controls controls{};
+  controls.checkpoint.save = wh::compose::checkpoint_save_options{
+      .checkpoint_id = std::string{"parked-run"},
+  };
+  wh::core::run_context context{};
+  auto invoked =
+      invoke_graph_sync(graph, wh::core::any(6), context, controls, std::addressof(services));
+  REQUIRE(invoked.has_value());
+  REQUIRE(invoked.value().output_status.has_value());
+  REQUIRE(parking.contains("parked-run"));
+  REQUIRE(encode_calls == 0U);
+
+  wh::compose::graph_invoke_controls resume_controls{};
+  resume_controls.checkpoint.load =
+      wh::compose::checkpoint_load_options{.checkpoint_id = std::string{"parked-run"}};
+  resume_controls.checkpoint.save = controls.checkpoint.save;
+  wh::core::run_context resume_context{};
+  auto resumed = invoke_graph_sync(graph, wh::compose::graph_input::restore_checkpoint(),
+                                   resume_context, resume_controls, std::addressof(services));
+  REQUIRE(resumed.has_value());
+  REQUIRE(resumed.value().output_status.has_value());
+  auto typed = read_any<int>(resumed.value().output_status.value());
+  REQUIRE(typed.has_value());
+  REQUIRE(typed.value() == 7);
+  REQUIRE(encode_calls == 0U);
+  REQUIRE(parking.size() == 1U);
+
+  auto flushed = parking.flush();
+  REQUIRE(flushed.has_value());
+  REQUIRE(flushed.value() == 1U);
+  REQUIRE(encode_calls == 1U);
+  REQUIRE(stored_payload.has_value());
+  auto persisted = read_any<wh::compose::checkpoint_state>(std::move(*stored_payload));
+  REQUIRE(persisted.has_value());
+  auto persisted_start = checkpoint_entry_input(persisted.value());
+  REQUIRE(persisted_start.has_value());
+  REQUIRE(persisted_start.value() == 6);
+}
+
 TEST_CASE("compose graph checkpoint serializer falls back to default and supports custom hooks",
           "[core][compose][checkpoint][condition]") {
   wh::compose::graph graph{};
@@ -68,14 +68,24 @@ TEST_CASE("agent tool impl detail constants runtime access and metadata helpers
   REQUIRE(default_metadata.agent_name == "worker");
   REQUIRE(default_metadata.tool_name == "delegate");
   REQUIRE(default_metadata.path.to_string("/") == "tool/delegate/call-1/agent/worker");
+  REQUIRE(default_metadata.path_prefix.empty());
 
+  wh::adk::run_path_forwarder forwarder{snapshot.location};
   wh::adk::event_metadata child_metadata{};
   child_metadata.path = wh::adk::run_path{{"agent", "leaf"}};
-  auto normalized = wh::adk::detail::normalize_child_metadata(runtime.value(), snapshot,
+  auto normalized = wh::adk::detail::normalize_child_metadata(runtime.value(), forwarder,
                                                               std::move(child_metadata));
-  REQUIRE(normalized.path.to_string("/") == "tool/delegate/call-1/agent/leaf");
+  REQUIRE(normalized.path.to_string("/") == "agent/leaf");
+  REQUIRE(wh::adk::resolve_run_path(normalized).to_string("/") ==
+          "tool/delegate/call-1/agent/leaf");
   REQUIRE(normalized.agent_name == "worker");
   REQUIRE(normalized.tool_name == "delegate");
+
+  wh::adk::event_metadata sibling_metadata{};
+  sibling_metadata.path = wh::adk::run_path{{"agent", "leaf"}};
+  auto sibling = wh::adk::detail::normalize_child_metadata(runtime.value(), forwarder,
+                                                           std::move(sibling_metadata));
+  REQUIRE(sibling.path_prefix.same_chain(normalized.path_prefix));
 }
 
 TEST_CASE(
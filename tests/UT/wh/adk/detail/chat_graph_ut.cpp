@@ -93,11 +93,11 @@ TEST_CASE("chat detail helpers normalize message streams instructions and output
   REQUIRE(invalid_messages.has_error());
   REQUIRE(invalid_messages.error() == wh::core::errc::type_mismatch);
 
-  auto instruction = wh::adk::detail::chat_detail::make_instruction_message("role", "prompt");
-  REQUIRE(instruction.has_value());
+  auto instruction = wh::adk::detail::make_instruction_message("role", "prompt");
+  REQUIRE(instruction != nullptr);
   REQUIRE(instruction->role == wh::schema::message_role::system);
   REQUIRE(std::get<wh::schema::text_part>(instruction->parts.front()).text == "role\nprompt");
-  REQUIRE_FALSE(wh::adk::detail::chat_detail::make_instruction_message("", "").has_value());
+  REQUIRE(wh::adk::detail::make_instruction_message("", "") == nullptr);
 
   wh::schema::message rendered{};
   rendered.role = wh::schema::message_role::assistant;
@@ -40,3 +40,25 @@ TEST_CASE("live_event_bridge close prevents later emits from succeeding",
   REQUIRE(status.has_error());
   REQUIRE(status.error() == wh::core::errc::channel_closed);
 }
+
+TEST_CASE("live_event_bridge folds deferred path prefixes before events reach the reader",
+          "[UT][wh/adk/detail/live_event_bridge.hpp][live_event_bridge::emit][boundary]") {
+  auto bridge = wh::adk::detail::make_live_event_bridge();
+  wh::adk::run_path_forwarder forwarder{wh::adk::run_path{{"tool", "delegate"}}};
+  wh::adk::event_metadata metadata{};
+  metadata.path = wh::adk::run_path{{"agent", "leaf"}};
+  metadata.path_prefix = forwarder.forward(metadata.path_prefix);
+  REQUIRE(bridge
+              .emit(wh::adk::make_control_event(
+                  wh::adk::control_action{.kind = wh::adk::control_action_kind::exit},
+                  std::move(metadata)))
+              .has_value());
+  REQUIRE(bridge.close().has_value());
+
+  auto reader = bridge.release_reader();
+  auto next = wh::adk::read_agent_event_stream(reader);
+  REQUIRE(next.has_value());
+  REQUIRE(next.value().value.has_value());
+  REQUIRE(next.value().value->metadata.path.to_string("/") == "tool/delegate/agent/leaf");
+  REQUIRE(next.value().value->metadata.path_prefix.empty());
+}
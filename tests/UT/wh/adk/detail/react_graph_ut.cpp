@@ -145,9 +145,9 @@ TEST_CASE(
   REQUIRE(invalid_messages.has_error());
   REQUIRE(invalid_messages.error() == wh::core::errc::type_mismatch);
 
-  auto instruction = wh::adk::detail::react_detail::make_instruction_message("role", "guide");
-  REQUIRE(instruction.has_value());
-  REQUIRE_FALSE(wh::adk::detail::react_detail::make_instruction_message("", "").has_value());
+  auto instruction = wh::adk::detail::make_instruction_message("role", "guide");
+  REQUIRE(instruction != nullptr);
+  REQUIRE(wh::adk::detail::make_instruction_message("", "") == nullptr);
 
   wh::agent::react authored{"react", "assistant"};
   wh::schema::tool_schema_definition schema{
@@ -315,7 +315,8 @@ TEST_CASE(
   REQUIRE(state->get().remaining_iterations == 2U);
 
   auto prepare_request = wh::adk::detail::react_detail::make_prepare_request_options(
-      "desc", "inst", std::vector<wh::schema::tool_schema_definition>{});
+      wh::adk::detail::make_instruction_message("desc", "inst"),
+      std::vector<wh::schema::tool_schema_definition>{});
   REQUIRE(run_pre(prepare_request, process_state, payload).has_value());
   auto *request = wh::core::any_cast<wh::model::chat_request>(&payload);
   REQUIRE(request != nullptr);
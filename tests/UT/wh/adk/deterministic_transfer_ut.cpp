@@ -1,4 +1,7 @@
+#include <cstddef>
+#include <span>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -201,3 +204,77 @@ TEST_CASE(
               .has_value());
   REQUIRE(history.size() == 2U);
 }
+
+TEST_CASE("transfer history view extends rewrite spans incrementally and matches full rewrite",
+          "[UT][wh/adk/"
+          "deterministic_transfer.hpp][transfer_history_view][condition][branch][boundary]") {
+  const wh::adk::resolved_transfer_trim_options trim{
+      .trim_assistant_transfer_message = true,
+      .trim_tool_transfer_pair = true,
+  };
+  std::vector<wh::schema::message> history{};
+  history.push_back(make_named_text_message(wh::schema::message_role::user, "", "question"));
+  history.push_back(
+      make_named_text_message(wh::schema::message_role::assistant, "planner", "plan"));
+  history.push_back(wh::adk::make_transfer_assistant_message("worker", "call-1"));
+  history.push_back(wh::adk::make_transfer_tool_message("worker", "call-1"));
+
+  wh::adk::transfer_history_view view{};
+  auto spans = view.overlay(history, "worker", trim);
+  REQUIRE(spans.size() == 3U);
+  REQUIRE(spans[0].kind == wh::adk::transfer_rewrite_kind::keep);
+  REQUIRE(spans[1].kind == wh::adk::transfer_rewrite_kind::context);
+  REQUIRE(spans[2].kind == wh::adk::transfer_rewrite_kind::trim);
+  REQUIRE(spans[2].begin == 2U);
+  REQUIRE(spans[2].end == 4U);
+  REQUIRE(view.observed_size() == 4U);
+
+  history.push_back(
+      make_named_text_message(wh::schema::message_role::assistant, "worker", "result"));
+  history.push_back(
+      make_named_text_message(wh::schema::message_role::tool, "planner", "tool output"));
+  spans = view.overlay(history, "worker", trim);
+  REQUIRE(spans.size() == 5U);
+  REQUIRE(spans[3].begin == 4U);
+  REQUIRE(spans[3].kind == wh::adk::transfer_rewrite_kind::keep);
+  REQUIRE(spans[4].kind == wh::adk::transfer_rewrite_kind::context);
+
+  const auto expect_same = [&history](wh::adk::transfer_history_view &target,
+                                      const std::string_view agent,
+                                      const wh::adk::resolved_transfer_trim_options options) {
+    const auto incremental = target.rewrite(history, agent, options);
+    const auto full = wh::adk::rewrite_transfer_history(history, agent, options);
+    REQUIRE(incremental.size() == full.size());
+    for (std::size_t index = 0U; index < full.size(); ++index) {
+      REQUIRE(incremental[index].role == full[index].role);
+      REQUIRE(incremental[index].name == full[index].name);
+      REQUIRE(wh::adk::detail::transfer::render_message_text(incremental[index]) ==
+              wh::adk::detail::transfer::render_message_text(full[index]));
+    }
+  };
+  expect_same(view, "worker", trim);
+  expect_same(view, "planner", trim);
+  expect_same(view, "planner", {});
+
+  history.resize(2U);
+  expect_same(view, "worker", trim);
+  REQUIRE(view.observed_size() == 2U);
+
+  view.reset();
+  REQUIRE(view.observed_size() == 0U);
+  REQUIRE(view.rewrite(std::span<const wh::schema::message>{}, "worker", trim).empty());
+}
+
+TEST_CASE("record parent visible event moves messages out of rvalue events",
+          "[UT][wh/adk/deterministic_transfer.hpp][record_parent_visible_event][branch]") {
+  wh::adk::deterministic_transfer_state visible{};
+  visible.exact_run_path = wh::core::address{{"root", "planner"}};
+  auto event =
+      make_message_event(wh::core::address{{"root", "planner"}},
+                         make_named_text_message(wh::schema::message_role::assistant, "planner",
+                                                 "moved"));
+  REQUIRE(wh::adk::record_parent_visible_event(visible, std::move(event)).has_value());
+  REQUIRE(visible.visible_history.size() == 1U);
+  REQUIRE(std::get<wh::schema::text_part>(visible.visible_history.front().parts.front()).text ==
+          "moved");
+}
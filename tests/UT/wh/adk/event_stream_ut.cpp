@@ -71,6 +71,31 @@ TEST_CASE("send_agent_event maps closed and saturated writer failures to public
   REQUIRE(wh::adk::close_agent_event_stream(small_reader).has_value());
 }
 
+TEST_CASE("make_agent_event_stream grows past the legacy bound and honors explicit limits",
+          "[UT][wh/adk/event_stream.hpp][make_agent_event_stream][boundary]") {
+  auto [writer, reader] = wh::adk::make_agent_event_stream();
+  for (int index = 0; index < 100; ++index) {
+    REQUIRE(wh::adk::send_agent_event(writer, make_message_event("token")).has_value());
+  }
+  for (int index = 0; index < 100; ++index) {
+    auto next = wh::adk::read_agent_event_stream(reader);
+    REQUIRE(next.has_value());
+    REQUIRE(next.value().value.has_value());
+  }
+  REQUIRE(wh::adk::close_agent_event_stream(writer).has_value());
+  REQUIRE(wh::adk::close_agent_event_stream(reader).has_value());
+
+  auto [small_writer, small_reader] =
+      wh::adk::make_agent_event_stream(wh::core::ring_capacity_policy{.initial = 1U, .max = 2U});
+  REQUIRE(wh::adk::send_agent_event(small_writer, make_message_event("a")).has_value());
+  REQUIRE(wh::adk::send_agent_event(small_writer, make_message_event("b")).has_value());
+  auto full = wh::adk::send_agent_event(small_writer, make_message_event("c"));
+  REQUIRE(full.has_error());
+  REQUIRE(full.error() == wh::core::errc::resource_exhausted);
+  REQUIRE(wh::adk::close_agent_event_stream(small_writer).has_value());
+  REQUIRE(wh::adk::close_agent_event_stream(small_reader).has_value());
+}
+
 TEST_CASE("send_agent_event_or_error forwards successful factories unchanged",
           "[UT][wh/adk/event_stream.hpp][send_agent_event_or_error][condition][branch][boundary]") {
   auto [writer, reader] = wh::adk::make_agent_event_stream();
@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/adk/run_path.hpp"
+
+TEST_CASE("run path prefix prepends levels outermost first and materializes once",
+          "[UT][wh/adk/run_path.hpp][run_path_prefix::prepend][branch][boundary]") {
+  const wh::adk::run_path_prefix empty{};
+  REQUIRE(empty.empty());
+  REQUIRE(empty.size() == 0U);
+  REQUIRE(empty.prepend(wh::adk::run_path{}).empty());
+  REQUIRE(empty.materialize(wh::adk::run_path{{"leaf"}}).to_string() == "leaf");
+
+  const auto inner = empty.prepend(wh::adk::run_path{{"tool", "inner"}});
+  const auto outer = inner.prepend(wh::adk::run_path{{"agent", "outer"}});
+  REQUIRE(inner.size() == 2U);
+  REQUIRE(outer.size() == 4U);
+  REQUIRE(outer.materialize(wh::adk::run_path{{"leaf"}}).to_string() ==
+          "agent/outer/tool/inner/leaf");
+  REQUIRE(inner.materialize(wh::adk::run_path{}).to_string() == "tool/inner");
+  REQUIRE(outer.prepend(wh::adk::run_path{}).same_chain(outer));
+}
+
+TEST_CASE("run path prefix matches expected paths without materializing",
+          "[UT][wh/adk/run_path.hpp][run_path_prefix::matches][condition][boundary]") {
+  const auto prefix = wh::adk::run_path_prefix{}
+                          .prepend(wh::adk::run_path{{"b"}})
+                          .prepend(wh::adk::run_path{{"a"}});
+  const wh::adk::run_path suffix{{"c"}};
+  REQUIRE(prefix.matches(suffix, wh::adk::run_path{{"a", "b", "c"}}));
+  REQUIRE_FALSE(prefix.matches(suffix, wh::adk::run_path{{"a", "x", "c"}}));
+  REQUIRE_FALSE(prefix.matches(suffix, wh::adk::run_path{{"a", "b"}}));
+  REQUIRE(wh::adk::run_path_prefix{}.matches(wh::adk::run_path{}, wh::adk::run_path{}));
+}
+
+TEST_CASE("append run path prefix concatenates without mutating either source",
+          "[UT][wh/adk/run_path.hpp][append_run_path_prefix][boundary]") {
+  const wh::adk::run_path prefix{{"parent", "agent"}};
+  const wh::adk::run_path suffix{{"child"}};
+  REQUIRE(wh::adk::append_run_path_prefix(prefix, suffix).to_string() == "parent/agent/child");
+  REQUIRE(wh::adk::append_run_path_prefix({}, suffix) == suffix);
+  REQUIRE(wh::adk::append_run_path_prefix(prefix, {}) == prefix);
+  REQUIRE(prefix.size() == 2U);
+}
+
+TEST_CASE("run path forwarder reuses its node while the inner chain is unchanged",
+          "[UT][wh/adk/run_path.hpp][run_path_forwarder::forward][branch]") {
+  wh::adk::run_path_forwarder inner_level{wh::adk::run_path{{"inner"}}};
+  wh::adk::run_path_forwarder outer_level{wh::adk::run_path{{"outer"}}};
+  REQUIRE(outer_level.prefix().to_string() == "outer");
+
+  const auto first = outer_level.forward(inner_level.forward({}));
+  const auto second = outer_level.forward(inner_level.forward({}));
+  REQUIRE(first.same_chain(second));
+  REQUIRE(first.materialize(wh::adk::run_path{{"token"}}).to_string() == "outer/inner/token");
+
+  const auto rerouted = wh::adk::run_path_prefix{}.prepend(wh::adk::run_path{{"other"}});
+  const auto third = outer_level.forward(rerouted);
+  REQUIRE_FALSE(third.same_chain(first));
+  REQUIRE(third.materialize(wh::adk::run_path{}).to_string() == "outer/other");
+}
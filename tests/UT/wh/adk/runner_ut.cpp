@@ -122,6 +122,28 @@ TEST_CASE("adk runner utility helpers normalize run paths events message collect
       wh::adk::run_path{{"root"}});
   REQUIRE(prefixed.metadata.path.to_string("/") == "root/leaf");
 
+  wh::adk::run_path_forwarder inner_level{wh::adk::run_path{{"inner"}}};
+  wh::adk::run_path_forwarder outer_level{wh::adk::run_path{{"outer"}}};
+  auto forwarded = wh::adk::prefix_agent_event(
+      wh::adk::prefix_agent_event(
+          wh::adk::make_message_event(make_assistant_message("token"),
+                                      wh::adk::event_metadata{.path = wh::adk::run_path{{"leaf"}}}),
+          inner_level),
+      outer_level);
+  REQUIRE(forwarded.metadata.path.to_string("/") == "leaf");
+  REQUIRE(wh::adk::resolve_run_path(forwarded.metadata).to_string("/") == "outer/inner/leaf");
+  REQUIRE(wh::adk::run_path_matches(forwarded.metadata,
+                                    wh::adk::run_path{{"outer", "inner", "leaf"}}));
+  auto flattened = wh::adk::materialize_agent_event_path(std::move(forwarded));
+  REQUIRE(flattened.metadata.path.to_string("/") == "outer/inner/leaf");
+  REQUIRE(flattened.metadata.path_prefix.empty());
+  auto rooted = wh::adk::prefix_agent_event(
+      wh::adk::prefix_agent_event(wh::adk::make_message_event(make_assistant_message("token")),
+                                  outer_level),
+      wh::adk::run_path{{"root"}});
+  REQUIRE(rooted.metadata.path.to_string("/") == "root/outer");
+  REQUIRE(rooted.metadata.path_prefix.empty());
+
   wh::adk::agent_message_stream_reader message_reader{wh::schema::stream::make_values_stream_reader(
       std::vector<wh::schema::message>{make_user_message("a"), make_assistant_message("b")})};
   auto messages = wh::adk::collect_agent_messages(std::move(message_reader));
@@ -243,6 +265,41 @@ TEST_CASE("adk runner detail helpers lower requests and resolve resume targets f
   REQUIRE(invalid.error() == wh::core::errc::invalid_argument);
 }
 
+TEST_CASE("adk runner routes resume targets to parked runs without a prior run context",
+          "[UT][wh/adk/runner.hpp][route_parked_resume][condition][branch]") {
+  wh::compose::checkpoint_parking_lot parking{};
+  wh::compose::checkpoint_state parked{};
+  parked.interrupt_snapshot.interrupt_id_to_address.emplace("approve-1",
+                                                            wh::core::address{{"graph", "gate"}});
+  REQUIRE(parking
+              .park(std::move(parked),
+                    wh::compose::checkpoint_save_options{.checkpoint_id = "session-7"})
+              .has_value());
+
+  wh::adk::resume_request request{};
+  request.targets.push_back(wh::adk::resume_target{
+      .interrupt_id = "approve-1",
+      .payload = wh::core::any{1},
+  });
+  request.targets.push_back(wh::adk::resume_target{
+      .interrupt_id = "unknown",
+      .payload = wh::core::any{2},
+  });
+  REQUIRE(wh::adk::route_parked_resume(parking, request));
+  const auto &load = request.run.options.compose_controls.checkpoint.load;
+  REQUIRE(load.has_value());
+  REQUIRE(load->checkpoint_id == std::optional<std::string>{"session-7"});
+  REQUIRE(request.targets[0].location == wh::core::address({"graph", "gate"}));
+  REQUIRE_FALSE(request.targets[1].location.has_value());
+
+  wh::adk::resume_request other_checkpoint{};
+  other_checkpoint.run.options.compose_controls.checkpoint.load =
+      wh::compose::checkpoint_load_options{.checkpoint_id = "session-8"};
+  other_checkpoint.targets.push_back(wh::adk::resume_target{.interrupt_id = "approve-1"});
+  REQUIRE_FALSE(wh::adk::route_parked_resume(parking, other_checkpoint));
+  REQUIRE_FALSE(other_checkpoint.targets[0].location.has_value());
+}
+
 TEST_CASE(
     "adk runner facade lowers query run and resume requests onto the underlying implementation",
     "[UT][wh/adk/runner.hpp][runner::resume][condition][branch][boundary]") {
@@ -56,3 +56,49 @@ TEST_CASE("agent instruction render skips empty fragments and honors custom sepa
 
   REQUIRE(instruction.render("|") == "tail");
 }
+
+TEST_CASE("agent instruction freeze reuses one rendering until fragments change",
+          "[UT][wh/agent/instruction.hpp][instruction::freeze][condition][branch][boundary]") {
+  wh::agent::instruction instruction{};
+  const auto empty = instruction.freeze();
+  REQUIRE(empty.empty());
+  REQUIRE(empty.text().empty());
+
+  instruction.append("tail", 1);
+  instruction.replace("base", 0);
+  const auto first = instruction.freeze("|");
+  const auto second = instruction.freeze("|");
+  REQUIRE(first.text() == "base|tail");
+  REQUIRE(first.shared_text() == second.shared_text());
+  REQUIRE(first.revision() == instruction.revision());
+  REQUIRE(instruction.render("|") == "base|tail");
+
+  const auto newline = instruction.freeze();
+  REQUIRE(newline.text() == "base\ntail");
+  REQUIRE(newline.shared_text() != first.shared_text());
+
+  instruction.append("more", 2);
+  const auto changed = instruction.freeze();
+  REQUIRE(changed.text() == "base\ntail\nmore");
+  REQUIRE(changed.revision() != newline.revision());
+  REQUIRE(newline.text() == "base\ntail");
+}
+
+TEST_CASE("agent instruction const reads never write the frozen cache",
+          "[UT][wh/agent/instruction.hpp][instruction::snapshot][condition][branch]") {
+  wh::agent::instruction instruction{};
+  instruction.replace("base", 0);
+  instruction.append("tail", 1);
+
+  const auto &reader = instruction;
+  const auto unfrozen = reader.snapshot("|");
+  REQUIRE(unfrozen.text() == "base|tail");
+  REQUIRE(unfrozen.shared_text() != reader.snapshot("|").shared_text());
+
+  const auto frozen = instruction.freeze("|");
+  REQUIRE(reader.snapshot("|").shared_text() == frozen.shared_text());
+  REQUIRE(reader.render("|") == "base|tail");
+  REQUIRE(reader.render() == "base\ntail");
+  REQUIRE(reader.snapshot().shared_text() != frozen.shared_text());
+  REQUIRE(reader.snapshot("|").shared_text() == frozen.shared_text());
+}
@@ -1,3 +1,4 @@
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -137,3 +138,46 @@ TEST_CASE("callbacks helpers apply component run info and filter disabled sinks"
   REQUIRE_FALSE(wh::callbacks::callbacks_enabled(disabled));
   REQUIRE_FALSE(wh::callbacks::filter_callback_sink(std::move(sink), disabled).has_value());
 }
+
+TEST_CASE("callbacks sink skips state construction without listeners and borrows bound run info",
+          "[UT][wh/callbacks/"
+          "callbacks.hpp][make_lazy_callback_state][condition][branch][boundary]") {
+  wh::core::run_context silent{};
+  silent.callbacks.emplace();
+  silent.callbacks->metadata.trace_id = "trace-silent";
+  const auto silent_sink = wh::callbacks::borrow_callback_sink(silent);
+  REQUIRE_FALSE(silent_sink.has_value());
+  REQUIRE_FALSE(silent_sink.active(wh::callbacks::stage::start));
+  REQUIRE_FALSE(wh::callbacks::make_callback_sink(silent).has_value());
+
+  int built = 0;
+  const auto make_state = [&built] {
+    ++built;
+    return callback_state_t{.event = callback_event_t{5}, .run_info = make_run_info()};
+  };
+  const auto skipped = wh::callbacks::make_lazy_callback_state(silent_sink, make_state);
+  REQUIRE_FALSE(skipped.has_value());
+  REQUIRE(built == 0);
+  wh::callbacks::emit(silent_sink, wh::callbacks::stage::start, skipped);
+
+  observed_dispatch observed{};
+  auto context = make_sink_context(observed);
+  context.callbacks->metadata.trace_id = "trace-override";
+  const auto sink = wh::callbacks::borrow_callback_sink(context);
+  REQUIRE(sink.active(wh::callbacks::stage::start));
+  REQUIRE_FALSE(sink.active(wh::callbacks::stage::end));
+  REQUIRE(sink.metadata_ptr() == std::addressof(context.callbacks->metadata));
+  REQUIRE_FALSE(sink.metadata.has_value());
+
+  const auto state = wh::callbacks::make_lazy_callback_state(sink, make_state);
+  REQUIRE(state.has_value());
+  REQUIRE(built == 1);
+  REQUIRE(state->run_info.trace_id == "trace-override");
+  REQUIRE(state->run_info.span_id == "span-base");
+
+  wh::callbacks::emit(sink, wh::callbacks::stage::start, state);
+  wh::callbacks::emit(sink, wh::callbacks::stage::end, state);
+  REQUIRE(observed.values == std::vector<int>{5});
+  REQUIRE(observed.trace_ids == std::vector<std::string>{"trace-override"});
+  REQUIRE(observed.span_ids == std::vector<std::string>{"span-base"});
+}
@@ -0,0 +1,205 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/callbacks/span_exporter.hpp"
+
+namespace {
+
+struct collected_spans {
+  std::mutex mutex{};
+  std::vector<wh::callbacks::span_record> spans{};
+  std::vector<std::size_t> batch_sizes{};
+};
+
+[[nodiscard]] auto make_collecting_sink(const std::shared_ptr<collected_spans> &collected)
+    -> wh::callbacks::span_sink {
+  return [collected](const std::span<const wh::callbacks::span_record> spans)
+             -> wh::core::result<void> {
+    std::lock_guard lock{collected->mutex};
+    collected->batch_sizes.push_back(spans.size());
+    collected->spans.insert(collected->spans.end(), spans.begin(), spans.end());
+    return {};
+  };
+}
+
+[[nodiscard]] auto make_run_info(std::string name) -> wh::callbacks::run_info {
+  wh::callbacks::run_info info{};
+  info.name = std::move(name);
+  info.type = "Retriever";
+  info.component = wh::core::component_kind::retriever;
+  info.trace_id = "trace-1";
+  info.parent_span_id = "graph-span";
+  info.node_path = wh::core::address{"graph", "retriever"};
+  return info;
+}
+
+constexpr wh::callbacks::span_exporter_options manual_flush{
+    .thread_buffer_capacity = 4U, .max_batch_size = 2U, .flush_interval = std::chrono::hours{1}};
+
+} // namespace
+
+TEST_CASE("span exporter pairs start and end events into ok spans",
+          "[UT][wh/callbacks/span_exporter.hpp][span_exporter::callbacks][branch]") {
+  auto collected = std::make_shared<collected_spans>();
+  wh::callbacks::span_exporter exporter{make_collecting_sink(collected), manual_flush};
+  wh::callbacks::manager manager{};
+  wh::callbacks::register_span_exporter(manager, exporter);
+  REQUIRE(manager.has_stage(wh::callbacks::stage::start));
+  REQUIRE_FALSE(manager.has_stage(wh::callbacks::stage::stream_end));
+
+  const auto info = make_run_info("search");
+  int payload = 0;
+  manager.dispatch(wh::callbacks::stage::start, wh::callbacks::make_event_view(payload), info);
+  manager.dispatch(wh::callbacks::stage::end, wh::callbacks::make_event_view(payload), info);
+  REQUIRE(exporter.flush().has_value());
+
+  REQUIRE(collected->spans.size() == 1U);
+  const auto &span = collected->spans.front();
+  REQUIRE(span.trace_id == "trace-1");
+  REQUIRE(span.parent_span_id == "graph-span");
+  REQUIRE(span.span_id.size() == 16U);
+  REQUIRE(span.name == "search");
+  REQUIRE(span.status == wh::callbacks::span_status_code::ok);
+  REQUIRE(span.start_time_unix_nano <= span.end_time_unix_nano);
+  REQUIRE(span.component_type == "Retriever");
+  REQUIRE(span.component_kind == wh::core::component_kind::retriever);
+  REQUIRE(span.node_path == "graph/retriever");
+  REQUIRE(span.attributes.empty());
+}
+
+TEST_CASE("span exporter marks error spans and closes nested calls last in first out",
+          "[UT][wh/callbacks/span_exporter.hpp][span_exporter::callbacks][condition]") {
+  auto collected = std::make_shared<collected_spans>();
+  wh::callbacks::span_exporter exporter{make_collecting_sink(collected), manual_flush};
+  wh::callbacks::manager manager{};
+  wh::callbacks::register_span_exporter(manager, exporter);
+
+  auto info = make_run_info("tool");
+  info.span_id = "span-a";
+  wh::core::callback_fatal_error code{.code = wh::core::make_error(wh::core::errc::timeout)};
+  manager.dispatch(wh::callbacks::stage::start, wh::callbacks::make_event_view(code), info);
+  manager.dispatch(wh::callbacks::stage::error, wh::callbacks::make_event_view(code), info);
+
+  const auto repeated = make_run_info("repeated");
+  manager.dispatch(wh::callbacks::stage::start, wh::callbacks::make_event_view(code), repeated);
+  manager.dispatch(wh::callbacks::stage::start, wh::callbacks::make_event_view(code), repeated);
+  manager.dispatch(wh::callbacks::stage::end, wh::callbacks::make_event_view(code), repeated);
+  manager.dispatch(wh::callbacks::stage::end, wh::callbacks::make_event_view(code), repeated);
+  REQUIRE(exporter.flush().has_value());
+
+  REQUIRE(collected->spans.size() == 3U);
+  REQUIRE(collected->batch_sizes == std::vector<std::size_t>{2U, 1U});
+  REQUIRE(collected->spans[0].span_id == "span-a");
+  REQUIRE(collected->spans[0].status == wh::callbacks::span_status_code::error);
+  REQUIRE_FALSE(collected->spans[0].status_message.empty());
+  REQUIRE(collected->spans[1].span_id != collected->spans[2].span_id);
+  REQUIRE(collected->spans[1].start_time_unix_nano >= collected->spans[2].start_time_unix_nano);
+}
+
+TEST_CASE("span exporter bounds per-thread buffers and exports on shutdown",
+          "[UT][wh/callbacks/span_exporter.hpp][span_exporter::shutdown][boundary]") {
+  auto collected = std::make_shared<collected_spans>();
+  wh::callbacks::span_exporter exporter{make_collecting_sink(collected), manual_flush};
+  const auto callbacks = exporter.callbacks();
+  const auto info = make_run_info("bounded");
+  int payload = 0;
+  for (std::size_t index = 0U; index < 6U; ++index) {
+    callbacks.on_end(wh::callbacks::stage::end, wh::callbacks::make_event_view(payload), info);
+  }
+  REQUIRE(exporter.stats().dropped == 2U);
+
+  std::thread worker{[&callbacks, &info, &payload]() {
+    callbacks.on_end(wh::callbacks::stage::end, wh::callbacks::make_event_view(payload), info);
+  }};
+  worker.join();
+
+  exporter.shutdown();
+  REQUIRE(collected->spans.size() == 5U);
+  REQUIRE(exporter.stats().exported == 5U);
+  exporter.shutdown();
+}
+
+TEST_CASE("span exporter background thread exports and counts sink failures",
+          "[UT][wh/callbacks/span_exporter.hpp][span_exporter::flush][branch]") {
+  auto calls = std::make_shared<std::atomic<std::size_t>>(0U);
+  wh::callbacks::span_exporter exporter{
+      [calls](const std::span<const wh::callbacks::span_record>) -> wh::core::result<void> {
+        calls->fetch_add(1U);
+        return wh::core::result<void>::failure(wh::core::errc::unavailable);
+      },
+      wh::callbacks::span_exporter_options{.flush_interval = std::chrono::milliseconds{1}}};
+  const auto callbacks = exporter.callbacks();
+  int payload = 0;
+  callbacks.on_end(wh::callbacks::stage::end, wh::callbacks::make_event_view(payload),
+                   make_run_info("failing"));
+  for (std::size_t attempt = 0U; attempt < 500U && calls->load() == 0U; ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  REQUIRE(calls->load() == 1U);
+  REQUIRE(exporter.stats().failed == 1U);
+  REQUIRE(exporter.stats().exported == 0U);
+}
+
+TEST_CASE("span exporter abandons started calls that never end",
+          "[UT][wh/callbacks/span_exporter.hpp][span_exporter::callbacks][boundary]") {
+  auto collected = std::make_shared<collected_spans>();
+  auto options = manual_flush;
+  options.max_open_spans = 16U;
+  wh::callbacks::span_exporter exporter{make_collecting_sink(collected), options};
+  const auto callbacks = exporter.callbacks();
+  const auto info = make_run_info("leaked");
+  int payload = 0;
+  for (std::size_t index = 0U; index < 5U; ++index) {
+    callbacks.on_start(wh::callbacks::stage::start, wh::callbacks::make_event_view(payload), info);
+  }
+  // Sixteen open spans share sixteen shards, so each shard tracks one call.
+  REQUIRE(exporter.stats().abandoned == 4U);
+
+  options.max_open_spans = 4096U;
+  options.open_span_timeout = std::chrono::milliseconds{0};
+  wh::callbacks::span_exporter expiring{make_collecting_sink(collected), options};
+  const auto expiring_callbacks = expiring.callbacks();
+  for (std::size_t index = 0U; index < 3U; ++index) {
+    expiring_callbacks.on_start(wh::callbacks::stage::start,
+                                wh::callbacks::make_event_view(payload), info);
+  }
+  REQUIRE(expiring.stats().abandoned == 2U);
+
+  expiring_callbacks.on_end(wh::callbacks::stage::end, wh::callbacks::make_event_view(payload),
+                            info);
+  REQUIRE(expiring.flush().has_value());
+  REQUIRE(collected->spans.size() == 1U);
+}
+
+TEST_CASE("span exporter drains rings of exited threads before retiring them",
+          "[UT][wh/callbacks/span_exporter.hpp][span_exporter::flush][condition]") {
+  auto collected = std::make_shared<collected_spans>();
+  wh::callbacks::span_exporter exporter{make_collecting_sink(collected), manual_flush};
+  wh::callbacks::manager manager{};
+  wh::callbacks::register_span_exporter(manager, exporter);
+
+  const auto info = make_run_info("search");
+  for (int round = 0; round < 8; ++round) {
+    std::thread producer{[&manager, &info]() {
+      int payload = 0;
+      manager.dispatch(wh::callbacks::stage::start, wh::callbacks::make_event_view(payload),
+                       info);
+      manager.dispatch(wh::callbacks::stage::end, wh::callbacks::make_event_view(payload), info);
+    }};
+    producer.join();
+  }
+  REQUIRE(exporter.flush().has_value());
+  REQUIRE(collected->spans.size() == 8U);
+  REQUIRE(exporter.flush().has_value());
+  REQUIRE(collected->spans.size() == 8U);
+  REQUIRE(exporter.stats().dropped == 0U);
+}
@@ -0,0 +1,194 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/callbacks/span_sinks.hpp"
+
+#if WH_OS_POSIX_LIKE
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+[[nodiscard]] auto make_span(std::string name) -> wh::callbacks::span_record {
+  wh::callbacks::span_record span{};
+  span.trace_id = "graph-trace";
+  span.span_id = "0123456789abcdef";
+  span.parent_span_id = "gs-1";
+  span.name = std::move(name);
+  span.start_time_unix_nano = 10U;
+  span.end_time_unix_nano = 25U;
+  span.status = wh::callbacks::span_status_code::ok;
+  span.component_type = "Tool";
+  span.component_kind = wh::core::component_kind::tool;
+  span.node_path = "graph/\"tool\"";
+  span.attributes.push_back({"team", "search"});
+  return span;
+}
+
+#if WH_OS_POSIX_LIKE
+
+/// Accepts one HTTP request on a loopback port and answers with `status`.
+class stand_in_collector {
+public:
+  explicit stand_in_collector(std::string status) : status_(std::move(status)) {
+    listener_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    ::bind(listener_, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+    ::listen(listener_, 1);
+    socklen_t length = sizeof(address);
+    ::getsockname(listener_, reinterpret_cast<sockaddr *>(&address), &length);
+    port_ = ntohs(address.sin_port);
+    worker_ = std::thread{[this]() { serve(); }};
+  }
+
+  stand_in_collector(const stand_in_collector &) = delete;
+  auto operator=(const stand_in_collector &) -> stand_in_collector & = delete;
+
+  ~stand_in_collector() {
+    if (worker_.joinable()) {
+      worker_.join();
+    }
+    ::close(listener_);
+  }
+
+  [[nodiscard]] auto port() const noexcept -> std::uint16_t { return port_; }
+
+  [[nodiscard]] auto request() -> const std::string & {
+    worker_.join();
+    return request_;
+  }
+
+private:
+  auto serve() -> void {
+    const auto client = ::accept(listener_, nullptr, nullptr);
+    if (client < 0) {
+      return;
+    }
+    char buffer[1024];
+    while (true) {
+      const auto header_end = request_.find("\r\n\r\n");
+      if (header_end != std::string::npos) {
+        const auto length_at = request_.find("Content-Length: ");
+        const auto length = std::stoul(request_.substr(length_at + 16U));
+        if (request_.size() >= header_end + 4U + length) {
+          break;
+        }
+      }
+      const auto received = ::recv(client, buffer, sizeof(buffer), 0);
+      if (received <= 0) {
+        break;
+      }
+      request_.append(buffer, static_cast<std::size_t>(received));
+    }
+    const auto response = "HTTP/1.1 " + status_ + "\r\nContent-Length: 0\r\n\r\n";
+    ::send(client, response.data(), response.size(), 0);
+    ::close(client);
+  }
+
+  std::string status_{};
+  int listener_{-1};
+  std::uint16_t port_{0U};
+  std::thread worker_{};
+  std::string request_{};
+};
+
+#endif
+
+} // namespace
+
+TEST_CASE("otlp span encoding normalizes ids and escapes strings",
+          "[UT][wh/callbacks/span_sinks.hpp][append_otlp_span_json][branch][boundary]") {
+  std::string json{};
+  wh::callbacks::append_otlp_span_json(json, make_span("search"));
+  REQUIRE(json.find(R"("spanId":"0123456789abcdef")") != std::string::npos);
+  REQUIRE(json.find(R"("startTimeUnixNano":"10")") != std::string::npos);
+  REQUIRE(json.find(R"("status":{"code":1})") != std::string::npos);
+  REQUIRE(json.find(R"("stringValue":"graph/\"tool\"")") != std::string::npos);
+  REQUIRE(json.find(R"({"key":"wh.component.kind","value":{"stringValue":"tool"}})") !=
+          std::string::npos);
+  REQUIRE(json.find(R"({"key":"team","value":{"stringValue":"search"}})") != std::string::npos);
+  const auto trace_at = json.find(R"("traceId":")");
+  REQUIRE(trace_at != std::string::npos);
+  REQUIRE(json.find('"', trace_at + 11U) == trace_at + 11U + 32U);
+
+  std::string again{};
+  wh::callbacks::append_otlp_span_json(again, make_span("search"));
+  REQUIRE(again == json);
+
+  auto failed = make_span("failed");
+  failed.parent_span_id.clear();
+  failed.node_path.clear();
+  failed.status = wh::callbacks::span_status_code::error;
+  failed.status_message = "line\nbreak";
+  std::string error_json{};
+  wh::callbacks::append_otlp_span_json(error_json, failed);
+  REQUIRE(error_json.find("parentSpanId") == std::string::npos);
+  REQUIRE(error_json.find("wh.node_path") == std::string::npos);
+  REQUIRE(error_json.find(R"("status":{"code":2,"message":"line\nbreak"})") !=
+          std::string::npos);
+
+  const std::vector<wh::callbacks::span_record> batch{make_span("a"), make_span("b")};
+  const auto body = wh::callbacks::encode_otlp_trace_request(batch, "svc");
+  REQUIRE(body.starts_with(R"({"resourceSpans":[)"));
+  REQUIRE(body.find(R"("stringValue":"svc")") != std::string::npos);
+  REQUIRE(body.find(R"("name":"a")") < body.find(R"("name":"b")"));
+}
+
+TEST_CASE("jsonl span sink appends one span per line",
+          "[UT][wh/callbacks/span_sinks.hpp][make_jsonl_span_sink][condition]") {
+  const auto path = std::filesystem::temp_directory_path() / "worm_hole_span_sinks_ut.jsonl";
+  std::error_code ignored{};
+  std::filesystem::remove(path, ignored);
+
+  const auto sink = wh::callbacks::make_jsonl_span_sink(path.string());
+  const std::vector<wh::callbacks::span_record> batch{make_span("a"), make_span("b")};
+  REQUIRE(sink(batch).has_value());
+  REQUIRE(sink(std::span<const wh::callbacks::span_record>{batch.data(), 1U}).has_value());
+
+  std::ifstream input{path};
+  std::vector<std::string> lines{};
+  for (std::string line{}; std::getline(input, line);) {
+    lines.push_back(line);
+  }
+  REQUIRE(lines.size() == 3U);
+  REQUIRE(lines[1].find(R"("name":"b")") != std::string::npos);
+  std::filesystem::remove(path, ignored);
+
+  const auto unavailable = wh::callbacks::make_jsonl_span_sink(
+      (std::filesystem::temp_directory_path() / "missing-dir" / "spans.jsonl").string());
+  REQUIRE(unavailable(batch).error() == wh::core::errc::unavailable);
+}
+
+#if WH_OS_POSIX_LIKE
+TEST_CASE("otlp http span sink posts batches to a collector",
+          "[UT][wh/callbacks/span_sinks.hpp][make_otlp_http_span_sink][branch]") {
+  const std::vector<wh::callbacks::span_record> batch{make_span("exported")};
+
+  stand_in_collector accepting{"200 OK"};
+  const auto sink = wh::callbacks::make_otlp_http_span_sink(
+      wh::callbacks::otlp_http_options{.port = accepting.port(), .service_name = "svc"});
+  REQUIRE(sink(batch).has_value());
+  const auto &request = accepting.request();
+  REQUIRE(request.starts_with("POST /v1/traces HTTP/1.1\r\n"));
+  REQUIRE(request.find("Content-Type: application/json") != std::string::npos);
+  REQUIRE(request.find(R"("name":"exported")") != std::string::npos);
+
+  stand_in_collector rejecting{"503 Service Unavailable"};
+  const auto rejected = wh::callbacks::make_otlp_http_span_sink(
+      wh::callbacks::otlp_http_options{.port = rejecting.port()});
+  REQUIRE(rejected(batch).error() == wh::core::errc::protocol_error);
+}
+#endif
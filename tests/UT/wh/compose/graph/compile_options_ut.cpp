@@ -14,6 +14,8 @@ TEST_CASE("graph compile options serialize all major policy fields",
   options.trigger_mode = wh::compose::graph_trigger_mode::all_predecessors;
   options.fan_in_policy = wh::compose::graph_fan_in_policy::require_all_sources;
   options.node_timeout = std::chrono::milliseconds{50};
+  options.max_child_concurrency = 4U;
+  options.stream_drain_budget = 8U;
   options.compile_callback = [](const wh::compose::graph_compile_info &) {
     return wh::core::result<void>{};
   };
@@ -25,6 +27,8 @@ TEST_CASE("graph compile options serialize all major policy fields",
   REQUIRE(text.find("dispatch_policy=next_wave") != std::string::npos);
   REQUIRE(text.find("trigger_mode=all_predecessors") != std::string::npos);
   REQUIRE(text.find("fan_in_policy=require_all_sources") != std::string::npos);
+  REQUIRE(text.find("max_child_concurrency=4") != std::string::npos);
+  REQUIRE(text.find("stream_drain_budget=8") != std::string::npos);
   REQUIRE(text.find("compile_callback=true") != std::string::npos);
 }
 
@@ -40,6 +44,8 @@ TEST_CASE("graph compile options defaults and false-path serialization remain st
   REQUIRE(options.retain_cold_data);
   REQUIRE(options.max_parallel_nodes == 1U);
   REQUIRE(options.max_parallel_per_node == 1U);
+  REQUIRE(options.max_child_concurrency == 1U);
+  REQUIRE(options.stream_drain_budget == 64U);
   REQUIRE(options.enable_local_state_generation);
   REQUIRE_FALSE(static_cast<bool>(options.compile_callback));
 
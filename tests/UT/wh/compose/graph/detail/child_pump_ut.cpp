@@ -1,3 +1,4 @@
+#include <cstddef>
 #include <memory>
 #include <tuple>
 #include <vector>
@@ -110,3 +111,59 @@ TEST_CASE(
   REQUIRE(std::get<0>(*waited).has_error());
   REQUIRE(std::get<0>(*waited).error() == wh::core::errc::invalid_argument);
 }
+
+TEST_CASE("bounded child batch sender consumes concurrent children in index order",
+          "[UT][wh/compose/graph/detail/"
+          "child_pump.hpp][make_bounded_child_batch_sender][condition][branch][boundary]") {
+  std::size_t launched = 0U;
+  const auto run = [&launched](const std::size_t max_in_flight, const bool fail_second) {
+    launched = 0U;
+    std::vector<wh::compose::graph_sender> senders{};
+    for (int value = 1; value <= 4; ++value) {
+      auto current = fail_second && value == 2
+                         ? wh::core::result<wh::compose::graph_value>::failure(
+                               wh::core::errc::invalid_argument)
+                         : wh::core::result<wh::compose::graph_value>{
+                               wh::compose::graph_value{value}};
+      senders.push_back(wh::compose::detail::bridge_graph_sender(
+          stdexec::just() | stdexec::then([&launched, current = std::move(current)]() mutable {
+            ++launched;
+            return std::move(current);
+          })));
+    }
+    auto sender = wh::compose::detail::make_bounded_child_batch_sender(
+        std::move(senders), std::vector<int>{},
+        [](std::vector<int> &stage, const std::size_t index,
+           wh::core::result<wh::compose::graph_value> current) -> wh::core::result<void> {
+          if (current.has_error()) {
+            return wh::core::result<void>::failure(current.error());
+          }
+          REQUIRE(static_cast<int>(index) + 1 == *wh::core::any_cast<int>(&current.value()));
+          stage.push_back(*wh::core::any_cast<int>(&current.value()));
+          return {};
+        },
+        [](std::vector<int> &&stage) -> wh::core::result<wh::compose::graph_value> {
+          REQUIRE(stage == std::vector<int>{1, 2, 3, 4});
+          return wh::compose::graph_value{static_cast<int>(stage.size())};
+        },
+        wh::core::detail::erase_resume_scheduler(stdexec::inline_scheduler{}), max_in_flight);
+    auto waited = stdexec::sync_wait(std::move(sender));
+    REQUIRE(waited.has_value());
+    return std::get<0>(std::move(*waited));
+  };
+
+  for (const std::size_t max_in_flight : {1U, 2U, 8U}) {
+    auto completed = run(max_in_flight, false);
+    REQUIRE(completed.has_value());
+    REQUIRE(*wh::core::any_cast<int>(&completed.value()) == 4);
+
+    REQUIRE(launched == 4U);
+
+    // Ready prefixes are consumed before launching more, so nothing starts
+    // after the failing child.
+    auto failed = run(max_in_flight, true);
+    REQUIRE(failed.has_error());
+    REQUIRE(failed.error() == wh::core::errc::invalid_argument);
+    REQUIRE(launched == 2U);
+  }
+}
@@ -1,8 +1,11 @@
+#include <memory>
+#include <string>
 #include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include "wh/compose/graph/detail/collect_policy.hpp"
+#include "wh/compose/reduce/stream_concat.hpp"
 
 TEST_CASE("collect policy drains value chunks until terminal eof and returns collected vector",
           "[UT][wh/compose/graph/detail/"
@@ -80,3 +83,124 @@ TEST_CASE(
   REQUIRE(errored->has_error());
   REQUIRE(errored->error() == wh::core::errc::invalid_argument);
 }
+
+TEST_CASE("collect policy folds chunks through registry accumulators and reports partials",
+          "[UT][wh/compose/graph/detail/"
+          "collect_policy.hpp][collect_policy::handle_completion][branch][boundary]") {
+  auto registry = std::make_shared<wh::internal::stream_concat_registry>();
+  REQUIRE(wh::compose::register_builtin_concat_accumulators(*registry).has_value());
+
+  std::vector<std::string> partials{};
+  const wh::compose::edge_fold fold{
+      .registry = registry,
+      .on_partial = [&partials](const wh::compose::graph_value &partial) {
+        partials.push_back(*wh::core::any_cast<std::string>(&partial));
+      }};
+
+  std::vector<wh::compose::graph_value> values{};
+  values.emplace_back(std::string{"he"});
+  values.emplace_back(std::string{"llo"});
+  auto reader = wh::compose::make_values_stream_reader(values);
+  REQUIRE(reader.has_value());
+
+  wh::compose::detail::collect_policy policy{
+      .reader = std::move(reader).value(),
+      .limits = wh::compose::edge_limits{.max_items = 2U},
+      .fold = &fold,
+  };
+  policy.start();
+  REQUIRE(policy.collected.capacity() == 0U);
+
+  for (int index = 0; index < 2; ++index) {
+    auto next = policy.reader.read();
+    REQUIRE(next.has_value());
+    REQUIRE_FALSE(policy.handle_completion(std::move(next).value()).has_value());
+  }
+  REQUIRE(policy.collected.empty());
+  REQUIRE(partials == std::vector<std::string>{"he", "hello"});
+
+  auto eof = policy.reader.read();
+  REQUIRE(eof.has_value());
+  auto finished = policy.handle_completion(std::move(eof).value());
+  REQUIRE(finished.has_value());
+  REQUIRE(finished->has_value());
+  REQUIRE(*wh::core::any_cast<std::string>(&finished->value()) == "hello");
+
+  std::vector<wh::compose::graph_value> unsupported_values{};
+  unsupported_values.emplace_back(1);
+  auto unsupported_reader = wh::compose::make_values_stream_reader(unsupported_values);
+  REQUIRE(unsupported_reader.has_value());
+  wh::compose::detail::collect_policy unsupported{
+      .reader = std::move(unsupported_reader).value(),
+      .fold = &fold,
+  };
+  auto first = unsupported.reader.read();
+  REQUIRE(first.has_value());
+  auto rejected = unsupported.handle_completion(std::move(first).value());
+  REQUIRE(rejected.has_value());
+  REQUIRE(rejected->has_error());
+  REQUIRE(rejected->error() == wh::core::errc::not_supported);
+
+  auto empty_reader =
+      wh::compose::make_values_stream_reader(std::vector<wh::compose::graph_value>{});
+  REQUIRE(empty_reader.has_value());
+  wh::compose::detail::collect_policy empty{
+      .reader = std::move(empty_reader).value(),
+      .fold = &fold,
+  };
+  auto empty_eof = empty.reader.read();
+  REQUIRE(empty_eof.has_value());
+  auto empty_finished = empty.handle_completion(std::move(empty_eof).value());
+  REQUIRE(empty_finished.has_value());
+  REQUIRE(empty_finished->has_value());
+  REQUIRE_FALSE(empty_finished->value().has_value());
+
+  const wh::compose::edge_fold text_fold{
+      .registry = registry,
+      .empty_value = wh::compose::graph_value{std::string{}},
+  };
+  auto empty_text_reader =
+      wh::compose::make_values_stream_reader(std::vector<wh::compose::graph_value>{});
+  REQUIRE(empty_text_reader.has_value());
+  wh::compose::detail::collect_policy empty_text{
+      .reader = std::move(empty_text_reader).value(),
+      .fold = &text_fold,
+  };
+  auto empty_text_eof = empty_text.reader.read();
+  REQUIRE(empty_text_eof.has_value());
+  auto identity = empty_text.handle_completion(std::move(empty_text_eof).value());
+  REQUIRE(identity.has_value());
+  REQUIRE(identity->has_value());
+  REQUIRE(wh::core::any_cast<std::string>(&identity->value()) != nullptr);
+  REQUIRE(wh::core::any_cast<std::string>(&identity->value())->empty());
+}
+
+TEST_CASE("collect policy drains buffered chunks up to its budget in one completion",
+          "[UT][wh/compose/graph/detail/"
+          "collect_policy.hpp][collect_policy::handle_completion][condition][boundary]") {
+  std::vector<wh::compose::graph_value> values{};
+  for (int value = 1; value <= 5; ++value) {
+    values.emplace_back(value);
+  }
+  auto reader = wh::compose::make_values_stream_reader(values);
+  REQUIRE(reader.has_value());
+
+  wh::compose::detail::collect_policy policy{
+      .reader = std::move(reader).value(),
+      .drain_budget = 3U,
+  };
+  auto first = policy.reader.read();
+  REQUIRE(first.has_value());
+  REQUIRE_FALSE(policy.handle_completion(std::move(first).value()).has_value());
+  REQUIRE(policy.collected.size() == 3U);
+
+  auto fourth = policy.reader.read();
+  REQUIRE(fourth.has_value());
+  auto finished = policy.handle_completion(std::move(fourth).value());
+  REQUIRE(finished.has_value());
+  REQUIRE(finished->has_value());
+  auto *collected = wh::core::any_cast<std::vector<wh::compose::graph_value>>(&finished->value());
+  REQUIRE(collected != nullptr);
+  REQUIRE(collected->size() == 5U);
+  REQUIRE(*wh::core::any_cast<int>(&(*collected)[4]) == 5);
+}
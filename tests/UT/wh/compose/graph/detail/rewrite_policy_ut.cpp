@@ -72,3 +72,40 @@ TEST_CASE(
           wh::schema::stream::stream_pending);
   REQUIRE(rewritten.close().has_value());
 }
+
+TEST_CASE("rewrite policy drains buffered chunks and stops when the source is pending",
+          "[UT][wh/compose/graph/detail/"
+          "rewrite_policy.hpp][rewrite_policy::handle_completion][condition][boundary]") {
+  auto [source_writer, source] = wh::compose::make_graph_stream();
+  for (int value = 1; value <= 3; ++value) {
+    REQUIRE(source_writer.try_write(wh::compose::graph_value{value}).has_value());
+  }
+  auto [writer, rewritten] = wh::compose::make_graph_stream();
+
+  wh::compose::detail::rewrite_policy policy{
+      .reader = std::move(source),
+      .writer = std::move(writer),
+      .handler = [](wh::compose::graph_value &value) -> wh::core::result<void> {
+        *wh::core::any_cast<int>(&value) *= 10;
+        return {};
+      },
+      .drain_budget = 8U,
+  };
+  auto first = policy.reader.read();
+  REQUIRE(first.has_value());
+  REQUIRE_FALSE(policy.handle_completion(std::move(first).value()).has_value());
+
+  for (int value = 1; value <= 3; ++value) {
+    auto next = rewritten.read();
+    REQUIRE(next.has_value());
+    REQUIRE(*wh::core::any_cast<int>(&next->value.value()) == value * 10);
+  }
+  REQUIRE(std::holds_alternative<wh::schema::stream::stream_signal>(rewritten.try_read()));
+
+  REQUIRE(source_writer.close().has_value());
+  auto eof = policy.reader.read();
+  REQUIRE(eof.has_value());
+  auto finished = policy.handle_completion(std::move(eof).value());
+  REQUIRE(finished.has_value());
+  REQUIRE(finished->has_value());
+}
@@ -0,0 +1,66 @@
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdexec/execution.hpp>
+
+#include "wh/compose/graph/versioned.hpp"
+#include "wh/compose/node.hpp"
+#include "wh/compose/node/passthrough.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_compiled_graph(std::string name) -> wh::compose::graph {
+  wh::compose::graph_compile_options options{};
+  options.name = std::move(name);
+  wh::compose::graph graph{options};
+  REQUIRE(graph.add_passthrough(wh::compose::make_passthrough_node("worker")).has_value());
+  REQUIRE(graph.add_entry_edge("worker").has_value());
+  REQUIRE(graph.add_exit_edge("worker").has_value());
+  REQUIRE(graph.compile().has_value());
+  return graph;
+}
+
+[[nodiscard]] auto make_request(const int value) -> wh::compose::graph_invoke_request {
+  wh::compose::graph_invoke_request request{};
+  request.input = wh::compose::graph_input::value(value);
+  return request;
+}
+
+} // namespace
+
+TEST_CASE("versioned graph rejects uncompiled graphs and empty handles",
+          "[UT][wh/compose/graph/versioned.hpp][publish_compiled_graph][condition][branch]") {
+  wh::compose::versioned_graph graphs{};
+  wh::core::run_context context{};
+  auto empty = stdexec::sync_wait(wh::compose::invoke_latest(graphs, context, make_request(1)));
+  REQUIRE(empty.has_value());
+  REQUIRE(std::get<0>(*empty).error() == wh::core::errc::contract_violation);
+
+  auto published = wh::compose::publish_compiled_graph(graphs, wh::compose::graph{});
+  REQUIRE(published.has_error());
+  REQUIRE(published.error() == wh::core::errc::contract_violation);
+  REQUIRE_FALSE(graphs.has_value());
+}
+
+TEST_CASE("versioned graph invokes pin the version current at call time",
+          "[UT][wh/compose/graph/versioned.hpp][invoke_latest][branch][lifecycle]") {
+  wh::compose::versioned_graph graphs{};
+  REQUIRE(wh::compose::publish_compiled_graph(graphs, make_compiled_graph("v1")).value() == 1U);
+  auto first = graphs.snapshot();
+  std::weak_ptr<const wh::compose::graph> first_alive = first.value;
+  first = {};
+
+  wh::core::run_context context{};
+  auto in_flight = wh::compose::invoke_latest(graphs, context, make_request(7));
+  REQUIRE(wh::compose::publish_compiled_graph(graphs, make_compiled_graph("v2")).value() == 2U);
+  REQUIRE_FALSE(first_alive.expired());
+
+  auto awaited = stdexec::sync_wait(std::move(in_flight));
+  REQUIRE(awaited.has_value());
+  REQUIRE(*wh::core::any_cast<int>(&std::get<0>(*awaited).value().output_status.value()) == 7);
+  REQUIRE(first_alive.expired());
+  REQUIRE(graphs.snapshot()->options().name == "v2");
+}
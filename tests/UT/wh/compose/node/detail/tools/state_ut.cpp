@@ -1,3 +1,4 @@
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -194,3 +195,41 @@ TEST_CASE("tools state helper falls back to null missing tool when no override h
   REQUIRE(wh::compose::detail::find_tool(state, "alpha") != nullptr);
   REQUIRE(wh::compose::detail::find_tool(state, "missing") == nullptr);
 }
+
+TEST_CASE("tools state pins the latest versioned registry for the whole run",
+          "[UT][wh/compose/node/detail/tools/state.hpp][resolve_tools_state][condition][branch]") {
+  auto frozen = make_registry(false, false);
+  auto live = std::make_shared<wh::compose::versioned_tool_registry>();
+  wh::compose::tools_options options{};
+  options.live_registry = live;
+  wh::compose::node_runtime runtime{};
+  const auto input = make_tool_batch_value(std::vector<wh::compose::tool_call>{
+      {.tool_name = "alpha"},
+  });
+
+  auto unpublished = wh::compose::detail::resolve_tools_state(input, frozen, options, runtime);
+  REQUIRE(unpublished.has_value());
+  REQUIRE(&unpublished.value().active_tools() == &frozen);
+
+  live->publish(make_registry(true, false));
+  auto pinned = wh::compose::detail::resolve_tools_state(input, frozen, options, runtime);
+  REQUIRE(pinned.has_value());
+  REQUIRE(pinned.value().has_return_direct);
+
+  wh::compose::tool_registry replacement{};
+  replacement.emplace("gamma", wh::compose::tool_entry{});
+  live->publish(std::move(replacement));
+  REQUIRE(wh::compose::detail::find_tool(pinned.value(), "alpha") != nullptr);
+  REQUIRE(wh::compose::detail::find_tool(pinned.value(), "gamma") == nullptr);
+
+  wh::compose::versioned_tool_registry per_call{make_registry(false, true)};
+  wh::compose::graph_call_options call_options_storage{};
+  call_options_storage.tools = wh::compose::tools_call_options{.versioned_registry = &per_call};
+  wh::compose::graph_call_scope scope{call_options_storage};
+  runtime.set_call_options(&scope);
+  auto overridden = wh::compose::detail::resolve_tools_state(
+      make_tool_batch_value(std::vector<wh::compose::tool_call>{{.tool_name = "beta"}}), frozen,
+      options, runtime);
+  REQUIRE(overridden.has_value());
+  REQUIRE(overridden.value().has_return_direct);
+}
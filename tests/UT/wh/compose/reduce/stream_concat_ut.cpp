@@ -60,3 +60,62 @@ TEST_CASE("compose stream concat surfaces empty unsupported and type mismatch br
   REQUIRE(unsupported.has_error());
   REQUIRE(unsupported.error() == wh::core::errc::not_supported);
 }
+
+TEST_CASE("compose stream concat owned path moves caller-owned chunks",
+          "[UT][wh/compose/reduce/stream_concat.hpp][stream_concat_owned][branch]") {
+  wh::internal::stream_concat_registry registry{};
+  REQUIRE(registry
+              .register_owned_concat<std::string>(
+                  [](const std::span<std::string> values) -> wh::core::result<std::string> {
+                    auto joined = std::move(values.front());
+                    for (const auto &value : values.subspan(1U)) {
+                      joined += value;
+                    }
+                    return joined;
+                  })
+              .has_value());
+
+  std::array typed_chunks = {std::string{"a"}, std::string{"b"}};
+  auto typed = wh::compose::stream_concat_owned(registry, std::span<std::string>{typed_chunks});
+  REQUIRE(typed.has_value());
+  REQUIRE(typed.value() == "ab");
+
+  std::array dynamic_chunks = {wh::core::any{std::string{"c"}}, wh::core::any{std::string{"d"}}};
+  auto dynamic = wh::compose::stream_concat_owned(
+      registry, wh::core::any_type_key_v<std::string>, dynamic_chunks);
+  REQUIRE(dynamic.has_value());
+  REQUIRE(*wh::core::any_cast<std::string>(&dynamic.value()) == "cd");
+}
+
+TEST_CASE("compose stream concat registers builtin accumulators for text messages and vectors",
+          "[UT][wh/compose/reduce/"
+          "stream_concat.hpp][register_builtin_concat_accumulators][branch]") {
+  wh::internal::stream_concat_registry registry{};
+  REQUIRE(wh::compose::register_builtin_concat_accumulators(registry).has_value());
+  auto again = wh::compose::register_builtin_concat_accumulators(registry);
+  REQUIRE(again.has_error());
+  REQUIRE(again.error() == wh::core::errc::already_exists);
+
+  auto begun = registry.begin_concat(wh::core::any_type_key_v<wh::schema::message>);
+  REQUIRE(begun.has_value());
+  auto accumulator = std::move(begun).value();
+  for (const auto *text : {"he", "llo"}) {
+    wh::schema::message chunk{};
+    chunk.role = wh::schema::message_role::assistant;
+    chunk.parts.emplace_back(wh::schema::text_part{text});
+    REQUIRE(accumulator.append(wh::core::any{std::move(chunk)}).has_value());
+  }
+  const auto *partial = accumulator.partial_as<wh::schema::message>();
+  REQUIRE(partial != nullptr);
+  REQUIRE(std::get<wh::schema::text_part>(partial->parts.front()).text == "hello");
+  auto finished = accumulator.finish();
+  REQUIRE(finished.has_value());
+  REQUIRE(wh::core::any_cast<wh::schema::message>(&finished.value())->parts.size() == 1U);
+
+  std::array vectors = {wh::core::any{std::vector<wh::core::any>{wh::core::any{1}}},
+                        wh::core::any{std::vector<wh::core::any>{wh::core::any{2}}}};
+  auto joined = wh::compose::stream_concat_owned(
+      registry, wh::core::any_type_key_v<std::vector<wh::core::any>>, vectors);
+  REQUIRE(joined.has_value());
+  REQUIRE(wh::core::any_cast<std::vector<wh::core::any>>(&joined.value())->size() == 2U);
+}
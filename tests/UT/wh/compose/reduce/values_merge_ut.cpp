@@ -51,3 +51,44 @@ TEST_CASE("compose values merge surfaces empty singleton and unsupported branche
   REQUIRE(unsupported.has_error());
   REQUIRE(unsupported.error() == wh::core::errc::not_supported);
 }
+
+TEST_CASE("compose values merge owned path moves caller-owned inputs",
+          "[UT][wh/compose/reduce/values_merge.hpp][values_merge_owned][branch]") {
+  wh::internal::values_merge_registry registry{};
+  REQUIRE(registry
+              .register_owned_merge<std::string>(
+                  [](const std::span<std::string> values) -> wh::core::result<std::string> {
+                    auto merged = std::move(values.front());
+                    for (const auto &value : values.subspan(1U)) {
+                      merged += value;
+                    }
+                    return merged;
+                  })
+              .has_value());
+
+  std::array typed_values = {std::string{"a"}, std::string{"b"}};
+  auto typed = wh::compose::values_merge_owned(registry, std::span<std::string>{typed_values});
+  REQUIRE(typed.has_value());
+  REQUIRE(typed.value() == "ab");
+
+  std::array dynamic_values = {wh::core::any{std::string{"c"}}, wh::core::any{std::string{"d"}}};
+  auto dynamic = wh::compose::values_merge_owned(
+      registry, wh::core::any_type_key_v<std::string>, dynamic_values);
+  REQUIRE(dynamic.has_value());
+  REQUIRE(*wh::core::any_cast<std::string>(&dynamic.value()) == "cd");
+}
+
+TEST_CASE("compose values merge registers builtin accumulators",
+          "[UT][wh/compose/reduce/values_merge.hpp][register_builtin_merge_accumulators][branch]") {
+  wh::internal::values_merge_registry registry{};
+  REQUIRE(wh::compose::register_builtin_merge_accumulators(registry).has_value());
+
+  const std::array texts = {wh::core::any{std::string{"a"}}, wh::core::any{std::string{"b"}}};
+  auto merged = wh::compose::values_merge(registry, wh::core::any_type_key_v<std::string>, texts);
+  REQUIRE(merged.has_value());
+  REQUIRE(*wh::core::any_cast<std::string>(&merged.value()) == "ab");
+
+  auto begun = registry.begin_merge(wh::core::any_type_key_v<std::vector<wh::schema::message>>);
+  REQUIRE(begun.has_value());
+  REQUIRE(registry.begin_merge(wh::core::any_type_key_v<int>).has_error());
+}
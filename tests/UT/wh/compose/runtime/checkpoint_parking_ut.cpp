@@ -0,0 +1,293 @@
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/compose/runtime/checkpoint_parking.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_interrupted_state(const std::string &interrupt_id, const int entry)
+    -> wh::compose::checkpoint_state {
+  wh::compose::checkpoint_state state{};
+  state.runtime.dag = wh::compose::checkpoint_dag_runtime_state{};
+  state.runtime.dag->pending_inputs.entry = wh::compose::graph_value{entry};
+  state.interrupt_snapshot.interrupt_id_to_address.emplace(
+      interrupt_id, wh::core::make_address({"graph", "approve"}));
+  return state;
+}
+
+[[nodiscard]] auto entry_of(const wh::compose::checkpoint_state &state) -> int {
+  return *wh::core::any_cast<int>(&*state.runtime.dag->pending_inputs.entry);
+}
+
+[[nodiscard]] auto save_options(std::string id) -> wh::compose::checkpoint_save_options {
+  return wh::compose::checkpoint_save_options{.checkpoint_id = std::move(id)};
+}
+
+[[nodiscard]] auto load_options(std::string id) -> wh::compose::checkpoint_load_options {
+  return wh::compose::checkpoint_load_options{.checkpoint_id = std::move(id)};
+}
+
+} // namespace
+
+TEST_CASE("checkpoint parking lot hands back live state inside the ttl without durable writes",
+          "[UT][wh/compose/runtime/"
+          "checkpoint_parking.hpp][checkpoint_parking_lot::prepare_restore][branch]") {
+  wh::compose::checkpoint_store store{};
+  wh::compose::checkpoint_parking_lot parking{wh::compose::checkpoint_parking_options{
+      .durable_store = std::addressof(store),
+  }};
+  REQUIRE(parking.backend()->retains_live_state);
+
+  wh::core::run_context context{};
+  REQUIRE(parking.backend()
+              ->save(make_interrupted_state("approve-1", 3), save_options("run-1"), context)
+              .has_value());
+  auto routed = parking.find_interrupt("approve-1");
+  REQUIRE(routed.has_value());
+  REQUIRE(routed->checkpoint_id == "run-1");
+  REQUIRE(routed->location == wh::core::make_address({"graph", "approve"}));
+
+  auto plan = parking.backend()->prepare_restore(load_options("run-1"), context);
+  REQUIRE(plan.has_value());
+  REQUIRE(plan.value().restore_from_checkpoint);
+  REQUIRE(plan.value().live_state);
+  REQUIRE(entry_of(*plan.value().checkpoint) == 3);
+  REQUIRE(parking.size() == 0U);
+  REQUIRE_FALSE(parking.find_interrupt("approve-1").has_value());
+  REQUIRE(store.load(load_options("run-1")).has_error());
+
+  auto missing = parking.prepare_restore(load_options("run-1"), context);
+  REQUIRE(missing.has_error());
+  REQUIRE(missing.error() == wh::core::errc::not_found);
+}
+
+TEST_CASE("checkpoint parking lot writes durably on ttl eviction and flush only",
+          "[UT][wh/compose/runtime/"
+          "checkpoint_parking.hpp][checkpoint_parking_lot::evict_expired][boundary]") {
+  using namespace std::chrono_literals;
+  wh::compose::checkpoint_store store{};
+  wh::compose::checkpoint_parking_lot parking{wh::compose::checkpoint_parking_options{
+      .ttl = 100ms,
+      .durable_store = std::addressof(store),
+  }};
+  const auto parked_at = wh::compose::checkpoint_parking_lot::clock::now();
+  REQUIRE(parking.park(make_interrupted_state("a", 1), save_options("run-a"), parked_at)
+              .has_value());
+  REQUIRE(parking.park(make_interrupted_state("b", 2), save_options("run-b"), parked_at + 50ms)
+              .has_value());
+
+  auto early = parking.evict_expired(parked_at + 99ms);
+  REQUIRE(early.has_value());
+  REQUIRE(early.value() == 0U);
+
+  auto expired = parking.evict_expired(parked_at + 100ms);
+  REQUIRE(expired.has_value());
+  REQUIRE(expired.value() == 1U);
+  REQUIRE_FALSE(parking.contains("run-a"));
+  REQUIRE_FALSE(parking.find_interrupt("a").has_value());
+  auto durable = store.load(load_options("run-a"));
+  REQUIRE(durable.has_value());
+  REQUIRE(entry_of(durable.value()) == 1);
+
+  wh::core::run_context context{};
+  auto fallback = parking.prepare_restore(load_options("run-a"), context, parked_at + 100ms);
+  REQUIRE(fallback.has_value());
+  REQUIRE_FALSE(fallback.value().live_state);
+  REQUIRE(entry_of(*fallback.value().checkpoint) == 1);
+
+  auto flushed = parking.flush();
+  REQUIRE(flushed.has_value());
+  REQUIRE(flushed.value() == 1U);
+  REQUIRE(parking.size() == 0U);
+  REQUIRE(store.load(load_options("run-b")).has_value());
+}
+
+TEST_CASE("checkpoint parking lot keeps runs parked when the durable write fails",
+          "[UT][wh/compose/runtime/"
+          "checkpoint_parking.hpp][checkpoint_parking_lot::flush][condition]") {
+  std::size_t save_calls = 0U;
+  wh::compose::checkpoint_backend failing{};
+  failing.prepare_restore = wh::compose::checkpoint_backend_prepare_restore{
+      [](const wh::compose::checkpoint_load_options &, wh::core::run_context &)
+          -> wh::core::result<wh::compose::checkpoint_restore_plan> {
+        return wh::core::result<wh::compose::checkpoint_restore_plan>::failure(
+            wh::core::errc::not_found);
+      }};
+  failing.save = wh::compose::checkpoint_backend_save{
+      [&save_calls](wh::compose::checkpoint_state &&, wh::compose::checkpoint_save_options &&,
+                    wh::core::run_context &) -> wh::core::result<void> {
+        ++save_calls;
+        return wh::core::result<void>::failure(wh::core::errc::unavailable);
+      }};
+  wh::compose::checkpoint_parking_lot parking{wh::compose::checkpoint_parking_options{
+      .durable_backend = std::addressof(failing),
+  }};
+  REQUIRE(parking.park(make_interrupted_state("c", 5), wh::compose::checkpoint_save_options{})
+              .has_value());
+  REQUIRE(parking.contains("default"));
+
+  auto flushed = parking.flush();
+  REQUIRE(flushed.has_error());
+  REQUIRE(flushed.error() == wh::core::errc::unavailable);
+  REQUIRE(save_calls == 1U);
+  REQUIRE(parking.size() == 1U);
+  REQUIRE(parking.find_interrupt("c").has_value());
+}
+
+TEST_CASE("checkpoint parking lot resumes live runs while an expired run cannot be written",
+          "[UT][wh/compose/runtime/"
+          "checkpoint_parking.hpp][checkpoint_parking_lot::prepare_restore][condition]") {
+  using namespace std::chrono_literals;
+  wh::compose::checkpoint_backend failing{};
+  failing.save = wh::compose::checkpoint_backend_save{
+      [](wh::compose::checkpoint_state &&, wh::compose::checkpoint_save_options &&,
+         wh::core::run_context &) -> wh::core::result<void> {
+        return wh::core::result<void>::failure(wh::core::errc::unavailable);
+      }};
+  std::vector<std::string> reported{};
+  wh::compose::checkpoint_parking_lot parking{wh::compose::checkpoint_parking_options{
+      .ttl = 100ms,
+      .durable_backend = std::addressof(failing),
+      .on_persist_error = wh::compose::checkpoint_parking_error_handler{
+          [&reported](const std::string_view checkpoint_id, const wh::core::error_code) {
+            reported.emplace_back(checkpoint_id);
+          }},
+  }};
+  const auto parked_at = wh::compose::checkpoint_parking_lot::clock::now();
+  REQUIRE(parking.park(make_interrupted_state("old", 1), save_options("run-old"), parked_at)
+              .has_value());
+  REQUIRE(parking.park(make_interrupted_state("live", 2), save_options("run-live"),
+                       parked_at + 80ms)
+              .has_value());
+
+  wh::core::run_context context{};
+  auto plan = parking.prepare_restore(load_options("run-live"), context, parked_at + 120ms);
+  REQUIRE(plan.has_value());
+  REQUIRE(plan.value().live_state);
+  REQUIRE(entry_of(*plan.value().checkpoint) == 2);
+  REQUIRE(reported == std::vector<std::string>{"run-old"});
+  REQUIRE(parking.contains("run-old"));
+  REQUIRE_FALSE(parking.contains("run-live"));
+}
+
+TEST_CASE("checkpoint parking lot without a durable sink fails writes and keeps runs parked",
+          "[UT][wh/compose/runtime/"
+          "checkpoint_parking.hpp][checkpoint_parking_lot::flush][boundary]") {
+  std::vector<std::string> reported{};
+  {
+    wh::compose::checkpoint_parking_lot parking{wh::compose::checkpoint_parking_options{
+        .on_persist_error = wh::compose::checkpoint_parking_error_handler{
+            [&reported](const std::string_view checkpoint_id, const wh::core::error_code code) {
+              reported.emplace_back(code == wh::core::errc::invalid_argument ? checkpoint_id
+                                                                             : "unexpected");
+            }},
+    }};
+    REQUIRE(parking.park(make_interrupted_state("d", 7), save_options("run-d")).has_value());
+
+    auto flushed = parking.flush();
+    REQUIRE(flushed.has_error());
+    REQUIRE(flushed.error() == wh::core::errc::invalid_argument);
+    REQUIRE(parking.contains("run-d"));
+    REQUIRE(parking.find_interrupt("d").has_value());
+    REQUIRE(reported == std::vector<std::string>{"run-d"});
+  }
+  // Destruction retries the write and reports the failure instead of dropping it.
+  REQUIRE(reported == std::vector<std::string>{"run-d", "run-d"});
+}
+
+TEST_CASE("checkpoint parking lot persists the oldest run once max_parked is reached",
+          "[UT][wh/compose/runtime/"
+          "checkpoint_parking.hpp][checkpoint_parking_lot::park][boundary]") {
+  using namespace std::chrono_literals;
+  wh::compose::checkpoint_store store{};
+  wh::compose::checkpoint_parking_lot parking{wh::compose::checkpoint_parking_options{
+      .ttl = 1h,
+      .max_parked = 2U,
+      .durable_store = std::addressof(store),
+  }};
+  const auto parked_at = wh::compose::checkpoint_parking_lot::clock::now();
+  REQUIRE(parking.park(make_interrupted_state("a", 1), save_options("run-a"), parked_at)
+              .has_value());
+  REQUIRE(parking.park(make_interrupted_state("b", 2), save_options("run-b"), parked_at + 1ms)
+              .has_value());
+  REQUIRE(parking.park(make_interrupted_state("b", 3), save_options("run-b"), parked_at + 2ms)
+              .has_value());
+  REQUIRE(parking.size() == 2U);
+  REQUIRE(store.load(load_options("run-a")).has_error());
+
+  REQUIRE(parking.park(make_interrupted_state("c", 4), save_options("run-c"), parked_at + 3ms)
+              .has_value());
+  REQUIRE(parking.size() == 2U);
+  REQUIRE_FALSE(parking.contains("run-a"));
+  REQUIRE_FALSE(parking.find_interrupt("a").has_value());
+  auto durable = store.load(load_options("run-a"));
+  REQUIRE(durable.has_value());
+  REQUIRE(entry_of(durable.value()) == 1);
+
+  // Expired runs are swept on park even when the lot has room.
+  REQUIRE(parking.park(make_interrupted_state("e", 5), save_options("run-e"), parked_at + 2h)
+              .has_value());
+  REQUIRE(parking.size() == 1U);
+  REQUIRE(store.load(load_options("run-c")).has_value());
+}
+
+TEST_CASE("checkpoint parking lot hands the encoded payload to a payload sink",
+          "[UT][wh/compose/runtime/"
+          "checkpoint_parking.hpp][checkpoint_parking_lot::prepare_restore][condition]") {
+  std::size_t decode_calls = 0U;
+  const wh::compose::checkpoint_serializer serializer{
+      .encode = wh::compose::checkpoint_serializer_encode{
+          [](wh::compose::checkpoint_state &&state,
+             wh::core::run_context &) -> wh::core::result<wh::compose::graph_value> {
+            return wh::compose::graph_value{entry_of(state)};
+          }},
+      .decode = wh::compose::checkpoint_serializer_decode{
+          [&decode_calls](wh::compose::graph_value &&payload, wh::core::run_context &)
+              -> wh::core::result<wh::compose::checkpoint_state> {
+            ++decode_calls;
+            return make_interrupted_state("restored", *wh::core::any_cast<int>(&payload));
+          }},
+  };
+  std::optional<wh::compose::graph_value> stored{};
+  const wh::compose::checkpoint_payload_sink sink{
+      .save = wh::compose::checkpoint_payload_save{
+          [&stored](wh::compose::graph_value &&payload, wh::compose::checkpoint_save_options &&,
+                    wh::core::run_context &) -> wh::core::result<void> {
+            stored = std::move(payload);
+            return {};
+          }},
+      .load = wh::compose::checkpoint_payload_load{
+          [&stored](const wh::compose::checkpoint_load_options &,
+                    wh::core::run_context &) -> wh::core::result<wh::compose::graph_value> {
+            if (!stored.has_value()) {
+              return wh::core::result<wh::compose::graph_value>::failure(
+                  wh::core::errc::not_found);
+            }
+            return std::move(*stored);
+          }},
+  };
+  wh::compose::checkpoint_parking_lot parking{wh::compose::checkpoint_parking_options{
+      .durable_payload_sink = std::addressof(sink),
+      .serializer = std::addressof(serializer),
+  }};
+  REQUIRE(parking.park(make_interrupted_state("f", 9), save_options("run-f")).has_value());
+  REQUIRE(parking.flush().value() == 1U);
+  REQUIRE(stored.has_value());
+  REQUIRE(*wh::core::any_cast<int>(&*stored) == 9);
+  REQUIRE(decode_calls == 0U);
+
+  wh::core::run_context context{};
+  auto plan = parking.prepare_restore(load_options("run-f"), context);
+  REQUIRE(plan.has_value());
+  REQUIRE(plan.value().restore_from_checkpoint);
+  REQUIRE(plan.value().live_state);
+  REQUIRE(entry_of(*plan.value().checkpoint) == 9);
+  REQUIRE(decode_calls == 1U);
+}
@@ -35,6 +35,8 @@ TEST_CASE("compose types expose edge and branch data contracts",
   REQUIRE(edge.to == "b");
   REQUIRE(edge.options.no_control);
   REQUIRE(edge.options.limits.max_items == 4U);
+  REQUIRE(edge.options.fold.registry == nullptr);
+  REQUIRE_FALSE(static_cast<bool>(edge.options.fold.on_partial));
 }
 
 TEST_CASE("compose types expose default adapter branch and diagnostic carriers",
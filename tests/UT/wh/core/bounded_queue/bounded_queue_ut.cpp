@@ -106,6 +106,33 @@ TEST_CASE("bounded queue sync api covers full empty closed and zero-capacity bou
   REQUIRE(rendezvous.try_pop().error() == wh::core::bounded_queue_status::empty);
 }
 
+TEST_CASE("bounded queue adaptive ring grows under pressure and reports capacity stats",
+          "[UT][wh/core/bounded_queue/"
+          "bounded_queue.hpp][bounded_queue::capacity_stats][condition][boundary]") {
+  wh::core::bounded_queue<int> queue{wh::core::ring_capacity_policy{.initial = 2U, .max = 6U}};
+  REQUIRE(queue.capacity() == 6U);
+  REQUIRE(queue.capacity_stats().allocated == 0U);
+
+  for (int value = 0; value < 6; ++value) {
+    REQUIRE(queue.try_push(value) == wh::core::bounded_queue_status::success);
+  }
+  REQUIRE(queue.try_push(6) == wh::core::bounded_queue_status::full);
+
+  auto stats = queue.capacity_stats();
+  REQUIRE(stats.allocated == 6U);
+  REQUIRE(stats.high_water == 6U);
+  REQUIRE(stats.grow_count == 2U);
+
+  for (int expected = 0; expected < 6; ++expected) {
+    REQUIRE(queue.pop() == std::optional<int>{expected});
+  }
+  REQUIRE(queue.try_push(7) == wh::core::bounded_queue_status::success);
+  REQUIRE(queue.pop() == std::optional<int>{7});
+  stats = queue.capacity_stats();
+  REQUIRE(stats.allocated == 0U);
+  REQUIRE(stats.shrink_count == 1U);
+}
+
 TEST_CASE("bounded queue async api wakes waiting push and pop via scheduler env",
           "[UT][wh/core/bounded_queue/"
           "bounded_queue.hpp][bounded_queue::async_pop][branch][concurrency]") {
@@ -0,0 +1,17 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/bounded_queue/capacity.hpp"
+
+TEST_CASE("ring capacity policy and stats default to small lazily grown rings",
+          "[UT][wh/core/bounded_queue/capacity.hpp][ring_capacity_policy][boundary]") {
+  constexpr wh::core::ring_capacity_policy policy{};
+  STATIC_REQUIRE(policy.initial == 8U);
+  STATIC_REQUIRE(policy.max == 64U);
+
+  constexpr wh::core::ring_capacity_stats stats{};
+  STATIC_REQUIRE(stats.capacity == 0U);
+  STATIC_REQUIRE(stats.allocated == 0U);
+  STATIC_REQUIRE(stats.high_water == 0U);
+  STATIC_REQUIRE(stats.grow_count == 0U);
+  STATIC_REQUIRE(stats.shrink_count == 0U);
+}
@@ -80,3 +80,93 @@ TEST_CASE("ring storage destroys consumed slot even when sink throws",
   REQUIRE(storage.empty());
   REQUIRE(ring_probe::live_count == 0);
 }
+
+TEST_CASE("adaptive ring storage allocates lazily grows under pressure and keeps order",
+          "[UT][wh/core/bounded_queue/detail/"
+          "ring_storage.hpp][ring_storage::reserve_slot][condition][boundary]") {
+  ring_probe::live_count = 0;
+
+  wh::core::detail::ring_storage<ring_probe> storage{
+      wh::core::ring_capacity_policy{.initial = 2U, .max = 8U}};
+  REQUIRE(storage.capacity() == 8U);
+  REQUIRE(storage.allocated() == 0U);
+
+  storage.emplace_back(0);
+  REQUIRE(storage.allocated() == 2U);
+  storage.emplace_back(1);
+  REQUIRE(storage.pop_front().value == 0);
+  storage.emplace_back(2);
+  storage.emplace_back(3);
+  REQUIRE(storage.allocated() == 4U);
+  for (int value = 4; value < 9; ++value) {
+    REQUIRE(storage.reserve_slot());
+    storage.emplace_back(value);
+  }
+  REQUIRE(storage.full());
+  REQUIRE_FALSE(storage.reserve_slot());
+  REQUIRE(storage.allocated() == 8U);
+
+  for (int expected = 1; expected < 9; ++expected) {
+    REQUIRE(storage.pop_front().value == expected);
+  }
+  const auto stats = storage.stats();
+  REQUIRE(stats.capacity == 8U);
+  REQUIRE(stats.high_water == 8U);
+  REQUIRE(stats.grow_count == 2U);
+  REQUIRE(stats.shrink_count == 0U);
+  REQUIRE(ring_probe::live_count == 0);
+}
+
+TEST_CASE("adaptive ring storage releases storage after an idle drain",
+          "[UT][wh/core/bounded_queue/detail/"
+          "ring_storage.hpp][ring_storage::consume_front][branch]") {
+  wh::core::detail::ring_storage<int> storage{
+      wh::core::ring_capacity_policy{.initial = 1U, .max = 16U}};
+  for (int value = 0; value < 16; ++value) {
+    storage.emplace_back(value);
+  }
+  while (!storage.empty()) {
+    static_cast<void>(storage.pop_front());
+  }
+  REQUIRE(storage.allocated() == 16U);
+
+  storage.emplace_back(42);
+  REQUIRE(storage.pop_front() == 42);
+  REQUIRE(storage.allocated() == 0U);
+  REQUIRE(storage.stats().shrink_count == 1U);
+
+  storage.emplace_back(7);
+  REQUIRE(storage.allocated() == 1U);
+  REQUIRE(storage.stats().high_water == 16U);
+
+  wh::core::detail::ring_storage<int> fixed{4U};
+  REQUIRE(fixed.saturated() == fixed.full());
+  fixed.emplace_back(1);
+  REQUIRE(fixed.pop_front() == 1);
+  REQUIRE(fixed.allocated() == 4U);
+}
+
+TEST_CASE("ring storage keeps an attached depth gauge in sync with its size",
+          "[UT][wh/core/bounded_queue/detail/"
+          "ring_storage.hpp][ring_storage::attach_depth_gauge][condition][branch]") {
+  wh::core::metric_gauge gauge{};
+  wh::core::metric_gauge replacement{};
+  {
+    wh::core::detail::ring_storage<int> storage{2U};
+    storage.emplace_back(1);
+    storage.attach_depth_gauge(&gauge);
+    REQUIRE(gauge.value() == 1);
+    storage.emplace_back(2);
+    REQUIRE(gauge.value() == 2);
+    REQUIRE(storage.pop_front() == 1);
+    REQUIRE(gauge.value() == 1);
+
+    auto moved = std::move(storage);
+    moved.emplace_back(3);
+    REQUIRE(gauge.value() == 2);
+    moved.attach_depth_gauge(&replacement);
+    REQUIRE(gauge.value() == 0);
+    REQUIRE(replacement.value() == 2);
+  }
+  REQUIRE(replacement.value() == 0);
+}
@@ -0,0 +1,111 @@
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/callback/sampling.hpp"
+
+namespace {
+
+using wh::core::callback_sampling_decision;
+using wh::core::callback_sampling_options;
+using wh::core::callback_sampling_route;
+using wh::core::callback_stage;
+using wh::core::callback_trace_sampler;
+
+} // namespace
+
+TEST_CASE("callback sampling decision honors ratio bounds and trace ids",
+          "[UT][wh/core/callback/sampling.hpp][decide_callback_sampling][branch][boundary]") {
+  REQUIRE(wh::core::decide_callback_sampling(callback_sampling_options{}) ==
+          callback_sampling_decision::sampled);
+  REQUIRE(wh::core::decide_callback_sampling(callback_sampling_options{.ratio = 0.0}, "t") ==
+          callback_sampling_decision::dropped);
+  REQUIRE(wh::core::decide_callback_sampling(
+              callback_sampling_options{.ratio = 0.0, .tail_sampling = true}, "t") ==
+          callback_sampling_decision::tail);
+
+  const callback_sampling_options half{.ratio = 0.5};
+  std::size_t sampled = 0U;
+  for (std::size_t index = 0U; index < 1000U; ++index) {
+    const auto trace_id = "trace-" + std::to_string(index);
+    const auto decision = wh::core::decide_callback_sampling(half, trace_id);
+    REQUIRE(decision == wh::core::decide_callback_sampling(half, trace_id));
+    if (decision == callback_sampling_decision::sampled) {
+      ++sampled;
+    }
+  }
+  REQUIRE(sampled > 400U);
+  REQUIRE(sampled < 600U);
+}
+
+TEST_CASE("callback sampler routes events by decision",
+          "[UT][wh/core/callback/sampling.hpp][callback_trace_sampler::route][branch]") {
+  const callback_trace_sampler sampled{callback_sampling_decision::sampled};
+  REQUIRE(sampled.route(callback_stage::start) == callback_sampling_route::dispatch);
+
+  const callback_trace_sampler dropped{callback_sampling_decision::dropped};
+  REQUIRE(dropped.route(callback_stage::start) == callback_sampling_route::drop);
+  REQUIRE(dropped.route(callback_stage::error) == callback_sampling_route::dispatch);
+
+  const callback_trace_sampler silent{callback_sampling_decision::dropped,
+                                      callback_sampling_options{.always_trace_errors = false}};
+  REQUIRE(silent.route(callback_stage::error) == callback_sampling_route::drop);
+
+  const callback_trace_sampler tail{callback_sampling_decision::tail};
+  REQUIRE(tail.route(callback_stage::end) == callback_sampling_route::buffer);
+}
+
+TEST_CASE("callback sampler replays tail runs only when kept",
+          "[UT][wh/core/callback/sampling.hpp][callback_trace_sampler::finish][condition]"
+          "[boundary]") {
+  std::vector<int> replayed{};
+  const wh::core::stage_view_callback record =
+      [&replayed](const callback_stage, const wh::core::callback_event_view event,
+                  const wh::core::callback_run_info &) {
+        const auto *value = wh::core::any_cast<int>(&event);
+        replayed.push_back(value == nullptr ? -1 : *value);
+      };
+
+  SECTION("fast successful run is discarded") {
+    callback_trace_sampler sampler{callback_sampling_decision::tail,
+                                   callback_sampling_options{.tail_sampling = true}};
+    int payload = 1;
+    sampler.buffer(callback_stage::start, wh::core::make_callback_event_view(payload), {},
+                   record);
+    REQUIRE(sampler.buffered_count() == 1U);
+    REQUIRE(sampler.finish(false) == 0U);
+    REQUIRE(replayed.empty());
+  }
+
+  SECTION("error stage keeps owned copies in arrival order") {
+    callback_trace_sampler sampler{callback_sampling_decision::tail,
+                                   callback_sampling_options{.tail_sampling = true}};
+    int payload = 1;
+    sampler.buffer(callback_stage::start, wh::core::make_callback_event_view(payload), {},
+                   record);
+    payload = 2;
+    sampler.buffer(callback_stage::error, wh::core::make_callback_event_view(payload), {},
+                   record);
+    payload = 3;
+    REQUIRE(sampler.finish(false) == 2U);
+    REQUIRE(replayed == std::vector<int>{1, 2});
+  }
+
+  SECTION("slow run is kept and capacity bounds the buffer") {
+    callback_trace_sampler sampler{
+        callback_sampling_decision::tail,
+        callback_sampling_options{.tail_sampling = true,
+                                  .tail_latency_threshold = std::chrono::nanoseconds{0},
+                                  .tail_event_capacity = 1U}};
+    int payload = 4;
+    sampler.buffer(callback_stage::start, wh::core::make_callback_event_view(payload), {},
+                   record);
+    sampler.buffer(callback_stage::end, wh::core::make_callback_event_view(payload), {}, record);
+    REQUIRE(sampler.overflow_count() == 1U);
+    REQUIRE(sampler.finish(false) == 1U);
+    REQUIRE(replayed == std::vector<int>{4});
+  }
+}
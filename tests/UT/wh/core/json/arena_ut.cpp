@@ -0,0 +1,132 @@
+#include <string>
+#include <string_view>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/json/arena.hpp"
+
+TEST_CASE("json arena parses into pooled documents and serializes into pooled buffers",
+          "[UT][wh/core/json/arena.hpp][parse_json_into][branch]") {
+  wh::core::json_arena arena{};
+  wh::core::json_arena_scope scope{arena};
+
+  const auto parsed = wh::core::parse_json_into(arena, R"({"name":"alpha","items":[1,2]})");
+  REQUIRE(parsed.has_value());
+  REQUIRE(parsed.value()->IsObject());
+  REQUIRE(std::string_view{(*parsed.value())["name"].GetString()} == "alpha");
+
+  const auto second = wh::core::parse_json_into(arena, R"([true])");
+  REQUIRE(second.has_value());
+  REQUIRE(second.value()->IsArray());
+  REQUIRE(parsed.value()->IsObject());
+
+  const auto serialized = wh::core::json_to_string(arena, *parsed.value());
+  REQUIRE(serialized.has_value());
+  REQUIRE(serialized.value() == R"({"name":"alpha","items":[1,2]})");
+
+  const auto failed = wh::core::parse_json_into(arena, "{]");
+  REQUIRE(failed.has_error());
+  REQUIRE(failed.error() == wh::core::errc::parse_error);
+}
+
+TEST_CASE("json arena values use the pooled allocator until reset",
+          "[UT][wh/core/json/arena.hpp][json_arena::make_value][condition]") {
+  wh::core::json_arena arena{256U};
+  auto *value = arena.make_value();
+  REQUIRE(value->IsNull());
+  value->SetObject();
+  value->AddMember("key", wh::core::json_value{"text", arena.allocator()}, arena.allocator());
+  REQUIRE(value->MemberCount() == 1U);
+  REQUIRE(arena.allocator().Size() > 0U);
+
+  arena.reset();
+  REQUIRE(arena.allocator().Size() == 0U);
+}
+
+TEST_CASE("json arena scope resets only when the outermost scope exits",
+          "[UT][wh/core/json/arena.hpp][json_arena_scope][boundary]") {
+  wh::core::json_arena arena{};
+  {
+    wh::core::json_arena_scope outer{arena};
+    REQUIRE(arena.scope_depth() == 1U);
+    const auto parsed = wh::core::parse_json_into(arena, R"({"a":1})");
+    REQUIRE(parsed.has_value());
+    {
+      wh::core::json_arena_scope inner{arena};
+      REQUIRE(arena.scope_depth() == 2U);
+    }
+    REQUIRE(arena.scope_depth() == 1U);
+    REQUIRE(parsed.value()->IsObject());
+    REQUIRE((*parsed.value())["a"].GetInt() == 1);
+  }
+  REQUIRE(arena.scope_depth() == 0U);
+  REQUIRE(arena.allocator().Size() == 0U);
+}
+
+TEST_CASE("json arena grows its retained chunk to the observed high-water mark",
+          "[UT][wh/core/json/arena.hpp][json_arena::reset][boundary]") {
+  wh::core::json_arena arena{512U, 64U * 1024U};
+  const auto initial = arena.retained_capacity();
+
+  std::string payload{"["};
+  for (int index = 0; index < 512; ++index) {
+    payload += index == 0 ? "" : ",";
+    payload += R"({"k":"value"})";
+  }
+  payload += "]";
+
+  {
+    wh::core::json_arena_scope scope{arena};
+    const auto parsed = wh::core::parse_json_into(arena, payload);
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed.value()->Size() == 512U);
+  }
+  REQUIRE(arena.high_water_bytes() > initial);
+  REQUIRE(arena.retained_capacity() > initial);
+  REQUIRE(arena.retained_capacity() <= 64U * 1024U);
+
+  const auto grown = arena.retained_capacity();
+  {
+    wh::core::json_arena_scope scope{arena};
+    const auto parsed = wh::core::parse_json_into(arena, R"({"small":true})");
+    REQUIRE(parsed.has_value());
+  }
+  REQUIRE(arena.retained_capacity() == grown);
+}
+
+TEST_CASE("json arena reuses both pools across scopes without new chunk allocations",
+          "[UT][wh/core/json/arena.hpp][json_arena::reset][boundary]") {
+  wh::core::json_arena arena{};
+  std::string nested{};
+  for (int depth = 0; depth < 64; ++depth) {
+    nested += R"({"k":[)";
+  }
+  nested += "1";
+  for (int depth = 0; depth < 64; ++depth) {
+    nested += "]}";
+  }
+
+  std::size_t chunk_allocations = 0U;
+  const auto run_scope = [&]() {
+    wh::core::json_arena_scope scope{arena};
+    for (int round = 0; round < 8; ++round) {
+      const auto value_before = arena.allocator().Capacity();
+      const auto stack_before = arena.stack_capacity();
+      const auto parsed = wh::core::parse_json_into(arena, nested);
+      REQUIRE(parsed.has_value());
+      chunk_allocations += arena.allocator().Capacity() > value_before ? 1U : 0U;
+      chunk_allocations += arena.stack_capacity() > stack_before ? 1U : 0U;
+    }
+  };
+
+  run_scope();
+  REQUIRE(chunk_allocations > 0U);
+  const auto warmed_stack = arena.stack_capacity();
+
+  chunk_allocations = 0U;
+  run_scope();
+  REQUIRE(chunk_allocations == 0U);
+  run_scope();
+  REQUIRE(chunk_allocations == 0U);
+  REQUIRE(arena.stack_capacity() == warmed_stack);
+}
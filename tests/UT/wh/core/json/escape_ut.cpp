@@ -0,0 +1,20 @@
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/json/escape.hpp"
+
+TEST_CASE("json escape quotes strings and escapes control characters like rapidjson",
+          "[UT][wh/core/json/escape.hpp][append_json_string][branch][boundary]") {
+  std::string output{"prefix:"};
+  wh::core::append_json_string(output, "");
+  REQUIRE(output == "prefix:\"\"");
+
+  output.clear();
+  wh::core::append_json_string(output, "a\"b\\c\b\f\n\r\t");
+  REQUIRE(output == R"("a\"b\\c\b\f\n\r\t")");
+
+  output.clear();
+  wh::core::append_json_string(output, std::string{"\x01\x1f/\x7f", 4U});
+  REQUIRE(output == "\"\\u0001\\u001F/\x7f\"");
+}
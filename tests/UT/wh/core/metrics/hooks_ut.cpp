@@ -0,0 +1,71 @@
+#include <chrono>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/metrics/hooks.hpp"
+
+TEST_CASE("component call metrics count calls and errors per descriptor",
+          "[UT][wh/core/metrics/hooks.hpp][make_component_call_metrics][branch]") {
+  wh::core::metrics_registry registry{};
+  const wh::core::component_descriptor descriptor{.type_name = "Retriever",
+                                                  .kind = wh::core::component_kind::retriever};
+  const auto metrics = wh::core::make_component_call_metrics(registry, descriptor);
+  REQUIRE(metrics.calls != nullptr);
+  REQUIRE(metrics.errors != nullptr);
+  metrics.record(false);
+  metrics.record(true);
+  REQUIRE(metrics.calls->value() == 2U);
+  REQUIRE(metrics.errors->value() == 1U);
+
+  const auto again = wh::core::make_component_call_metrics(registry, descriptor);
+  REQUIRE(again.calls == metrics.calls);
+  const auto families = registry.collect();
+  REQUIRE(families[0].name == wh::core::metric_names::component_calls);
+  REQUIRE(families[0].series[0].labels[1].value == "retriever");
+  REQUIRE(families[0].help == "Component calls completed.");
+
+  // Help text is registered once per registry, so later lookups keep overrides.
+  registry.describe(wh::core::metric_names::component_calls, "Calls.");
+  static_cast<void>(wh::core::make_component_call_metrics(registry, descriptor));
+  REQUIRE(registry.collect()[0].help == "Calls.");
+
+  wh::core::component_call_metrics disabled{};
+  disabled.record(true);
+}
+
+TEST_CASE("component call metrics lookup resolves shared global handles per descriptor",
+          "[UT][wh/core/metrics/hooks.hpp][component_call_metrics_for][condition]") {
+  const wh::core::component_descriptor descriptor{.type_name = "HooksUtModel",
+                                                  .kind = wh::core::component_kind::model};
+  const auto first = wh::core::component_call_metrics_for(descriptor);
+  const auto second = wh::core::component_call_metrics_for(descriptor);
+  REQUIRE(first.calls != nullptr);
+  REQUIRE(first.calls == second.calls);
+
+  const auto other = wh::core::component_call_metrics_for(
+      {.type_name = "HooksUtModel", .kind = wh::core::component_kind::custom});
+  REQUIRE(other.calls != first.calls);
+}
+
+TEST_CASE("graph node and stream metrics resolve labelled handles",
+          "[UT][wh/core/metrics/hooks.hpp][make_graph_node_metrics][branch]") {
+  wh::core::metrics_registry registry{};
+  const auto node = wh::core::make_graph_node_metrics(registry, "g", "n");
+  REQUIRE(node.enabled());
+  REQUIRE_FALSE(wh::core::graph_node_metrics{}.enabled());
+  wh::core::record_elapsed(node.execution_latency, std::chrono::steady_clock::now());
+  wh::core::record_elapsed(nullptr, std::chrono::steady_clock::now());
+  REQUIRE(node.execution_latency->snapshot().count == 1U);
+  REQUIRE(node.queue_latency->snapshot().count == 0U);
+
+  const auto stream = wh::core::make_stream_read_metrics(registry, "s");
+  REQUIRE(stream.enabled());
+  REQUIRE_FALSE(wh::core::stream_read_metrics{}.enabled());
+  stream.depth->add(2);
+  REQUIRE(registry.gauge(wh::core::metric_names::queue_depth, {{.name = "stream", .value = "s"}})
+              .value()
+              .get()
+              .value() == 2);
+  REQUIRE(registry.series_count() == 5U);
+}
@@ -0,0 +1,95 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/metrics/instruments.hpp"
+
+TEST_CASE("metric counter sums increments from every thread",
+          "[UT][wh/core/metrics/instruments.hpp][metric_counter::add][concurrency]") {
+  wh::core::metric_counter counter{};
+  REQUIRE(counter.value() == 0U);
+  counter.add();
+  counter.add(4U);
+  REQUIRE(counter.value() == 5U);
+
+  std::vector<std::thread> workers{};
+  for (std::size_t index = 0U; index < 4U; ++index) {
+    workers.emplace_back([&counter] {
+      for (std::size_t step = 0U; step < 1000U; ++step) {
+        counter.add();
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  REQUIRE(counter.value() == 4005U);
+}
+
+TEST_CASE("metric gauge supports set and signed deltas",
+          "[UT][wh/core/metrics/instruments.hpp][metric_gauge::add][branch]") {
+  wh::core::metric_gauge gauge{};
+  gauge.set(10);
+  gauge.add(-3);
+  REQUIRE(gauge.value() == 7);
+  gauge.add(-9);
+  REQUIRE(gauge.value() == -2);
+}
+
+TEST_CASE("metric histogram buckets are log-linear and contiguous",
+          "[UT][wh/core/metrics/instruments.hpp][metric_histogram::bucket_index][boundary]") {
+  using wh::core::metric_histogram;
+  REQUIRE(metric_histogram::bucket_index(0U) == 0U);
+  REQUIRE(metric_histogram::bucket_index(3U) == 3U);
+  REQUIRE(metric_histogram::bucket_index(4U) == 4U);
+  REQUIRE(metric_histogram::bucket_index(7U) == 7U);
+  REQUIRE(metric_histogram::bucket_index(8U) == 8U);
+  REQUIRE(metric_histogram::bucket_index(9U) == 8U);
+  REQUIRE(metric_histogram::bucket_index(10U) == 9U);
+  REQUIRE(metric_histogram::bucket_index(UINT64_MAX) == metric_histogram::bucket_count - 1U);
+  REQUIRE(metric_histogram::bucket_upper_bound(metric_histogram::bucket_count - 1U) == UINT64_MAX);
+
+  // Every bucket starts where the previous one ends.
+  for (std::size_t index = 1U; index + 1U < metric_histogram::bucket_count; ++index) {
+    const auto lower = metric_histogram::bucket_upper_bound(index - 1U);
+    REQUIRE(metric_histogram::bucket_index(lower) == index);
+    REQUIRE(metric_histogram::bucket_index(metric_histogram::bucket_upper_bound(index) - 1U) ==
+            index);
+  }
+}
+
+TEST_CASE("metric histogram snapshot merges shards and answers quantiles",
+          "[UT][wh/core/metrics/instruments.hpp][metric_histogram::snapshot][branch]") {
+  wh::core::metric_histogram histogram{};
+  REQUIRE(histogram.snapshot().quantile(0.5) == std::chrono::nanoseconds{0});
+
+  for (std::size_t index = 0U; index < 90U; ++index) {
+    histogram.record(std::chrono::microseconds{1});
+  }
+  std::thread worker{[&histogram] {
+    for (std::size_t index = 0U; index < 10U; ++index) {
+      histogram.record(std::chrono::milliseconds{1});
+    }
+  }};
+  worker.join();
+  histogram.record(std::chrono::nanoseconds{-5});
+
+  const auto snapshot = histogram.snapshot();
+  REQUIRE(snapshot.count == 101U);
+  REQUIRE(snapshot.sum_nanos == 90U * 1000U + 10U * 1000000U);
+  REQUIRE(snapshot.buckets[0] == 1U);
+  const auto median = snapshot.quantile(0.5);
+  REQUIRE(median >= std::chrono::microseconds{1});
+  REQUIRE(median <= std::chrono::nanoseconds{1250});
+  const auto tail = snapshot.quantile(0.99);
+  REQUIRE(tail >= std::chrono::milliseconds{1});
+  REQUIRE(tail <= std::chrono::microseconds{1250});
+
+  wh::core::metric_histogram overflowed{};
+  overflowed.record(std::chrono::hours{24 * 365});
+  REQUIRE(overflowed.snapshot().quantile(0.5) == std::chrono::nanoseconds::max());
+}
@@ -0,0 +1,65 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/metrics/prometheus.hpp"
+
+TEST_CASE("prometheus text renders counters gauges and escaped labels",
+          "[UT][wh/core/metrics/prometheus.hpp][encode_prometheus_text][branch]") {
+  wh::core::metrics_registry registry{};
+  registry.describe("calls_total", "Calls\nmade.");
+  registry.counter("calls_total", {{.name = "name", .value = "a\"b\\c"}}).value().get().add(3U);
+  registry.gauge("depth").value().get().set(-2);
+
+  const auto text = wh::core::encode_prometheus_text(registry);
+  REQUIRE(text == "# HELP calls_total Calls\\nmade.\n"
+                  "# TYPE calls_total counter\n"
+                  "calls_total{name=\"a\\\"b\\\\c\"} 3\n"
+                  "# TYPE depth gauge\n"
+                  "depth -2\n");
+}
+
+TEST_CASE("prometheus histogram buckets are cumulative and in seconds",
+          "[UT][wh/core/metrics/prometheus.hpp][write_prometheus_text][boundary]") {
+  wh::core::metrics_registry registry{};
+  auto &histogram =
+      registry.histogram("lat_seconds", {{.name = "node", .value = "n"}}).value().get();
+  histogram.record_nanos(1000U);
+  histogram.record_nanos(1024U);
+  histogram.record_nanos(5000U);
+  histogram.record_nanos(std::uint64_t{1} << 45U);
+
+  std::string text{};
+  wh::core::write_prometheus_text(registry, text);
+  REQUIRE(text.find("# TYPE lat_seconds histogram\n") != std::string::npos);
+  REQUIRE(text.find("lat_seconds_bucket{node=\"n\",le=\"1.024e-06\"} 1\n") != std::string::npos);
+  REQUIRE(text.find("lat_seconds_bucket{node=\"n\",le=\"2.048e-06\"} 2\n") != std::string::npos);
+  REQUIRE(text.find("lat_seconds_bucket{node=\"n\",le=\"8.192e-06\"} 3\n") != std::string::npos);
+  REQUIRE(text.find("lat_seconds_bucket{node=\"n\",le=\"+Inf\"} 4\n") != std::string::npos);
+  REQUIRE(text.find("lat_seconds_count{node=\"n\"} 4\n") != std::string::npos);
+  REQUIRE(text.find("lat_seconds_sum{node=\"n\"} ") != std::string::npos);
+}
+
+TEST_CASE("prometheus dump writes the exposition file and reports failures",
+          "[UT][wh/core/metrics/prometheus.hpp][dump_prometheus_text][condition]") {
+  wh::core::metrics_registry registry{};
+  registry.counter("dumped_total").value().get().add();
+  const auto path =
+      (std::filesystem::temp_directory_path() / "wh_metrics_prometheus_ut.prom").string();
+
+  REQUIRE(wh::core::dump_prometheus_text(registry, path).has_value());
+  std::ifstream stream{path};
+  std::stringstream contents{};
+  contents << stream.rdbuf();
+  REQUIRE(contents.str() == wh::core::encode_prometheus_text(registry));
+  REQUIRE_FALSE(std::filesystem::exists(path + ".tmp"));
+  std::filesystem::remove(path);
+
+  const auto missing = wh::core::dump_prometheus_text(registry, "/nonexistent-dir/x.prom");
+  REQUIRE(missing.has_error());
+  REQUIRE(missing.error() == wh::core::errc::unavailable);
+}
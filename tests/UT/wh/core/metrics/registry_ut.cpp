@@ -0,0 +1,63 @@
+#include <chrono>
+#include <cstdint>
+#include <variant>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/metrics/registry.hpp"
+
+TEST_CASE("metrics registry returns one instrument per name and label set",
+          "[UT][wh/core/metrics/registry.hpp][metrics_registry::counter][branch]") {
+  wh::core::metrics_registry registry{};
+  auto first =
+      registry.counter("calls_total", {{.name = "b", .value = "2"}, {.name = "a", .value = "1"}});
+  auto reordered =
+      registry.counter("calls_total", {{.name = "a", .value = "1"}, {.name = "b", .value = "2"}});
+  auto other = registry.counter("calls_total", {{.name = "a", .value = "9"}});
+  REQUIRE(first.has_value());
+  REQUIRE(reordered.has_value());
+  REQUIRE(other.has_value());
+  REQUIRE(&first.value().get() == &reordered.value().get());
+  REQUIRE(&first.value().get() != &other.value().get());
+  REQUIRE(registry.series_count() == 2U);
+}
+
+TEST_CASE("metrics registry rejects malformed names and kind conflicts",
+          "[UT][wh/core/metrics/registry.hpp][metrics_registry::gauge][condition]") {
+  wh::core::metrics_registry registry{};
+  REQUIRE(registry.counter("").error() == wh::core::errc::invalid_argument);
+  REQUIRE(registry.counter("9lives").error() == wh::core::errc::invalid_argument);
+  REQUIRE(registry.counter("has-dash").error() == wh::core::errc::invalid_argument);
+  REQUIRE(registry.counter("ns:calls").has_value());
+  REQUIRE(registry.counter("ok", {{.name = "bad:label", .value = "x"}}).error() ==
+          wh::core::errc::invalid_argument);
+  REQUIRE(registry.counter("ok", {{.name = "dup", .value = "x"}, {.name = "dup", .value = "y"}})
+              .error() == wh::core::errc::invalid_argument);
+
+  REQUIRE(registry.gauge("depth").has_value());
+  REQUIRE(registry.counter("depth").error() == wh::core::errc::type_mismatch);
+  REQUIRE(registry.histogram("depth").error() == wh::core::errc::type_mismatch);
+}
+
+TEST_CASE("metrics registry collect snapshots every family sorted by name",
+          "[UT][wh/core/metrics/registry.hpp][metrics_registry::collect][branch]") {
+  wh::core::metrics_registry registry{};
+  registry.describe("zeta_seconds", "latency");
+  registry.histogram("zeta_seconds").value().get().record(std::chrono::microseconds{3});
+  registry.gauge("alpha").value().get().set(-4);
+  registry.counter("mid_total", {{.name = "k", .value = "v"}}).value().get().add(7U);
+
+  const auto families = registry.collect();
+  REQUIRE(families.size() == 3U);
+  REQUIRE(families[0].name == "alpha");
+  REQUIRE(families[0].kind == wh::core::metric_kind::gauge);
+  REQUIRE(std::get<std::int64_t>(families[0].series[0].value) == -4);
+  REQUIRE(families[1].name == "mid_total");
+  REQUIRE(families[1].series[0].labels[0].value == "v");
+  REQUIRE(std::get<std::uint64_t>(families[1].series[0].value) == 7U);
+  REQUIRE(families[2].help == "latency");
+  const auto &histogram =
+      std::get<wh::core::metric_histogram_snapshot>(families[2].series[0].value);
+  REQUIRE(histogram.count == 1U);
+  REQUIRE(histogram.sum_nanos == 3000U);
+}
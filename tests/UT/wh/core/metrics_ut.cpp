@@ -0,0 +1,14 @@
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/metrics.hpp"
+
+TEST_CASE("metrics facade exposes registry hooks and prometheus encoding",
+          "[UT][wh/core/metrics.hpp][encode_prometheus_text][branch]") {
+  wh::core::metrics_registry registry{};
+  const auto stream = wh::core::make_stream_read_metrics(registry, "facade");
+  stream.chunks->add(2U);
+  const auto text = wh::core::encode_prometheus_text(registry);
+  REQUIRE(text.find("wh_stream_chunks_total{stream=\"facade\"} 2\n") != std::string::npos);
+}
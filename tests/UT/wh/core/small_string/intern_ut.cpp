@@ -0,0 +1,50 @@
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/small_string/intern.hpp"
+
+TEST_CASE("string_intern_pool returns one stable entry per distinct string",
+          "[UT][wh/core/small_string/intern.hpp][string_intern_pool::intern][branch][boundary]") {
+  wh::core::string_intern_pool pool{};
+  REQUIRE(pool.size() == 0U);
+
+  const auto empty = pool.intern("");
+  REQUIRE(empty.empty());
+  REQUIRE(empty.str().empty());
+  REQUIRE(pool.size() == 0U);
+
+  const std::string dynamic{"search"};
+  const auto first = pool.intern("search");
+  const auto second = pool.intern(dynamic);
+  REQUIRE(first == second);
+  REQUIRE(first.data() == second.data());
+  REQUIRE(first == std::string_view{"search"});
+  REQUIRE(pool.size() == 1U);
+
+  REQUIRE(pool.find("missing").empty());
+  REQUIRE(pool.find("search") == first);
+  REQUIRE(pool.size() == 1U);
+}
+
+TEST_CASE("intern shares the global pool across threads",
+          "[UT][wh/core/small_string/intern.hpp][intern][concurrency]") {
+  std::vector<wh::core::interned_string> handles(4U);
+  std::vector<std::thread> workers{};
+  for (std::size_t index = 0U; index < handles.size(); ++index) {
+    workers.emplace_back([&handles, index]() { handles[index] = wh::core::intern("shared_tool"); });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  for (const auto &handle : handles) {
+    REQUIRE(handle.data() == handles.front().data());
+    REQUIRE(handle.view() == "shared_tool");
+  }
+  REQUIRE(std::hash<wh::core::interned_string>{}(handles.front()) ==
+          std::hash<std::string_view>{}("shared_tool"));
+}
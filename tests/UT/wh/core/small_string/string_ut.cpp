@@ -0,0 +1,93 @@
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/small_string/string.hpp"
+#include "wh/core/type_traits.hpp"
+
+TEST_CASE("small_string keeps provider-sized ids inline and spills longer text",
+          "[UT][wh/core/small_string/string.hpp][small_string][branch][boundary]") {
+  wh::core::small_string<> call_id{"call_9f2b7c1d4e5a6f708192a3b4c5d6e7f8"};
+  REQUIRE(call_id.size() == 37U);
+  REQUIRE(call_id.is_small());
+  REQUIRE(call_id.capacity() == wh::core::small_string_default_inline_capacity);
+  REQUIRE(call_id == "call_9f2b7c1d4e5a6f708192a3b4c5d6e7f8");
+  REQUIRE(call_id.c_str()[call_id.size()] == '\0');
+
+  wh::core::small_string<8> label{"abcdefgh"};
+  REQUIRE(label.is_small());
+  label.push_back('i');
+  REQUIRE_FALSE(label.is_small());
+  REQUIRE(label == "abcdefghi");
+
+  label.append(label.view());
+  REQUIRE(label == "abcdefghiabcdefghi");
+
+  label.resize(4U);
+  label.shrink_to_fit();
+  REQUIRE(label.is_small());
+  REQUIRE(label == "abcd");
+}
+
+TEST_CASE("small_string interoperates with std string and string_view call sites",
+          "[UT][wh/core/small_string/string.hpp][operator==][condition][branch]") {
+  const std::string owned{"tool"};
+  wh::core::small_string<> name = owned;
+  REQUIRE(name == owned);
+  REQUIRE(owned == name);
+  REQUIRE(name != std::string_view{"other"});
+
+  std::string copied = name;
+  REQUIRE(copied == "tool");
+  copied = name;
+  copied += name;
+  REQUIRE(copied == "tooltool");
+  REQUIRE(name + "#1" == "tool#1");
+  REQUIRE(owned + name == "tooltool");
+
+  const auto takes_string = [](const std::string &value) { return value.size(); };
+  const auto takes_view = [](const std::string_view value) { return value.size(); };
+  REQUIRE(takes_string(name) == 4U);
+  REQUIRE(takes_view(name) == 4U);
+
+  std::unordered_map<std::string, int, wh::core::transparent_string_hash,
+                     wh::core::transparent_string_equal>
+      index{};
+  index.emplace("tool", 1);
+  REQUIRE(index.find(name) != index.end());
+  REQUIRE(std::hash<wh::core::small_string<>>{}(name) == std::hash<std::string_view>{}("tool"));
+
+  wh::core::small_string<> smaller{"a"};
+  REQUIRE(smaller < name);
+}
+
+TEST_CASE("small_string copy move and swap keep inline and heap storage independent",
+          "[UT][wh/core/small_string/string.hpp][swap][boundary]") {
+  wh::core::small_string<4> heap{"heap-backed"};
+  wh::core::small_string<4> inline_value{"in"};
+  const auto *heap_data = heap.data();
+
+  wh::core::small_string<4> moved{std::move(heap)};
+  REQUIRE(moved.data() == heap_data);
+  REQUIRE(heap.empty());
+  REQUIRE(heap.is_small());
+
+  wh::core::small_string<4> copied{moved};
+  REQUIRE(copied == moved);
+  REQUIRE(copied.data() != moved.data());
+
+  swap(copied, inline_value);
+  REQUIRE(copied == "in");
+  REQUIRE(copied.is_small());
+  REQUIRE(inline_value == "heap-backed");
+
+  const auto &alias = inline_value;
+  inline_value = alias;
+  REQUIRE(inline_value == "heap-backed");
+  inline_value.clear();
+  REQUIRE(inline_value.empty());
+  REQUIRE_THROWS_AS(inline_value.at(0U), std::out_of_range);
+}
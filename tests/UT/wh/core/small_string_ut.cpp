@@ -0,0 +1,14 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/small_string.hpp"
+
+TEST_CASE("small_string facade exports inline strings and interning",
+          "[UT][wh/core/small_string.hpp][small_string][condition][boundary]") {
+  wh::core::small_string<> id{"call-1"};
+  REQUIRE(id.is_small());
+  REQUIRE(id == "call-1");
+
+  const auto interned = wh::core::intern(id);
+  REQUIRE(interned == id.view());
+  REQUIRE(wh::core::intern("call-1").data() == interned.data());
+}
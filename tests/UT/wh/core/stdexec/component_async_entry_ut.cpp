@@ -65,6 +65,12 @@ TEST_CASE("component async entry filters callback sink and runs start success er
           "component_async_entry.hpp][component_async_entry][condition][branch][boundary]") {
   wh::core::run_context context{};
   context.callbacks.emplace();
+  wh::core::stage_callbacks listener{};
+  listener.on_start = [](wh::core::callback_stage, wh::core::callback_event_view,
+                         const wh::core::callback_run_info &) {};
+  context.callbacks->manager.register_local_callbacks(
+      wh::callbacks::make_callback_config([](const wh::callbacks::stage) noexcept { return true; }),
+      std::move(listener));
   auto sink = wh::callbacks::make_callback_sink(context);
 
   auto success_probe = std::make_shared<callback_probe>();
@@ -189,6 +195,34 @@ TEST_CASE("component async entry filters callback sink and runs start success er
   REQUIRE(disabled_probe->start_calls == 0);
   REQUIRE(disabled_probe->success_calls == 0);
   REQUIRE(disabled_probe->error_calls == 0);
+
+  wh::core::run_context silent_context{};
+  silent_context.callbacks.emplace();
+  auto silent_probe = std::make_shared<callback_probe>();
+  auto silent_sender = wh::core::detail::component_async_entry<wh::core::resume_mode::unchanged>(
+      test_request{.value = 6}, wh::callbacks::make_callback_sink(silent_context),
+      wh::core::detail::resume_passthrough,
+      [](test_request &&request) { return stdexec::just(result_t{request.value}); },
+      [silent_probe](const test_request &) {
+        ++silent_probe->make_state_calls;
+        return callback_state{};
+      },
+      [silent_probe](const wh::callbacks::callback_sink &, const callback_state &) {
+        ++silent_probe->start_calls;
+      },
+      [silent_probe](const wh::callbacks::callback_sink &, callback_state &, const result_t &) {
+        ++silent_probe->success_calls;
+      },
+      [silent_probe](const wh::callbacks::callback_sink &, callback_state &, const result_t &) {
+        ++silent_probe->error_calls;
+      });
+
+  auto silent = wh::testing::helper::wait_value_on_test_thread(std::move(silent_sender));
+  REQUIRE(silent.has_value());
+  REQUIRE(silent.value() == 6);
+  REQUIRE(silent_probe->make_state_calls == 0);
+  REQUIRE(silent_probe->start_calls == 0);
+  REQUIRE(silent_probe->success_calls == 0);
 }
 
 TEST_CASE(
@@ -0,0 +1,86 @@
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/versioned.hpp"
+
+namespace {
+
+struct lifetime_probe {
+  explicit lifetime_probe(int input, std::shared_ptr<int> live_counter)
+      : value(input), live(std::move(live_counter)) {
+    ++*live;
+  }
+  lifetime_probe(const lifetime_probe &other) : value(other.value), live(other.live) { ++*live; }
+  ~lifetime_probe() { --*live; }
+
+  int value{0};
+  std::shared_ptr<int> live{};
+};
+
+} // namespace
+
+TEST_CASE("versioned publish hands new readers the latest version",
+          "[UT][wh/core/versioned.hpp][versioned::publish][branch]") {
+  wh::core::versioned<std::string> handle{};
+  REQUIRE_FALSE(handle.has_value());
+  REQUIRE(handle.version() == 0U);
+  REQUIRE_FALSE(static_cast<bool>(handle.snapshot()));
+
+  REQUIRE(handle.publish("v1") == 1U);
+  const auto first = handle.snapshot();
+  REQUIRE(first.version == 1U);
+  REQUIRE(*first == "v1");
+
+  REQUIRE(handle.emplace(2U, 'x') == 2U);
+  REQUIRE(*handle.snapshot() == "xx");
+  REQUIRE(*first == "v1");
+  REQUIRE(first->size() == 2U);
+}
+
+TEST_CASE("versioned reclaims a version when its last snapshot is released",
+          "[UT][wh/core/versioned.hpp][versioned::snapshot][lifecycle]") {
+  auto live = std::make_shared<int>(0);
+  wh::core::versioned<lifetime_probe> handle{lifetime_probe{1, live}};
+  REQUIRE(*live == 1);
+
+  auto pinned = handle.snapshot();
+  handle.emplace(2, live);
+  REQUIRE(*live == 2);
+  REQUIRE(pinned->value == 1);
+  REQUIRE(handle.snapshot()->value == 2);
+
+  pinned = {};
+  REQUIRE(*live == 1);
+}
+
+TEST_CASE("versioned update retries on the newest version and copies share it",
+          "[UT][wh/core/versioned.hpp][versioned::update][concurrency]") {
+  wh::core::versioned<std::uint64_t> empty{};
+  REQUIRE(empty.update([](const std::uint64_t value) { return value + 1U; }) == 0U);
+
+  wh::core::versioned<std::uint64_t> counter{0U};
+  std::vector<std::thread> writers{};
+  for (int index = 0; index < 4; ++index) {
+    writers.emplace_back([&counter] {
+      for (int step = 0; step < 250; ++step) {
+        counter.update([](const std::uint64_t value) { return value + 1U; });
+      }
+    });
+  }
+  for (auto &writer : writers) {
+    writer.join();
+  }
+  REQUIRE(*counter.snapshot() == 1000U);
+
+  auto copy = counter;
+  REQUIRE(copy.snapshot().value == counter.snapshot().value);
+  const auto copied_version = copy.publish(7U);
+  REQUIRE(copied_version > counter.version());
+  REQUIRE(*counter.snapshot() == 1000U);
+}
@@ -0,0 +1,238 @@
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/flow/retrieval/parent_cache.hpp"
+
+namespace {
+
+using loaded_documents = wh::core::result<std::vector<wh::schema::document>>;
+
+[[nodiscard]] auto make_parent(const std::string &parent_id, const std::string &content)
+    -> wh::schema::document {
+  wh::schema::document document{content};
+  document.set_metadata(std::string{wh::flow::retrieval::parent_id_metadata_key}, parent_id);
+  return document;
+}
+
+struct counting_loader {
+  std::vector<std::vector<std::string>> *calls{nullptr};
+
+  auto operator()(const std::vector<std::string> &parent_ids) const -> loaded_documents {
+    calls->push_back(parent_ids);
+    std::vector<wh::schema::document> documents{};
+    for (const auto &parent_id : parent_ids) {
+      if (parent_id != "absent") {
+        documents.push_back(make_parent(parent_id, "doc:" + parent_id));
+      }
+    }
+    return documents;
+  }
+};
+
+} // namespace
+
+TEST_CASE("parent document cache loads misses once and shares cached documents",
+          "[UT][wh/flow/retrieval/parent_cache.hpp][parent_document_cache::get_or_load][branch]") {
+  wh::flow::retrieval::parent_document_cache cache{};
+  std::vector<std::vector<std::string>> calls{};
+  const counting_loader loader{.calls = &calls};
+
+  auto first = cache.get_or_load({"a", "b"}, loader);
+  REQUIRE(first.has_value());
+  REQUIRE(first.value().size() == 2U);
+  REQUIRE(first.value()[0]->content() == "doc:a");
+  REQUIRE(first.value()[1]->content() == "doc:b");
+
+  auto second = cache.get_or_load({"b", "c", "a"}, loader);
+  REQUIRE(second.has_value());
+  REQUIRE(second.value().size() == 3U);
+  REQUIRE(second.value()[0] == first.value()[1]);
+  REQUIRE(second.value()[1]->content() == "doc:c");
+  REQUIRE(second.value()[2] == first.value()[0]);
+
+  REQUIRE(calls.size() == 2U);
+  REQUIRE(calls[1] == std::vector<std::string>{"c"});
+  const auto stats = cache.stats();
+  REQUIRE(stats.hits == 2U);
+  REQUIRE(stats.misses == 3U);
+  REQUIRE(stats.entries == 3U);
+  REQUIRE(stats.bytes > 0U);
+}
+
+TEST_CASE("parent document cache skips absent ids and propagates loader failures",
+          "[UT][wh/flow/retrieval/parent_cache.hpp][parent_document_cache::get_or_load][branch]") {
+  wh::flow::retrieval::parent_document_cache cache{};
+  std::vector<std::vector<std::string>> calls{};
+  const counting_loader loader{.calls = &calls};
+
+  auto partial = cache.get_or_load({"absent", "a"}, loader);
+  REQUIRE(partial.has_value());
+  REQUIRE(partial.value().size() == 1U);
+  REQUIRE(partial.value()[0]->content() == "doc:a");
+  REQUIRE(cache.find("absent") == nullptr);
+
+  auto failed = cache.get_or_load({"a", "b"}, [](const std::vector<std::string> &) {
+    return loaded_documents::failure(wh::core::errc::network_error);
+  });
+  REQUIRE(failed.has_error());
+  REQUIRE(failed.error() == wh::core::errc::network_error);
+  REQUIRE(cache.find("b") == nullptr);
+
+  auto retried = cache.get_or_load({"b"}, loader);
+  REQUIRE(retried.has_value());
+  REQUIRE(retried.value().size() == 1U);
+}
+
+TEST_CASE("parent document cache evicts least recently used documents by size",
+          "[UT][wh/flow/retrieval/parent_cache.hpp][parent_document_cache::insert][boundary]") {
+  const auto one = wh::flow::retrieval::parent_document_bytes(make_parent("a", "xxxx"));
+  wh::flow::retrieval::parent_document_cache cache{{.max_bytes = one * 2U}};
+
+  REQUIRE(cache.insert(make_parent("a", "xxxx")) != nullptr);
+  REQUIRE(cache.insert(make_parent("b", "yyyy")) != nullptr);
+  REQUIRE(cache.find("a") != nullptr);
+  REQUIRE(cache.insert(make_parent("c", "zzzz")) != nullptr);
+
+  REQUIRE(cache.find("a") != nullptr);
+  REQUIRE(cache.find("b") == nullptr);
+  REQUIRE(cache.find("c") != nullptr);
+  REQUIRE(cache.stats().evictions == 1U);
+  REQUIRE(cache.stats().bytes == one * 2U);
+
+  auto oversized = cache.insert(make_parent("d", std::string(one * 4U, 'd')));
+  REQUIRE(oversized != nullptr);
+  REQUIRE(cache.find("d") == nullptr);
+  REQUIRE(cache.stats().entries == 2U);
+
+  auto unkeyed = cache.insert(wh::schema::document{"no parent"});
+  REQUIRE(unkeyed->content() == "no parent");
+  REQUIRE(cache.stats().entries == 2U);
+
+  cache.invalidate("a");
+  REQUIRE(cache.find("a") == nullptr);
+  cache.clear();
+  REQUIRE(cache.stats().entries == 0U);
+  REQUIRE(cache.stats().bytes == 0U);
+}
+
+TEST_CASE("parent document cache coalesces concurrent loads of the same ids",
+          "[UT][wh/flow/retrieval/"
+          "parent_cache.hpp][parent_document_cache::get_or_load][condition]") {
+  wh::flow::retrieval::parent_document_cache cache{};
+  std::atomic<int> loads{0};
+  std::atomic<bool> entered{false};
+  std::atomic<bool> release{false};
+
+  auto slow_loader = [&](const std::vector<std::string> &parent_ids) -> loaded_documents {
+    loads.fetch_add(1);
+    entered.store(true);
+    while (!release.load()) {
+      std::this_thread::yield();
+    }
+    std::vector<wh::schema::document> documents{};
+    for (const auto &parent_id : parent_ids) {
+      documents.push_back(make_parent(parent_id, "doc:" + parent_id));
+    }
+    return documents;
+  };
+
+  wh::flow::retrieval::shared_parent_document leader_document{};
+  std::thread leader{[&] {
+    auto loaded = cache.get_or_load({"a"}, slow_loader);
+    leader_document = loaded.value().front();
+  }};
+  while (!entered.load()) {
+    std::this_thread::yield();
+  }
+
+  wh::flow::retrieval::shared_parent_document follower_document{};
+  std::thread follower{[&] {
+    auto loaded = cache.get_or_load({"a"}, slow_loader);
+    follower_document = loaded.value().front();
+  }};
+  while (cache.stats().coalesced == 0U) {
+    std::this_thread::yield();
+  }
+  release.store(true);
+  leader.join();
+  follower.join();
+
+  REQUIRE(loads.load() == 1);
+  REQUIRE(leader_document != nullptr);
+  REQUIRE(leader_document == follower_document);
+}
+
+TEST_CASE("parent document cache parks callers on an in-flight load without blocking",
+          "[UT][wh/flow/retrieval/"
+          "parent_cache.hpp][parent_document_cache::get_or_load][condition]") {
+  using load_result = wh::flow::retrieval::parent_document_cache::load_result;
+  wh::flow::retrieval::parent_document_cache cache{};
+  std::vector<std::vector<std::string>> calls{};
+  const counting_loader loader{.calls = &calls};
+  std::optional<load_result> parked{};
+  bool parked_before_load_finished = false;
+  std::optional<load_result> leader{};
+
+  cache.get_or_load(
+      {"a", "b"},
+      [&](const std::vector<std::string> &parent_ids) {
+        // Another caller arrives while "a" is loading; it must return at once.
+        cache.get_or_load({"c", "a"}, loader,
+                          [&](load_result status) noexcept { parked.emplace(std::move(status)); });
+        parked_before_load_finished = !parked.has_value();
+        return loader(parent_ids);
+      },
+      [&](load_result status) noexcept { leader.emplace(std::move(status)); });
+
+  REQUIRE(parked_before_load_finished);
+  REQUIRE(leader.has_value());
+  REQUIRE(parked.has_value());
+  REQUIRE(parked->has_value());
+  REQUIRE(parked->value().size() == 2U);
+  REQUIRE(parked->value()[0]->content() == "doc:c");
+  REQUIRE(parked->value()[1] == leader->value()[0]);
+  REQUIRE(calls.size() == 2U);
+  REQUIRE(calls[0] == std::vector<std::string>{"c"});
+  REQUIRE(cache.stats().coalesced == 1U);
+}
+
+TEST_CASE("parent document cache fails parked callers when the loader throws",
+          "[UT][wh/flow/retrieval/parent_cache.hpp][parent_document_cache::get_or_load][branch]") {
+  using load_result = wh::flow::retrieval::parent_document_cache::load_result;
+  wh::flow::retrieval::parent_document_cache cache{};
+  std::vector<std::vector<std::string>> calls{};
+  const counting_loader loader{.calls = &calls};
+  std::optional<load_result> parked{};
+
+  auto thrown = cache.get_or_load({"a"}, [&](const std::vector<std::string> &) -> loaded_documents {
+    cache.get_or_load({"a"}, loader,
+                      [&](load_result status) noexcept { parked.emplace(std::move(status)); });
+    throw std::runtime_error{"store down"};
+  });
+  REQUIRE(thrown.has_error());
+  REQUIRE(thrown.error() == wh::core::errc::internal_error);
+  REQUIRE(parked.has_value());
+  REQUIRE(parked->has_error());
+  REQUIRE(parked->error() == wh::core::errc::internal_error);
+  REQUIRE(calls.empty());
+  REQUIRE(cache.get_or_load({"a"}, loader).has_value());
+}
+
+TEST_CASE("parent document cache does not cache loads invalidated in flight",
+          "[UT][wh/flow/retrieval/parent_cache.hpp][parent_document_cache::invalidate][branch]") {
+  wh::flow::retrieval::parent_document_cache cache{};
+  auto loaded = cache.get_or_load({"a"}, [&](const std::vector<std::string> &parent_ids) {
+    cache.invalidate(parent_ids.front());
+    return loaded_documents{std::vector<wh::schema::document>{make_parent("a", "stale")}};
+  });
+  REQUIRE(loaded.has_value());
+  REQUIRE(loaded.value().front()->content() == "stale");
+  REQUIRE(cache.find("a") == nullptr);
+}
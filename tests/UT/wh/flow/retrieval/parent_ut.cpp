@@ -1,3 +1,5 @@
+#include <cstddef>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 
@@ -106,3 +108,71 @@ TEST_CASE("retrieval parent helpers reject type mismatches and freeze idempotent
   auto second_freeze = flow.freeze();
   REQUIRE(second_freeze.has_value());
 }
+
+TEST_CASE("retrieval parent flow serves repeated parents from a shared cache",
+          "[UT][wh/flow/retrieval/parent.hpp][parent::retrieve][branch]") {
+  auto cache = std::make_shared<wh::flow::retrieval::parent_document_cache>();
+  auto loads = std::make_shared<std::size_t>(0U);
+  wh::flow::retrieval::parent flow{
+      wh::retriever::retriever{child_retriever_impl{}},
+      [loads](const std::vector<std::string> &parent_ids,
+              wh::core::run_context &) -> wh::core::result<std::vector<wh::schema::document>> {
+        *loads += parent_ids.size();
+        std::vector<wh::schema::document> documents{};
+        for (const auto &parent_id : parent_ids) {
+          wh::schema::document document{"doc:" + parent_id};
+          document.set_metadata(std::string{wh::flow::retrieval::parent_id_metadata_key},
+                                parent_id);
+          documents.push_back(std::move(document));
+        }
+        return documents;
+      },
+      cache};
+  REQUIRE(flow.freeze().has_value());
+
+  wh::retriever::retriever_request request{};
+  request.query = "hello";
+  wh::core::run_context context{};
+  for (int round = 0; round < 2; ++round) {
+    auto awaited = stdexec::sync_wait(flow.retrieve(request, context));
+    REQUIRE(awaited.has_value());
+    REQUIRE(std::get<0>(*awaited).has_value());
+    REQUIRE(std::get<0>(*awaited).value().size() == 2U);
+    REQUIRE(std::get<0>(*awaited).value()[0].content() == "doc:parent-a");
+    REQUIRE(std::get<0>(*awaited).value()[1].content() == "doc:parent-b");
+  }
+  REQUIRE(*loads == 2U);
+  REQUIRE(cache->stats().hits == 2U);
+  REQUIRE(cache->find("parent-a") != nullptr);
+}
+
+TEST_CASE("retrieval parent flow hands out cached parents without copying them",
+          "[UT][wh/flow/retrieval/parent.hpp][parent::async_retrieve_shared][branch]") {
+  auto cache = std::make_shared<wh::flow::retrieval::parent_document_cache>();
+  wh::flow::retrieval::parent flow{
+      wh::retriever::retriever{child_retriever_impl{}},
+      [](const std::vector<std::string> &parent_ids,
+         wh::core::run_context &) -> wh::core::result<std::vector<wh::schema::document>> {
+        std::vector<wh::schema::document> documents{};
+        for (const auto &parent_id : parent_ids) {
+          wh::schema::document document{"doc:" + parent_id};
+          document.set_metadata(std::string{wh::flow::retrieval::parent_id_metadata_key},
+                                parent_id);
+          documents.push_back(std::move(document));
+        }
+        return documents;
+      },
+      cache};
+  REQUIRE(flow.freeze().has_value());
+
+  wh::retriever::retriever_request request{};
+  request.query = "hello";
+  wh::core::run_context context{};
+  auto awaited = stdexec::sync_wait(flow.async_retrieve_shared(request, context));
+  REQUIRE(awaited.has_value());
+  REQUIRE(std::get<0>(*awaited).has_value());
+  const auto &shared = std::get<0>(*awaited).value();
+  REQUIRE(shared.size() == 2U);
+  REQUIRE(shared[0] == cache->find("parent-a"));
+  REQUIRE(shared[1] == cache->find("parent-b"));
+}
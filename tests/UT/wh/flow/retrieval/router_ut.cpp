@@ -2,6 +2,8 @@
 #include <tuple>
 #include <type_traits>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <stdexec/execution.hpp>
@@ -103,6 +105,45 @@ TEST_CASE("retrieval router succeeds when route policy selects one registered su
   REQUIRE(std::get<0>(*waited).value().front().content() == "left:hello");
 }
 
+TEST_CASE("retrieval router reloads retrievers while pinned requests keep their set",
+          "[UT][wh/flow/retrieval/router.hpp][router::reload_retrievers][branch][boundary]") {
+  using retriever_t = wh::retriever::retriever<routed_retriever_impl>;
+  using binding_list = std::vector<std::pair<std::string, retriever_t>>;
+
+  wh::flow::retrieval::router<retriever_t> router{};
+  REQUIRE(router.version() == 0U);
+  REQUIRE(router.reload_retrievers({}).error() == wh::core::errc::contract_violation);
+  REQUIRE(router.add_retriever("left", retriever_t{routed_retriever_impl{"left"}}).has_value());
+  REQUIRE(router.freeze().has_value());
+  REQUIRE(router.version() == 1U);
+
+  REQUIRE(router.reload_retrievers({}).error() == wh::core::errc::invalid_argument);
+  binding_list duplicate{};
+  duplicate.emplace_back("a", retriever_t{routed_retriever_impl{"a"}});
+  duplicate.emplace_back("a", retriever_t{routed_retriever_impl{"b"}});
+  REQUIRE(router.reload_retrievers(std::move(duplicate)).error() ==
+          wh::core::errc::already_exists);
+  REQUIRE(router.version() == 1U);
+
+  wh::retriever::retriever_request request{};
+  request.query = "hello";
+  wh::core::run_context context{};
+  auto in_flight = router.retrieve(request, context);
+
+  binding_list replacement{};
+  replacement.emplace_back("right", retriever_t{routed_retriever_impl{"right"}});
+  REQUIRE(router.reload_retrievers(std::move(replacement)).has_value());
+  REQUIRE(router.version() == 2U);
+
+  auto pinned = stdexec::sync_wait(std::move(in_flight));
+  REQUIRE(pinned.has_value());
+  REQUIRE(std::get<0>(*pinned).value().front().content() == "left:hello");
+  auto latest = stdexec::sync_wait(router.retrieve(request, context));
+  REQUIRE(latest.has_value());
+  REQUIRE(std::get<0>(*latest).value().size() == 1U);
+  REQUIRE(std::get<0>(*latest).value().front().content() == "right:hello");
+}
+
 TEST_CASE("retrieval router propagates route and fusion failures",
           "[UT][wh/flow/retrieval/router.hpp][router::retrieve][branch]") {
   using retriever_t = wh::retriever::retriever<routed_retriever_impl>;
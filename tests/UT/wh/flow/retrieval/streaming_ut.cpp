@@ -0,0 +1,144 @@
+#include <chrono>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/flow/retrieval/streaming.hpp"
+#include "wh/schema/stream/pipe.hpp"
+
+namespace {
+
+using document_pipe = decltype(wh::schema::stream::make_pipe_stream<wh::schema::document>(4U));
+using document_reader = std::tuple_element_t<1U, document_pipe>;
+using named_reader = wh::schema::stream::named_stream_reader<document_reader>;
+
+} // namespace
+
+TEST_CASE("streaming fusion emits provisional top-k on quorum and merges late routes",
+          "[UT][wh/flow/retrieval/streaming.hpp][streaming_fusion::emit][branch]") {
+  using clock = std::chrono::steady_clock;
+  wh::flow::retrieval::streaming_fusion<> fusion{
+      {"fast", "slow"},
+      {.top_k = 2U, .quorum = 1U, .late_results = wh::flow::retrieval::late_result_policy::merge}};
+  const auto now = clock::now();
+  fusion.arm(now);
+  REQUIRE_FALSE(fusion.ready(now));
+
+  REQUIRE(fusion.offer("fast", wh::schema::document{"a"}));
+  REQUIRE(fusion.offer("fast", wh::schema::document{"b"}));
+  REQUIRE(fusion.offer("fast", wh::schema::document{"c"}));
+  REQUIRE_FALSE(fusion.offer("unknown", wh::schema::document{"x"}));
+  fusion.finish("fast");
+  REQUIRE(fusion.ready(now));
+
+  auto provisional = fusion.emit();
+  REQUIRE(provisional.has_value());
+  REQUIRE(provisional.value().provisional);
+  REQUIRE(provisional.value().documents.size() == 2U);
+  REQUIRE(provisional.value().documents[0].content() == "a");
+  REQUIRE(provisional.value().finished_routes == std::vector<std::string>{"fast"});
+  REQUIRE_FALSE(fusion.ready(now));
+  REQUIRE_FALSE(fusion.done());
+
+  REQUIRE(fusion.offer("slow", wh::schema::document{"b"}));
+  fusion.finish("slow");
+  REQUIRE(fusion.ready(now));
+  auto final_result = fusion.emit();
+  REQUIRE(final_result.has_value());
+  REQUIRE_FALSE(final_result.value().provisional);
+  REQUIRE(final_result.value().documents[0].content() == "b");
+  REQUIRE(fusion.done());
+}
+
+TEST_CASE("streaming fusion deadline emits once and drops late documents by policy",
+          "[UT][wh/flow/retrieval/streaming.hpp][streaming_fusion::ready][condition][boundary]") {
+  using clock = std::chrono::steady_clock;
+  wh::flow::retrieval::streaming_fusion<> fusion{
+      {"x", "y"},
+      {.deadline = std::chrono::milliseconds{5},
+       .late_results = wh::flow::retrieval::late_result_policy::drop,
+       .per_route_limit = 1U}};
+  const auto now = clock::now();
+  fusion.arm(now);
+  REQUIRE(fusion.awaiting_deadline(now));
+  REQUIRE_FALSE(fusion.ready(now));
+  REQUIRE(fusion.ready(now + std::chrono::milliseconds{6}));
+
+  REQUIRE(fusion.offer("x", wh::schema::document{"q"}));
+  REQUIRE_FALSE(fusion.offer("x", wh::schema::document{"over-limit"}));
+  auto provisional = fusion.emit();
+  REQUIRE(provisional.has_value());
+  REQUIRE(provisional.value().provisional);
+  REQUIRE(provisional.value().documents.size() == 1U);
+  REQUIRE(fusion.done());
+  REQUIRE_FALSE(fusion.offer("y", wh::schema::document{"late"}));
+  REQUIRE(fusion.dropped() == 1U);
+}
+
+TEST_CASE("streaming fusion reader fuses merged routes and merges late results",
+          "[UT][wh/flow/retrieval/streaming.hpp][streaming_fusion_reader::read][branch]") {
+  auto [fast_writer, fast_reader] = wh::schema::stream::make_pipe_stream<wh::schema::document>(4U);
+  auto [slow_writer, slow_reader] = wh::schema::stream::make_pipe_stream<wh::schema::document>(4U);
+  REQUIRE(fast_writer.try_write(wh::schema::document{"a"}).has_value());
+  REQUIRE(fast_writer.try_write(wh::schema::document{"b"}).has_value());
+  REQUIRE(fast_writer.close().has_value());
+
+  std::vector<named_reader> routes{};
+  routes.push_back(named_reader{.source = "fast", .reader = std::move(fast_reader)});
+  routes.push_back(named_reader{.source = "slow", .reader = std::move(slow_reader)});
+  auto fused = wh::flow::retrieval::make_streaming_fusion_reader(
+      std::move(routes), {.top_k = 2U, .quorum = 1U});
+
+  auto provisional = fused.read();
+  REQUIRE(provisional.has_value());
+  REQUIRE(provisional.value().value.has_value());
+  REQUIRE(provisional.value().value->provisional);
+  REQUIRE(provisional.value().value->documents.size() == 2U);
+
+  auto pending = fused.try_read();
+  REQUIRE(std::holds_alternative<wh::schema::stream::stream_signal>(pending));
+
+  REQUIRE(slow_writer.try_write(wh::schema::document{"b"}).has_value());
+  REQUIRE(slow_writer.close().has_value());
+  auto final_result = fused.read();
+  REQUIRE(final_result.has_value());
+  REQUIRE(final_result.value().value.has_value());
+  REQUIRE_FALSE(final_result.value().value->provisional);
+  REQUIRE(final_result.value().value->documents[0].content() == "b");
+
+  auto eof = fused.read();
+  REQUIRE(eof.has_value());
+  REQUIRE(eof.value().is_terminal_eof());
+  REQUIRE(fused.is_closed());
+}
+
+TEST_CASE("streaming fusion reader emits on deadline and drops a stalled route",
+          "[UT][wh/flow/retrieval/streaming.hpp][streaming_fusion_reader::read][condition]") {
+  auto [fast_writer, fast_reader] = wh::schema::stream::make_pipe_stream<wh::schema::document>(4U);
+  auto [slow_writer, slow_reader] = wh::schema::stream::make_pipe_stream<wh::schema::document>(4U);
+  REQUIRE(fast_writer.try_write(wh::schema::document{"a"}).has_value());
+
+  std::vector<named_reader> routes{};
+  routes.push_back(named_reader{.source = "fast", .reader = std::move(fast_reader)});
+  routes.push_back(named_reader{.source = "slow", .reader = std::move(slow_reader)});
+  auto fused = wh::flow::retrieval::make_streaming_fusion_reader(
+      std::move(routes), {.deadline = std::chrono::milliseconds{2},
+                          .late_results = wh::flow::retrieval::late_result_policy::drop});
+
+  auto provisional = fused.read();
+  REQUIRE(provisional.has_value());
+  REQUIRE(provisional.value().value.has_value());
+  REQUIRE(provisional.value().value->provisional);
+  REQUIRE(provisional.value().value->documents.size() == 1U);
+  REQUIRE(provisional.value().value->finished_routes.empty());
+
+  auto eof = fused.read();
+  REQUIRE(eof.has_value());
+  REQUIRE(eof.value().is_terminal_eof());
+  static_cast<void>(slow_writer.close());
+  static_cast<void>(fast_writer.close());
+}
@@ -225,3 +225,112 @@ TEST_CASE("internal callback manager copy preserves snapshots and isolates "
 
   REQUIRE(*seen == std::vector<int>{10, 1, 20, 10, 2, 1});
 }
+
+TEST_CASE("internal callback manager publishes per-stage registration masks",
+          "[UT][wh/internal/callbacks.hpp][callback_manager::has_stage][condition][boundary]") {
+  wh::internal::callback_manager manager{};
+  REQUIRE(manager.empty());
+  REQUIRE(manager.registered_stages() == 0U);
+  REQUIRE_FALSE(manager.has_stage(wh::core::callback_stage::start));
+
+  wh::core::stage_callbacks local{};
+  local.on_end = [](const wh::core::callback_stage, const wh::core::callback_event_view,
+                    const wh::core::callback_run_info &) {};
+  local.on_error = [](const wh::core::callback_stage, const wh::core::callback_event_view,
+                      const wh::core::callback_run_info &) {};
+  manager.register_local_callbacks(
+      wh::internal::make_callback_config([](const wh::core::callback_stage stage) noexcept {
+        return stage == wh::core::callback_stage::end;
+      }),
+      std::move(local));
+  REQUIRE_FALSE(manager.empty());
+  REQUIRE(manager.has_stage(wh::core::callback_stage::end));
+  REQUIRE_FALSE(manager.has_stage(wh::core::callback_stage::error));
+  REQUIRE_FALSE(manager.has_stage(wh::core::callback_stage::start));
+
+  int started = 0;
+  wh::core::stage_callbacks global{};
+  global.on_start = [&started](const wh::core::callback_stage,
+                               const wh::core::callback_event_view,
+                               const wh::core::callback_run_info &) { ++started; };
+  manager.register_global_callbacks(
+      wh::internal::make_callback_config([](const wh::core::callback_stage) noexcept {
+        return true;
+      }),
+      std::move(global));
+  REQUIRE(manager.has_stage(wh::core::callback_stage::start));
+  REQUIRE_FALSE(manager.has_stage(wh::core::callback_stage::stream_end));
+
+  const auto copied = manager;
+  REQUIRE(copied.registered_stages() == manager.registered_stages());
+
+  int payload = 1;
+  copied.dispatch(wh::core::callback_stage::start, wh::core::make_callback_event_view(payload),
+                  {});
+  copied.dispatch(wh::core::callback_stage::stream_end,
+                  wh::core::make_callback_event_view(payload), {});
+  REQUIRE(started == 1);
+}
+
+TEST_CASE("internal callback manager applies shared run sampling decisions",
+          "[UT][wh/internal/callbacks.hpp][callback_manager::finish_sampled_run][branch]") {
+  wh::internal::callback_manager manager{};
+  auto seen = std::make_shared<std::vector<wh::core::callback_stage>>();
+  wh::core::stage_callbacks callbacks{};
+  const auto record = [seen](const wh::core::callback_stage stage,
+                             const wh::core::callback_event_view,
+                             const wh::core::callback_run_info &) { seen->push_back(stage); };
+  callbacks.on_start = record;
+  callbacks.on_error = record;
+  manager.register_local_callbacks(
+      wh::internal::make_callback_config([](const wh::core::callback_stage) noexcept {
+        return true;
+      }),
+      std::move(callbacks));
+  const auto all_stages = manager.registered_stages();
+  int payload = 1;
+
+  SECTION("dropped runs keep error stage only") {
+    manager.set_sampler(std::make_shared<wh::core::callback_trace_sampler>(
+        wh::core::callback_sampling_decision::dropped));
+    REQUIRE(manager.dispatched_stages() ==
+            wh::internal::callback_manager::stage_bit(wh::core::callback_stage::error));
+    const auto copied = manager;
+    copied.dispatch(wh::core::callback_stage::start, wh::core::make_callback_event_view(payload),
+                    {});
+    copied.dispatch(wh::core::callback_stage::error, wh::core::make_callback_event_view(payload),
+                    {});
+    REQUIRE(*seen == std::vector<wh::core::callback_stage>{wh::core::callback_stage::error});
+    REQUIRE(manager.finish_sampled_run(false) == 0U);
+    REQUIRE(manager.sampler() == nullptr);
+    REQUIRE(manager.dispatched_stages() == all_stages);
+  }
+
+  SECTION("tail runs replay through copied managers after they are gone") {
+    manager.set_sampler(std::make_shared<wh::core::callback_trace_sampler>(
+        wh::core::callback_sampling_decision::tail,
+        wh::core::callback_sampling_options{.tail_sampling = true}));
+    REQUIRE(manager.dispatched_stages() == all_stages);
+    {
+      auto child = manager;
+      child.dispatch(wh::core::callback_stage::start, wh::core::make_callback_event_view(payload),
+                     {});
+      wh::core::stage_callbacks late{};
+      late.on_start = [seen](const wh::core::callback_stage, const wh::core::callback_event_view,
+                             const wh::core::callback_run_info &) {
+        seen->push_back(wh::core::callback_stage::stream_start);
+      };
+      child.register_local_callbacks(
+          wh::internal::make_callback_config([](const wh::core::callback_stage) noexcept {
+            return true;
+          }),
+          std::move(late));
+      child.dispatch(wh::core::callback_stage::error, wh::core::make_callback_event_view(payload),
+                     {});
+    }
+    REQUIRE(seen->empty());
+    REQUIRE(manager.finish_sampled_run(false) == 2U);
+    REQUIRE(*seen == std::vector<wh::core::callback_stage>{wh::core::callback_stage::start,
+                                                           wh::core::callback_stage::error});
+  }
+}
@@ -1,5 +1,8 @@
 #include <array>
 #include <span>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -103,3 +106,83 @@ TEST_CASE(
   REQUIRE(frozen.has_error());
   REQUIRE(frozen.error() == wh::core::errc::contract_violation);
 }
+
+TEST_CASE("stream concat registry owned concat moves chunks and keeps adl fallback",
+          "[UT][wh/internal/concat.hpp][stream_concat_registry::concat_owned][branch][boundary]") {
+  wh::internal::stream_concat_registry registry{};
+  REQUIRE(registry
+              .register_owned_concat<std::string>(
+                  [](const std::span<std::string> values) -> wh::core::result<std::string> {
+                    auto joined = std::move(values.front());
+                    for (const auto &value : values.subspan(1U)) {
+                      joined += value;
+                    }
+                    return joined;
+                  })
+              .has_value());
+
+  std::array chunks = {wh::core::any{std::string(64U, 'a')}, wh::core::any{std::string{"b"}}};
+  auto joined = registry.concat_owned(wh::core::any_type_key_v<std::string>, chunks);
+  REQUIRE(joined.has_value());
+  REQUIRE(wh::core::any_cast<std::string>(&joined.value())->size() == 65U);
+  REQUIRE(wh::core::any_cast<std::string>(&chunks[0])->empty());
+
+  std::array typed_chunks = {std::string{"x"}, std::string{"y"}};
+  auto typed = registry.concat_owned_as<std::string>(typed_chunks);
+  REQUIRE(typed.has_value());
+  REQUIRE(typed.value() == "xy");
+
+  std::array adl_values = {adl_concat_value{2}, adl_concat_value{3}};
+  auto adl = registry.concat_owned_as<adl_concat_value>(adl_values);
+  REQUIRE(adl.has_value());
+  REQUIRE(adl.value().value == 5);
+
+  std::array singleton = {wh::core::any{7}};
+  auto single = registry.concat_owned(wh::core::any_type_key_v<int>, singleton);
+  REQUIRE(single.has_value());
+  REQUIRE(*wh::core::any_cast<int>(&single.value()) == 7);
+
+  auto mismatch = registry.concat_owned(wh::core::any_type_key_v<double>, singleton);
+  REQUIRE(mismatch.has_error());
+  REQUIRE(mismatch.error() == wh::core::errc::type_mismatch);
+
+  std::array unsupported = {wh::core::any{1}, wh::core::any{2}};
+  auto no_handler = registry.concat_owned(wh::core::any_type_key_v<int>, unsupported);
+  REQUIRE(no_handler.has_error());
+  REQUIRE(no_handler.error() == wh::core::errc::not_supported);
+
+  auto empty = registry.concat_owned(wh::core::any_type_key_v<int>,
+                                     wh::internal::dynamic_owned_stream_chunks{});
+  REQUIRE(empty.has_error());
+  REQUIRE(empty.error() == wh::core::errc::invalid_argument);
+}
+
+TEST_CASE("stream concat registry accumulators fold chunks and back batch concat",
+          "[UT][wh/internal/concat.hpp][stream_concat_registry::begin_concat][branch]") {
+  wh::internal::stream_concat_registry registry{};
+  REQUIRE(registry.register_concat_accumulator<std::string>(wh::internal::string_accumulate{})
+              .has_value());
+
+  auto begun = registry.begin_concat(wh::core::any_type_key_v<std::string>);
+  REQUIRE(begun.has_value());
+  auto accumulator = std::move(begun).value();
+  REQUIRE(accumulator.append(wh::core::any{std::string{"a"}}).has_value());
+  REQUIRE(accumulator.append(wh::core::any{std::string{"b"}}).has_value());
+  REQUIRE(*accumulator.partial_as<std::string>() == "ab");
+
+  const std::array chunks = {wh::core::any{std::string{"x"}}, wh::core::any{std::string{"y"}}};
+  auto joined = registry.concat(wh::core::any_type_key_v<std::string>, chunks);
+  REQUIRE(joined.has_value());
+  REQUIRE(*wh::core::any_cast<std::string>(&joined.value()) == "xy");
+
+  std::array owned = {wh::core::any{std::string{"p"}}, wh::core::any{std::string{"q"}}};
+  auto owned_joined = registry.concat_owned(wh::core::any_type_key_v<std::string>, owned);
+  REQUIRE(owned_joined.has_value());
+  REQUIRE(*wh::core::any_cast<std::string>(&owned_joined.value()) == "pq");
+
+  registry.freeze();
+  auto frozen = registry.register_concat_accumulator<std::vector<int>>(
+      wh::internal::vector_accumulate{});
+  REQUIRE(frozen.has_error());
+  REQUIRE(frozen.error() == wh::core::errc::contract_violation);
+}
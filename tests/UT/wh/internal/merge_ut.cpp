@@ -1,6 +1,8 @@
 #include <array>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -89,3 +91,77 @@ TEST_CASE(
   REQUIRE(frozen.has_error());
   REQUIRE(frozen.error() == wh::core::errc::contract_violation);
 }
+
+TEST_CASE("values merge registry owned merges move pending inputs",
+          "[UT][wh/internal/merge.hpp][values_merge_registry::merge_owned_as][branch][boundary]") {
+  using string_list = std::vector<std::string>;
+  wh::internal::values_merge_registry registry{};
+  REQUIRE(registry
+              .register_owned_merge<string_list>(
+                  [](const std::span<string_list> values) -> wh::core::result<string_list> {
+                    auto merged = std::move(values.front());
+                    for (auto &value : values.subspan(1U)) {
+                      merged.insert(merged.end(), std::make_move_iterator(value.begin()),
+                                    std::make_move_iterator(value.end()));
+                    }
+                    return merged;
+                  })
+              .has_value());
+
+  std::array typed_values = {string_list{"a"}, string_list{"b", "c"}};
+  auto typed = registry.merge_owned_as<string_list>(typed_values);
+  REQUIRE(typed.has_value());
+  REQUIRE(typed.value() == string_list{"a", "b", "c"});
+  REQUIRE(typed_values[0].empty());
+
+  std::array dynamic_values = {wh::core::any{string_list{"x"}}, wh::core::any{string_list{"y"}}};
+  auto dynamic = registry.merge_owned(wh::core::any_type_key_v<string_list>, dynamic_values);
+  REQUIRE(dynamic.has_value());
+  REQUIRE(*wh::core::any_cast<string_list>(&dynamic.value()) == string_list{"x", "y"});
+
+  const std::array shared_values = {string_list{"s"}, string_list{"t"}};
+  auto shared = registry.merge_as<string_list>(shared_values);
+  REQUIRE(shared.has_value());
+  REQUIRE(shared.value() == string_list{"s", "t"});
+  REQUIRE(shared_values[0] == string_list{"s"});
+
+  std::array singleton = {std::string{"only"}};
+  auto single = registry.merge_owned_as<std::string>(singleton);
+  REQUIRE(single.has_value());
+  REQUIRE(single.value() == "only");
+
+  auto empty = registry.merge_owned_as<std::string>(std::span<std::string>{});
+  REQUIRE(empty.has_error());
+  REQUIRE(empty.error() == wh::core::errc::invalid_argument);
+
+  std::array unsupported = {std::string{"a"}, std::string{"b"}};
+  auto no_handler = registry.merge_owned_as<std::string>(unsupported);
+  REQUIRE(no_handler.has_error());
+  REQUIRE(no_handler.error() == wh::core::errc::not_supported);
+}
+
+TEST_CASE("values merge registry accumulators merge values as they arrive",
+          "[UT][wh/internal/merge.hpp][values_merge_registry::begin_merge][branch]") {
+  using int_list = std::vector<int>;
+  wh::internal::values_merge_registry registry{};
+  REQUIRE(registry.register_merge_accumulator<int_list>(wh::internal::vector_accumulate{})
+              .has_value());
+
+  auto begun = registry.begin_merge(wh::core::any_type_key_v<int_list>);
+  REQUIRE(begun.has_value());
+  auto accumulator = std::move(begun).value();
+  REQUIRE(accumulator.append(wh::core::any{int_list{1}}).has_value());
+  REQUIRE(accumulator.append(wh::core::any{int_list{2, 3}}).has_value());
+  auto merged = accumulator.finish();
+  REQUIRE(merged.has_value());
+  REQUIRE(*wh::core::any_cast<int_list>(&merged.value()) == int_list{1, 2, 3});
+
+  const std::array values = {wh::core::any{int_list{4}}, wh::core::any{int_list{5}}};
+  auto batch = registry.merge(wh::core::any_type_key_v<int_list>, values);
+  REQUIRE(batch.has_value());
+  REQUIRE(*wh::core::any_cast<int_list>(&batch.value()) == int_list{4, 5});
+
+  auto unsupported = registry.begin_merge(wh::core::any_type_key_v<int>);
+  REQUIRE(unsupported.has_error());
+  REQUIRE(unsupported.error() == wh::core::errc::not_supported);
+}
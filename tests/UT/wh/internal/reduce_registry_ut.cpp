@@ -1,10 +1,36 @@
+#include <array>
+#include <cstddef>
 #include <span>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include "wh/internal/reduce_registry.hpp"
 
+namespace {
+
+struct copy_counted {
+  static inline std::size_t copies{0U};
+
+  std::string text{};
+
+  copy_counted() = default;
+  explicit copy_counted(std::string value) : text(std::move(value)) {}
+  copy_counted(const copy_counted &other) : text(other.text) { ++copies; }
+  copy_counted(copy_counted &&) noexcept = default;
+  auto operator=(const copy_counted &other) -> copy_counted & {
+    text = other.text;
+    ++copies;
+    return *this;
+  }
+  auto operator=(copy_counted &&) noexcept -> copy_counted & = default;
+  ~copy_counted() = default;
+};
+
+} // namespace
+
 TEST_CASE("reduce registry registers typed reducers and bridges dynamic reduction",
           "[UT][wh/internal/"
           "reduce_registry.hpp][reduce_registry_core::register_reducer][branch][boundary]") {
@@ -80,3 +106,182 @@ TEST_CASE("reduce registry reports empty and unsupported dynamic reduction reque
   REQUIRE(no_handler.has_error());
   REQUIRE(no_handler.error() == wh::core::errc::not_supported);
 }
+
+TEST_CASE("reduce registry owned reducers move inputs and copy only shared inputs",
+          "[UT][wh/internal/"
+          "reduce_registry.hpp][reduce_registry_core::register_owned_reducer][branch]") {
+  wh::internal::reduce_registry_core registry{};
+  auto registered = registry.register_owned_reducer<copy_counted>(
+      [](const std::span<copy_counted> values) -> wh::core::result<copy_counted> {
+        auto joined = std::move(values.front());
+        for (auto &value : values.subspan(1U)) {
+          joined.text += value.text;
+        }
+        return joined;
+      });
+  REQUIRE(registered.has_value());
+  REQUIRE(registry.find_owned(wh::core::any_type_key_v<copy_counted>) != nullptr);
+  REQUIRE(registry.find_typed_owned<copy_counted>() != nullptr);
+  REQUIRE(registry.find_typed<copy_counted>() != nullptr);
+
+  std::array owned = {wh::core::any{copy_counted{"a"}}, wh::core::any{copy_counted{"b"}}};
+  copy_counted::copies = 0U;
+  auto moved = registry.reduce_owned(wh::core::any_type_key_v<copy_counted>, owned);
+  REQUIRE(moved.has_value());
+  REQUIRE(wh::core::any_cast<copy_counted>(&moved.value())->text == "ab");
+  REQUIRE(copy_counted::copies == 0U);
+
+  const std::array shared = {wh::core::any{copy_counted{"c"}}, wh::core::any{copy_counted{"d"}}};
+  copy_counted::copies = 0U;
+  auto copied = registry.reduce(wh::core::any_type_key_v<copy_counted>, shared);
+  REQUIRE(copied.has_value());
+  REQUIRE(wh::core::any_cast<copy_counted>(&copied.value())->text == "cd");
+  REQUIRE(copy_counted::copies == 2U);
+  REQUIRE(wh::core::any_cast<copy_counted>(&shared[0])->text == "c");
+
+  auto duplicate = registry.register_reducer<copy_counted>(
+      [](std::span<const copy_counted>) -> wh::core::result<copy_counted> { return {}; });
+  REQUIRE(duplicate.has_error());
+  REQUIRE(duplicate.error() == wh::core::errc::already_exists);
+}
+
+TEST_CASE("reduce registry owned path moves inputs into const reducers",
+          "[UT][wh/internal/"
+          "reduce_registry.hpp][reduce_registry_core::reduce_owned][condition][branch][boundary]") {
+  wh::internal::reduce_registry_core registry{};
+  REQUIRE(registry
+              .register_reducer<copy_counted>(
+                  [](const std::span<const copy_counted> values) -> wh::core::result<copy_counted> {
+                    return copy_counted{std::to_string(values.size())};
+                  })
+              .has_value());
+  REQUIRE(registry
+              .register_reducer_from_ptrs<int>(
+                  [](const std::span<const int *> values) -> wh::core::result<int> {
+                    return static_cast<int>(values.size());
+                  })
+              .has_value());
+
+  std::array owned = {wh::core::any{copy_counted{"a"}}, wh::core::any{copy_counted{"b"}}};
+  copy_counted::copies = 0U;
+  auto reduced = registry.reduce_owned(wh::core::any_type_key_v<copy_counted>, owned);
+  REQUIRE(reduced.has_value());
+  REQUIRE(wh::core::any_cast<copy_counted>(&reduced.value())->text == "2");
+  REQUIRE(copy_counted::copies == 0U);
+
+  std::array pointers = {wh::core::any{1}, wh::core::any{2}, wh::core::any{3}};
+  auto counted = registry.reduce_owned(wh::core::any_type_key_v<int>, pointers);
+  REQUIRE(counted.has_value());
+  REQUIRE(*wh::core::any_cast<int>(&counted.value()) == 3);
+
+  std::array mixed = {wh::core::any{copy_counted{"a"}}, wh::core::any{1}};
+  auto mismatch = registry.reduce_owned(wh::core::any_type_key_v<copy_counted>, mixed);
+  REQUIRE(mismatch.has_error());
+  REQUIRE(mismatch.error() == wh::core::errc::type_mismatch);
+
+  auto empty = registry.reduce_owned(wh::core::any_type_key_v<int>,
+                                     wh::internal::dynamic_reduce_owned_values{});
+  REQUIRE(empty.has_error());
+  REQUIRE(empty.error() == wh::core::errc::invalid_argument);
+
+  auto unsupported = registry.reduce_owned(wh::core::any_type_key_v<double>, pointers);
+  REQUIRE(unsupported.has_error());
+  REQUIRE(unsupported.error() == wh::core::errc::not_supported);
+}
+
+TEST_CASE("reduce registry accumulators fold chunks incrementally and expose partials",
+          "[UT][wh/internal/"
+          "reduce_registry.hpp][reduce_registry_core::begin][condition][branch][boundary]") {
+  wh::internal::reduce_registry_core registry{};
+  int finished_count = 0;
+  REQUIRE(registry
+              .register_accumulator<std::string>(
+                  wh::internal::string_accumulate{},
+                  [&finished_count](std::string &) -> wh::core::result<void> {
+                    ++finished_count;
+                    return {};
+                  })
+              .has_value());
+  auto duplicate = registry.register_accumulator<std::string>(wh::internal::string_accumulate{});
+  REQUIRE(duplicate.has_error());
+  REQUIRE(duplicate.error() == wh::core::errc::already_exists);
+  auto invalid = registry.register_accumulator<int>(nullptr);
+  REQUIRE(invalid.has_error());
+  REQUIRE(invalid.error() == wh::core::errc::invalid_argument);
+
+  auto begun = registry.begin(wh::core::any_type_key_v<std::string>);
+  REQUIRE(begun.has_value());
+  auto accumulator = std::move(begun).value();
+  REQUIRE_FALSE(accumulator.partial().has_value());
+  REQUIRE(accumulator.partial_as<std::string>() == nullptr);
+  REQUIRE(accumulator.append(wh::core::any{std::string{"he"}}).has_value());
+  const wh::core::any shared{std::string{"llo"}};
+  REQUIRE(accumulator.append_copy(shared).has_value());
+  REQUIRE(*accumulator.partial_as<std::string>() == "hello");
+  REQUIRE(accumulator.count() == 2U);
+
+  auto mismatch = accumulator.append(wh::core::any{1});
+  REQUIRE(mismatch.has_error());
+  REQUIRE(mismatch.error() == wh::core::errc::type_mismatch);
+
+  auto finished = accumulator.finish();
+  REQUIRE(finished.has_value());
+  REQUIRE(*wh::core::any_cast<std::string>(&finished.value()) == "hello");
+  REQUIRE(finished_count == 1);
+  auto drained = accumulator.finish();
+  REQUIRE(drained.has_error());
+  REQUIRE(drained.error() == wh::core::errc::invalid_argument);
+
+  const std::array chunks = {wh::core::any{std::string{"a"}}, wh::core::any{std::string{"b"}}};
+  auto folded = registry.reduce(wh::core::any_type_key_v<std::string>, chunks);
+  REQUIRE(folded.has_value());
+  REQUIRE(*wh::core::any_cast<std::string>(&folded.value()) == "ab");
+  REQUIRE(registry.size() == 0U);
+
+  auto unsupported = registry.begin(wh::core::any_type_key_v<double>);
+  REQUIRE(unsupported.has_error());
+  REQUIRE(unsupported.error() == wh::core::errc::not_supported);
+
+  wh::internal::dynamic_reduce_accumulator detached{};
+  auto detached_append = detached.append(wh::core::any{1});
+  REQUIRE(detached_append.has_error());
+  REQUIRE(detached_append.error() == wh::core::errc::contract_violation);
+}
+
+TEST_CASE("reduce registry begin falls back to one reducer call over buffered chunks",
+          "[UT][wh/internal/reduce_registry.hpp][reduce_registry_core::begin][branch]") {
+  wh::internal::reduce_registry_core registry{};
+  int reduce_calls = 0;
+  auto registered = registry.register_reducer<int>(
+      [&reduce_calls](const std::span<const int> values) -> wh::core::result<int> {
+        ++reduce_calls;
+        int sum = 0;
+        for (const auto value : values) {
+          sum += value;
+        }
+        return sum;
+      });
+  REQUIRE(registered.has_value());
+  REQUIRE(registry.register_accumulator<std::vector<int>>(wh::internal::vector_accumulate{})
+              .has_value());
+
+  auto begun = registry.begin(wh::core::any_type_key_v<int>);
+  REQUIRE(begun.has_value());
+  auto accumulator = std::move(begun).value();
+  for (int value = 1; value <= 4; ++value) {
+    REQUIRE(accumulator.append(wh::core::any{value}).has_value());
+    REQUIRE(accumulator.partial_as<int>() == nullptr);
+  }
+  REQUIRE(accumulator.count() == 4U);
+  REQUIRE(reduce_calls == 0);
+  auto finished = accumulator.finish();
+  REQUIRE(finished.has_value());
+  REQUIRE(*wh::core::any_cast<int>(&finished.value()) == 10);
+  REQUIRE(reduce_calls == 1);
+  REQUIRE(accumulator.count() == 0U);
+
+  std::array vectors = {wh::core::any{std::vector<int>{1}}, wh::core::any{std::vector<int>{2, 3}}};
+  auto joined = registry.reduce_owned(wh::core::any_type_key_v<std::vector<int>>, vectors);
+  REQUIRE(joined.has_value());
+  REQUIRE(*wh::core::any_cast<std::vector<int>>(&joined.value()) == std::vector<int>{1, 2, 3});
+}
@@ -0,0 +1,85 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/retriever/filter.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_document() -> wh::schema::document {
+  wh::schema::document document{"release notes"};
+  document.with_score(0.75).with_sub_index("docs");
+  document.set_metadata("lang", "zh");
+  document.set_metadata("year", std::int64_t{2024});
+  document.set_metadata("draft", false);
+  document.set_metadata("path", "guides/install.md");
+  document.set_metadata("tags", std::vector<std::string>{"cpp", "retrieval"});
+  return document;
+}
+
+} // namespace
+
+TEST_CASE("filter expressions combine typed comparisons with boolean operators",
+          "[UT][wh/retriever/filter.hpp][parse_filter_expression][condition][branch]") {
+  const auto document = make_document();
+  auto matches = [&](const std::string_view expression) -> bool {
+    auto program = wh::retriever::parse_filter_expression(expression);
+    REQUIRE(program.has_value());
+    return program.value().matches(document);
+  };
+
+  REQUIRE(matches("lang = zh AND year >= 2024"));
+  REQUIRE(matches("lang == 'en' || year > 2020"));
+  REQUIRE_FALSE(matches("lang = zh and not draft = false"));
+  REQUIRE(matches("!(year < 2000) && score > 0.5"));
+  REQUIRE(matches("lang IN (en, \"zh\") AND tags in (go, cpp)"));
+  REQUIRE(matches("path ^= guides/ and sub_index = docs"));
+  REQUIRE(matches("path prefix 'guides' and tags ^= ret"));
+  REQUIRE_FALSE(matches("missing = 1 or missing >= 0"));
+  REQUIRE(matches("missing != 1"));
+  REQUIRE_FALSE(matches("year < abc"));
+  REQUIRE(matches("content = 'release notes'"));
+}
+
+TEST_CASE("filter programs flatten to postfix instructions for index pushdown",
+          "[UT][wh/retriever/filter.hpp][filter_program::instructions][boundary]") {
+  const wh::retriever::filter_program empty{};
+  REQUIRE(empty.empty());
+  REQUIRE(empty.matches(wh::schema::document{}));
+
+  auto program = wh::retriever::parse_filter_expression("a = 1 and (b = 2 or not c = 3)");
+  REQUIRE(program.has_value());
+  const auto code = program.value().instructions();
+  REQUIRE(code.size() == 6U);
+  REQUIRE(code[0].opcode == wh::retriever::filter_opcode::equal);
+  REQUIRE(code[0].operands.front().kind == wh::retriever::filter_literal_kind::integer);
+  REQUIRE(code[3].opcode == wh::retriever::filter_opcode::logical_not);
+  REQUIRE(code[4].opcode == wh::retriever::filter_opcode::logical_or);
+  REQUIRE(code[5].opcode == wh::retriever::filter_opcode::logical_and);
+  REQUIRE(program.value().max_depth() == 3U);
+
+  REQUIRE(wh::retriever::parse_filter_expression("  ").value().empty());
+  REQUIRE(wh::retriever::parse_filter_expression("a = 'open").has_error());
+  REQUIRE(wh::retriever::parse_filter_expression("(a = 1").has_error());
+  REQUIRE(wh::retriever::parse_filter_expression("a in ()").has_error());
+  REQUIRE(wh::retriever::parse_filter_expression("a & b").has_error());
+  REQUIRE(wh::retriever::parse_filter_expression(std::string(200U, '(')).has_error());
+}
+
+TEST_CASE("compile_filter keeps the legacy key=value and substring forms",
+          "[UT][wh/retriever/filter.hpp][compile_filter][condition][boundary]") {
+  const auto document = make_document();
+  REQUIRE(wh::retriever::compile_filter("lang=zh").matches(document));
+  REQUIRE(wh::retriever::compile_filter("year=2024").matches(document));
+  REQUIRE(wh::retriever::compile_filter("notes").matches(document));
+  REQUIRE_FALSE(wh::retriever::compile_filter("absent text").matches(document));
+  REQUIRE(wh::retriever::compile_filter("content=release notes").matches(document));
+  REQUIRE_FALSE(wh::retriever::compile_filter("=zh").matches(document));
+  REQUIRE(wh::retriever::compile_filter("").empty());
+
+  const wh::schema::document bare{"body"};
+  REQUIRE(wh::retriever::compile_filter("dsl=").matches(bare));
+  REQUIRE_FALSE(wh::retriever::compile_filter("lang=zh").matches(bare));
+}
@@ -1,3 +1,6 @@
+#include <cstdint>
+#include <memory>
+#include <string>
 #include <tuple>
 
 #include <catch2/catch_test_macros.hpp>
@@ -28,6 +31,41 @@ struct async_retriever_impl {
   }
 };
 
+/// Applies the compiled request filter before truncating, like an index would.
+struct pushdown_retriever_impl {
+  static constexpr bool filter_pushdown = true;
+
+  [[nodiscard]] auto retrieve(const wh::retriever::retriever_request &request) const
+      -> wh::retriever::detail::retriever_result {
+    const auto filter = wh::retriever::request_filter(request);
+    wh::retriever::retriever_response output{};
+    for (int index = 0; index < 8; ++index) {
+      wh::schema::document document{"doc-" + std::to_string(index)};
+      document.with_score(0.9);
+      document.set_metadata("rank", std::int64_t{index});
+      if (filter->matches(document)) {
+        output.push_back(std::move(document));
+      }
+    }
+    return output;
+  }
+};
+
+struct described_retriever_impl {
+  [[nodiscard]] auto descriptor() const -> wh::core::component_descriptor {
+    return wh::core::component_descriptor{"RetrieverUtCustom",
+                                          wh::core::component_kind::retriever};
+  }
+
+  [[nodiscard]] auto retrieve(const wh::retriever::retriever_request &request) const
+      -> wh::retriever::detail::retriever_result {
+    return wh::retriever::retriever_response{wh::schema::document{request.query}};
+  }
+};
+
+static_assert(wh::retriever::filter_pushdown_retriever<pushdown_retriever_impl>);
+static_assert(!wh::retriever::filter_pushdown_retriever<sync_retriever_impl>);
+
 } // namespace
 
 TEST_CASE("retriever wrapper applies response policy filters on sync outputs",
@@ -106,3 +144,42 @@ TEST_CASE("retriever detail filters dedupes truncates and exposes callback state
   REQUIRE(applied.value().size() == 1U);
   REQUIRE(applied.value().front().content() == "same");
 }
+
+TEST_CASE("retriever wrapper skips post-filtering for pushdown implementations",
+          "[UT][wh/retriever/retriever.hpp][filter_pushdown_retriever][condition][branch]") {
+  wh::retriever::retriever wrapped{pushdown_retriever_impl{}};
+  wh::retriever::retriever_request request{};
+  request.options.set_base(wh::retriever::retriever_common_options{
+      .top_k = 3U,
+      .filter = "rank >= 4 and rank != 5",
+  });
+  REQUIRE(wh::retriever::detail::make_response_policy(request, true).filter == nullptr);
+  REQUIRE(wh::retriever::detail::make_response_policy(request).filter != nullptr);
+
+  request.compiled_filter = wh::retriever::request_filter(request);
+  REQUIRE(wh::retriever::request_filter(request) == request.compiled_filter);
+
+  wh::core::run_context context{};
+  auto output = wrapped.retrieve(request, context);
+  REQUIRE(output.has_value());
+  REQUIRE(output.value().size() == 3U);
+  REQUIRE(output.value().front().content() == "doc-4");
+  REQUIRE(output.value().back().content() == "doc-7");
+}
+
+TEST_CASE("retriever records call metrics under the implementation descriptor",
+          "[UT][wh/retriever/retriever.hpp][retriever::descriptor][branch]") {
+  wh::retriever::retriever wrapped{described_retriever_impl{}};
+  REQUIRE(wrapped.descriptor().type_name == "RetrieverUtCustom");
+  REQUIRE(wh::retriever::retriever{sync_retriever_impl{}}.descriptor().type_name == "Retriever");
+
+  const auto metrics = wh::core::component_call_metrics_for(wrapped.descriptor());
+  REQUIRE(metrics.calls != nullptr);
+  const auto before = metrics.calls->value();
+
+  wh::retriever::retriever_request request{};
+  request.query = "q";
+  wh::core::run_context context{};
+  REQUIRE(wrapped.retrieve(request, context).has_value());
+  REQUIRE(metrics.calls->value() == before + 1U);
+}
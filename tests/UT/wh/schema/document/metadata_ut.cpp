@@ -0,0 +1,83 @@
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/schema/document/metadata.hpp"
+
+TEST_CASE("document metadata keeps reserved keys in leading slots",
+          "[UT][wh/schema/document/metadata.hpp][document_metadata::insert_or_assign][branch]") {
+  wh::schema::document_metadata metadata{};
+  REQUIRE(metadata.empty());
+  REQUIRE(metadata.find(wh::schema::reserved_metadata_slot::score) == metadata.end());
+
+  metadata.insert_or_assign("lang", std::string{"en"});
+  metadata.insert_or_assign(wh::schema::document_metadata_keys::dsl, std::string{"dsl"});
+  metadata.insert_or_assign(wh::schema::document_metadata_keys::score, 0.5);
+  metadata.insert_or_assign(wh::schema::document_metadata_keys::score, 0.75);
+
+  REQUIRE(metadata.size() == 3U);
+  REQUIRE(metadata.begin()->first == wh::schema::document_metadata_keys::score);
+  REQUIRE(std::next(metadata.begin())->first == wh::schema::document_metadata_keys::dsl);
+
+  const auto score = metadata.find(wh::schema::reserved_metadata_slot::score);
+  REQUIRE(score != metadata.end());
+  REQUIRE(std::get<double>(score->second) == 0.75);
+  REQUIRE(metadata.find(wh::schema::reserved_metadata_slot::sub_index) == metadata.end());
+  REQUIRE(metadata.find(wh::schema::reserved_metadata_slot::dsl) != metadata.end());
+  REQUIRE(metadata.contains("lang"));
+  REQUIRE_FALSE(metadata.contains("missing"));
+}
+
+TEST_CASE("document metadata lookups agree across key forms and store sizes",
+          "[UT][wh/schema/document/metadata.hpp][document_metadata::find][condition][boundary]") {
+  wh::schema::document_metadata metadata{};
+  for (std::int64_t index = 0; index < 20; ++index) {
+    metadata.insert_or_assign("field_" + std::to_string(index), index);
+  }
+  metadata.insert_or_assign(wh::schema::document_metadata_keys::sparse_vector,
+                            wh::schema::sparse_vector{{1U, 0.5}});
+  REQUIRE(metadata.size() == 21U);
+
+  for (std::int64_t index = 0; index < 20; ++index) {
+    const auto name = "field_" + std::to_string(index);
+    const auto key = wh::schema::make_document_metadata_key(name);
+    const auto by_text = metadata.find(name);
+    REQUIRE(by_text != metadata.end());
+    REQUIRE(by_text == metadata.find(key));
+    REQUIRE(std::get<std::int64_t>(by_text->second) == index);
+  }
+  REQUIRE(metadata.find("field_never_interned_anywhere") == metadata.end());
+  REQUIRE(metadata.find(wh::schema::reserved_metadata_slot::sparse_vector_slot) != metadata.end());
+
+  REQUIRE(metadata.erase("field_3") == 1U);
+  REQUIRE(metadata.erase("field_3") == 0U);
+  REQUIRE_FALSE(metadata.contains("field_3"));
+
+  const auto map = metadata.to_map();
+  REQUIRE(map.size() == 20U);
+  REQUIRE(std::get<std::int64_t>(map.at("field_7")) == 7);
+}
+
+TEST_CASE("document metadata stores user keys inline without growing the intern pool",
+          "[UT][wh/schema/document/metadata.hpp][document_metadata::insert_or_assign][boundary]") {
+  wh::schema::document_metadata metadata{};
+  metadata.insert_or_assign(wh::schema::document_metadata_keys::score, 1.0);
+  const auto pool_size = wh::core::string_intern_pool::global().size();
+
+  for (std::int64_t index = 0; index < 32; ++index) {
+    metadata.insert_or_assign("inline_only_" + std::to_string(index), index);
+  }
+  REQUIRE(metadata.find("inline_only_31") != metadata.end());
+  REQUIRE(metadata.find("inline_only_missing") == metadata.end());
+  REQUIRE(metadata.find("_score") == metadata.find(wh::schema::reserved_metadata_slot::score));
+  REQUIRE(wh::core::string_intern_pool::global().size() == pool_size);
+
+  const auto key = wh::schema::make_document_metadata_key("inline_only_5");
+  REQUIRE(key.interned());
+  metadata.insert_or_assign(key, std::int64_t{50});
+  REQUIRE(metadata.size() == 33U);
+  REQUIRE(std::get<std::int64_t>(metadata.find("inline_only_5")->second) == 50);
+}
@@ -0,0 +1,93 @@
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/schema/message/blob.hpp"
+
+TEST_CASE("base64 helpers round-trip padded and unpadded payloads",
+          "[UT][wh/schema/message/blob.hpp][decode_base64][condition][boundary]") {
+  REQUIRE(wh::schema::encode_base64("").empty());
+  REQUIRE(wh::schema::encode_base64("f") == "Zg==");
+  REQUIRE(wh::schema::encode_base64("fo") == "Zm8=");
+  REQUIRE(wh::schema::encode_base64("foo") == "Zm9v");
+  REQUIRE(wh::schema::encode_base64(std::string{"\xff\x00", 2U}) == "/wA=");
+
+  REQUIRE(wh::schema::decode_base64("Zm9vYg==").value() == "foob");
+  REQUIRE(wh::schema::decode_base64("Zm9vYg").value() == "foob");
+  REQUIRE(wh::schema::decode_base64("/wA=").value() == std::string{"\xff\x00", 2U});
+  REQUIRE(wh::schema::decode_base64("").value().empty());
+  REQUIRE(wh::schema::decode_base64("Zm9vY").error() == wh::core::errc::invalid_argument);
+  REQUIRE(wh::schema::decode_base64("Zm*v").error() == wh::core::errc::invalid_argument);
+}
+
+TEST_CASE("media blob shares decoded bytes across copies and compares by content",
+          "[UT][wh/schema/message/blob.hpp][media_blob][branch][boundary]") {
+  const wh::schema::media_blob empty{};
+  REQUIRE(empty.empty());
+  REQUIRE(empty.size() == 0U);
+  REQUIRE(empty.hash() == 0U);
+
+  auto decoded = wh::schema::media_blob::from_base64("aGVsbG8=");
+  REQUIRE(decoded.has_value());
+  const auto blob = decoded.value();
+  REQUIRE(blob.bytes() == "hello");
+  REQUIRE(blob.to_base64() == "aGVsbG8=");
+
+  const auto copy = blob;
+  REQUIRE(copy.same_storage(blob));
+  REQUIRE(copy.use_count() >= 2);
+
+  const auto rebuilt = wh::schema::media_blob::from_bytes("hello");
+  REQUIRE_FALSE(rebuilt.same_storage(blob));
+  REQUIRE(rebuilt == blob);
+  REQUIRE(rebuilt.hash() == blob.hash());
+  REQUIRE_FALSE(wh::schema::media_blob::from_bytes("world") == blob);
+  REQUIRE(wh::schema::media_blob::from_base64("!!").has_error());
+}
+
+TEST_CASE("media blob store deduplicates live content and drops expired entries",
+          "[UT][wh/schema/message/blob.hpp][media_blob_store::intern][branch][condition]") {
+  wh::schema::media_blob_store store{};
+  REQUIRE(store.intern(wh::schema::media_blob{}).empty());
+
+  const auto first = store.intern_bytes("pixels");
+  const auto second = store.intern_base64(wh::schema::encode_base64("pixels"));
+  REQUIRE(second.has_value());
+  REQUIRE(second.value().same_storage(first));
+  REQUIRE(store.size() == 1U);
+  REQUIRE(store.intern_base64("%%%").has_error());
+
+  {
+    const auto other = store.intern_bytes("frames");
+    REQUIRE(store.size() == 2U);
+  }
+  REQUIRE(store.size() == 1U);
+  store.purge_expired();
+  REQUIRE(store.intern_bytes("pixels").same_storage(first));
+}
+
+TEST_CASE("media blob table references each distinct blob once in first-use order",
+          "[UT][wh/schema/message/blob.hpp][media_blob_table::reference][branch][boundary]") {
+  wh::schema::media_blob_table table{};
+  const auto image = wh::schema::media_blob::from_bytes("image-bytes");
+  const auto audio = wh::schema::media_blob::from_bytes("audio-bytes");
+
+  const auto image_id = table.reference(image);
+  REQUIRE(image_id.size() == 16U);
+  REQUIRE(table.reference(wh::schema::media_blob::from_bytes("image-bytes")) == image_id);
+  const auto audio_id = table.reference(audio);
+  REQUIRE(audio_id != image_id);
+  REQUIRE(table.size() == 2U);
+  REQUIRE(table.payload_bytes() == image.size() + audio.size());
+
+  REQUIRE(table.resolve(image_id).value().same_storage(image));
+  REQUIRE(table.resolve("missing").error() == wh::core::errc::not_found);
+  REQUIRE(table.insert(image_id, audio).error() == wh::core::errc::already_exists);
+  REQUIRE(table.insert("extra", audio).has_value());
+
+  std::string order{};
+  table.for_each([&order](const std::string_view id, const wh::schema::media_blob &) {
+    order.append(id).push_back(',');
+  });
+  REQUIRE(order == image_id + "," + audio_id + ",extra,");
+}
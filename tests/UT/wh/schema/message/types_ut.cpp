@@ -1,5 +1,7 @@
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <catch2/catch_test_macros.hpp>
@@ -117,3 +119,134 @@ TEST_CASE("message types merge chunk and update pipelines cover append insert re
   REQUIRE(wrong_role_status.has_error());
   REQUIRE(wrong_role_status.error() == wh::core::errc::contract_violation);
 }
+
+TEST_CASE("message types fold chunks incrementally to the same result as batch merge",
+          "[UT][wh/schema/message/types.hpp][append_message_chunk][condition][branch][boundary]") {
+  using wh::schema::message;
+  using wh::schema::message_role;
+  using wh::schema::text_part;
+  using wh::schema::tool_call_part;
+
+  std::vector<message> chunks(4U);
+  for (auto &chunk : chunks) {
+    chunk.role = message_role::assistant;
+  }
+  chunks[0].parts.emplace_back(text_part{"he"});
+  chunks[0].parts.emplace_back(
+      tool_call_part{.index = 1, .id = "id", .name = "tool", .arguments = "{", .complete = false});
+  chunks[1].name = "bot";
+  chunks[1].parts.emplace_back(text_part{"llo"});
+  chunks[1].meta.usage.completion_tokens = 3;
+  chunks[2].parts.emplace_back(tool_call_part{.index = 0, .name = "first", .arguments = "[]"});
+  chunks[2].parts.emplace_back(tool_call_part{.index = 1, .arguments = "}"});
+  chunks[3].parts.emplace_back(text_part{"!"});
+  chunks[3].meta.finish_reason = "stop";
+
+  auto batch = wh::schema::merge_message_chunks(std::span<const message>{chunks});
+  REQUIRE(batch.has_value());
+
+  auto folded = chunks.front();
+  for (auto &chunk : std::span<message>{chunks}.subspan(1U)) {
+    REQUIRE(wh::schema::append_message_chunk(folded, message{chunk}).has_value());
+  }
+  REQUIRE(folded.parts.size() == 3U);
+  REQUIRE(wh::schema::finish_message_chunks(folded).has_value());
+
+  REQUIRE(folded.name == batch.value().name);
+  REQUIRE(folded.meta.finish_reason == "stop");
+  REQUIRE(folded.meta.usage.completion_tokens == 3);
+  REQUIRE(folded.parts.size() == batch.value().parts.size());
+  REQUIRE(std::get<text_part>(folded.parts[0]).text == "hello!");
+  REQUIRE(std::get<tool_call_part>(folded.parts[1]).name == "first");
+  REQUIRE(std::get<tool_call_part>(folded.parts[2]).arguments == "{}");
+  REQUIRE(std::get<tool_call_part>(batch.value().parts[2]).arguments == "{}");
+
+  message empty{};
+  empty.role = message_role::assistant;
+  auto rejected_empty = wh::schema::append_message_chunk(folded, message{empty});
+  REQUIRE(rejected_empty.has_error());
+  REQUIRE(rejected_empty.error() == wh::core::errc::protocol_error);
+
+  message other_role{};
+  other_role.role = message_role::user;
+  other_role.parts.emplace_back(text_part{"x"});
+  auto rejected_role = wh::schema::append_message_chunk(folded, std::move(other_role));
+  REQUIRE(rejected_role.has_error());
+  REQUIRE(rejected_role.error() == wh::core::errc::contract_violation);
+
+  message conflicting{};
+  conflicting.role = message_role::assistant;
+  conflicting.parts.emplace_back(tool_call_part{.index = 1, .id = "other"});
+  auto rejected_tool = wh::schema::append_message_chunk(folded, std::move(conflicting));
+  REQUIRE(rejected_tool.has_error());
+  REQUIRE(rejected_tool.error() == wh::core::errc::contract_violation);
+}
+
+TEST_CASE("message types intern inline media into shared blobs once",
+          "[UT][wh/schema/message/types.hpp][intern_message_media][condition][branch][boundary]") {
+  using wh::schema::audio_part;
+  using wh::schema::file_part;
+  using wh::schema::image_part;
+  using wh::schema::text_part;
+
+  wh::schema::media_blob_store store{};
+  wh::schema::message first{};
+  first.parts.emplace_back(text_part{"look"});
+  first.parts.emplace_back(image_part{.uri = "data:image/png;base64,cGl4ZWxz"});
+  first.parts.emplace_back(image_part{.uri = "https://example.com/a.png"});
+  first.parts.emplace_back(audio_part{.base64 = "c291bmQ="});
+  first.parts.emplace_back(file_part{.uri = "data:application/pdf;base64,cGRm"});
+
+  auto converted = wh::schema::intern_message_media(first, store);
+  REQUIRE(converted.has_value());
+  REQUIRE(converted.value() == 3U);
+  const auto &image = std::get<image_part>(first.parts[1]);
+  REQUIRE(image.uri.empty());
+  REQUIRE(image.data.bytes() == "pixels");
+  REQUIRE(image.mime_type == "image/png");
+  REQUIRE(std::get<image_part>(first.parts[2]).data.empty());
+  REQUIRE(std::get<audio_part>(first.parts[3]).base64.empty());
+  REQUIRE(std::get<audio_part>(first.parts[3]).data.bytes() == "sound");
+  REQUIRE(std::get<file_part>(first.parts[4]).mime_type == "application/pdf");
+
+  wh::schema::message repeated{};
+  repeated.parts.emplace_back(image_part{.uri = "data:image/png;base64,cGl4ZWxz"});
+  REQUIRE(wh::schema::intern_message_media(repeated, store).value() == 1U);
+  REQUIRE(std::get<image_part>(repeated.parts[0]).data.same_storage(image.data));
+  REQUIRE(wh::schema::intern_message_media(repeated, store).value() == 0U);
+
+  const auto copy = first;
+  REQUIRE(std::get<image_part>(copy.parts[1]).data.same_storage(image.data));
+
+  std::vector<wh::schema::message_part> audio{};
+  audio.emplace_back(audio_part{.data = wh::schema::media_blob::from_bytes("a")});
+  audio.emplace_back(audio_part{.base64 = "Yg=="});
+  REQUIRE_FALSE(wh::schema::detail::can_merge_adjacent_parts(audio[0], audio[1]));
+
+  wh::schema::message invalid{};
+  invalid.parts.emplace_back(audio_part{.base64 = "%%"});
+  REQUIRE(wh::schema::intern_message_media(invalid, store).error() ==
+          wh::core::errc::invalid_argument);
+}
+
+TEST_CASE("message types rebuild interned image and video data URIs",
+          "[UT][wh/schema/message/types.hpp][media_data_uri][branch][boundary]") {
+  using wh::schema::image_part;
+  using wh::schema::video_part;
+
+  constexpr std::string_view image_uri = "data:image/webp;base64,cGl4ZWxz";
+  constexpr std::string_view video_uri = "data:video/mp4;base64,ZnJhbWVz";
+  wh::schema::media_blob_store store{};
+  wh::schema::message value{};
+  value.parts.emplace_back(image_part{.uri = std::string{image_uri}});
+  value.parts.emplace_back(video_part{.uri = std::string{video_uri}});
+  value.parts.emplace_back(image_part{.uri = "https://example.com/a.png"});
+  REQUIRE(wh::schema::intern_message_media(value, store).value() == 2U);
+
+  const auto &image = std::get<image_part>(value.parts[0]);
+  REQUIRE(image.uri.empty());
+  REQUIRE(wh::schema::media_data_uri(image) == image_uri);
+  REQUIRE(wh::schema::media_data_uri(std::get<video_part>(value.parts[1])) == video_uri);
+  REQUIRE(wh::schema::media_data_uri(std::get<image_part>(value.parts[2])) ==
+          "https://example.com/a.png");
+}
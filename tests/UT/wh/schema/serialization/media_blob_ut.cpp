@@ -0,0 +1,60 @@
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/core/json.hpp"
+#include "wh/schema/serialization/api.hpp"
+#include "wh/schema/serialization/media_blob.hpp"
+
+TEST_CASE("media blob codec writes inline base64 without a table scope",
+          "[UT][wh/schema/serialization/media_blob.hpp][wh_to_json][condition][boundary]") {
+  const auto blob = wh::schema::media_blob::from_bytes("hello");
+  auto encoded = wh::schema::serialize_fast(blob);
+  REQUIRE(encoded.has_value());
+  REQUIRE(encoded.value().IsString());
+  REQUIRE(std::string{encoded.value().GetString()} == "aGVsbG8=");
+
+  auto decoded = wh::schema::deserialize_fast<wh::schema::media_blob>(encoded.value());
+  REQUIRE(decoded.has_value());
+  REQUIRE(decoded.value() == blob);
+
+  auto empty = wh::schema::serialize_fast(wh::schema::media_blob{});
+  REQUIRE(empty.has_value());
+  REQUIRE(empty.value().IsNull());
+  REQUIRE(wh::schema::deserialize_fast<wh::schema::media_blob>(empty.value()).value().empty());
+}
+
+TEST_CASE("media blob codec writes each blob once per table and resolves references",
+          "[UT][wh/schema/serialization/media_blob.hpp][media_blob_table_scope][branch]") {
+  const auto image = wh::schema::media_blob::from_bytes(std::string(1024U, 'p'));
+  const std::vector<wh::schema::media_blob> history{image, image, image};
+
+  wh::schema::media_blob_table written{};
+  wh::core::json_document payload{};
+  {
+    wh::schema::media_blob_table_scope scope{written};
+    REQUIRE(wh::schema::serialize_fast_to(history, payload).has_value());
+  }
+  REQUIRE(written.size() == 1U);
+  REQUIRE(payload.IsArray());
+  REQUIRE(payload[0U].IsObject());
+  REQUIRE(payload[0U].HasMember("$blob"));
+
+  auto table_json = wh::schema::serialize_fast(written);
+  REQUIRE(table_json.has_value());
+  REQUIRE(table_json.value().MemberCount() == 1U);
+
+  auto table = wh::schema::deserialize_fast<wh::schema::media_blob_table>(table_json.value());
+  REQUIRE(table.has_value());
+  auto missing = wh::schema::deserialize_fast<std::vector<wh::schema::media_blob>>(payload);
+  REQUIRE(missing.has_error());
+  REQUIRE(missing.error() == wh::core::errc::not_found);
+
+  wh::schema::media_blob_table_scope scope{table.value()};
+  auto restored = wh::schema::deserialize_fast<std::vector<wh::schema::media_blob>>(payload);
+  REQUIRE(restored.has_value());
+  REQUIRE(restored.value().size() == 3U);
+  REQUIRE(restored.value()[0] == image);
+  REQUIRE(restored.value()[0].same_storage(restored.value()[2]));
+}
@@ -0,0 +1,87 @@
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdexec/execution.hpp>
+
+#include "wh/schema/stream/adapter/fused_stream_reader.hpp"
+#include "wh/schema/stream/reader/values_stream_reader.hpp"
+
+namespace {
+
+using string_reader_t =
+    decltype(wh::schema::stream::make_values_stream_reader(std::vector<std::string>{}));
+
+[[nodiscard]] auto parse_int(const std::string &input) -> wh::core::result<int> {
+  if (input == "bad") {
+    return wh::core::result<int>::failure(wh::core::errc::parse_error);
+  }
+  return std::stoi(input);
+}
+
+} // namespace
+
+TEST_CASE("stream pipeline fuses transform and filter-map stages into one erased reader",
+          "[UT][wh/schema/stream/adapter/"
+          "fused_stream_reader.hpp][stream_pipeline::erase][branch][boundary]") {
+  auto reader =
+      wh::schema::stream::make_stream_pipeline(
+          wh::schema::stream::make_values_stream_reader(std::vector<std::string>{"1", "2", "3"}))
+          .transform(parse_int)
+          .filter_map([](const int value)
+                          -> wh::core::result<wh::schema::stream::filter_map_step<int>> {
+            if (value % 2 == 0) {
+              return wh::schema::stream::skip;
+            }
+            return value * 10;
+          })
+          .transform([](const int value) -> wh::core::result<std::string> {
+            return std::to_string(value);
+          })
+          .erase();
+  using erased_t = wh::schema::stream::any_stream_reader<std::string>;
+  STATIC_REQUIRE(std::same_as<decltype(reader), erased_t>);
+
+  std::vector<std::string> seen{};
+  while (true) {
+    auto next = reader.read();
+    REQUIRE(next.has_value());
+    if (next.value().eof) {
+      break;
+    }
+    seen.push_back(*next.value().value);
+  }
+  REQUIRE(seen == std::vector<std::string>{"10", "30"});
+  REQUIRE(reader.is_closed());
+}
+
+TEST_CASE("stream pipeline picks the host adapter by stage kinds and surfaces stage failures",
+          "[UT][wh/schema/stream/adapter/"
+          "fused_stream_reader.hpp][stream_pipeline::build][condition][error]") {
+  auto source = wh::schema::stream::make_values_stream_reader(std::vector<std::string>{"7"});
+  auto untouched = wh::schema::stream::make_stream_pipeline(std::move(source)).build();
+  STATIC_REQUIRE(std::same_as<decltype(untouched), string_reader_t>);
+
+  auto transformed =
+      wh::schema::stream::make_stream_pipeline(
+          wh::schema::stream::make_values_stream_reader(std::vector<std::string>{"4", "bad"}))
+          .transform(parse_int)
+          .transform([](int value) -> wh::core::result<long> { return value + 1L; })
+          .build();
+  using chain_t = wh::schema::stream::fused_adapter_chain<
+      std::string, wh::schema::stream::detail::fused_transform_stage<decltype(&parse_int)>>;
+  STATIC_REQUIRE_FALSE(chain_t::can_skip);
+  STATIC_REQUIRE(std::same_as<typename decltype(transformed)::value_type, long>);
+
+  auto first = transformed.read();
+  REQUIRE(first.has_value());
+  REQUIRE(first.value().value == std::optional<long>{5L});
+  auto failed = std::get<wh::schema::stream::stream_result<wh::schema::stream::stream_chunk<long>>>(
+      transformed.try_read());
+  REQUIRE(failed.has_value());
+  REQUIRE(failed.value().error == wh::core::errc::parse_error);
+  REQUIRE(transformed.is_closed());
+}
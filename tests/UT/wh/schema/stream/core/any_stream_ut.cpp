@@ -1,3 +1,6 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
 
@@ -162,3 +165,36 @@ TEST_CASE("any stream erases pipe backends for values without nothrow copy or mo
   REQUIRE(second.has_value());
   REQUIRE(second.value().value == std::optional<non_nothrow_value_t>{non_nothrow_value_t{22}});
 }
+
+TEST_CASE("any stream reader reports backends that spill out of inline storage",
+          "[UT][wh/schema/stream/core/"
+          "any_stream.hpp][stream_reader_spill_report][condition][boundary]") {
+  struct oversized_reader : auto_close_probe_reader {
+    std::array<std::byte, 256U> padding{};
+  };
+  STATIC_REQUIRE(wh::schema::stream::stream_reader_stores_inline_v<auto_close_probe_reader>);
+  STATIC_REQUIRE_FALSE(wh::schema::stream::stream_reader_stores_inline_v<oversized_reader>);
+
+  const auto spilled_count = [] {
+    std::uint64_t count = 0U;
+    for (const auto &record : wh::schema::stream::stream_reader_spill_report()) {
+      if (record.model_size == sizeof(oversized_reader) && record.storage_size == 128U) {
+        count += record.count;
+      }
+    }
+    return count;
+  };
+
+  wh::schema::stream::reset_stream_reader_spill_report();
+  {
+    wh::schema::stream::any_stream_reader<int> inline_reader{auto_close_probe_reader{}};
+    wh::schema::stream::any_stream_reader<int> first{oversized_reader{}};
+    wh::schema::stream::any_stream_reader<int> second{oversized_reader{}};
+    auto moved = std::move(second);
+    REQUIRE(moved.target_if<oversized_reader>() != nullptr);
+  }
+  REQUIRE(spilled_count() == 2U);
+
+  wh::schema::stream::reset_stream_reader_spill_report();
+  REQUIRE(spilled_count() == 0U);
+}
@@ -40,3 +40,25 @@ TEST_CASE("pipe facade preserves buffered values across close and eof",
   REQUIRE(eof.has_value());
   REQUIRE(eof.value().is_terminal_eof());
 }
+
+TEST_CASE("pipe facade adaptive capacity grows to its max and exposes high-water stats",
+          "[UT][wh/schema/stream/pipe.hpp][make_pipe_stream][condition]") {
+  auto [writer, reader] = wh::schema::stream::make_pipe_stream<int>(
+      wh::core::ring_capacity_policy{.initial = 1U, .max = 4U});
+  REQUIRE(writer.capacity_stats().allocated == 0U);
+
+  for (int value = 0; value < 4; ++value) {
+    REQUIRE(writer.try_write(value).has_value());
+  }
+  auto full = writer.try_write(4);
+  REQUIRE(full.has_error());
+  REQUIRE(full.error() == wh::core::errc::queue_full);
+
+  const auto stats = reader.capacity_stats();
+  REQUIRE(stats.capacity == 4U);
+  REQUIRE(stats.allocated == 4U);
+  REQUIRE(stats.high_water == 4U);
+
+  wh::schema::stream::pipe_stream_writer<int> unbound{};
+  REQUIRE(unbound.capacity_stats().capacity == 0U);
+}
@@ -1,4 +1,6 @@
 #include <array>
+#include <string>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -64,3 +66,87 @@ TEST_CASE("tool schema types expose parameter type names and default tool choice
   wh::schema::tool_choice choice{};
   REQUIRE(choice.mode == wh::schema::tool_call_mode::allow);
 }
+
+TEST_CASE("compiled tool schema caches the canonical default export once",
+          "[UT][wh/schema/tool/types.hpp][compiled_tool_json_schema::compile][branch][boundary]") {
+  wh::schema::tool_parameter_schema filter{
+      .name = "filter",
+      .type = wh::schema::tool_parameter_type::object,
+      .description = "match \"exact\"\n",
+  };
+  filter.properties.push_back(wh::schema::tool_parameter_schema{.name = "z"});
+  filter.properties.push_back(wh::schema::tool_parameter_schema{.name = "a", .required = true});
+  wh::schema::tool_parameter_schema mode{
+      .name = "mode", .required = true, .enum_values = {"fast", "exact"}};
+  wh::schema::tool_parameter_schema ids{.name = "ids",
+                                        .type = wh::schema::tool_parameter_type::array};
+  ids.item_types.push_back(wh::schema::tool_parameter_schema{
+      .name = "id", .type = wh::schema::tool_parameter_type::integer});
+  ids.item_types.push_back(wh::schema::tool_parameter_schema{.name = "key"});
+
+  wh::schema::tool_schema_definition definition{
+      .name = "search",
+      .description = "lookup",
+      .parameters = {mode, ids, filter},
+  };
+  auto compiled = wh::schema::compiled_tool_json_schema::compile(definition);
+  REQUIRE(compiled.has_value());
+
+  auto built = wh::schema::build_default_tool_json_schema(definition);
+  REQUIRE(built.has_value());
+  auto expected = wh::core::json_to_string(built.value());
+  REQUIRE(expected.has_value());
+  REQUIRE(compiled.value().json() == expected.value());
+
+  auto parameters = wh::schema::build_parameters_json_schema(definition.parameters);
+  REQUIRE(parameters.has_value());
+  REQUIRE(compiled.value().parameters_json() ==
+          wh::core::json_to_string(parameters.value()).value());
+
+  const auto nodes = compiled.value().nodes();
+  REQUIRE(nodes.size() == 8U);
+  REQUIRE(nodes[0].properties.size == 3U);
+  REQUIRE(compiled.value().text(nodes[nodes[0].properties.offset].name) == "filter");
+  REQUIRE(compiled.value().name() == "search");
+  REQUIRE(compiled.value().hash() ==
+          wh::schema::compiled_tool_json_schema::compile(definition).value().hash());
+
+  std::string request{"tools="};
+  compiled.value().append_json(request);
+  REQUIRE(request == "tools=" + expected.value());
+}
+
+TEST_CASE("compiled tool schema canonicalizes raw schemas and joins tool lists",
+          "[UT][wh/schema/tool/types.hpp][append_tool_schemas_json][branch][error]") {
+  wh::schema::tool_schema_definition definition{
+      .name = "raw",
+      .raw_parameters_json_schema = R"({ "type" : "object", "properties" : {} })",
+  };
+  auto raw = wh::schema::compiled_tool_json_schema::compile(definition);
+  REQUIRE(raw.has_value());
+  REQUIRE(raw.value().nodes().empty());
+  REQUIRE(raw.value().parameters_json() == R"({"type":"object","properties":{}})");
+
+  auto other = wh::schema::compiled_tool_json_schema::compile(
+      wh::schema::tool_schema_definition{.name = "other"});
+  REQUIRE(other.has_value());
+  REQUIRE(other.value().hash() != raw.value().hash());
+
+  const std::vector<wh::schema::compiled_tool_json_schema> tools{raw.value(), other.value()};
+  std::string joined{};
+  wh::schema::append_tool_schemas_json(tools, joined);
+  REQUIRE(joined == "[" + std::string{raw.value().json()} + "," +
+                        std::string{other.value().json()} + "]");
+  REQUIRE(wh::schema::tool_schemas_hash(tools) !=
+          wh::schema::tool_schemas_hash(std::vector{other.value(), raw.value()}));
+
+  std::string empty{};
+  wh::schema::append_tool_schemas_json({}, empty);
+  REQUIRE(empty == "[]");
+
+  definition.raw_parameters_json_schema = "{";
+  REQUIRE(wh::schema::compiled_tool_json_schema::compile(definition).error() ==
+          wh::core::errc::parse_error);
+  REQUIRE(wh::schema::compiled_tool_json_schema::compile(wh::schema::tool_schema_definition{})
+              .error() == wh::core::errc::invalid_argument);
+}
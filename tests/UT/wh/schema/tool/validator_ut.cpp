@@ -0,0 +1,108 @@
+#include <array>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/schema/tool/validator.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_parameter(std::string name, const wh::schema::tool_parameter_type type,
+                                  const bool required = false)
+    -> wh::schema::tool_parameter_schema {
+  wh::schema::tool_parameter_schema parameter{};
+  parameter.name = std::move(name);
+  parameter.type = type;
+  parameter.required = required;
+  return parameter;
+}
+
+} // namespace
+
+TEST_CASE("compiled tool schema accepts valid input and reports first violation path",
+          "[UT][wh/schema/tool/validator.hpp][compiled_tool_schema::validate][branch]") {
+  auto mode = make_parameter("mode", wh::schema::tool_parameter_type::string, true);
+  mode.enum_values = {"fast", "safe"};
+  auto payload = make_parameter("payload", wh::schema::tool_parameter_type::object, true);
+  payload.properties = {mode};
+  auto ids = make_parameter("ids", wh::schema::tool_parameter_type::array);
+  ids.item_types = {make_parameter("", wh::schema::tool_parameter_type::integer),
+                    make_parameter("", wh::schema::tool_parameter_type::string)};
+
+  const std::array parameters = {payload, ids};
+  const wh::schema::compiled_tool_schema compiled{parameters};
+  REQUIRE_FALSE(compiled.empty());
+
+  std::string error_path{};
+  REQUIRE(compiled.validate(R"({"ids":[1,"two"],"payload":{"mode":"fast"},"extra":1})",
+                            error_path)
+              .has_value());
+
+  auto missing = compiled.validate(R"({"payload":{}})", error_path);
+  REQUIRE(missing.has_error());
+  REQUIRE(missing.error() == wh::core::errc::invalid_argument);
+  REQUIRE(error_path == "$.payload.mode");
+
+  auto bad_item = compiled.validate(R"({"payload":{"mode":"safe"},"ids":[1,true]})", error_path);
+  REQUIRE(bad_item.has_error());
+  REQUIRE(error_path == "$.ids[1]");
+
+  auto not_object = compiled.validate("[]", error_path);
+  REQUIRE(not_object.has_error());
+  REQUIRE(not_object.error() == wh::core::errc::type_mismatch);
+  REQUIRE(error_path == "$");
+
+  auto malformed = compiled.validate("{", error_path);
+  REQUIRE(malformed.has_error());
+  REQUIRE(malformed.error() == wh::core::errc::parse_error);
+}
+
+TEST_CASE("compiled tool schema collects every violation in schema order",
+          "[UT][wh/schema/tool/validator.hpp][compiled_tool_schema::validate_all][condition]") {
+  std::vector<wh::schema::tool_parameter_schema> parameters{};
+  for (int index = 0; index < 70; ++index) {
+    parameters.push_back(make_parameter("field_" + std::to_string(index),
+                                        wh::schema::tool_parameter_type::integer,
+                                        index % 3 == 0));
+  }
+  const wh::schema::compiled_tool_schema compiled{parameters};
+
+  std::string input{"{"};
+  for (int index = 69; index >= 0; --index) {
+    if (index == 66 || index == 3) {
+      continue;
+    }
+    input += "\"field_" + std::to_string(index) + "\":";
+    input += index == 40 ? "\"text\"" : std::to_string(index);
+    input += index == 0 ? "" : ",";
+  }
+  input += "}";
+
+  auto violations = compiled.validate_all(input);
+  REQUIRE(violations.has_value());
+  REQUIRE(violations.value().size() == 3U);
+  REQUIRE(violations.value()[0].path == "$.field_3");
+  REQUIRE(violations.value()[1].path == "$.field_40");
+  REQUIRE(violations.value()[2].path == "$.field_66");
+}
+
+TEST_CASE("compiled tool schema handles one-of duplicates and empty parameter lists",
+          "[UT][wh/schema/tool/validator.hpp][compiled_tool_schema][boundary]") {
+  const wh::schema::compiled_tool_schema empty{};
+  REQUIRE(empty.empty());
+  std::string error_path{};
+  REQUIRE(empty.validate("not json", error_path).has_value());
+
+  auto value = make_parameter("value", wh::schema::tool_parameter_type::number, true);
+  value.one_of = {make_parameter("", wh::schema::tool_parameter_type::integer)};
+  const auto shadow = make_parameter("value", wh::schema::tool_parameter_type::integer);
+  const std::array parameters = {value, shadow};
+  const wh::schema::compiled_tool_schema compiled{parameters};
+
+  REQUIRE(compiled.validate(R"({"value":3})", error_path).has_value());
+  auto fractional = compiled.validate_all(R"({"value":1.5})");
+  REQUIRE(fractional.has_value());
+  REQUIRE(fractional.value().size() == 2U);
+  REQUIRE(fractional.value().front().path == "$.value");
+}
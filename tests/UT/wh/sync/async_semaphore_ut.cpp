@@ -0,0 +1,136 @@
+#include <optional>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdexec/execution.hpp>
+
+#include "helper/manual_scheduler.hpp"
+#include "helper/sender_env.hpp"
+#include "wh/sync/async_semaphore.hpp"
+
+namespace {
+
+using semaphore_t = wh::sync::async_semaphore;
+using permit_t = semaphore_t::permit;
+
+using manual_scheduler_state = wh::testing::helper::manual_scheduler_state;
+using manual_scheduler = wh::testing::helper::manual_scheduler<void>;
+using receiver_env =
+    wh::testing::helper::scheduler_env<manual_scheduler, wh::testing::helper::stop_token>;
+
+struct receiver_state {
+  bool value_called{false};
+  bool stopped_called{false};
+  std::optional<permit_t> permit{};
+};
+
+struct permit_receiver {
+  using receiver_concept = stdexec::receiver_t;
+
+  receiver_state *state{nullptr};
+  receiver_env env{};
+
+  auto set_value(permit_t permit) noexcept -> void {
+    state->value_called = true;
+    state->permit.emplace(std::move(permit));
+  }
+  template <typename error_t> auto set_error(error_t &&) noexcept -> void {}
+  auto set_stopped() noexcept -> void { state->stopped_called = true; }
+  [[nodiscard]] auto get_env() const noexcept -> receiver_env { return env; }
+};
+
+} // namespace
+
+TEST_CASE("async semaphore try_acquire and permits return units",
+          "[UT][wh/sync/async_semaphore.hpp][async_semaphore::try_acquire][branch][boundary]") {
+  semaphore_t semaphore{3U};
+  auto first = semaphore.try_acquire(2U);
+  REQUIRE(first.has_value());
+  REQUIRE(first->units() == 2U);
+  REQUIRE(semaphore.available() == 1U);
+  REQUIRE_FALSE(semaphore.try_acquire(2U).has_value());
+  REQUIRE(semaphore.try_acquire(0U).has_value());
+
+  permit_t moved = std::move(*first);
+  REQUIRE_FALSE(static_cast<bool>(*first));
+  moved.release();
+  REQUIRE_FALSE(static_cast<bool>(moved));
+  REQUIRE(semaphore.available() == 3U);
+
+  semaphore.release(2U);
+  REQUIRE(semaphore.available() == 5U);
+}
+
+TEST_CASE("async semaphore grants queued acquisitions in FIFO order",
+          "[UT][wh/sync/async_semaphore.hpp][async_semaphore::acquire][concurrency]") {
+  semaphore_t semaphore{2U};
+  manual_scheduler_state sched{};
+  const auto env = receiver_env{manual_scheduler{&sched}};
+
+  receiver_state holder{};
+  auto holder_op = stdexec::connect(semaphore.acquire(2U), permit_receiver{&holder, env});
+  stdexec::start(holder_op);
+  sched.run_all();
+  REQUIRE(holder.value_called);
+
+  receiver_state large{};
+  receiver_state small{};
+  auto large_op = stdexec::connect(semaphore.acquire(2U), permit_receiver{&large, env});
+  auto small_op = stdexec::connect(semaphore.acquire(1U), permit_receiver{&small, env});
+  stdexec::start(large_op);
+  stdexec::start(small_op);
+
+  // One released unit must not let the small request overtake the large one.
+  semaphore.release(1U);
+  sched.run_all();
+  REQUIRE_FALSE(large.value_called);
+  REQUIRE_FALSE(small.value_called);
+
+  holder.permit.reset();
+  sched.run_all();
+  REQUIRE(large.value_called);
+  REQUIRE(small.value_called);
+  REQUIRE(semaphore.available() == 0U);
+  large.permit.reset();
+  small.permit.reset();
+  REQUIRE(semaphore.available() == 3U);
+}
+
+TEST_CASE("async semaphore cancellation unblocks waiters queued behind",
+          "[UT][wh/sync/async_semaphore.hpp][async_semaphore::acquire_sender][condition][stop]") {
+  semaphore_t semaphore{1U};
+  manual_scheduler_state sched{};
+
+  receiver_state stopped_early{};
+  wh::testing::helper::stop_source early_source{};
+  early_source.request_stop();
+  auto early_op = stdexec::connect(
+      semaphore.acquire(),
+      permit_receiver{&stopped_early,
+                      receiver_env{manual_scheduler{&sched}, early_source.get_token()}});
+  stdexec::start(early_op);
+  sched.run_all();
+  REQUIRE(stopped_early.stopped_called);
+  REQUIRE(semaphore.available() == 1U);
+
+  receiver_state blocked{};
+  receiver_state behind{};
+  wh::testing::helper::stop_source source{};
+  auto blocked_op = stdexec::connect(
+      semaphore.acquire(3U),
+      permit_receiver{&blocked, receiver_env{manual_scheduler{&sched}, source.get_token()}});
+  auto behind_op = stdexec::connect(
+      semaphore.acquire(1U), permit_receiver{&behind, receiver_env{manual_scheduler{&sched}}});
+  stdexec::start(blocked_op);
+  stdexec::start(behind_op);
+  sched.run_all();
+  REQUIRE_FALSE(behind.value_called);
+
+  source.request_stop();
+  sched.run_all();
+  REQUIRE(blocked.stopped_called);
+  REQUIRE_FALSE(blocked.value_called);
+  REQUIRE(behind.value_called);
+  behind.permit.reset();
+  REQUIRE(semaphore.available() == 1U);
+}
@@ -0,0 +1,145 @@
+#include <optional>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdexec/execution.hpp>
+
+#include "helper/manual_scheduler.hpp"
+#include "helper/sender_env.hpp"
+#include "wh/sync/async_shared_mutex.hpp"
+
+namespace {
+
+using mutex_t = wh::sync::async_shared_mutex;
+using lock_guard_t = mutex_t::lock_guard;
+using shared_lock_guard_t = mutex_t::shared_lock_guard;
+
+using manual_scheduler_state = wh::testing::helper::manual_scheduler_state;
+using manual_scheduler = wh::testing::helper::manual_scheduler<void>;
+using receiver_env =
+    wh::testing::helper::scheduler_env<manual_scheduler, wh::testing::helper::stop_token>;
+
+template <typename guard_t> struct receiver_state {
+  bool value_called{false};
+  bool stopped_called{false};
+  std::optional<guard_t> guard{};
+};
+
+template <typename guard_t> struct guard_receiver {
+  using receiver_concept = stdexec::receiver_t;
+
+  receiver_state<guard_t> *state{nullptr};
+  receiver_env env{};
+
+  auto set_value(guard_t guard) noexcept -> void {
+    state->value_called = true;
+    state->guard.emplace(std::move(guard));
+  }
+  template <typename error_t> auto set_error(error_t &&) noexcept -> void {}
+  auto set_stopped() noexcept -> void { state->stopped_called = true; }
+  [[nodiscard]] auto get_env() const noexcept -> receiver_env { return env; }
+};
+
+using writer_state = receiver_state<lock_guard_t>;
+using reader_state = receiver_state<shared_lock_guard_t>;
+using writer_receiver = guard_receiver<lock_guard_t>;
+using reader_receiver = guard_receiver<shared_lock_guard_t>;
+
+} // namespace
+
+TEST_CASE("async shared mutex try paths share readers and exclude writers",
+          "[UT][wh/sync/async_shared_mutex.hpp][async_shared_mutex::try_lock_shared][branch]") {
+  mutex_t mutex{};
+  auto first = mutex.try_lock_shared();
+  auto second = mutex.try_lock_shared();
+  REQUIRE(first.has_value());
+  REQUIRE(second.has_value());
+  REQUIRE_FALSE(mutex.try_lock().has_value());
+
+  first.reset();
+  second->unlock();
+  REQUIRE_FALSE(static_cast<bool>(*second));
+  auto writer = mutex.try_lock();
+  REQUIRE(writer.has_value());
+  REQUIRE_FALSE(mutex.try_lock_shared().has_value());
+  writer.reset();
+  REQUIRE(mutex.try_lock_shared().has_value());
+}
+
+TEST_CASE("async shared mutex prefers writers and batches queued readers",
+          "[UT][wh/sync/async_shared_mutex.hpp][async_shared_mutex::lock][concurrency]") {
+  mutex_t mutex{};
+  manual_scheduler_state sched{};
+  const auto env = receiver_env{manual_scheduler{&sched}};
+
+  reader_state reader_a{};
+  auto reader_a_op = stdexec::connect(mutex.lock_shared(), reader_receiver{&reader_a, env});
+  stdexec::start(reader_a_op);
+  sched.run_all();
+  REQUIRE(reader_a.value_called);
+
+  writer_state writer_a{};
+  auto writer_a_op = stdexec::connect(mutex.lock(), writer_receiver{&writer_a, env});
+  stdexec::start(writer_a_op);
+  reader_state reader_b{};
+  auto reader_b_op = stdexec::connect(mutex.lock_shared(), reader_receiver{&reader_b, env});
+  stdexec::start(reader_b_op);
+  sched.run_all();
+  REQUIRE_FALSE(writer_a.value_called);
+  REQUIRE_FALSE(reader_b.value_called);
+
+  reader_a.guard.reset();
+  sched.run_all();
+  REQUIRE(writer_a.value_called);
+  REQUIRE_FALSE(reader_b.value_called);
+
+  writer_state writer_b{};
+  auto writer_b_op = stdexec::connect(mutex.lock(), writer_receiver{&writer_b, env});
+  stdexec::start(writer_b_op);
+  reader_state reader_c{};
+  auto reader_c_op = stdexec::connect(mutex.lock_shared(), reader_receiver{&reader_c, env});
+  stdexec::start(reader_c_op);
+
+  writer_a.guard.reset();
+  sched.run_all();
+  REQUIRE(reader_b.value_called);
+  REQUIRE(reader_c.value_called);
+  REQUIRE_FALSE(writer_b.value_called);
+
+  reader_b.guard.reset();
+  reader_c.guard.reset();
+  sched.run_all();
+  REQUIRE(writer_b.value_called);
+  writer_b.guard.reset();
+  REQUIRE(mutex.try_lock().has_value());
+}
+
+TEST_CASE("async shared mutex cancelled writer releases readers held behind it",
+          "[UT][wh/sync/async_shared_mutex.hpp][async_shared_mutex::lock_sender][stop]") {
+  mutex_t mutex{};
+  manual_scheduler_state sched{};
+  auto holder = mutex.try_lock_shared();
+  REQUIRE(holder.has_value());
+
+  wh::testing::helper::stop_source source{};
+  writer_state writer{};
+  auto writer_op = stdexec::connect(
+      mutex.lock(),
+      writer_receiver{&writer, receiver_env{manual_scheduler{&sched}, source.get_token()}});
+  stdexec::start(writer_op);
+  reader_state reader{};
+  auto reader_op = stdexec::connect(
+      mutex.lock_shared(), reader_receiver{&reader, receiver_env{manual_scheduler{&sched}}});
+  stdexec::start(reader_op);
+  sched.run_all();
+  REQUIRE_FALSE(reader.value_called);
+
+  source.request_stop();
+  sched.run_all();
+  REQUIRE(writer.stopped_called);
+  REQUIRE_FALSE(writer.value_called);
+  REQUIRE(reader.value_called);
+  reader.guard.reset();
+  holder.reset();
+  REQUIRE(mutex.try_lock().has_value());
+}
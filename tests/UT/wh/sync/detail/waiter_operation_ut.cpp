@@ -0,0 +1,45 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "wh/sync/detail/waiter_operation.hpp"
+
+TEST_CASE("waiter list keeps FIFO order and unlinks from any position",
+          "[UT][wh/sync/detail/waiter_operation.hpp][waiter_list::erase][branch][boundary]") {
+  wh::sync::detail::waiter_list list{};
+  wh::sync::detail::waiter_node first{};
+  wh::sync::detail::waiter_node middle{};
+  wh::sync::detail::waiter_node last{};
+  REQUIRE(list.empty());
+  REQUIRE(list.pop_front() == nullptr);
+
+  list.push_back(first);
+  list.push_back(middle);
+  list.push_back(last);
+  list.erase(middle);
+  REQUIRE(list.front() == &first);
+  REQUIRE(list.pop_front() == &first);
+  list.erase(last);
+  REQUIRE(list.empty());
+
+  list.push_back(middle);
+  REQUIRE(list.pop_front() == &middle);
+  REQUIRE(list.empty());
+}
+
+TEST_CASE("complete waiters drains the granted list before each callback",
+          "[UT][wh/sync/detail/waiter_operation.hpp][complete_waiters][condition]") {
+  static int completed = 0;
+  completed = 0;
+  wh::sync::detail::waiter_list granted{};
+  wh::sync::detail::waiter_node first{};
+  wh::sync::detail::waiter_node second{};
+  first.complete_fn = [](wh::sync::detail::waiter_node *node) noexcept {
+    REQUIRE(node->next == nullptr);
+    ++completed;
+  };
+  second.complete_fn = first.complete_fn;
+  granted.push_back(first);
+  granted.push_back(second);
+  wh::sync::detail::complete_waiters(granted);
+  REQUIRE(completed == 2);
+  REQUIRE(granted.empty());
+}
@@ -361,6 +361,31 @@ TEST_CASE("tool wrapper exposes sync invoke stream retry and skip semantics",
   REQUIRE(ended.load(std::memory_order_acquire) == 2);
 }
 
+TEST_CASE("tool wrapper rejects calls on a moved-from tool instead of validating",
+          "[UT][wh/tool/tool.hpp][tool::invoke][condition][boundary]") {
+  wh::schema::tool_schema_definition schema{};
+  schema.name = "moved_tool";
+
+  std::atomic<int> calls{0};
+  auto make_result = [&calls](const std::string_view, const wh::tool::tool_options &) {
+    calls.fetch_add(1, std::memory_order_relaxed);
+    return wh::tool::tool_invoke_result{std::string{"ok"}};
+  };
+  wh::tool::tool source{schema, sync_tool_impl{sync_tool_invoke_impl{make_result}}};
+  auto target = std::move(source);
+
+  wh::core::run_context context{};
+  auto moved = source.invoke(wh::tool::tool_request{"{}", {}}, context);
+  REQUIRE(moved.has_error());
+  REQUIRE(moved.error() == wh::core::errc::contract_violation);
+  REQUIRE(calls.load(std::memory_order_relaxed) == 0);
+
+  auto live = target.invoke(wh::tool::tool_request{"{}", {}}, context);
+  REQUIRE(live.has_value());
+  REQUIRE(live.value() == "ok");
+  REQUIRE(calls.load(std::memory_order_relaxed) == 1);
+}
+
 TEST_CASE("tool wrapper preserves async validation retry and stream semantics",
           "[UT][wh/tool/tool.hpp][tool::async_invoke][branch]") {
   wh::schema::tool_schema_definition schema{};